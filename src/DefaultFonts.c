@@ -139,7 +139,7 @@ const unsigned char SmallFont[] = {
 0x40,0xA4,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ~
 };  
 
-#ifdef ONLY_SMALL_FONT
+#ifndef ONLY_SMALL_FONT
 
 // BigFont.c (C)2010 by Henning Karlsen
 // Font Size	: 16x16
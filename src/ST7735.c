@@ -168,24 +168,79 @@ static const uint8_t Rcmd3[] = {
 	100							//     100 ms delay
 };
 
-#define putpix(c) { lcd7735_senddata(c >> 8); lcd7735_senddata(c & 0xFF); }
+// 16-bit pixels are sent as is, 12-bit ones are packed two into three bytes
+#define putpix(c) { if (colmod == 16) { lcd7735_senddata((c) >> 8); lcd7735_senddata((c) & 0xFF); } else putpix12(c); }
+
+// RGB565 to RGB444
+#define rgb444(c)	((((c) >> 4) & 0xF00) | (((c) >> 3) & 0x0F0) | (((c) >> 1) & 0x00F))
 
 static int colstart = 0;
 static int rowstart = 0; // May be overridden in init func
 //static uint8_t tabcolor	= 0;
 static uint8_t orientation = PORTRAIT;
+static uint8_t madctl = MADCTL_MX | MADCTL_MY;	// MADCTL value of the current orientation
+static uint8_t blit_madctl = MADCTL_MX | MADCTL_MY;	// MADCTL value used by the blit in progress
+static uint8_t scroll_top = 0;		// fixed lines before the scrolling band
+static uint8_t scroll_bottom = 0;	// fixed lines after the scrolling band
+static uint8_t colmod = 16;		// bits per pixel sent to the panel, 16 or 12
+static uint8_t pix_half = 0;		// 12-bit mode: pix_pending waits for its pair
+static uint16_t pix_pending;
+static uint32_t win_left = 0;		// 12-bit mode: pixels left in the address window
 typedef struct _font {
 	uint8_t 	*font;
 	uint8_t 	x_size;
 	uint8_t 	y_size;
 	uint8_t		offset;
 	uint16_t	numchars;
+	uint8_t		bpp;		// 1 for UTFT fonts, 1, 2 or 4 for the others
+	uint8_t		header;		// bytes before the first glyph
+	uint8_t		prop;		// proportional font, the fields below are valid
+	uint8_t		rle;		// glyphs are runs, see FONT_RLE
+	uint8_t		baseline;
+	uint16_t	nranges;
+	uint16_t	nkern;
+	const uint8_t	*glyphs;	// glyph table, kerning pairs follow
+	const uint8_t	*bitmaps;
 } Font;
 
 static Font cfont;
 static uint8_t _transparent = 0;
 static uint16_t _fg = ST7735_GREEN;
 static uint16_t _bg = ST7735_BLACK;
+static uint16_t font_ramp[16];		// anti-aliased fonts: color of every coverage level
+
+// Send the pending pixel of an odd 12-bit stream, its padding nibble is
+// dropped by the panel when the next command arrives
+static void flushpix(void) {
+	if (pix_half) {
+		LCD_DC1;
+		lcd7735_senddata(pix_pending >> 4);
+		lcd7735_senddata((pix_pending & 0x0F) << 4);
+		pix_half = 0;
+	}
+}
+
+static void putpix12(uint16_t c) {
+	c = rgb444(c);
+	if (pix_half) {
+		lcd7735_senddata(pix_pending >> 4);
+		lcd7735_senddata(((pix_pending & 0x0F) << 4) | (c >> 8));
+		lcd7735_senddata(c & 0xFF);
+		pix_half = 0;
+	} else {
+		pix_pending = c;
+		pix_half = 1;
+	}
+	// complete the window at once, a single pixel mustn't wait for the next command
+	if (--win_left == 0)
+		flushpix();
+}
+
+// Every command ends a pixel stream
+static void sendCmd(uint8_t cmd) {
+	flushpix();
+	lcd7735_sendCmd(cmd);
+}
 
 // Companion code to the above tables.  Reads and issues
 // a series of LCD commands stored in PROGMEM byte array.
@@ -195,7 +250,7 @@ static void commandList(const uint8_t *addr) {
 
 	numCommands = *addr++;   // Number of commands to follow
 	while(numCommands--) {                 // For each command...
-		lcd7735_sendCmd(*addr++); //   Read, issue command
+		sendCmd(*addr++); //   Read, issue command
 		numArgs  = *addr++;    //   Number of args to follow
 		ms       = numArgs & DELAY;          //   If hibit set, delay follows args
 		numArgs &= ~DELAY;                   //   Mask out delay bit
@@ -216,7 +271,7 @@ static void commonInit(const uint8_t *cmdList) {
 	// toggle RST low to reset; CS low so it'll listen to us
 	LCD_CS0;
 #ifdef LCD_SOFT_RESET
-	lcd7735_sendCmd(ST7735_SWRESET);
+	sendCmd(ST7735_SWRESET);
 	delay_ms(500);
 #else
 	LCD_RST1;
@@ -226,12 +281,15 @@ static void commonInit(const uint8_t *cmdList) {
 	LCD_RST1;
 	delay_ms(500);
 #endif    
+	pix_half = 0;
+	colmod = 16;	// the init lists select 16-bit pixels
 	if(cmdList) commandList(cmdList);
 }
 
 // Initialization for ST7735B screens
 void lcd7735_initB(void) {
 	commonInit(Bcmd);
+	madctl = MADCTL_BGR;
 }
 
 
@@ -248,10 +306,11 @@ void lcd7735_initR(uint8_t options) {
 		commandList(Rcmd2red);
 	}
 	commandList(Rcmd3);
+	madctl = MADCTL_MX | MADCTL_MY;
 
 	// if black, change MADCTL color filter
 	if (options == INITR_BLACKTAB) {
-		lcd7735_sendCmd(ST7735_MADCTL);
+		sendCmd(ST7735_MADCTL);
 		lcd7735_sendData(0xC0);
 	}
 
@@ -260,31 +319,62 @@ void lcd7735_initR(uint8_t options) {
 
 
 void lcd7735_setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
-	lcd7735_sendCmd(ST7735_CASET);		// Column addr set
+	sendCmd(ST7735_CASET);		// Column addr set
 	lcd7735_sendData(0x00);
 	lcd7735_sendData(x0+colstart);     // XSTART 
 	lcd7735_sendData(0x00);
 	lcd7735_sendData(x1+colstart);     // XEND
 
-	lcd7735_sendCmd(ST7735_RASET); // Row addr set
+	sendCmd(ST7735_RASET); // Row addr set
 	lcd7735_sendData(0x00);
 	lcd7735_sendData(y0+rowstart);     // YSTART
 	lcd7735_sendData(0x00);
 	lcd7735_sendData(y1+rowstart);     // YEND
 
-	lcd7735_sendCmd(ST7735_RAMWR); // write to RAM
+	sendCmd(ST7735_RAMWR); // write to RAM
+	win_left = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+// Select 16-bit RGB565 or 12-bit RGB444 pixel transfers (COLMOD 0x05 or 0x03).
+// Colors stay RGB565 everywhere, in 12-bit mode they are converted on the fly
+// and the SPI traffic of pixel data drops by 25%.
+void lcd7735_setColorMode(uint8_t bits) {
+	sendCmd(ST7735_COLMOD);
+	lcd7735_sendData(bits == 12 ? 0x03 : 0x05);
+	colmod = bits == 12 ? 12 : 16;
+}
+
+uint8_t lcd7735_getColorMode(void) {
+	return colmod;
 }
 void lcd7735_pushColor(uint16_t color) {
 	LCD_DC1;  
 	putpix(color);
 }
 
+// stream n pixels into the window set by lcd7735_setAddrWindow()
+void lcd7735_pushColors(const uint16_t *data, uint16_t n) {
+	LCD_DC1;
+	while (n--) {
+		putpix(*data);
+		data++;
+	}
+}
+
+// stream the same color n times into the window
+void lcd7735_pushColorRepeat(uint16_t color, uint16_t n) {
+	LCD_DC1;
+	while (n--) {
+		putpix(color);
+	}
+}
+
 // draw color pixel on screen
 void lcd7735_drawPixel(int16_t x, int16_t y, uint16_t color) {
 
 	if((x < 0) ||(x >= _width) || (y < 0) || (y >= _height)) return;
 
-	lcd7735_setAddrWindow(x,y,x+1,y+1);
+	lcd7735_setAddrWindow(x,y,x,y);
 	lcd7735_pushColor(color);
 }
 
@@ -305,6 +395,157 @@ void lcd7735_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color
 	}
 }
 
+// Glyph cache: cells of lcd7735_print() and the terminal are kept expanded to
+// RGB565 in panel byte order, keyed by font, char and colors, so drawing one
+// again is a single burst of lcd7735_senddatabuf(). The pool is allocated in
+// blocks, a glyph takes consecutive blocks and the least recently used glyphs
+// are evicted until they fit. Transparent text isn't cached.
+#if LCD_GLYPH_CACHE > 0
+
+#define GLYPH_BLOCK	64			// bytes
+#define GLYPH_BLOCKS	(LCD_GLYPH_CACHE / GLYPH_BLOCK)
+#define GLYPH_ENTRIES	(GLYPH_BLOCKS / 2)
+#define swap16(c)	((uint16_t)(((c) >> 8) | ((c) << 8)))
+
+typedef struct _glyphentry {
+	const uint8_t	*font;		// NULL if the entry is free
+	uint16_t	c;
+	uint16_t	fg;
+	uint16_t	bg;
+	uint16_t	first;		// first block
+	uint16_t	nblocks;
+	uint32_t	used;		// time of the last use
+} GlyphEntry;
+
+static uint16_t glyph_pool[GLYPH_BLOCKS * GLYPH_BLOCK / 2] LCD_GLYPH_CACHE_SECTION;
+static GlyphEntry glyph_cache[GLYPH_ENTRIES];
+static uint32_t glyph_clock = 0;
+static GlyphCacheStats glyph_stats;
+
+static void glyphDrop(GlyphEntry *e) {
+	glyph_stats.glyphs--;
+	glyph_stats.bytes -= e->nblocks * GLYPH_BLOCK;
+	e->font = NULL;
+}
+
+// Image of the n pixel cell of char c, NULL if it is too big to be cached.
+// *hit is 0 if the image has just been allocated and must be filled.
+static uint16_t *glyphCacheGet(const uint8_t *font, uint16_t c, uint16_t fg, uint16_t bg, int n, uint8_t *hit) {
+	uint8_t owned[GLYPH_BLOCKS];
+	GlyphEntry *e, *lru, *slot;
+	int nblocks = (n * 2 + GLYPH_BLOCK - 1) / GLYPH_BLOCK, i, run;
+
+	if (nblocks > GLYPH_BLOCKS / 4)
+		return NULL;
+	glyph_clock++;
+	for (e = glyph_cache; e < glyph_cache + GLYPH_ENTRIES; e++) {
+		if (e->font == font && e->c == c && e->fg == fg && e->bg == bg) {
+			e->used = glyph_clock;
+			glyph_stats.hits++;
+			*hit = 1;
+			return glyph_pool + e->first * (GLYPH_BLOCK / 2);
+		}
+	}
+	glyph_stats.misses++;
+	*hit = 0;
+
+	for (;;) {
+		memset(owned, 0, sizeof(owned));
+		lru = slot = NULL;
+		for (e = glyph_cache; e < glyph_cache + GLYPH_ENTRIES; e++) {
+			if (e->font == NULL) {
+				slot = e;
+				continue;
+			}
+			memset(owned + e->first, 1, e->nblocks);
+			if (lru == NULL || e->used < lru->used)
+				lru = e;
+		}
+		for (i = 0, run = 0; slot && i < GLYPH_BLOCKS && run < nblocks; i++)
+			run = owned[i] ? 0 : run + 1;
+		if (slot && run == nblocks)
+			break;
+		glyphDrop(lru);
+		glyph_stats.evictions++;
+	}
+	slot->font = font;
+	slot->c = c;
+	slot->fg = fg;
+	slot->bg = bg;
+	slot->first = i - nblocks;
+	slot->nblocks = nblocks;
+	slot->used = glyph_clock;
+	glyph_stats.glyphs++;
+	glyph_stats.bytes += nblocks * GLYPH_BLOCK;
+	return glyph_pool + slot->first * (GLYPH_BLOCK / 2);
+}
+
+// Send a cached cw x ch cell to x,y
+static void glyphCacheSend(const uint16_t *img, int x, int y, int cw, int ch) {
+	uint32_t n = cw * ch;
+	uint16_t c;
+
+	lcd7735_setAddrWindow(x,y,x+cw-1,y+ch-1);
+	LCD_DC1;
+	if (colmod == 16) {
+		lcd7735_senddatabuf((const uint8_t *)img, n * 2);
+	} else {
+		while (n--) {
+			c = swap16(*img);
+			putpix(c);
+			img++;
+		}
+	}
+}
+
+// Expand a gw x gh glyph of bpp bit levels at gx,gy of a cw x ch cell, level
+// l is drawn in color ramp[l]
+static void glyphExpand(uint16_t *img, const uint8_t *bits, uint8_t bpp, const uint16_t *ramp,
+		int gw, int gh, int gx, int gy, int cw, int ch) {
+	int rowbytes = (gw * bpp + 7) / 8, i, j;
+	uint16_t sw[16], *d;
+
+	for (i=0; i<(1 << bpp); i++)
+		sw[i] = swap16(ramp[i]);
+	for (i=0; i<cw*ch; i++)
+		img[i] = sw[0];
+	for (j=0; j<gh; j++, bits+=rowbytes) {
+		d = img + (gy+j)*cw + gx;
+		for (i=0; i<gw; i++)
+			d[i] = sw[(bits[i * bpp / 8] >> (8 - bpp - i * bpp % 8)) & ((1 << bpp) - 1)];
+	}
+}
+
+// Fill the counters of the glyph cache
+void lcd7735_getGlyphCacheStats(GlyphCacheStats *st) {
+	*st = glyph_stats;
+}
+
+// Drop the cached glyphs of font, or of every font if NULL. Needed when the
+// data of a font in RAM changes, colors and fonts are part of the cache key.
+void lcd7735_clearGlyphCache(const uint8_t *font) {
+	GlyphEntry *e;
+
+	for (e = glyph_cache; e < glyph_cache + GLYPH_ENTRIES; e++)
+		if (e->font && (font == NULL || e->font == font))
+			glyphDrop(e);
+}
+
+#else
+
+#define glyphCacheGet(font, c, fg, bg, n, hit)	((uint16_t *)NULL)
+#define glyphCacheSend(img, x, y, cw, ch)
+#define glyphExpand(img, bits, bpp, ramp, gw, gh, gx, gy, cw, ch)
+
+void lcd7735_getGlyphCacheStats(GlyphCacheStats *st) {
+	memset(st, 0, sizeof(*st));
+}
+
+void lcd7735_clearGlyphCache(const uint8_t *font) {
+}
+
+#endif /* LCD_GLYPH_CACHE */
+
 //
 // for optimize code size if graphics features not need
 //
@@ -439,46 +680,221 @@ void lcd7735_fillCircle(int16_t x, int16_t y, int radius, uint16_t color) {
 			}
 }
 
+// Frame memory position of address x,y written with MADCTL value m
+static void madctl_map(uint8_t m, int x, int y, int *px, int *py) {
+	int t;
+
+	if (m & MADCTL_MV) { t = x; x = y; y = t; }
+	if (m & MADCTL_MX) x = ST7735_TFTWIDTH - 1 - x;
+	if (m & MADCTL_MY) y = ST7735_TFTHEIGHT - 1 - y;
+	*px = x;
+	*py = y;
+}
+
+// Address of frame memory position px,py with MADCTL value m
+static void madctl_unmap(uint8_t m, int px, int py, int *x, int *y) {
+	int t;
+
+	if (m & MADCTL_MX) px = ST7735_TFTWIDTH - 1 - px;
+	if (m & MADCTL_MY) py = ST7735_TFTHEIGHT - 1 - py;
+	if (m & MADCTL_MV) { t = px; px = py; py = t; }
+	*x = px;
+	*y = py;
+}
+
+// Screen offset of source pixel u,v of a w*h image drawn with BLIT_ flags
+static void blit_dest(uint8_t flags, int w, int h, int u, int v, int *dx, int *dy) {
+	if (flags & BLIT_FLIP_H) u = w - 1 - u;
+	if (flags & BLIT_FLIP_V) v = h - 1 - v;
+	if (flags & BLIT_TRANSPOSE) {
+		*dx = v;
+		*dy = u;
+	} else {
+		*dx = u;
+		*dy = v;
+	}
+}
+
+// Open a single window at x,y for a w*h pixel stream in source order. The scan
+// direction is taken over by a temporary MADCTL value, the one that puts source
+// pixels 0,0 1,0 and 0,1 onto their transformed screen places, so no per-row
+// windows or backward iteration is needed. Must be paired with blitEnd().
+static void blitBegin(int x, int y, int w, int h, uint8_t flags) {
+	int dx, dy, px[3], py[3], ax[3], ay[3], i;
+	uint8_t m, cand;
+
+	for (i=0; i<3; i++) {
+		blit_dest(flags, w, h, i == 1, i == 2, &dx, &dy);
+		madctl_map(madctl, x+dx, y+dy, &px[i], &py[i]);
+	}
+	for (cand=0; cand<8; cand++) {
+		m = (madctl & ~(MADCTL_MY | MADCTL_MX | MADCTL_MV)) | (cand << 5);
+		for (i=0; i<3; i++)
+			madctl_unmap(m, px[i], py[i], &ax[i], &ay[i]);
+		if (ax[1] == ax[0]+1 && ay[1] == ay[0] && ax[2] == ax[0] && ay[2] == ay[0]+1)
+			break;
+	}
+	if (m != madctl) {
+		sendCmd(ST7735_MADCTL);
+		lcd7735_sendData(m);
+	}
+	blit_madctl = m;
+	lcd7735_setAddrWindow(ax[0], ay[0], ax[0]+w-1, ay[0]+h-1);
+	LCD_DC1;
+}
+
+static void blitEnd(void) {
+	if (blit_madctl != madctl) {
+		sendCmd(ST7735_MADCTL);
+		lcd7735_sendData(madctl);
+		blit_madctl = madctl;
+	}
+}
+
+// Open a w x h window at x,y that is filled in source order by lcd7735_pushColors(),
+// flags as for lcd7735_drawSubBitmap(). Must be closed by lcd7735_blitEnd().
+void lcd7735_blitBegin(int x, int y, int w, int h, uint8_t flags) {
+	blitBegin(x, y, w, h, flags);
+}
+
+void lcd7735_blitEnd(void) {
+	blitEnd();
+}
+
+// Bitmaps have always been rendered mirrored in landscape. Returns the blit
+// flags of a bitmap drawn in source order with "flags", the mirror added in
+// landscape, so every image entry point lays out its pixels the same way.
+uint8_t lcd7735_bitmapFlags(uint8_t flags) {
+	if (orientation == LANDSAPE || orientation == LANDSAPE_FLIP)
+		flags ^= (flags & BLIT_TRANSPOSE) ? BLIT_FLIP_V : BLIT_FLIP_H;
+	return flags;
+}
+
+#define bitmapFlags()	lcd7735_bitmapFlags(0)
+
 void lcd7735_drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale) {
 	int tx, ty, tc, tsx, tsy;
 
+	blitBegin(x, y, sx*scale, sy*scale, bitmapFlags());
 	if (scale==1) {
-		if (orientation == PORTRAIT || orientation == PORTRAIT_FLIP)
-		{
-			lcd7735_setAddrWindow(x, y, x+sx-1, y+sy-1);
-			LCD_DC1;
-			for (tc=0; tc<(sx*sy); tc++)
-				putpix(data[tc]);
-		} else {
-			for (ty=0; ty<sy; ty++) {
-				lcd7735_setAddrWindow(x, y+ty, x+sx-1, y+ty);
-				LCD_DC1;
-				for (tx=sx-1; tx>=0; tx--)
-					putpix(data[(ty*sx)+tx]);
+		for (tc=0; tc<(sx*sy); tc++)
+			putpix(data[tc]);
+	} else {
+		for (ty=0; ty<sy; ty++)
+			for (tsy=0; tsy<scale; tsy++)
+				for (tx=0; tx<sx; tx++)
+					for (tsx=0; tsx<scale; tsx++)
+						putpix(data[(ty*sx)+tx]);
+	}
+	blitEnd();
+}
+
+// Start decoding the tokens of a RLE565 image of "pixels" pixels
+void lcd7735_rle565Begin(RLE565Stream *s, const uint16_t *tokens, uint32_t pixels) {
+	s->p = tokens;
+	s->n = 0;
+	s->left = pixels;
+}
+
+// Send the next n pixels of a RLE565 stream into the open window, or skip them
+// if send is 0. Repeat runs go out as repeated color writes and literals as
+// pixel streams. A token of no pixels or of more pixels than the image has left
+// ends a corrupt stream. Returns the number of pixels taken, less than n only
+// at the end of the image or of a corrupt stream.
+uint32_t lcd7735_rle565Take(RLE565Stream *s, uint32_t n, uint8_t send) {
+	uint32_t taken = 0;
+	uint16_t c, k;
+
+	while (taken < n) {
+		c = *s->p & ~RLE565_RUN;
+		if (s->n == 0) {
+			if (c == 0 || c > s->left) {
+				s->left = 0;
+				break;
 			}
+			s->n = c;
+			s->left -= c;
+		}
+		k = n - taken < s->n ? n - taken : s->n;
+		if (send) {
+			if (*s->p & RLE565_RUN)
+				lcd7735_pushColorRepeat(s->p[1], k);
+			else
+				lcd7735_pushColors(s->p + 1 + c - s->n, k);
 		}
+		taken += k;
+		s->n -= k;
+		if (s->n == 0)
+			s->p += *s->p & RLE565_RUN ? 2 : 1 + c;
+	}
+	return taken;
+}
+
+// Decode a RLE565 image straight into one window
+void lcd7735_drawRLE565(int x, int y, const uint16_t *rle) {
+	RLE565Stream s;
+
+	blitBegin(x, y, rle[0], rle[1], bitmapFlags());
+	lcd7735_rle565Begin(&s, rle + 2, (uint32_t)rle[0] * rle[1]);
+	lcd7735_rle565Take(&s, (uint32_t)rle[0] * rle[1], 1);
+	blitEnd();
+}
+
+// Draw a RGB565 bitmap stored in panel byte order (high byte first). Pixels
+// need no CPU work, the whole image is one burst straight from flash. In 12-bit
+// color mode the pixels are converted one by one.
+void lcd7735_drawBitmapSwapped(int x, int y, int sx, int sy, const uint8_t *data) {
+	int tc;
+
+	blitBegin(x, y, sx, sy, bitmapFlags());
+	if (colmod == 16) {
+		lcd7735_senddatabuf(data, sx*sy*2);
 	} else {
-		if (orientation == PORTRAIT || orientation == PORTRAIT_FLIP) {
-			for (ty=0; ty<sy; ty++) {
-				lcd7735_setAddrWindow(x, y+(ty*scale), x+((sx*scale)-1), y+(ty*scale)+scale);
-				for (tsy=0; tsy<scale; tsy++)
-					for (tx=0; tx<sx; tx++) {
-						for (tsx=0; tsx<scale; tsx++)
-							lcd7735_pushColor(data[(ty*sx)+tx]);
-					}
-			}
-		} else {
-			for (ty=0; ty<sy; ty++) {
-				for (tsy=0; tsy<scale; tsy++) {
-					lcd7735_setAddrWindow(x, y+(ty*scale)+tsy, x+((sx*scale)-1), y+(ty*scale)+tsy);
-					for (tx=sx-1; tx>=0; tx--) {
-						for (tsx=0; tsx<scale; tsx++)
-							lcd7735_pushColor(data[(ty*sx)+tx]);
-					}
-				}
-			}
+		for (tc=0; tc<(sx*sy); tc++, data+=2)
+			putpix((data[0] << 8) | data[1]);
+	}
+	blitEnd();
+}
+
+// Draw a bitmap of 8-bit indices into a RGB565 palette
+void lcd7735_drawBitmapIndexed(int x, int y, int sx, int sy, const uint8_t *data, const uint16_t *palette) {
+	int tc;
+
+	blitBegin(x, y, sx, sy, bitmapFlags());
+	for (tc=0; tc<(sx*sy); tc++)
+		putpix(palette[data[tc]]);
+	blitEnd();
+}
+
+// Stream sx*sy pixels of a bitmap "stride" pixels wide in source order
+static void blit(int x, int y, bitmapdatatype data, int stride, int sx, int sy, uint8_t flags) {
+	int tx, ty;
+	bitmapdatatype row;
+
+	blitBegin(x, y, sx, sy, flags);
+	for (ty=0; ty<sy; ty++) {
+		row = data;
+		for (tx=0; tx<sx; tx++) {
+			putpix(*row);
+			row++;
 		}
+		data += stride;
 	}
+	blitEnd();
+}
+
+// Draw sx*sy pixels taken at src_x,src_y out of a bitmap "stride" pixels wide.
+// Landscape orientations mirror rows the same way lcd7735_drawBitmap() does.
+void lcd7735_drawSubBitmap(int x, int y, bitmapdatatype data, int stride, int src_x, int src_y, int sx, int sy, uint8_t flags) {
+	blit(x, y, data + src_y * stride + src_x, stride, sx, sy, lcd7735_bitmapFlags(flags));
+}
+
+// Draw cell n of a sprite sheet, cells are numbered row by row
+void lcd7735_drawSprite(int x, int y, const SpriteSheet *sheet, int n, uint8_t flags) {
+	int cols = sheet->stride / sheet->cell_w;
+
+	lcd7735_drawSubBitmap(x, y, sheet->data, sheet->stride, (n % cols) * sheet->cell_w, (n / cols) * sheet->cell_h,
+						  sheet->cell_w, sheet->cell_h, flags);
 }
 
 void lcd7735_drawBitmapRotate(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy) {
@@ -488,6 +904,12 @@ void lcd7735_drawBitmapRotate(int x, int y, int sx, int sy, bitmapdatatype data,
 
 	if (deg==0)
 		lcd7735_drawBitmap(x, y, sx, sy, data, 1);
+	else if (deg==90)
+		blit(x+rox+roy-sy+1, y+roy-rox, data, sx, sx, sy, BLIT_ROTATE_90);
+	else if (deg==180)
+		blit(x+2*rox-sx+1, y+2*roy-sy+1, data, sx, sx, sy, BLIT_ROTATE_180);
+	else if (deg==270)
+		blit(x+rox-roy, y+roy+rox-sx+1, data, sx, sx, sy, BLIT_ROTATE_270);
 	else
 	{
 		for (ty=0; ty<sy; ty++)
@@ -501,20 +923,414 @@ void lcd7735_drawBitmapRotate(int x, int y, int sx, int sy, bitmapdatatype data,
 	}
 }
 
+// Colors from _bg (level 0) to _fg (top level) for the anti-aliased and
+// proportional fonts, so that glyphs are drawn by table lookup
+static void fontRamp(void) {
+	uint8_t i, top = (1 << cfont.bpp) - 1;
+	uint16_t r, g, b;
+
+	if (cfont.bpp == 0)
+		return;
+	for (i=0; i<=top; i++) {
+		r = ((_fg >> 11) * i + (_bg >> 11) * (top - i) + top/2) / top;
+		g = (((_fg >> 5) & 0x3F) * i + ((_bg >> 5) & 0x3F) * (top - i) + top/2) / top;
+		b = ((_fg & 0x1F) * i + (_bg & 0x1F) * (top - i) + top/2) / top;
+		font_ramp[i] = (r << 11) | (g << 5) | b;
+	}
+}
+
+#define le16(p)		((p)[0] | ((p)[1] << 8))
+
 void lcd7735_setFont(uint8_t* font) {
 	cfont.font=font;
-	cfont.x_size=font[0];
-	cfont.y_size=font[1];
-	cfont.offset=font[2];
-	cfont.numchars=font[3];
+	cfont.prop=0;
+	cfont.rle=0;
+	if (font[0] == 0 && (font[1] & FONT_PROP)) {
+		cfont.prop=1;
+		cfont.rle=(font[1] & FONT_RLE) != 0;
+		cfont.bpp=font[1] & 0x0F;
+		cfont.x_size=0;
+		cfont.y_size=font[2];
+		cfont.baseline=font[3];
+		cfont.nranges=le16(font + 4);
+		cfont.numchars=le16(font + 6);
+		cfont.nkern=le16(font + 8);
+		cfont.offset=0;
+		cfont.header=FONT_PROP_HEADER;
+		cfont.glyphs=font + FONT_PROP_HEADER + cfont.nranges * 6;
+		cfont.bitmaps=cfont.glyphs + cfont.numchars * 8 + cfont.nkern * 5;
+	} else if (font[0] == 0) {
+		// anti-aliased font, UTFT fonts never have a zero width
+		cfont.bpp=font[1];
+		cfont.x_size=font[2];
+		cfont.y_size=font[3];
+		cfont.offset=font[4];
+		cfont.numchars=font[5];
+		cfont.header=FONT_AA_HEADER;
+	} else {
+		cfont.bpp=1;
+		cfont.x_size=font[0];
+		cfont.y_size=font[1];
+		cfont.offset=font[2];
+		cfont.numchars=font[3];
+		cfont.header=4;
+	}
+	fontRamp();
+}
+
+void lcd7735_setTransparent(uint8_t s) {
+	_transparent = s;
+}
+
+void lcd7735_setForeground(uint16_t s) {
+	_fg = s;
+	fontRamp();
+}
+
+void lcd7735_setBackground(uint16_t s) {
+	_bg = s;
+	fontRamp();
+}
+
+uint16_t lcd7735_getForeground(void) {
+	return _fg;
+}
+
+uint16_t lcd7735_getBackground(void) {
+	return _bg;
+}
+
+// Level of pixel i in a glyph row of bpp bit levels, the first pixel in the high bits
+#define glyphLevel(row, i)	(((row)[(i) * cfont.bpp / 8] >> (8 - cfont.bpp - (i) * cfont.bpp % 8)) & ((1 << cfont.bpp) - 1))
+#define glyphRowBytes(w)	(((w) * cfont.bpp + 7) / 8)
+
+// Glyph of c in an anti-aliased font, rows padded to bytes
+#define aaGlyph(c)	(cfont.font + cfont.header + ((c) - cfont.offset) * glyphRowBytes(cfont.x_size) * cfont.y_size)
+
+// Draw a cw x ch cell at x,y holding the gw x gh glyph at gx,gy of the cell.
+// Only the covered runs of the glyph rows are sent in transparent mode.
+static void drawGlyph(const uint8_t *bits, int gw, int gh, int gx, int gy, int x, int y, int cw, int ch) {
+	uint8_t n, v = 0, bpp = cfont.bpp, rshift = 8 - cfont.bpp;
+	int rowbytes = glyphRowBytes(gw), i, j, k;
+	const uint8_t *p;
+
+	if (!_transparent) {
+		lcd7735_setAddrWindow(x,y,x+cw-1,y+ch-1);
+		LCD_DC1;
+		for (j=0; j<ch; j++) {
+			if (j < gy || j >= gy+gh) {
+				for (i=0; i<cw; i++)
+					putpix(font_ramp[0]);
+				continue;
+			}
+			p = bits + (j-gy) * rowbytes;
+			for (i=0; i<gx; i++)
+				putpix(font_ramp[0]);
+			for (k=0, n=0; k<gw; k++, n-=bpp) {
+				if (n == 0) {
+					v = *p++;
+					n = 8;
+				}
+				putpix(font_ramp[v >> rshift]);
+				v <<= bpp;
+			}
+			for (i=gx+gw; i<cw; i++)
+				putpix(font_ramp[0]);
+		}
+	} else {
+		// runs of covered pixels, blended towards the background color
+		for (j=0, p=bits; j<gh; j++, p+=rowbytes) {
+			for (i=0; i<gw; i=k) {
+				for (k=i; k<gw && glyphLevel(p, k); k++)
+					;
+				if (k == i) {
+					k++;
+					continue;
+				}
+				lcd7735_setAddrWindow(x+gx+i,y+gy+j,x+gx+k-1,y+gy+j);
+				LCD_DC1;
+				for (; i<k; i++)
+					putpix(font_ramp[glyphLevel(p, i)]);
+			}
+		}
+	}
+}
+
+static void putRepeat(uint16_t color, int n) {
+	while (n-- > 0)
+		putpix(color);
+}
+
+// drawGlyph() for FONT_RLE glyphs, decoded run by run: runs of level 0 and of
+// the top level are repeated colors. In transparent mode level 0 pixels are
+// skipped and a window to the end of the row is opened where coverage starts.
+static void drawGlyphRLE(const uint8_t *p, int gw, int gh, int gx, int gy, int x, int y, int cw, int ch) {
+	uint8_t t = 0, v = 0, nbits = 0, bpp = cfont.bpp, kind, l, open = 0;
+	int n = 0, part, row = 0, col = 0, i;
+
+	if (!_transparent) {
+		lcd7735_setAddrWindow(x,y,x+cw-1,y+ch-1);
+		LCD_DC1;
+		if (gw == 0 || gh == 0) {
+			putRepeat(font_ramp[0], cw*ch);
+			return;
+		}
+		putRepeat(font_ramp[0], gy*cw + gx);
+	}
+	while (row < gh) {
+		if (n == 0) {
+			t = *p++;
+			n = (t & 0x3F) + 1;
+			nbits = 0;
+		}
+		kind = t & 0xC0;
+		part = n < gw - col ? n : gw - col;
+		if (kind == GLYPH_LITERAL) {
+			for (i=0; i<part; i++, nbits-=bpp) {
+				if (nbits == 0) {
+					v = *p++;
+					nbits = 8;
+				}
+				l = v >> (8 - bpp);
+				v <<= bpp;
+				if (_transparent && l == 0) {
+					open = 0;
+					continue;
+				}
+				if (_transparent && !open) {
+					lcd7735_setAddrWindow(x+gx+col+i,y+gy+row,x+gx+gw-1,y+gy+row);
+					LCD_DC1;
+					open = 1;
+				}
+				putpix(font_ramp[l]);
+			}
+		} else if (kind == GLYPH_RUN_FG) {
+			if (_transparent && !open) {
+				lcd7735_setAddrWindow(x+gx+col,y+gy+row,x+gx+gw-1,y+gy+row);
+				LCD_DC1;
+				open = 1;
+			}
+			putRepeat(font_ramp[(1 << bpp) - 1], part);
+		} else if (!_transparent) {
+			putRepeat(font_ramp[0], part);
+		} else {
+			open = 0;
+		}
+		n -= part;
+		col += part;
+		if (col == gw) {
+			col = 0;
+			row++;
+			open = 0;
+			if (!_transparent)
+				putRepeat(font_ramp[0], row < gh ? cw - gw : cw - gx - gw);
+		}
+	}
+	if (!_transparent)
+		putRepeat(font_ramp[0], (ch-gy-gh)*cw);
+}
+
+// Level of the next pixel of a FONT_RLE glyph
+typedef struct _glyphrle {
+	const uint8_t	*p;
+	uint8_t		t, v, nbits;
+	int		n;
+} GlyphRLE;
+
+static uint8_t rleNext(GlyphRLE *r) {
+	uint8_t l;
+
+	if (r->n == 0) {
+		r->t = *r->p++;
+		r->n = (r->t & 0x3F) + 1;
+		r->nbits = 0;
+	}
+	r->n--;
+	if ((r->t & 0xC0) == GLYPH_RUN_BG)
+		return 0;
+	if ((r->t & 0xC0) == GLYPH_RUN_FG)
+		return (1 << cfont.bpp) - 1;
+	if (r->nbits == 0) {
+		r->v = *r->p++;
+		r->nbits = 8;
+	}
+	l = r->v >> (8 - cfont.bpp);
+	r->v <<= cfont.bpp;
+	r->nbits -= cfont.bpp;
+	return l;
+}
+
+#if LCD_GLYPH_CACHE > 0
+// glyphExpand() for FONT_RLE glyphs
+static void glyphExpandRLE(uint16_t *img, const uint8_t *bits, int gw, int gh, int gx, int gy, int cw, int ch) {
+	GlyphRLE r = { bits, 0, 0, 0, 0 };
+	uint16_t sw[16], *d;
+	int i, j;
+
+	for (i=0; i<(1 << cfont.bpp); i++)
+		sw[i] = swap16(font_ramp[i]);
+	for (i=0; i<cw*ch; i++)
+		img[i] = sw[0];
+	for (j=0; j<gh; j++) {
+		d = img + (gy+j)*cw + gx;
+		for (i=0; i<gw; i++)
+			d[i] = sw[rleNext(&r)];
+	}
+}
+#else
+#define glyphExpandRLE(img, bits, gw, gh, gx, gy, cw, ch)
+#endif
+
+// Draw glyph pixels one by one, rotated by deg around x,y. The glyph is at
+// gx,gy of a cell of the columns left..right-1 and the font height, pos
+// pixels along the text. Opaque glyphs paint the whole cell in the order of
+// rotateChar(), so both leave the same pixels.
+static void rotateGlyph(const uint8_t *bits, int gw, int gh, int gx, int gy, int left, int right, int x, int y, int pos, int deg) {
+	double radian = deg*0.0175;
+	int i, j, newx, newy;
+	uint8_t ch;
+	GlyphRLE r = { bits, 0, 0, 0, 0 };
+
+	for (j=0; j<cfont.y_size; j++) {
+		if (j > gy && j < gy+gh)
+			bits += glyphRowBytes(gw);
+		for (i=left; i<right; i++) {
+			if (j < gy || j >= gy+gh || i < gx || i >= gx+gw)
+				ch = 0;
+			else
+				ch = cfont.rle ? rleNext(&r) : glyphLevel(bits, i-gx);
+			if (ch == 0 && _transparent)
+				continue;
+			newx=x+(((i+pos)*cos(radian))-((j)*sin(radian)));
+			newy=y+(((j)*cos(radian))+((i+pos)*sin(radian)));
+			lcd7735_setAddrWindow(newx,newy,newx,newy);
+			lcd7735_pushColor(font_ramp[ch]);
+		}
+	}
+}
+
+// Glyph index of code point c in the proportional font, -1 if it has none
+static int propGlyph(uint32_t c) {
+	const uint8_t *r;
+	int lo = 0, hi = cfont.nranges - 1, mid;
+
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		r = cfont.font + FONT_PROP_HEADER + mid * 6;
+		if (c < (uint32_t)le16(r))
+			hi = mid - 1;
+		else if (c >= (uint32_t)le16(r) + le16(r + 2))
+			lo = mid + 1;
+		else
+			return le16(r + 4) + (int)(c - le16(r));
+	}
+	return -1;
+}
+
+// Kerning of glyph pair left, right in pixels
+static int propKern(int left, int right) {
+	const uint8_t *k = cfont.glyphs + cfont.numchars * 8;
+	uint32_t key = ((uint32_t)left << 16) | right, v;
+	int lo = 0, hi = cfont.nkern - 1, mid;
+
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		v = ((uint32_t)le16(k + mid * 5) << 16) | le16(k + mid * 5 + 2);
+		if (key < v)
+			hi = mid - 1;
+		else if (key > v)
+			lo = mid + 1;
+		else
+			return (int8_t)k[mid * 5 + 4];
+	}
+	return 0;
+}
+
+// Glyph table entry: bitmap offset (24 bits), w, h, x bearing, y offset from
+// the top of the line, advance
+#define propEntry(g)	(cfont.glyphs + (g) * 8)
+#define propBits(e)	(cfont.bitmaps + ((e)[0] | ((e)[1] << 8) | ((uint32_t)(e)[2] << 16)))
+
+// Cell of a glyph from its origin: the advance, widened to the glyph box
+static void propCell(const uint8_t *e, int *left, int *right) {
+	int gx = (int8_t)e[5];
+
+	*left = gx < 0 ? gx : 0;
+	*right = gx + e[3] > e[7] ? gx + e[3] : e[7];
+}
+
+static void printGlyph(int g, int x, int y) {
+	const uint8_t *e = propEntry(g);
+	int gx = (int8_t)e[5], left, right;
+	uint16_t *img;
+	uint8_t hit;
+
+	propCell(e, &left, &right);
+	if (right <= left)
+		return;
+	if (!_transparent && (img = glyphCacheGet(cfont.font, g, _fg, _bg, (right - left) * cfont.y_size, &hit))) {
+		if (!hit && cfont.rle)
+			glyphExpandRLE(img, propBits(e), e[3], e[4], gx - left, e[6], right - left, cfont.y_size);
+		else if (!hit)
+			glyphExpand(img, propBits(e), cfont.bpp, font_ramp, e[3], e[4], gx - left, e[6], right - left, cfont.y_size);
+		glyphCacheSend(img, x + left, y, right - left, cfont.y_size);
+		return;
+	}
+	if (cfont.rle)
+		drawGlyphRLE(propBits(e), e[3], e[4], gx - left, e[6], x + left, y, right - left, cfont.y_size);
+	else
+		drawGlyph(propBits(e), e[3], e[4], gx - left, e[6], x + left, y, right - left, cfont.y_size);
+}
+
+// Next code point of a UTF-8 string. Bytes that don't start a valid sequence
+// are taken as Latin-1, so 8-bit strings print as before.
+static uint32_t utf8Next(const uint8_t **s) {
+	const uint8_t *p = *s;
+	uint32_t c = *p++;
+	int n, i;
+
+	if (c >= 0xF0 && c < 0xF8)
+		n = 3;
+	else if (c >= 0xE0)
+		n = 2;
+	else if (c >= 0xC2)
+		n = 1;
+	else
+		n = 0;
+	if (n && c < 0xF8) {
+		for (i=0; i<n; i++)
+			if ((p[i] & 0xC0) != 0x80)
+				break;
+		if (i == n) {
+			c &= 0x3F >> n;
+			for (i=0; i<n; i++)
+				c = (c << 6) | (*p++ & 0x3F);
+		}
+	}
+	*s = p;
+	return c;
 }
 
-void printChar(uint8_t c, int x, int y) {
-	uint8_t i,ch,fz;
+void printChar(uint16_t c, int x, int y) {
+	uint8_t i,ch,fz,hit;
 	uint16_t j;
 	uint16_t temp; 
+	uint16_t *img;
 	int zz;
 
+	// UTFT glyphs are rows of whole bytes, the cache takes the usual multiples of 8
+	if (!_transparent && (cfont.bpp > 1 || cfont.x_size % 8 == 0) &&
+			(img = glyphCacheGet(cfont.font, c, _fg, _bg, cfont.x_size * cfont.y_size, &hit))) {
+		if (!hit)
+			glyphExpand(img, cfont.bpp > 1 ? aaGlyph(c) : cfont.font + 4 + (c - cfont.offset) * (cfont.x_size / 8) * cfont.y_size,
+					cfont.bpp, font_ramp, cfont.x_size, cfont.y_size, 0, 0, cfont.x_size, cfont.y_size);
+		glyphCacheSend(img, x, y, cfont.x_size, cfont.y_size);
+		return;
+	}
+	if (cfont.bpp > 1) {
+		drawGlyph(aaGlyph(c), cfont.x_size, cfont.y_size, 0, 0, x, y, cfont.x_size, cfont.y_size);
+		return;
+	}
 	if( cfont.x_size < 8 ) 
 		fz = cfont.x_size;
 	else
@@ -559,13 +1375,17 @@ void printChar(uint8_t c, int x, int y) {
 	}
 }
 
-void rotateChar(uint8_t c, int x, int y, int pos, int deg) {
+void rotateChar(uint16_t c, int x, int y, int pos, int deg) {
 	uint8_t i,j,ch,fz;
 	uint16_t temp; 
 	int newx,newy;
 	double radian = deg*0.0175;
 	int zz;
 
+	if (cfont.bpp > 1) {
+		rotateGlyph(aaGlyph(c), cfont.x_size, cfont.y_size, 0, 0, 0, cfont.x_size, x, y, pos, deg);
+		return;
+	}
 	if( cfont.x_size < 8 ) 
 		fz = cfont.x_size;
 	else
@@ -575,8 +1395,8 @@ void rotateChar(uint8_t c, int x, int y, int pos, int deg) {
 		for (zz=0; zz<(fz); zz++) {
 			ch = cfont.font[temp+zz]; 
 			for(i=0;i<8;i++) {   
-				newx=x+(((i+(zz*8)+(pos*cfont.x_size))*cos(radian))-((j)*sin(radian)));
-				newy=y+(((j)*cos(radian))+((i+(zz*8)+(pos*cfont.x_size))*sin(radian)));
+				newx=x+(((i+(zz*8)+pos)*cos(radian))-((j)*sin(radian)));
+				newy=y+(((j)*cos(radian))+((i+(zz*8)+pos)*sin(radian)));
 
 				lcd7735_setAddrWindow(newx,newy,newx+1,newy+1);
 
@@ -592,21 +1412,354 @@ void rotateChar(uint8_t c, int x, int y, int pos, int deg) {
 	}
 }
 
-void lcd7735_print(char *st, int x, int y, int deg) {
-	int stl, i;
+// Walk through the glyphs of a string as print does, with kerning. Spaces are
+// widened by "space" pixels, the first "rem" of them by one more.
+typedef struct _textwalk {
+	const uint8_t	*s;
+	const uint8_t	*end;
+	int		pos;		// pen position after the last glyph
+	int		prev;		// last glyph of a proportional font, -1 if none
+	int		space;
+	int		rem;
+} TextWalk;
+
+static void textWalk(TextWalk *w, const char *st, int n, int space, int rem) {
+	w->s = (const uint8_t *)st;
+	w->end = w->s + (n < 0 ? strlen(st) : (size_t)n);
+	w->pos = 0;
+	w->prev = -1;
+	w->space = space;
+	w->rem = rem;
+}
+
+// Next glyph to draw and its position, c is the glyph index in proportional
+// fonts and the char otherwise. Returns 0 at the end of the text.
+static uint8_t textNext(TextWalk *w, uint32_t *c, int *at) {
+	uint32_t cp;
+	int g;
+
+	while (w->s < w->end && *w->s) {
+		cp = utf8Next(&w->s);
+		if (cfont.prop) {
+			g = propGlyph(cp);
+			if (g < 0)
+				continue;
+			if (w->prev >= 0 && cfont.nkern)
+				w->pos += propKern(w->prev, g);
+			w->prev = g;
+			*c = g;
+			*at = w->pos;
+			w->pos += propEntry(g)[7];
+		} else {
+			*c = cp;
+			*at = w->pos;
+			w->pos += cfont.x_size;
+		}
+		if (cp == ' ') {
+			w->pos += w->space + (w->rem > 0);
+			w->rem--;
+		}
+		if (cfont.prop || (cp >= cfont.offset && cp < (uint32_t)cfont.offset + cfont.numchars))
+			return 1;
+	}
+	return 0;
+}
+
+// Width in pixels of the first n bytes of st
+int lcd7735_textWidthN(const char *st, int n) {
+	TextWalk w;
+	uint32_t c;
+	int at;
+
+	textWalk(&w, st, n, 0, 0);
+	while (textNext(&w, &c, &at))
+		;
+	return w.pos;
+}
+
+uint8_t *lcd7735_getFont(void) {
+	return cfont.font;
+}
+
+uint8_t lcd7735_getFontHeight(void) {
+	return cfont.y_size;
+}
+
+// Skip n pixels of a FONT_RLE glyph, runs at once
+static void rleSkip(GlyphRLE *r, int n) {
+	int k;
+
+	while (n > 0) {
+		if (r->n == 0) {
+			r->t = *r->p++;
+			r->n = (r->t & 0x3F) + 1;
+			r->nbits = 0;
+		}
+		if ((r->t & 0xC0) == GLYPH_LITERAL) {
+			rleNext(r);
+			n--;
+		} else {
+			k = n < r->n ? n : r->n;
+			r->n -= k;
+			n -= k;
+		}
+	}
+}
+
+// Levels of row r of glyph c, which starts at x of the line. Uncovered pixels
+// are left alone, so overlapping glyphs merge.
+static void glyphRow(uint8_t *lev, int w, uint32_t c, int r, int x) {
+	const uint8_t *e, *bits;
+	int gw, i;
+	uint8_t l;
+	GlyphRLE rle;
+
+	if (cfont.prop) {
+		e = propEntry(c);
+		if (r < e[6] || r >= e[6] + e[4])
+			return;
+		gw = e[3];
+		x += (int8_t)e[5];
+		r -= e[6];
+		if (cfont.rle) {
+			rle.p = propBits(e);
+			rle.n = 0;
+			rleSkip(&rle, r * gw);
+			for (i=0; i<gw; i++) {
+				l = rleNext(&rle);
+				if (l && x+i >= 0 && x+i < w)
+					lev[x+i] = l;
+			}
+			return;
+		}
+		bits = propBits(e) + r * glyphRowBytes(gw);
+	} else {
+		gw = cfont.x_size;
+		if (cfont.bpp > 1)
+			bits = aaGlyph(c) + r * glyphRowBytes(gw);
+		else
+			bits = cfont.font + 4 + ((c - cfont.offset) * cfont.y_size + r) * ((gw + 7) / 8);
+	}
+	for (i=0; i<gw; i++) {
+		l = glyphLevel(bits, i);
+		if (l && x+i >= 0 && x+i < w)
+			lev[x+i] = l;
+	}
+}
+
+#define LINE_GLYPHS	64
+
+// A line of text rendered row by row
+static uint16_t line_buf[ST7735_TFTHEIGHT];
+static uint8_t line_lev[ST7735_TFTHEIGHT];
+static struct {
+	uint16_t	c;
+	int16_t		x;
+} line_glyphs[LINE_GLYPHS];
+static int line_n;
+
+// Collect the glyphs of a line that fall in its first w pixels
+static void lineGlyphs(TextWalk *tw, int indent, int w) {
+	uint32_t c;
+	int at;
+
+	line_n = 0;
+	while (line_n < LINE_GLYPHS && textNext(tw, &c, &at) && indent + at < w) {
+		line_glyphs[line_n].c = c;
+		line_glyphs[line_n++].x = indent + at;
+	}
+}
+
+// Levels of row r of the collected line
+static void lineRow(int r, int w) {
+	int i;
+
+	memset(line_lev, 0, w);
+	if (r < cfont.y_size)
+		for (i=0; i<line_n; i++)
+			glyphRow(line_lev, w, line_glyphs[i].c, r, line_glyphs[i].x);
+}
+
+// Print n bytes of st as a line of a w x h box at x,y. The text starts indent
+// pixels into the box and "extra" pixels are spread over its spaces. Opaque
+// lines are sent row by row through one window, so glyphs may overlap and
+// the background around them is cleared as well.
+void lcd7735_printLine(const char *st, int n, int x, int y, int w, int h, int indent, int extra) {
+	TextWalk tw;
+	uint32_t c;
+	int at, spaces = 0, r, i;
+
+	if (n < 0)
+		n = strlen(st);
+	for (i=0; i<n; i++)
+		spaces += st[i] == ' ';
+	textWalk(&tw, st, n, spaces ? extra / spaces : 0, spaces ? extra % spaces : 0);
+	if (w > ST7735_TFTHEIGHT)
+		w = ST7735_TFTHEIGHT;
+	if (_transparent) {
+		while (textNext(&tw, &c, &at)) {
+			if (cfont.prop)
+				printGlyph(c, x + indent + at, y);
+			else
+				printChar(c, x + indent + at, y);
+		}
+		return;
+	}
+	lineGlyphs(&tw, indent, w);
+
+	lcd7735_setAddrWindow(x,y,x+w-1,y+h-1);
+	for (r=0; r<h; r++) {
+		lineRow(r, w);
+		for (i=0; i<w; i++)
+			line_buf[i] = font_ramp[line_lev[i]];
+		lcd7735_pushColors(line_buf, w);
+	}
+}
+
+// Draw row r of a line of n bytes of st into row, a buffer of w pixels that
+// the text starts indent pixels into. Only the pixels covered by glyphs are
+// written, in the colors of the ramp from the current background.
+void lcd7735_textRow(const char *st, int n, int r, int indent, uint16_t *row, int w) {
+	TextWalk tw;
+	int i;
+
+	if (r < 0 || r >= cfont.y_size)
+		return;
+	if (n < 0)
+		n = strlen(st);
+	if (w > ST7735_TFTHEIGHT)
+		w = ST7735_TFTHEIGHT;
+	textWalk(&tw, st, n, 0, 0);
+	lineGlyphs(&tw, indent, w);
+	lineRow(r, w);
+	for (i=0; i<w; i++)
+		if (line_lev[i])
+			row[i] = font_ramp[line_lev[i]];
+}
+
+// Print st with every pixel of the font drawn as a scale x scale block. Each
+// row of the string is expanded once and sent scale times, opaque text
+// through one window, transparent text one window per covered run.
+void lcd7735_printScaled(char *st, int x, int y, int scale) {
+	TextWalk tw;
+	int w = lcd7735_textWidth(st), r, i, j, k, m;
 
-	stl = strlen(st);
+	if (scale < 1)
+		scale = 1;
+	if (x==RIGHT)
+		x=_width-w*scale;
+	if (x==CENTER)
+		x=(_width-w*scale)/2;
+	// what fits in the row buffer and on the panel
+	if (w * scale > ST7735_TFTHEIGHT)
+		w = ST7735_TFTHEIGHT / scale;
+	if (w * scale > _width - x)
+		w = (_width - x) / scale;
+	if (w <= 0 || x < 0)
+		return;
+	textWalk(&tw, st, -1, 0, 0);
+	lineGlyphs(&tw, 0, w);
+
+	if (!_transparent)
+		lcd7735_setAddrWindow(x,y,x+w*scale-1,y+cfont.y_size*scale-1);
+	for (r=0; r<cfont.y_size; r++) {
+		lineRow(r, w);
+		if (!_transparent) {
+			for (i=w*scale-1; i>=0; i--)
+				line_buf[i] = font_ramp[line_lev[i / scale]];
+			for (k=0; k<scale; k++)
+				lcd7735_pushColors(line_buf, w*scale);
+			continue;
+		}
+		for (i=0; i<w; i=j) {
+			for (j=i; j<w && line_lev[j]; j++)
+				line_buf[j] = font_ramp[line_lev[j]];
+			if (j == i) {
+				j++;
+				continue;
+			}
+			lcd7735_setAddrWindow(x+i*scale,y+r*scale,x+j*scale-1,y+r*scale+scale-1);
+			LCD_DC1;
+			for (k=0; k<scale; k++)
+				for (m=i*scale; m<j*scale; m++)
+					putpix(line_buf[m / scale]);
+		}
+	}
+}
+
+// Draw the opaque cell left..right of glyph g of a proportional font at x,y
+// over cells drawn before it. The cell is composed row by row with the last
+// glyphs of line_glyphs, so the ink of kerned and overhanging neighbours is
+// kept.
+static void printOver(int g, int x, int y, int left, int right) {
+	int w = right - left, r, i;
+
+	lcd7735_setAddrWindow(x+left,y,x+right-1,y+cfont.y_size-1);
+	for (r=0; r<cfont.y_size; r++) {
+		memset(line_lev, 0, w);
+		for (i=0; i<line_n; i++)
+			glyphRow(line_lev, w, line_glyphs[i].c, r, line_glyphs[i].x - x - left);
+		glyphRow(line_lev, w, g, r, -left);
+		for (i=0; i<w; i++)
+			line_buf[i] = font_ramp[line_lev[i]];
+		lcd7735_pushColors(line_buf, w);
+	}
+}
+
+// Glyphs kept for printOver(), a glyph box doesn't reach past more cells
+#define PRINT_BACK	4
+
+// Walk st as print does, with glyphs drawn at x,y unless draw is 0. Returns
+// the width of the text. An opaque proportional glyph whose cell overlaps
+// the cells drawn before it, from kerning or a negative bearing, is composed
+// with them by printOver(), the others are sent as cells of their own.
+static int printText(char *st, int x, int y, int deg, uint8_t draw) {
+	TextWalk w;
+	const uint8_t *e;
+	uint32_t c;
+	int at, left, right, edge = 0;
+
+	textWalk(&w, st, -1, 0, 0);
+	line_n = 0;
+	while (textNext(&w, &c, &at)) {
+		if (!draw)
+			continue;
+		if (cfont.prop) {
+			e = propEntry(c);
+			propCell(e, &left, &right);
+			if (deg != 0)
+				rotateGlyph(propBits(e), e[3], e[4], (int8_t)e[5], e[6], left, right, x, y, at, deg);
+			else if (!_transparent && line_n && at + left < edge && right - left <= ST7735_TFTHEIGHT)
+				printOver(c, x + at, y, left, right);
+			else
+				printGlyph(c, x + at, y);
+			if (!line_n || at + right > edge)
+				edge = at + right;
+			if (line_n == PRINT_BACK)
+				memmove(line_glyphs, line_glyphs + 1, --line_n * sizeof(line_glyphs[0]));
+			line_glyphs[line_n].c = c;
+			line_glyphs[line_n++].x = x + at;
+		} else if (deg == 0) {
+			printChar(c, x + at, y);
+		} else {
+			rotateChar(c, x, y, at, deg);
+		}
+	}
+	return w.pos;
+}
+
+// Width in pixels of st printed in the current font
+int lcd7735_textWidth(char *st) {
+	return printText(st, 0, 0, 0, 0);
+}
 
+void lcd7735_print(char *st, int x, int y, int deg) {
 	if (x==RIGHT)
-		x=(_width+1)-(stl*cfont.x_size);
+		x=(_width+1)-lcd7735_textWidth(st);
 	if (x==CENTER)
-		x=((_height+1)-(stl*cfont.x_size))/2;
+		x=((_height+1)-lcd7735_textWidth(st))/2;
 
-	for (i=0; i<stl; i++)
-		if (deg==0)
-			printChar(*st++, x + (i*(cfont.x_size)), y);
-		else
-			rotateChar(*st++, x, y, i, deg);
+	printText(st, x, y, deg, 1);
 }
 
 #endif /* ONLY_TERMINAL_EMULATOR */
@@ -713,14 +1866,26 @@ static void cursor_init() {
 }
 
 static void _putch(uint8_t c) {
-	uint8_t i,ch,fz;
+	uint8_t i,ch,fz,hit;
 	uint16_t j;
 	uint16_t temp; 
+	uint16_t *img, ramp[2];
 	int x,y;
 
 	fz = _screen.fnt.x_size/8;
 	x = _screen.c.col * _screen.fnt.x_size;
 	y = _screen.c.row * _screen.fnt.y_size;
+	img = glyphCacheGet(_screen.fnt.font, c, _screen.fg, _screen.bg, _screen.fnt.x_size * _screen.fnt.y_size, &hit);
+	if (img) {
+		ramp[0] = _screen.bg;
+		ramp[1] = _screen.fg;
+		if (!hit)
+			glyphExpand(img, _screen.fnt.font + 4 + (c - _screen.fnt.offset) * fz * _screen.fnt.y_size,
+					1, ramp, _screen.fnt.x_size, _screen.fnt.y_size, 0, 0, _screen.fnt.x_size, _screen.fnt.y_size);
+		glyphCacheSend(img, x, y, _screen.fnt.x_size, _screen.fnt.y_size);
+		*_scr(_screen.c.row, _screen.c.col) = c;
+		return;
+	}
 	lcd7735_setAddrWindow(x,y,x+_screen.fnt.x_size-1,y+_screen.fnt.y_size-1);
 	temp=((c-_screen.fnt.offset)*((fz)*_screen.fnt.y_size))+4;
 	for(j=0;j<((fz)*_screen.fnt.y_size);j++) {
@@ -811,45 +1976,88 @@ uint16_t lcd7735_Color565(uint8_t r, uint8_t g, uint8_t b) {
 void lcd7735_setRotation(uint8_t m) {
 	uint8_t rotation = m % 4; // can't be higher than 3
 
-	lcd7735_sendCmd(ST7735_MADCTL);
 	switch (rotation) {
    case PORTRAIT:
-	   lcd7735_sendData(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
+	   madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
 	   _width  = ST7735_TFTWIDTH;
 	   _height = ST7735_TFTHEIGHT;
 	   break;
    case LANDSAPE:
-	   lcd7735_sendData(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
+	   madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
 	   _width  = ST7735_TFTHEIGHT;
 	   _height = ST7735_TFTWIDTH;
 	   break;
    case PORTRAIT_FLIP:
-	   lcd7735_sendData(MADCTL_RGB);
+	   madctl = MADCTL_RGB;
 	   _width  = ST7735_TFTWIDTH;
 	   _height = ST7735_TFTHEIGHT;
 	   break;
    case LANDSAPE_FLIP:
-	   lcd7735_sendData(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
+	   madctl = MADCTL_MX | MADCTL_MV | MADCTL_RGB;
 	   _width  = ST7735_TFTHEIGHT;
 	   _height = ST7735_TFTWIDTH;
 	   break;
    default:
 	   return;
 	}
+	sendCmd(ST7735_MADCTL);
+	lcd7735_sendData(madctl);
 	orientation = m;
 }
 
+uint8_t lcd7735_getRotation(void) {
+	return orientation;
+}
+
+// The panel scrolls along its 160-line axis only, i.e. screen Y in portrait
+// and screen X in landscape. top/bottom are fixed lines in screen coordinates.
+void lcd7735_setScrollArea(uint8_t top, uint8_t bottom) {
+	uint8_t tfa = top;
+	uint8_t bfa = bottom;
+
+	// MY reverses the frame memory rows, so the screen top is the panel bottom
+	if (madctl & MADCTL_MY) {
+		tfa = bottom;
+		bfa = top;
+	}
+	sendCmd(ST7735_VSCRDEF);
+	lcd7735_sendData(0x00);
+	lcd7735_sendData(tfa + rowstart);	// TFA
+	lcd7735_sendData(0x00);
+	lcd7735_sendData(ST7735_TFTHEIGHT - top - bottom);	// VSA
+	lcd7735_sendData(0x00);
+	lcd7735_sendData(bfa + rowstart);	// BFA
+	scroll_top = top;
+	scroll_bottom = bottom;
+}
+
+// After this call the screen line top+n of the scrolling band shows the line
+// drawn at top+((n+offset) % band), where band = 160-top-bottom.
+void lcd7735_scrollTo(uint8_t offset) {
+	uint8_t band = ST7735_TFTHEIGHT - scroll_top - scroll_bottom;
+	uint8_t start;
+
+	offset %= band;
+	if (madctl & MADCTL_MY)
+		start = scroll_bottom + (band - offset) % band;
+	else
+		start = scroll_top + offset;
+	sendCmd(ST7735_VSCRSADD);
+	lcd7735_sendData(0x00);
+	lcd7735_sendData(start + rowstart);
+}
+
 void lcd7735_invertDisplay(const uint8_t mode) {
-	if( mode == INVERT_ON ) lcd7735_sendCmd(ST7735_INVON);
-	else if( mode == INVERT_OFF ) lcd7735_sendCmd(ST7735_INVOFF);
+	if( mode == INVERT_ON ) sendCmd(ST7735_INVON);
+	else if( mode == INVERT_OFF ) sendCmd(ST7735_INVOFF);
 }
 
 void lcd7735_lcdOff() {
-	lcd7735_sendCmd(ST7735_DISPOFF);
+	sendCmd(ST7735_DISPOFF);
 }
 
 void lcd7735_lcdOn() {
-	lcd7735_sendCmd(ST7735_DISPON);
+	sendCmd(ST7735_DISPON);
 }
 
 uint8_t lcd7735_getWidth() {
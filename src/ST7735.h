@@ -46,6 +46,8 @@
 #define ST7735_RAMRD   0x2E
 
 #define ST7735_PTLAR   0x30
+#define ST7735_VSCRDEF 0x33
+#define ST7735_VSCRSADD 0x37
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
 
@@ -103,9 +105,76 @@
 
 #define bitmapdatatype uint16_t *
 
+// flags for lcd7735_drawSubBitmap(), flips are applied before transposition
+#define BLIT_FLIP_H	0x01
+#define BLIT_FLIP_V	0x02
+#define BLIT_TRANSPOSE	0x04
+#define BLIT_ROTATE_90	(BLIT_TRANSPOSE | BLIT_FLIP_V)	// clockwise
+#define BLIT_ROTATE_180	(BLIT_FLIP_H | BLIT_FLIP_V)
+#define BLIT_ROTATE_270	(BLIT_TRANSPOSE | BLIT_FLIP_H)
+
+// RLE565 image: width, height, then tokens. A token RLE565_RUN|n is followed by
+// one color repeated n times, a token n is followed by n literal colors.
+#define RLE565_RUN	0x8000
+
+// Anti-aliased font for lcd7735_setFont(): 0, bits per pixel (2 or 4), width,
+// height, first char, number of chars, then the glyphs. A glyph is height rows
+// of coverage levels, the first pixel in the high bits, each row padded to a
+// whole byte. Level 0 is drawn in the background color, the top level in the
+// foreground color.
+#define FONT_AA_HEADER	6
+
+// Proportional font for lcd7735_setFont(), 16-bit fields are little endian:
+//	0, FONT_PROP | bits per pixel (1, 2 or 4), line height, baseline,
+//	number of ranges, glyphs and kerning pairs (16 bits each), then
+//	ranges:	first code point, count, index of its first glyph (16 bits each),
+//		sorted by code point
+//	glyphs:	bitmap offset (24 bits), w, h, x bearing (signed), y offset from
+//		the top of the line, advance
+//	kerning: left glyph, right glyph (16 bits each), signed adjustment,
+//		sorted by left then right glyph
+//	bitmaps: h rows of w levels, each row padded to a whole byte, or with
+//		FONT_RLE runs of the w*h levels in row order, a token byte
+//		GLYPH_RUN_BG|n-1 or GLYPH_RUN_FG|n-1 is n pixels of level 0 or
+//		the top level, GLYPH_LITERAL|n-1 is followed by n levels packed
+//		like a bitmap row
+#define FONT_PROP	0x80
+#define FONT_RLE	0x40
+#define FONT_PROP_HEADER	10
+#define GLYPH_RUN_BG	0x00
+#define GLYPH_RUN_FG	0x40
+#define GLYPH_LITERAL	0x80
+
+// Equally sized cells stored side by side in one bitmap
+typedef struct _spritesheet {
+	bitmapdatatype	data;
+	uint16_t	stride;		// bitmap width in pixels
+	uint8_t		cell_w;
+	uint8_t		cell_h;
+} SpriteSheet;
+
+// Decoder of a RLE565 token stream, see lcd7735_rle565Take()
+typedef struct _rle565stream {
+	const uint16_t	*p;		// token being decoded
+	uint16_t	n;		// its pixels not taken yet
+	uint32_t	left;		// pixels of the image after it
+} RLE565Stream;
+
+// Counters of the glyph cache, see lcd7735_getGlyphCacheStats()
+typedef struct _glyphcachestats {
+	uint32_t	hits;
+	uint32_t	misses;
+	uint32_t	evictions;
+	uint16_t	glyphs;		// glyphs held
+	uint16_t	bytes;		// bytes held
+} GlyphCacheStats;
+
 // HW config
 extern void lcd7735_setup(void);
 extern void delay_ms(uint32_t delay_value);
+extern uint32_t get_tick_ms(void);
+extern void lcd7735_releaseBus(void);
+extern void lcd7735_acquireBus(void);
 
 // Initialization for ST7735B screens
 extern void lcd7735_initB(void);
@@ -116,6 +185,11 @@ extern uint8_t lcd7735_getHeight(void);
 
 extern void lcd7735_invertDisplay(const uint8_t mode);
 extern void lcd7735_setRotation(uint8_t m);
+extern uint8_t lcd7735_getRotation(void);
+extern void lcd7735_setScrollArea(uint8_t top, uint8_t bottom);
+extern void lcd7735_scrollTo(uint8_t offset);
+extern void lcd7735_setColorMode(uint8_t bits);
+extern uint8_t lcd7735_getColorMode(void);
 extern void lcd7735_fillScreen(uint16_t color);
 // Pass 8-bit (each) R,G,B, get back 16-bit packed color
 extern uint16_t lcd7735_Color565(uint8_t r, uint8_t g, uint8_t b);
@@ -125,17 +199,40 @@ extern void lcd7735_drawPixel(int16_t x, int16_t y, uint16_t color);
 extern void lcd7735_drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
 extern void lcd7735_setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
 extern void lcd7735_pushColor(uint16_t color); // CAUTION!! can't be used separately
+extern void lcd7735_pushColors(const uint16_t *data, uint16_t n); // CAUTION!! can't be used separately
+extern void lcd7735_pushColorRepeat(uint16_t color, uint16_t n); // CAUTION!! can't be used separately
+extern void lcd7735_blitBegin(int x, int y, int w, int h, uint8_t flags);
+extern void lcd7735_blitEnd(void);
+extern uint8_t lcd7735_bitmapFlags(uint8_t flags);
 extern void lcd7735_drawFastLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint16_t color);
 extern void lcd7735_drawRect(uint8_t x1,uint8_t y1,uint8_t x2,uint8_t y2, uint16_t color);
 extern void lcd7735_drawCircle(int16_t x, int16_t y, int radius, uint16_t color);
 extern void lcd7735_fillCircle(int16_t x, int16_t y, int radius, uint16_t color);
 extern void lcd7735_drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale);
+extern void lcd7735_drawRLE565(int x, int y, const uint16_t *rle);
+extern void lcd7735_rle565Begin(RLE565Stream *s, const uint16_t *tokens, uint32_t pixels);
+extern uint32_t lcd7735_rle565Take(RLE565Stream *s, uint32_t n, uint8_t send);
+extern void lcd7735_drawBitmapSwapped(int x, int y, int sx, int sy, const uint8_t *data);
+extern void lcd7735_drawBitmapIndexed(int x, int y, int sx, int sy, const uint8_t *data, const uint16_t *palette);
+extern void lcd7735_drawSubBitmap(int x, int y, bitmapdatatype data, int stride, int src_x, int src_y, int sx, int sy, uint8_t flags);
+extern void lcd7735_drawSprite(int x, int y, const SpriteSheet *sheet, int n, uint8_t flags);
 extern void lcd7735_drawBitmapRotate(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy);
 extern void lcd7735_setFont(uint8_t* font);
 extern void lcd7735_setTransparent(uint8_t s);
 extern void lcd7735_setForeground(uint16_t s);
 extern void lcd7735_setBackground(uint16_t s);
+extern uint16_t lcd7735_getForeground(void);
+extern uint16_t lcd7735_getBackground(void);
 extern void lcd7735_print(char *st, int x, int y, int deg);
+extern int lcd7735_textWidth(char *st);
+extern int lcd7735_textWidthN(const char *st, int n);
+extern uint8_t *lcd7735_getFont(void);
+extern uint8_t lcd7735_getFontHeight(void);
+extern void lcd7735_printLine(const char *st, int n, int x, int y, int w, int h, int indent, int extra);
+extern void lcd7735_textRow(const char *st, int n, int r, int indent, uint16_t *row, int w);
+extern void lcd7735_printScaled(char *st, int x, int y, int scale);
+extern void lcd7735_getGlyphCacheStats(GlyphCacheStats *st);
+extern void lcd7735_clearGlyphCache(const uint8_t *font);
 
 extern void lcd7735_init_screen(void *font,uint16_t fg, uint16_t bg, uint8_t orientation);
 extern void lcd7735_puts(char *str);
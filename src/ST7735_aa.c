@@ -0,0 +1,181 @@
+/*********************************************************************************
+Anti-aliased lines and circles for ST7735 driver
+
+Positions across the line are kept in 16.16 fixed point, the top 8 bits of
+the fraction f give the coverage of the two pixels, 255-f of the nearer one
+and f of the farther one, reduced to 0..32 like the alpha of ST7735_blend.
+
+Runs are chosen by the slope: when the line moves across by less than half a
+pixel per step, pixels of the same row (column for steep lines) are merged;
+otherwise the two pixels of every step form a run across the line, so a
+window never carries a single pixel of a diagonal.
+**********************************************************************************/
+
+#include "ST7735.h"
+#include "ST7735_aa.h"
+
+// Octant of the largest circle
+#define AA_RUN	(AA_MAX_RADIUS * 3 / 4)
+
+static uint16_t aa_line[AA_RUN];
+static uint8_t aa_near[AA_RUN], aa_far[AA_RUN];
+static uint16_t aa_ramp[33];
+static uint16_t aa_fg, aa_bg;
+static uint8_t aa_ramp_ok;
+
+// Colors of coverage 0..32 from bg to fg
+static void aaRamp(uint16_t fg, uint16_t bg) {
+	int i, r = bg >> 11, g = (bg >> 5) & 0x3F, b = bg & 0x1F;
+	int dr = (fg >> 11) - r, dg = ((fg >> 5) & 0x3F) - g, db = (fg & 0x1F) - b;
+
+	if (aa_ramp_ok && fg == aa_fg && bg == aa_bg)
+		return;
+	for (i = 0; i <= 32; i++)
+		aa_ramp[i] = (r + ((dr * i + 16) >> 5)) << 11 | (g + ((dg * i + 16) >> 5)) << 5 | (b + ((db * i + 16) >> 5));
+	aa_fg = fg;
+	aa_bg = bg;
+	aa_ramp_ok = 1;
+}
+
+// Coverage of the nearer and the farther pixel from the fraction of a 16.16 position
+#define nearCov(p)	((263 - (((p) >> 8) & 0xFF)) >> 3)
+#define farCov(p)	(((((p) >> 8) & 0xFF) + 4) >> 3)
+
+// Send n pixels of coverage cov at start, start+step, ... of row pos
+// (horizontal) or column pos. Uncovered ends and the part off the screen are
+// skipped, the rest goes through one window.
+static void aaRun(uint8_t horizontal, int pos, int start, int n, const uint8_t *cov, int step) {
+	int a = 0, b = n, lo, hi, j, k;
+
+	if (pos < 0 || pos >= (horizontal ? lcd7735_getHeight() : lcd7735_getWidth()))
+		return;
+	while (a < b && cov[a] == 0)
+		a++;
+	while (b > a && cov[b-1] == 0)
+		b--;
+	if (a == b)
+		return;
+	lo = step > 0 ? start + a : start - (b - 1);
+	hi = lo + (b - a) - 1;
+	j = lo < 0 ? -lo : 0;
+	if (hi >= (horizontal ? lcd7735_getWidth() : lcd7735_getHeight()))
+		hi = (horizontal ? lcd7735_getWidth() : lcd7735_getHeight()) - 1;
+	if (lo + j > hi)
+		return;
+	for (k = 0; lo + j <= hi; j++, k++)
+		aa_line[k] = aa_ramp[cov[step > 0 ? a + j : b - 1 - j]];
+	if (horizontal)
+		lcd7735_setAddrWindow(hi - k + 1, pos, hi, pos);
+	else
+		lcd7735_setAddrWindow(pos, hi - k + 1, pos, hi);
+	lcd7735_pushColors(aa_line, k);
+}
+
+// Line from x0,y0 to x1,y1 in color, blended against bg
+void lcd7735_aa_line(int x0, int y0, int x1, int y1, uint16_t color, uint16_t bg) {
+	uint8_t steep = (y1 > y0 ? y1 - y0 : y0 - y1) > (x1 > x0 ? x1 - x0 : x0 - x1), across;
+	uint8_t pair[2];
+	int32_t p, grad;
+	int t, x, n, start, yi;
+
+	// x is the major axis from here on
+	if (steep) {
+		t = x0; x0 = y0; y0 = t;
+		t = x1; x1 = y1; y1 = t;
+	}
+	if (x0 > x1) {
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+	grad = x1 > x0 ? (int32_t)(y1 - y0) * 65536 / (x1 - x0) : 0;
+	across = grad > 0x8000 || grad < -0x8000;
+	aaRamp(color, bg);
+
+	p = (int32_t)y0 * 65536;
+	if (across) {
+		for (x = x0; x <= x1; x++, p += grad) {
+			pair[0] = nearCov(p);
+			pair[1] = farCov(p);
+			aaRun(steep, x, p >> 16, 2, pair, 1);
+		}
+		return;
+	}
+	yi = p >> 16;
+	for (x = start = x0, n = 0; x <= x1; x++, p += grad) {
+		if ((p >> 16) != yi || n == AA_RUN) {
+			aaRun(!steep, yi, start, n, aa_near, 1);
+			aaRun(!steep, yi + 1, start, n, aa_far, 1);
+			yi = p >> 16;
+			start = x;
+			n = 0;
+		}
+		aa_near[n] = nearCov(p);
+		aa_far[n++] = farCov(p);
+	}
+	aaRun(!steep, yi, start, n, aa_near, 1);
+	aaRun(!steep, yi + 1, start, n, aa_far, 1);
+}
+
+static uint32_t isqrt(uint32_t v) {
+	uint32_t r = 0, b = 1UL << 30;
+
+	while (b > v)
+		b >>= 2;
+	while (b) {
+		if (v >= r + b) {
+			v -= r + b;
+			r = (r >> 1) + b;
+		} else
+			r >>= 1;
+		b >>= 2;
+	}
+	return r;
+}
+
+// Circle of radius r (up to AA_MAX_RADIUS) around cx,cy in color, blended against bg
+void lcd7735_aa_circle(int cx, int cy, int r, uint16_t color, uint16_t bg) {
+	static uint8_t aa_y[AA_RUN];
+	uint8_t pair[2], diag, a, d;
+	uint32_t y;
+	int n, xa, k, sx, sy;
+
+	if (r <= 0 || r > AA_MAX_RADIUS)
+		return;
+	aaRamp(color, bg);
+	// one octant from the top down to the diagonal, y in 24.8 fixed point,
+	// as the pixel row and its coverage
+	for (n = 0; n < AA_RUN; n++) {
+		y = isqrt((uint32_t)(r * r - n * n) << 16);
+		if ((uint32_t)n << 8 > y)
+			break;
+		aa_y[n] = y >> 8;
+		aa_near[n] = nearCov(y << 8);
+		aa_far[n] = farCov(y << 8);
+	}
+	// runs of equal rows, mirrored to all octants. Column 0 is its own
+	// mirror and a near pixel on the diagonal is its own transpose, both are
+	// sent once, so no pixel gets a second coverage over the first.
+	diag = aa_y[n - 1] == n - 1;
+	for (xa = 0; xa < n; xa += k) {
+		for (k = 1; xa + k < n && aa_y[xa + k] == aa_y[xa]; k++)
+			;
+		d = diag && xa + k == n;
+		for (sy = -1; sy <= 1; sy += 2)
+			for (sx = -1; sx <= 1; sx += 2) {
+				a = sx < 0 && xa == 0;
+				if (k == 1) {
+					if (a)
+						continue;
+					pair[0] = aa_near[xa];
+					pair[1] = aa_far[xa];
+					aaRun(0, cx + sx * xa, cy + sy * aa_y[xa], 2, pair, sy);
+					aaRun(1, cy + sx * xa, cx + sy * (aa_y[xa] + d), 2 - d, pair + d, sy);
+					continue;
+				}
+				aaRun(1, cy + sy * aa_y[xa], cx + sx * (xa + a), k - a, aa_near + xa + a, sx);
+				aaRun(1, cy + sy * (aa_y[xa] + 1), cx + sx * (xa + a), k - a, aa_far + xa + a, sx);
+				aaRun(0, cx + sy * aa_y[xa], cy + sx * (xa + a), k - a - d, aa_near + xa + a, sx);
+				aaRun(0, cx + sy * (aa_y[xa] + 1), cy + sx * (xa + a), k - a, aa_far + xa + a, sx);
+			}
+	}
+}
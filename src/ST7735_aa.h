@@ -0,0 +1,27 @@
+/*********************************************************************************
+Anti-aliased lines and circles for ST7735 driver
+
+Wu's algorithm: every step along the major axis covers two pixels across the
+line, weighted by the distance of the exact position to their centers. The
+panel can't be read back reliably, so the pixels are blended against a
+background color given by the caller, e.g. the face of a gauge. Drawing the
+same line in the background color erases it.
+
+Coverage is computed in fixed point and mapped to 33 colors from background
+to foreground, kept while the colors don't change. Pixels on the same row
+or column are sent as runs through one window each, pixels of no coverage
+are skipped so nearby drawings are kept.
+**********************************************************************************/
+
+#ifndef _ST7735_AA_H_
+#define _ST7735_AA_H_
+
+#include "ST7735.h"
+
+// Largest radius of lcd7735_aa_circle()
+#define AA_MAX_RADIUS	255
+
+extern void lcd7735_aa_line(int x0, int y0, int x1, int y1, uint16_t color, uint16_t bg);
+extern void lcd7735_aa_circle(int cx, int cy, int r, uint16_t color, uint16_t bg);
+
+#endif /* _ST7735_AA_H_ */
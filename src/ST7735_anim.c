@@ -0,0 +1,128 @@
+/*********************************************************************************
+Delta-frame animation player for ST7735 driver
+**********************************************************************************/
+
+#include <stddef.h>
+#include "ST7735.h"
+#include "ST7735_anim.h"
+
+#define anim_width(ap)		((ap)->anim[0])
+#define anim_frames(ap)		((ap)->anim[2])
+#define anim_period(ap)		((ap)->anim[3])
+#define anim_first(ap)		((ap)->anim + 4)
+
+// Draw the rectangles of frame f. They are laid out like lcd7735_drawBitmap()
+// lays out the whole frame, mirrored in landscape, and clipped to the screen.
+static void anim_drawFrame(AnimPlayer *ap, const uint16_t *f) {
+	uint16_t n = f[1] & ~ANIM_KEY;
+	const uint16_t *p = f + 2;
+	uint8_t flags = lcd7735_bitmapFlags(0);
+	RLE565Stream s;
+	uint32_t got;
+	int x, y, w, h, cx, cy, vw, vh, r;
+
+	while (n--) {
+		w = p[2] & ~ANIM_RLE;
+		h = p[3];
+		x = ap->x + (flags & BLIT_FLIP_H ? anim_width(ap) - p[0] - w : p[0]);
+		y = ap->y + p[1];
+
+		// visible part: columns cx..cx+vw-1 and rows cy..cy+vh-1 of the rectangle
+		cx = x < 0 ? -x : 0;
+		cy = y < 0 ? -y : 0;
+		vw = (x + w > lcd7735_getWidth() ? lcd7735_getWidth() - x : w) - cx;
+		vh = (y + h > lcd7735_getHeight() ? lcd7735_getHeight() - y : h) - cy;
+		// a mirrored window shows the columns from the other end of the rows
+		if (flags & BLIT_FLIP_H)
+			cx = w - cx - vw;
+		if (vw > 0 && vh > 0)
+			lcd7735_blitBegin(x < 0 ? 0 : x, y < 0 ? 0 : y, vw, vh, flags);
+
+		if (p[2] & ANIM_RLE) {
+			lcd7735_rle565Begin(&s, p + 4, (uint32_t)w * h);
+			got = 0;
+			if (vw == w && vh > 0) {
+				got += lcd7735_rle565Take(&s, (uint32_t)cy * w, 0);
+				got += lcd7735_rle565Take(&s, (uint32_t)vh * w, 1);
+			} else if (vw > 0 && vh > 0) {
+				got += lcd7735_rle565Take(&s, (uint32_t)cy * w, 0);
+				for (r = 0; r < vh; r++) {
+					got += lcd7735_rle565Take(&s, cx, 0);
+					got += lcd7735_rle565Take(&s, vw, 1);
+					got += lcd7735_rle565Take(&s, w - cx - vw, 0);
+				}
+			}
+			got += lcd7735_rle565Take(&s, (uint32_t)w * h - got, 0);
+			p = s.p;
+		} else {
+			if (vw > 0 && vh > 0)
+				for (r = cy; r < cy + vh; r++)
+					lcd7735_pushColors(p + 4 + r * w + cx, vw);
+			got = w * h;
+			p += 4 + w * h;
+		}
+		if (vw > 0 && vh > 0)
+			lcd7735_blitEnd();
+		// a corrupt rectangle ends the frame
+		if (got < (uint32_t)w * h)
+			return;
+	}
+}
+
+// Start playing anim at x,y, frame 0 is drawn by the next lcd7735_anim_update()
+void lcd7735_anim_start(AnimPlayer *ap, const uint16_t *anim, int16_t x, int16_t y, uint8_t loop) {
+	ap->anim = anim;
+	ap->frame = anim_first(ap);
+	ap->index = 0;
+	ap->x = x;
+	ap->y = y;
+	ap->loop = loop;
+	ap->start = get_tick_ms();
+	ap->drawn = 0;
+	ap->dropped = 0;
+}
+
+// Draw the frames that are due, call it as often as possible. Returns 0 once
+// the last frame of a non looping animation is on screen.
+uint8_t lcd7735_anim_update(AnimPlayer *ap) {
+	uint32_t target = (get_tick_ms() - ap->start) / anim_period(ap);
+	const uint16_t *p, *key = NULL;
+	uint16_t i, k = 0;
+
+	if (ap->index >= anim_frames(ap) && !ap->loop)
+		return 0;
+	if (target < ap->index)
+		return 1;
+	if (target >= anim_frames(ap)) {
+		if (ap->loop) {
+			// restart from the key frame 0
+			ap->start += target / anim_frames(ap) * anim_frames(ap) * anim_period(ap);
+			target %= anim_frames(ap);
+			ap->dropped += anim_frames(ap) - ap->index;
+			ap->index = 0;
+			ap->frame = anim_first(ap);
+		} else {
+			target = anim_frames(ap) - 1;
+		}
+	}
+
+	// the last key frame that is due makes the frames before it needless
+	for (i = ap->index + 1, p = ap->frame + ap->frame[0]; i <= target; i++, p += p[0]) {
+		if (p[1] & ANIM_KEY) {
+			key = p;
+			k = i;
+		}
+	}
+	if (key) {
+		ap->dropped += k - ap->index;
+		ap->index = k;
+		ap->frame = key;
+	}
+	while (ap->index <= target) {
+		anim_drawFrame(ap, ap->frame);
+		ap->frame += ap->frame[0];
+		ap->index++;
+		ap->drawn++;
+	}
+	return ap->loop || ap->index < anim_frames(ap);
+}
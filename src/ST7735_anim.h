@@ -0,0 +1,44 @@
+/*********************************************************************************
+Delta-frame animation player for ST7735 driver
+
+An animation is an array of 16-bit words:
+
+	width, height, frame count, frame period in ms, frames...
+
+Every frame starts with its size in words (these two words included) and the
+number of rectangles, ANIM_KEY is set if the frame doesn't depend on the
+previous one. Each rectangle is x, y, w, h relative to the animation origin,
+followed by w*h RGB565 pixels, or by RLE565 tokens if ANIM_RLE is set in w.
+Frame 0 is always a key frame. imgconv -a builds the container from a frame
+sequence, storing only the rectangles that changed.
+The frames are drawn like lcd7735_drawBitmap() draws them, mirrored in
+landscape, and clipped at the screen edges.
+
+The player is polled from the main loop and paced by get_tick_ms(). When it
+falls behind, late frames are drawn back to back, or skipped entirely if a key
+frame is due.
+**********************************************************************************/
+
+#ifndef _ST7735_ANIM_H_
+#define _ST7735_ANIM_H_
+
+#include "ST7735.h"
+
+#define ANIM_KEY	0x8000	// in rectangle count: frame is complete by itself
+#define ANIM_RLE	0x8000	// in rectangle width: pixels are RLE565 tokens
+
+typedef struct _animplayer {
+	const uint16_t	*anim;
+	const uint16_t	*frame;		// next frame to draw
+	uint16_t	index;		// its number
+	int16_t		x, y;		// animation origin on screen
+	uint8_t		loop;
+	uint32_t	start;		// tick at which frame 0 of this loop was due
+	uint16_t	drawn;		// frames drawn
+	uint16_t	dropped;	// frames skipped to catch up
+} AnimPlayer;
+
+extern void lcd7735_anim_start(AnimPlayer *ap, const uint16_t *anim, int16_t x, int16_t y, uint8_t loop);
+extern uint8_t lcd7735_anim_update(AnimPlayer *ap);
+
+#endif /* _ST7735_ANIM_H_ */
@@ -0,0 +1,197 @@
+/*********************************************************************************
+RGB565 alpha blending for ST7735 driver
+
+Two pixels p0 (low half) and p1 (high half) of a word are split by mask in two
+words that leave every channel room to be multiplied by a 5-bit alpha:
+
+	s & RB_G		p1 green at 21, p0 red at 11, p0 blue at 0
+	(s >> 5) & (G_RB >> 5)	p1 red at 22, p1 blue at 11, p0 green at 0
+
+so a pair costs four multiplies, s * a + d * (32 - a) for each split word. A
+single pixel is spread over a word the same way, with green in the high half.
+Alpha maps blend pixel pairs of equal alpha as a word and skip or copy fully
+transparent and opaque pairs. On Cortex-M4 the color key compares both pixels
+of a word at once with the SIMD instructions of the DSP extension.
+**********************************************************************************/
+
+#include "ST7735.h"
+#include "ST7735_blend.h"
+
+#define RB_G	0x07E0F81F
+#define G_RB	0xF81F07E0
+
+// 8-bit alpha to 0..32
+#define alpha5(a)	(((uint32_t)(a) + 4) >> 3)
+
+// 4-bit alpha to 0..32
+static const uint8_t alpha4to5[16] = {
+	0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+};
+
+// Blend both pixels of s over the ones of d, a is 0..32
+static inline uint32_t blend2(uint32_t s, uint32_t d, uint32_t a) {
+	uint32_t lo, hi;
+
+	lo = ((s & RB_G) * a + (d & RB_G) * (32 - a)) >> 5;
+	hi = ((s >> 5) & (G_RB >> 5)) * a + ((d >> 5) & (G_RB >> 5)) * (32 - a);
+	return (lo & RB_G) | (hi & G_RB);
+}
+
+static inline uint16_t blend1(uint32_t s, uint32_t d, uint32_t a) {
+	s = (s | (s << 16)) & RB_G;
+	d = (d | (d << 16)) & RB_G;
+	d = ((s * a + d * (32 - a)) >> 5) & RB_G;
+	return d | (d >> 16);
+}
+
+// Rows are read and written as halfwords, the compiler merges them to words
+// when it can prove the alignment and a row of the bitmap needn't be aligned.
+#define load2(p)	((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 16))
+#define store2(p, v)	do { (p)[0] = (uint16_t)(v); (p)[1] = (uint16_t)((v) >> 16); } while (0)
+
+// dst = src over dst with a global alpha
+void lcd7735_blend(uint16_t *dst, const uint16_t *src, uint16_t n, uint8_t alpha) {
+	uint32_t a = alpha5(alpha), v;
+
+	if (a == 0)
+		return;
+	if (a == 32) {
+		while (n--)
+			*dst++ = *src++;
+		return;
+	}
+	for (; n >= 2; n -= 2, src += 2, dst += 2) {
+		v = blend2(load2(src), load2(dst), a);
+		store2(dst, v);
+	}
+	if (n)
+		*dst = blend1(*src, *dst, a);
+}
+
+// Blend one pixel pair with alphas a0 and a1
+static inline void blendPair(uint16_t *dst, const uint16_t *src, uint32_t a0, uint32_t a1) {
+	uint32_t v;
+
+	if (a0 == a1) {
+		if (a0 == 32) {
+			dst[0] = src[0];
+			dst[1] = src[1];
+		} else if (a0) {
+			v = blend2(load2(src), load2(dst), a0);
+			store2(dst, v);
+		}
+	} else {
+		dst[0] = blend1(src[0], dst[0], a0);
+		dst[1] = blend1(src[1], dst[1], a1);
+	}
+}
+
+// dst = src over dst with one 8-bit alpha per pixel
+void lcd7735_blendAlpha8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint16_t n) {
+	for (; n >= 2; n -= 2, src += 2, dst += 2, alpha += 2)
+		blendPair(dst, src, alpha5(alpha[0]), alpha5(alpha[1]));
+	if (n)
+		*dst = blend1(*src, *dst, alpha5(*alpha));
+}
+
+// dst = src over dst with 4-bit alphas, src[0] goes with nibble "first" of the map
+void lcd7735_blendAlpha4(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t first, uint16_t n) {
+	alpha += first >> 1;
+	if ((first & 1) && n) {
+		*dst = blend1(*src++, *dst, alpha4to5[*alpha++ & 0x0F]);
+		dst++;
+		n--;
+	}
+	for (; n >= 2; n -= 2, src += 2, dst += 2, alpha++)
+		blendPair(dst, src, alpha4to5[*alpha >> 4], alpha4to5[*alpha & 0x0F]);
+	if (n)
+		*dst = blend1(*src, *dst, alpha4to5[*alpha >> 4]);
+}
+
+// dst = src except where src is the key color
+void lcd7735_blendKey(uint16_t *dst, const uint16_t *src, uint16_t n, uint16_t key) {
+	uint32_t k = key | ((uint32_t)key << 16), s, d;
+
+	for (; n >= 2; n -= 2, src += 2, dst += 2) {
+		s = load2(src);
+#if defined(__CORTEX_M) && (__CORTEX_M >= 0x04)
+		// GE flags are set for the halfwords that differ from the key
+		__USUB16(s ^ k, 0x00010001);
+		d = __SEL(s, load2(dst));
+		store2(dst, d);
+#else
+		d = s ^ k;
+		if ((d & 0xFFFF) && (d >> 16)) {
+			store2(dst, s);
+		} else if (d) {
+			if (d & 0xFFFF)
+				dst[0] = (uint16_t)s;
+			else
+				dst[1] = (uint16_t)(s >> 16);
+		}
+#endif
+	}
+	if (n && *src != key)
+		*dst = *src;
+}
+
+// Draw the bitmap blended over its background, in every orientation the
+// bitmap's top row is drawn at the top, and in landscape it is mirrored like
+// lcd7735_drawBitmap(). bg is stepped by bg_stride per row.
+void lcd7735_drawBitmapBlend(int x, int y, int sx, int sy, bitmapdatatype data, const Blend *b) {
+	static uint16_t line[ST7735_TFTHEIGHT];
+	int cx = 0, cy = 0, w = sx, h = sy, r, i;
+	const uint16_t *src;
+	uint32_t pos;
+	uint8_t flags = lcd7735_bitmapFlags(0);
+
+	// visible part: columns cx..cx+w-1 and rows cy..cy+h-1 of the bitmap
+	if (x < 0) {
+		cx = -x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		cy = -y;
+		h += y;
+		y = 0;
+	}
+	if (w > lcd7735_getWidth() - x)
+		w = lcd7735_getWidth() - x;
+	if (h > lcd7735_getHeight() - y)
+		h = lcd7735_getHeight() - y;
+	if (w <= 0 || h <= 0)
+		return;
+	// a mirrored window shows the columns from the other end of the rows
+	if (flags & BLIT_FLIP_H)
+		cx = sx - cx - w;
+
+	lcd7735_blitBegin(x, y, w, h, flags);
+	for (r = cy; r < cy + h; r++) {
+		if (b->bg) {
+			src = b->bg + (uint32_t)r * b->bg_stride + cx;
+			for (i = 0; i < w; i++)
+				line[i] = src[i];
+		} else {
+			for (i = 0; i < w; i++)
+				line[i] = b->bg_color;
+		}
+		pos = (uint32_t)r * sx + cx;
+		switch (b->mode) {
+		case BLEND_ALPHA8:
+			lcd7735_blendAlpha8(line, data + pos, b->map + pos, w);
+			break;
+		case BLEND_ALPHA4:
+			lcd7735_blendAlpha4(line, data + pos, b->map, pos, w);
+			break;
+		case BLEND_KEY:
+			lcd7735_blendKey(line, data + pos, w, b->key);
+			break;
+		default:
+			lcd7735_blend(line, data + pos, w, b->alpha);
+			break;
+		}
+		lcd7735_pushColors(line, w);
+	}
+	lcd7735_blitEnd();
+}
@@ -0,0 +1,44 @@
+/*********************************************************************************
+RGB565 alpha blending for ST7735 driver
+
+The panel can't be read back reliably, so blending happens in RAM: the kernels
+mix a source row into a destination row, and lcd7735_drawBitmapBlend() mixes a
+bitmap over a background bitmap or color and streams the result to the panel.
+
+Alpha runs from 0 (destination kept) to 255 (source drawn) and is reduced to
+5 bits, the precision of the red and blue channels. Alpha maps hold one value
+per source pixel, 8-bit maps one byte per pixel, 4-bit maps two pixels per
+byte with the high nibble first. Color keyed blits copy every source pixel
+except the ones of the key color.
+
+The kernels handle two pixels per 32-bit word, see ST7735_blend.c.
+**********************************************************************************/
+
+#ifndef _ST7735_BLEND_H_
+#define _ST7735_BLEND_H_
+
+#include "ST7735.h"
+
+// Blend modes
+#define BLEND_ALPHA	0	// global alpha
+#define BLEND_ALPHA8	1	// 8-bit alpha map
+#define BLEND_ALPHA4	2	// 4-bit alpha map
+#define BLEND_KEY	3	// color key
+
+typedef struct _blend {
+	uint8_t		mode;
+	uint8_t		alpha;		// BLEND_ALPHA: opacity of the bitmap
+	uint16_t	key;		// BLEND_KEY: transparent color
+	const uint8_t	*map;		// BLEND_ALPHA8/4: sx*sy alpha values
+	bitmapdatatype	bg;		// background pixel under the bitmap's top left one, NULL for bg_color
+	uint16_t	bg_stride;	// background width in pixels
+	uint16_t	bg_color;
+} Blend;
+
+extern void lcd7735_blend(uint16_t *dst, const uint16_t *src, uint16_t n, uint8_t alpha);
+extern void lcd7735_blendAlpha8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint16_t n);
+extern void lcd7735_blendAlpha4(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t first, uint16_t n);
+extern void lcd7735_blendKey(uint16_t *dst, const uint16_t *src, uint16_t n, uint16_t key);
+extern void lcd7735_drawBitmapBlend(int x, int y, int sx, int sy, bitmapdatatype data, const Blend *b);
+
+#endif /* _ST7735_BLEND_H_ */
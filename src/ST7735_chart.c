@@ -0,0 +1,126 @@
+/*********************************************************************************
+Strip chart for ST7735 driver
+
+Columns are drawn where the hardware scroll maps them, like the lines of the
+tile map: the column c of the chart is the screen line top+c, drawn at
+top+((c+offset) % band).
+**********************************************************************************/
+
+#include "ST7735.h"
+#include "ST7735_chart.h"
+
+static const uint16_t chart_colors[4] = { ST7735_YELLOW, ST7735_CYAN, ST7735_MAGENTA, ST7735_GREEN };
+
+// One column, the screen height in landscape
+static uint16_t chart_col[ST7735_TFTWIDTH];
+
+#define sc_landscape()		(lcd7735_getRotation() == LANDSAPE || lcd7735_getRotation() == LANDSAPE_FLIP)
+#define sc_band(sc)			(ST7735_TFTHEIGHT - (sc)->top - (sc)->bottom)
+#define sc_sample(sc, n, t)	((sc)->samples[((n) % CHART_COLUMNS) * CHART_MAX_TRACES + (t)])
+
+// Value range, at least one step wide without overflowing at the top
+static void sc_range(StripChart *sc, int16_t min, int16_t max) {
+	if (max <= min) {
+		if (min == INT16_MAX)
+			min--;
+		max = min + 1;
+	}
+	sc->min = min;
+	sc->max = max;
+}
+
+// Pixel row of a value, the maximum on top
+static int sc_row(StripChart *sc, int16_t v) {
+	int32_t r = (int32_t)(sc->max - v) * (ST7735_TFTWIDTH - 1) / (sc->max - sc->min);
+
+	if (r < 0)
+		return 0;
+	if (r > ST7735_TFTWIDTH - 1)
+		return ST7735_TFTWIDTH - 1;
+	return r;
+}
+
+// Draw the column of sample n, an empty one for n < 0, at chart column c.
+// Each trace is joined to its previous sample by a vertical segment.
+static void sc_drawColumn(StripChart *sc, int32_t n, uint8_t c) {
+	uint8_t x = sc->top + (c + sc->offset) % sc_band(sc);
+	uint16_t fill = n >= 0 && sc->grid_x && n % sc->grid_x == 0 ? sc->grid : sc->bg;
+	int i, t, y, lo, hi;
+
+	for (i = 0; i < ST7735_TFTWIDTH; i++)
+		chart_col[i] = fill;
+	if (sc->grid_y)
+		for (i = ST7735_TFTWIDTH - 1; i >= 0; i -= sc->grid_y)
+			chart_col[i] = sc->grid;
+	for (t = 0; n >= 0 && t < sc->ntraces; t++) {
+		lo = hi = sc_row(sc, sc_sample(sc, n, t));
+		if (n > 0 && sc->count - n < CHART_COLUMNS) {
+			y = sc_row(sc, sc_sample(sc, n - 1, t));
+			if (y < lo)
+				lo = y;
+			if (y > hi)
+				hi = y;
+		}
+		for (i = lo; i <= hi; i++)
+			chart_col[i] = sc->color[t];
+	}
+	lcd7735_setAddrWindow(x, 0, x, ST7735_TFTWIDTH - 1);
+	lcd7735_pushColors(chart_col, ST7735_TFTWIDTH);
+}
+
+// Set up a chart of ntraces traces showing values from min to max
+void lcd7735_chart_init(StripChart *sc, uint8_t ntraces, int16_t min, int16_t max) {
+	uint8_t i;
+
+	sc->ntraces = ntraces > CHART_MAX_TRACES ? CHART_MAX_TRACES : ntraces;
+	sc_range(sc, min, max);
+	for (i = 0; i < CHART_MAX_TRACES; i++)
+		sc->color[i] = chart_colors[i % 4];
+	sc->bg = ST7735_BLACK;
+	sc->grid = 0x2104;
+	sc->grid_x = 20;
+	sc->grid_y = 32;
+	sc->top = 0;
+	sc->bottom = 0;
+	sc->offset = 0;
+	sc->count = 0;
+}
+
+// Take over the screen between top and bottom fixed columns and draw the
+// chart, the panel is turned to landscape if it isn't
+void lcd7735_chart_show(StripChart *sc, uint8_t top, uint8_t bottom) {
+	if (!sc_landscape())
+		lcd7735_setRotation(LANDSAPE);
+	sc->top = top;
+	sc->bottom = bottom;
+	sc->offset = 0;
+	lcd7735_setScrollArea(top, bottom);
+	lcd7735_scrollTo(0);
+	lcd7735_chart_redraw(sc);
+}
+
+void lcd7735_chart_redraw(StripChart *sc) {
+	uint8_t band = sc_band(sc), c;
+
+	for (c = 0; c < band; c++)
+		sc_drawColumn(sc, (int32_t)sc->count - band + c, c);
+}
+
+// Add one value per trace: the chart scrolls left by a column and only the
+// new column on the right is drawn
+void lcd7735_chart_add(StripChart *sc, const int16_t *values) {
+	uint8_t band = sc_band(sc), t;
+
+	for (t = 0; t < sc->ntraces; t++)
+		sc_sample(sc, sc->count, t) = values[t];
+	sc->count++;
+	sc->offset = (sc->offset + 1) % band;
+	lcd7735_scrollTo(sc->offset);
+	sc_drawColumn(sc, sc->count - 1, band - 1);
+}
+
+// Change the value range and redraw the kept samples
+void lcd7735_chart_setRange(StripChart *sc, int16_t min, int16_t max) {
+	sc_range(sc, min, max);
+	lcd7735_chart_redraw(sc);
+}
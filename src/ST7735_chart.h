@@ -0,0 +1,48 @@
+/*********************************************************************************
+Strip chart for ST7735 driver
+
+A rolling plot of up to CHART_MAX_TRACES traces, one column per sample, with
+time running along the screen X axis in landscape. A new sample scrolls the
+panel by one line with the hardware vertical scroll and draws only the new
+column: its grid and the segment of every trace from the previous sample. The
+samples of the visible columns are kept in a ring buffer, so the chart can be
+redrawn at any time, e.g. after a change of the value range.
+
+The panel scrolls complete lines, so the chart takes the whole screen height
+between fixed columns on the left and the right, which can hold readouts.
+**********************************************************************************/
+
+#ifndef _ST7735_CHART_H_
+#define _ST7735_CHART_H_
+
+#include "ST7735.h"
+
+#ifndef CHART_MAX_TRACES
+#define CHART_MAX_TRACES	4
+#endif
+
+// Samples kept, one per column of the widest chart
+#define CHART_COLUMNS		ST7735_TFTHEIGHT
+
+typedef struct _stripchart {
+	uint8_t		ntraces;
+	int16_t		min, max;	// values at the bottom and the top
+	uint16_t	color[CHART_MAX_TRACES];
+	uint16_t	bg;
+	uint16_t	grid;
+	uint8_t		grid_x;		// samples between vertical grid lines, 0 for none
+	uint8_t		grid_y;		// pixels between horizontal grid lines from the bottom, 0 for none
+	uint8_t		top;		// fixed columns before and after the chart
+	uint8_t		bottom;
+	uint8_t		offset;		// current hardware scroll offset
+	uint32_t	count;		// samples added
+	int16_t		samples[CHART_COLUMNS * CHART_MAX_TRACES];
+} StripChart;
+
+extern void lcd7735_chart_init(StripChart *sc, uint8_t ntraces, int16_t min, int16_t max);
+extern void lcd7735_chart_show(StripChart *sc, uint8_t top, uint8_t bottom);
+extern void lcd7735_chart_add(StripChart *sc, const int16_t *values);
+extern void lcd7735_chart_setRange(StripChart *sc, int16_t min, int16_t max);
+extern void lcd7735_chart_redraw(StripChart *sc);
+
+#endif /* _ST7735_CHART_H_ */
@@ -0,0 +1,187 @@
+/*********************************************************************************
+Color conversion blits for ST7735 driver
+
+A pixel is converted as a word 0x00RRGGBB and packed to RGB565 with three
+shifts. Dithering first scales every channel to the range of its levels,
+v - v/32 for 5 bits and v - v/64 for 6 bits (31/32 and 63/64 of 255, that
+truncation maps to the nearest of 31 and 63 steps instead of flooring), then
+adds a threshold of 0..7 or 0..3. Both work on the whole word and can't carry
+from one channel into the next. The row kernels convert four pixels per
+iteration, a row of the threshold matrix, so the thresholds stay in registers.
+**********************************************************************************/
+
+#include "ST7735.h"
+#include "ST7735_convert.h"
+
+#define DW(b)	((uint32_t)(b) / 2 << 16 | (uint32_t)(b) / 4 << 8 | (uint32_t)(b) / 2)
+
+// 4x4 Bayer matrix as thresholds for 5-6-5 bits
+static const uint32_t dither[4][4] = {
+	{ DW(0), DW(8), DW(2), DW(10) },
+	{ DW(12), DW(4), DW(14), DW(6) },
+	{ DW(3), DW(11), DW(1), DW(9) },
+	{ DW(15), DW(7), DW(13), DW(5) }
+};
+
+static const uint32_t no_dither[4] = { 0, 0, 0, 0 };
+
+static inline uint16_t pack565(uint32_t c) {
+	return ((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F);
+}
+
+// Masks of v/32 and v/64 of a word when dithering
+#define DITHER_M5	0x070007
+#define DITHER_M6	0x000300
+
+static inline uint32_t dith(uint32_t c, uint32_t t, uint32_t m5, uint32_t m6) {
+	return c - (((c >> 5) & m5) | ((c >> 6) & m6)) + t;
+}
+
+static inline uint32_t clamp8(int v) {
+	return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+#define rgb(s)	((uint32_t)(s)[0] << 16 | (uint32_t)(s)[1] << 8 | (s)[2])
+
+static void rgb888Row(uint16_t *dst, const uint8_t *s, uint16_t n, const uint32_t *th) {
+	uint32_t t0 = th[0], t1 = th[1], t2 = th[2], t3 = th[3], m5 = th[4], m6 = th[5];
+	uint16_t i;
+
+	for (; n >= 4; n -= 4, s += 12, dst += 4) {
+		dst[0] = pack565(dith(rgb(s), t0, m5, m6));
+		dst[1] = pack565(dith(rgb(s + 3), t1, m5, m6));
+		dst[2] = pack565(dith(rgb(s + 6), t2, m5, m6));
+		dst[3] = pack565(dith(rgb(s + 9), t3, m5, m6));
+	}
+	for (i = 0; i < n; i++, s += 3)
+		dst[i] = pack565(dith(rgb(s), th[i], m5, m6));
+}
+
+static void xrgbRow(uint16_t *dst, const uint32_t *s, uint16_t n, const uint32_t *th) {
+	uint32_t t0 = th[0], t1 = th[1], t2 = th[2], t3 = th[3], m5 = th[4], m6 = th[5];
+	uint16_t i;
+
+	for (; n >= 4; n -= 4, s += 4, dst += 4) {
+		dst[0] = pack565(dith(s[0], t0, m5, m6));
+		dst[1] = pack565(dith(s[1], t1, m5, m6));
+		dst[2] = pack565(dith(s[2], t2, m5, m6));
+		dst[3] = pack565(dith(s[3], t3, m5, m6));
+	}
+	for (i = 0; i < n; i++)
+		dst[i] = pack565(dith(s[i], th[i], m5, m6));
+}
+
+// BT.601, Y 16..235 and U, V 16..240, in 8.8 fixed point. The chroma terms
+// are shared by the two pixels of a pair.
+typedef struct _yuvchroma {
+	int		rv, gu, bu;
+} YuvChroma;
+
+static inline void yuvChroma(YuvChroma *ch, int u, int v) {
+	ch->rv = 409 * (v - 128) + 128;
+	ch->gu = -100 * (u - 128) - 208 * (v - 128) + 128;
+	ch->bu = 516 * (u - 128) + 128;
+}
+
+static inline uint32_t yuvPixel(const YuvChroma *ch, int y) {
+	int yy = 298 * (y - 16);
+
+	return clamp8((yy + ch->rv) >> 8) << 16 | clamp8((yy + ch->gu) >> 8) << 8 | clamp8((yy + ch->bu) >> 8);
+}
+
+static void yuyvRow(uint16_t *dst, const uint8_t *s, uint16_t n, const uint32_t *th) {
+	uint32_t t0 = th[0], t1 = th[1], t2 = th[2], t3 = th[3], m5 = th[4], m6 = th[5];
+	YuvChroma ch;
+
+	for (; n >= 4; n -= 4, s += 8, dst += 4) {
+		yuvChroma(&ch, s[1], s[3]);
+		dst[0] = pack565(dith(yuvPixel(&ch, s[0]), t0, m5, m6));
+		dst[1] = pack565(dith(yuvPixel(&ch, s[2]), t1, m5, m6));
+		yuvChroma(&ch, s[5], s[7]);
+		dst[2] = pack565(dith(yuvPixel(&ch, s[4]), t2, m5, m6));
+		dst[3] = pack565(dith(yuvPixel(&ch, s[6]), t3, m5, m6));
+	}
+	if (n) {
+		yuvChroma(&ch, s[1], s[3]);
+		dst[0] = pack565(dith(yuvPixel(&ch, s[0]), t0, m5, m6));
+		if (n > 1)
+			dst[1] = pack565(dith(yuvPixel(&ch, s[2]), t1, m5, m6));
+		if (n > 2) {
+			yuvChroma(&ch, s[5], s[7]);
+			dst[2] = pack565(dith(yuvPixel(&ch, s[4]), t2, m5, m6));
+		}
+	}
+}
+
+// Convert n pixels of format to RGB565. With CONVERT_DITHER the first pixel
+// gets the threshold of screen position x,y. YUYV rows start on a pair,
+// XRGB8888 rows on a word.
+void lcd7735_convertRow(uint16_t *dst, const void *src, uint16_t n, uint8_t format, int x, int y) {
+	const uint32_t *t = (format & CONVERT_DITHER) ? dither[y & 3] : no_dither;
+	uint32_t th[6];		// thresholds of x..x+3 and the masks
+	uint8_t i;
+
+	for (i = 0; i < 4; i++)
+		th[i] = t[(x + i) & 3];
+	th[4] = (format & CONVERT_DITHER) ? DITHER_M5 : 0;
+	th[5] = (format & CONVERT_DITHER) ? DITHER_M6 : 0;
+	switch (format & ~CONVERT_DITHER) {
+	case PIXEL_XRGB8888:
+		xrgbRow(dst, (const uint32_t *)src, n, th);
+		break;
+	case PIXEL_YUYV:
+		yuyvRow(dst, (const uint8_t *)src, n, th);
+		break;
+	default:
+		rgb888Row(dst, (const uint8_t *)src, n, th);
+		break;
+	}
+}
+
+// Draw an sx x sy image of format with its top left corner at x,y, rows
+// stride bytes apart (0 for packed rows). Every row is converted while it is
+// streamed into one window, the part outside of the screen is skipped. In
+// landscape the image is mirrored like lcd7735_drawBitmap().
+void lcd7735_drawBitmapRGB(int x, int y, int sx, int sy, const void *data, uint32_t stride, uint8_t format) {
+	static uint16_t line[ST7735_TFTHEIGHT + 1];
+	uint8_t bpp = (format & ~CONVERT_DITHER) == PIXEL_XRGB8888 ? 4 : (format & ~CONVERT_DITHER) == PIXEL_YUYV ? 2 : 3;
+	int cx = 0, cy = 0, w = sx, h = sy, r, odd, dx;
+	const uint8_t *row;
+	uint8_t flags = lcd7735_bitmapFlags(0);
+
+	if (stride == 0)
+		stride = (uint32_t)sx * bpp;
+	// visible part: columns cx..cx+w-1 and rows cy..cy+h-1 of the image
+	if (x < 0) {
+		cx = -x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		cy = -y;
+		h += y;
+		y = 0;
+	}
+	if (w > lcd7735_getWidth() - x)
+		w = lcd7735_getWidth() - x;
+	if (h > lcd7735_getHeight() - y)
+		h = lcd7735_getHeight() - y;
+	if (w <= 0 || h <= 0)
+		return;
+	// a mirrored window shows the columns from the other end of the rows
+	if (flags & BLIT_FLIP_H)
+		cx = sx - cx - w;
+
+	// a YUYV row is converted from the start of the pair of its first pixel
+	odd = bpp == 2 ? cx & 1 : 0;
+	// dither position of that pixel. A mirrored row runs to the left, it
+	// takes the thresholds of the negated columns, the mirrored pattern.
+	dx = (flags & BLIT_FLIP_H) ? -(x + w - 1 + odd) : x - odd;
+	lcd7735_blitBegin(x, y, w, h, flags);
+	for (r = 0; r < h; r++) {
+		row = (const uint8_t *)data + (uint32_t)(cy + r) * stride + (cx - odd) * bpp;
+		lcd7735_convertRow(line, row, w + odd, format, dx, y + r);
+		lcd7735_pushColors(line + odd, w);
+	}
+	lcd7735_blitEnd();
+}
@@ -0,0 +1,30 @@
+/*********************************************************************************
+Color conversion blits for ST7735 driver
+
+Draws RGB888, XRGB8888 and YUV 4:2:2 (YUYV) images, e.g. camera frames or
+decoded pictures, converting every row to RGB565 while it is streamed, so no
+RGB565 copy of the image is needed.
+
+Plain conversion truncates the 8-bit channels like lcd7735_Color565(). With
+CONVERT_DITHER a 4x4 ordered (Bayer) threshold is added to every channel
+first, which turns the banding of smooth gradients into a fine pattern. The
+pattern is fixed to the screen, so moving or redrawn images don't shimmer.
+**********************************************************************************/
+
+#ifndef _ST7735_CONVERT_H_
+#define _ST7735_CONVERT_H_
+
+#include "ST7735.h"
+
+// Source formats
+#define PIXEL_RGB888	0	// 3 bytes per pixel: R, G, B
+#define PIXEL_XRGB8888	1	// 32-bit words 0xXXRRGGBB
+#define PIXEL_YUYV	2	// Y0, U, Y1, V for every two pixels, BT.601 with Y in 16..235
+
+// Added to the format
+#define CONVERT_DITHER	0x80
+
+extern void lcd7735_convertRow(uint16_t *dst, const void *src, uint16_t n, uint8_t format, int x, int y);
+extern void lcd7735_drawBitmapRGB(int x, int y, int sx, int sy, const void *data, uint32_t stride, uint8_t format);
+
+#endif /* _ST7735_CONVERT_H_ */
@@ -0,0 +1,292 @@
+/*********************************************************************************
+Gradient and pattern fills for ST7735 driver
+
+A gradient position t runs from 0 at c0 to 65536 at c1. The color channels
+are kept as 5-6-5 levels << 16, so t times the level difference stays within
+32 bits and a linear gradient steps all three by a constant per pixel. The
+dither threshold is added to the fraction bits before they are dropped, a
+level can't go past the end colors since the clamped ends aren't dithered.
+**********************************************************************************/
+
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_fill.h"
+
+// 4x4 Bayer matrix as fractions of a level
+#define BT(b)	((b) * 4096 + 2048)
+static const int32_t bayer[4][4] = {
+	{ BT(0), BT(8), BT(2), BT(10) },
+	{ BT(12), BT(4), BT(14), BT(6) },
+	{ BT(3), BT(11), BT(1), BT(9) },
+	{ BT(15), BT(7), BT(13), BT(5) }
+};
+static const int32_t half[4] = { 0x8000, 0x8000, 0x8000, 0x8000 };
+
+static uint16_t fill_line[ST7735_TFTHEIGHT];
+
+#define red5(c)		((c) >> 11)
+#define green6(c)	(((c) >> 5) & 0x3F)
+#define blue5(c)	((c) & 0x1F)
+
+void lcd7735_fill_solid(Fill *f, uint16_t c) {
+	f->type = FILL_SOLID;
+	f->c0 = f->c1 = c;
+}
+
+// Linear gradient from c0 at x0,y0 to c1 at x1,y1, pixels before and after the
+// ends have the end colors
+void lcd7735_fill_linear(Fill *f, int x0, int y0, uint16_t c0, int x1, int y1, uint16_t c1) {
+	f->type = FILL_LINEAR;
+	f->x0 = x0;
+	f->y0 = y0;
+	f->x1 = x1;
+	f->y1 = y1;
+	f->c0 = c0;
+	f->c1 = c1;
+}
+
+// Radial gradient from c0 at cx,cy to c1 at distance r and beyond
+void lcd7735_fill_radial(Fill *f, int cx, int cy, int r, uint16_t c0, uint16_t c1) {
+	f->type = FILL_RADIAL;
+	f->x0 = cx;
+	f->y0 = cy;
+	f->r = r > 0 ? r : 1;
+	f->c0 = c0;
+	f->c1 = c1;
+}
+
+// 8x8 pattern of 8 bytes, bits 1 are drawn in fg and bits 0 in bg
+void lcd7735_fill_pattern(Fill *f, const uint8_t *pattern, uint16_t fg, uint16_t bg) {
+	f->type = FILL_PATTERN;
+	f->pattern = pattern;
+	f->c0 = fg;
+	f->c1 = bg;
+}
+
+// 8x8 tile of RGB565 pixels
+void lcd7735_fill_tile(Fill *f, const uint16_t *tile) {
+	f->type = FILL_TILE;
+	f->tile = tile;
+}
+
+// Color of position t (0..65536 exclusive) from the channels at t, rounded or dithered
+#define rampColor(r, g, b, th)	((uint16_t)(((r) + (th)) >> 16 << 11 | ((g) + (th)) >> 16 << 5 | ((b) + (th)) >> 16))
+
+static void linearSpan(const Fill *f, int x, int y, int n, uint16_t *row) {
+	int32_t dx = f->x1 - f->x0, dy = f->y1 - f->y0;
+	int32_t len2 = dx * dx + dy * dy, tx, t, r, g, b, dr, dg, db;
+	int32_t lr = red5(f->c0), lg = green6(f->c0), lb = blue5(f->c0);
+	int32_t er = red5(f->c1) - lr, eg = green6(f->c1) - lg, eb = blue5(f->c1) - lb;
+	const int32_t *th = (f->type & FILL_DITHER) ? bayer[y & 3] : half;
+	int i;
+
+	if (len2 == 0) {
+		for (i = 0; i < n; i++)
+			row[i] = f->c1;
+		return;
+	}
+	// t of x,y and its step along the row
+	tx = dx * 65536 / len2;
+	t = (x - f->x0) * tx + (y - f->y0) * (dy * 65536 / len2);
+	r = (lr << 16) + t * er;
+	g = (lg << 16) + t * eg;
+	b = (lb << 16) + t * eb;
+	dr = tx * er;
+	dg = tx * eg;
+	db = tx * eb;
+	for (i = 0; i < n; i++, x++) {
+		if (t <= 0)
+			row[i] = f->c0;
+		else if (t >= 0x10000)
+			row[i] = f->c1;
+		else
+			row[i] = rampColor(r, g, b, th[x & 3]);
+		t += tx;
+		r += dr;
+		g += dg;
+		b += db;
+	}
+}
+
+static void radialSpan(const Fill *f, int x, int y, int n, uint16_t *row) {
+	int32_t lr = red5(f->c0), lg = green6(f->c0), lb = blue5(f->c0);
+	int32_t er = red5(f->c1) - lr, eg = green6(f->c1) - lg, eb = blue5(f->c1) - lb;
+	int32_t dx = x - f->x0, dy = y - f->y0, d2 = dx * dx + dy * dy, t;
+	const int32_t *th = (f->type & FILL_DITHER) ? bayer[y & 3] : half;
+	float k = 65536.0f / f->r;
+	int i;
+
+	for (i = 0; i < n; i++, x++) {
+		t = (int32_t)(sqrtf((float)d2) * k);
+		if (t >= 0x10000)
+			row[i] = f->c1;
+		else
+			row[i] = rampColor((lr << 16) + t * er, (lg << 16) + t * eg, (lb << 16) + t * eb, th[x & 3]);
+		// (dx+1)^2 = dx^2 + 2dx + 1
+		d2 += 2 * dx + 1;
+		dx++;
+	}
+}
+
+// Generate n pixels of row y starting at x
+void lcd7735_fill_span(const Fill *f, int x, int y, int n, uint16_t *row) {
+	uint8_t bits;
+	const uint16_t *tile;
+	int i;
+
+	switch (f->type & ~FILL_DITHER) {
+	case FILL_LINEAR:
+		linearSpan(f, x, y, n, row);
+		break;
+	case FILL_RADIAL:
+		radialSpan(f, x, y, n, row);
+		break;
+	case FILL_PATTERN:
+		bits = f->pattern[y & 7];
+		for (i = 0; i < n; i++, x++)
+			row[i] = (bits << (x & 7)) & 0x80 ? f->c0 : f->c1;
+		break;
+	case FILL_TILE:
+		tile = f->tile + (y & 7) * 8;
+		for (i = 0; i < n; i++, x++)
+			row[i] = tile[x & 7];
+		break;
+	default:
+		for (i = 0; i < n; i++)
+			row[i] = f->c0;
+		break;
+	}
+}
+
+// Fill columns x0..x1 of row y, clipped to the screen
+void lcd7735_fill_hline(const Fill *f, int x0, int x1, int y) {
+	if (y < 0 || y >= lcd7735_getHeight())
+		return;
+	if (x0 < 0)
+		x0 = 0;
+	if (x1 >= lcd7735_getWidth())
+		x1 = lcd7735_getWidth() - 1;
+	if (x1 < x0)
+		return;
+	lcd7735_fill_span(f, x0, y, x1 - x0 + 1, fill_line);
+	lcd7735_setAddrWindow(x0, y, x1, y);
+	lcd7735_pushColors(fill_line, x1 - x0 + 1);
+}
+
+// Fill a w x h rectangle at x,y, all rows are streamed into one window
+void lcd7735_fill_rect(const Fill *f, int x, int y, int w, int h) {
+	int r;
+
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (w > lcd7735_getWidth() - x)
+		w = lcd7735_getWidth() - x;
+	if (h > lcd7735_getHeight() - y)
+		h = lcd7735_getHeight() - y;
+	if (w <= 0 || h <= 0)
+		return;
+
+	lcd7735_setAddrWindow(x, y, x+w-1, y+h-1);
+	for (r = y; r < y + h; r++) {
+		lcd7735_fill_span(f, x, r, w, fill_line);
+		lcd7735_pushColors(fill_line, w);
+	}
+}
+
+// Fill the circle of pixels within r of cx,cy
+void lcd7735_fill_circle(const Fill *f, int cx, int cy, int r) {
+	int32_t r2 = (int32_t)r * r;
+	int dx = 0, dy;
+
+	if (r < 0)
+		return;
+	// rows from the middle outwards, the half width only shrinks
+	for (dx = r, dy = 0; dy <= r; dy++) {
+		while ((int32_t)dx * dx + (int32_t)dy * dy > r2)
+			dx--;
+		lcd7735_fill_hline(f, cx - dx, cx + dx, cy + dy);
+		if (dy)
+			lcd7735_fill_hline(f, cx - dx, cx + dx, cy - dy);
+	}
+}
+
+// Fill a polygon of n points, xy holds x and y of each. Pixels whose centers
+// are inside by the nonzero winding rule are filled, so polygons sharing an
+// edge don't overlap.
+void lcd7735_fill_polygon(const Fill *f, const int16_t *xy, int n) {
+	int32_t xs[FILL_MAX_POINTS], x;
+	int8_t dir[FILL_MAX_POINTS], d;
+	int ymin, ymax, y, i, j, k, cnt, wind, xa, xb;
+	const int16_t *a, *b;
+
+	if (n < 3)
+		return;
+	if (n > FILL_MAX_POINTS)
+		n = FILL_MAX_POINTS;
+	ymin = ymax = xy[1];
+	for (i = 1; i < n; i++) {
+		if (xy[2*i+1] < ymin)
+			ymin = xy[2*i+1];
+		if (xy[2*i+1] > ymax)
+			ymax = xy[2*i+1];
+	}
+	if (ymin < 0)
+		ymin = 0;
+	if (ymax > lcd7735_getHeight())
+		ymax = lcd7735_getHeight();
+
+	for (y = ymin; y < ymax; y++) {
+		// crossings of the row center with the edges, x in 24.8 fixed point,
+		// sorted by insertion
+		cnt = 0;
+		for (i = 0; i < n; i++) {
+			a = xy + 2*i;
+			b = xy + 2*((i + 1) % n);
+			if (a[1] == b[1])
+				continue;
+			if (a[1] < b[1]) {
+				if (y < a[1] || y >= b[1])
+					continue;
+				d = 1;
+			} else {
+				if (y < b[1] || y >= a[1])
+					continue;
+				d = -1;
+				// from the top end, so an edge shared by two polygons
+				// rounds the same in both
+				a = b;
+				b = xy + 2*i;
+			}
+			x = (int32_t)a[0] * 256 + (int32_t)(2*(y - a[1]) + 1) * (b[0] - a[0]) * 128 / (b[1] - a[1]);
+			for (k = cnt; k > 0 && xs[k-1] > x; k--) {
+				xs[k] = xs[k-1];
+				dir[k] = dir[k-1];
+			}
+			xs[k] = x;
+			dir[k] = d;
+			cnt++;
+		}
+		// spans between crossings with a nonzero winding, pixel j is filled
+		// when its center j+0.5 lies in [xs[i], xs[i+1])
+		wind = 0;
+		for (i = 0; i < cnt - 1; i++) {
+			wind += dir[i];
+			if (wind == 0)
+				continue;
+			j = i;
+			while (i < cnt - 1 && wind != 0) {
+				i++;
+				wind += dir[i];
+			}
+			xa = (xs[j] - 128 + 255) >> 8;
+			xb = ((xs[i] - 128 + 255) >> 8) - 1;
+			lcd7735_fill_hline(f, xa, xb, y);
+		}
+	}
+}
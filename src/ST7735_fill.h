@@ -0,0 +1,59 @@
+/*********************************************************************************
+Gradient and pattern fills for ST7735 driver
+
+A Fill describes the color of every screen pixel: solid, a linear gradient
+between two points at any angle, a radial gradient around a center, or a
+repeating 8x8 pattern (two colored bits or RGB565 pixels). Fills are anchored
+to the screen, so shapes filled with the same Fill line up.
+
+Rectangles are filled through one window. Circles and polygons are filled
+span by span, a window per span. Every span is generated in a row buffer:
+linear gradients step their color channels incrementally in 16.16 fixed point,
+radial ones look the color up from the distance. Gradients are interpolated in
+5-6-5 levels, with FILL_DITHER a 4x4 ordered dither spreads the fractions.
+**********************************************************************************/
+
+#ifndef _ST7735_FILL_H_
+#define _ST7735_FILL_H_
+
+#include "ST7735.h"
+
+// Fill types
+#define FILL_SOLID	0
+#define FILL_LINEAR	1
+#define FILL_RADIAL	2
+#define FILL_PATTERN	3
+#define FILL_TILE	4
+
+// Added to a gradient type
+#define FILL_DITHER	0x80
+
+// Vertices of lcd7735_fill_polygon()
+#ifndef FILL_MAX_POINTS
+#define FILL_MAX_POINTS	32
+#endif
+
+typedef struct _fill {
+	uint8_t		type;
+	uint16_t	c0;		// solid color, color at the start of a gradient, pattern bits 1
+	uint16_t	c1;		// color at the end of a gradient, pattern bits 0
+	int16_t		x0, y0;		// linear: start, radial: center
+	int16_t		x1, y1;		// linear: end
+	int16_t		r;		// radial: radius
+	const uint8_t	*pattern;	// 8 rows, the high bit on the left
+	const uint16_t	*tile;		// 8x8 RGB565 pixels, row by row
+} Fill;
+
+extern void lcd7735_fill_solid(Fill *f, uint16_t c);
+extern void lcd7735_fill_linear(Fill *f, int x0, int y0, uint16_t c0, int x1, int y1, uint16_t c1);
+extern void lcd7735_fill_radial(Fill *f, int cx, int cy, int r, uint16_t c0, uint16_t c1);
+extern void lcd7735_fill_pattern(Fill *f, const uint8_t *pattern, uint16_t fg, uint16_t bg);
+extern void lcd7735_fill_tile(Fill *f, const uint16_t *tile);
+
+extern void lcd7735_fill_span(const Fill *f, int x, int y, int n, uint16_t *row);
+extern void lcd7735_fill_hline(const Fill *f, int x0, int x1, int y);
+extern void lcd7735_fill_rect(const Fill *f, int x, int y, int w, int h);
+extern void lcd7735_fill_circle(const Fill *f, int cx, int cy, int r);
+extern void lcd7735_fill_polygon(const Fill *f, const int16_t *xy, int n);
+
+#endif /* _ST7735_FILL_H_ */
@@ -0,0 +1,169 @@
+/*********************************************************************************
+Heat map renderer for ST7735 driver
+
+Interpolated values carry 4 fraction bits, so that a 16-bit value mixed with
+8-bit weights stays within 32 bits.
+**********************************************************************************/
+
+#include "ST7735.h"
+#include "ST7735_heatmap.h"
+
+// Palette stops: position, red, green, blue, the last one at 255
+static const uint8_t iron_stops[] = {
+	0, 0, 0, 0,
+	48, 32, 0, 112,
+	96, 150, 0, 150,
+	144, 220, 40, 60,
+	192, 250, 140, 0,
+	232, 255, 220, 40,
+	255, 255, 255, 255
+};
+static const uint8_t rainbow_stops[] = {
+	0, 0, 0, 255,
+	64, 0, 255, 255,
+	128, 0, 255, 0,
+	192, 255, 255, 0,
+	255, 255, 0, 0
+};
+static const uint8_t gray_stops[] = {
+	0, 0, 0, 0,
+	255, 255, 255, 255
+};
+
+// Output row, and the grid column and weight of each output column
+static uint16_t hm_line[ST7735_TFTHEIGHT];
+static uint8_t hm_col[ST7735_TFTHEIGHT];
+static uint16_t hm_frac[ST7735_TFTHEIGHT];
+// Two grid rows mixed for the current output row, values << 4
+static int32_t hm_row[HEATMAP_MAX_COLS];
+
+#define hm_value(hm, i)	((hm)->bits == 16 ? ((const int16_t *)(hm)->grid)[i] : ((const uint8_t *)(hm)->grid)[i])
+
+// Fill a palette of 256 colors, kind is HEATMAP_IRON, HEATMAP_RAINBOW or HEATMAP_GRAY
+void lcd7735_heatmap_palette(uint16_t *palette, uint8_t kind) {
+	const uint8_t *s = kind == HEATMAP_IRON ? iron_stops : kind == HEATMAP_RAINBOW ? rainbow_stops : gray_stops;
+	int i, f, d;
+
+	for (i = 0; i < 256; i++) {
+		while (s[4] < i)
+			s += 4;
+		d = s[4] - s[0];
+		f = i - s[0];
+		palette[i] = lcd7735_Color565(s[1] + (s[5] - s[1]) * f / d,
+									  s[2] + (s[6] - s[2]) * f / d,
+									  s[3] + (s[7] - s[3]) * f / d);
+	}
+}
+
+// Set up a heat map of a gw x gh grid (2..HEATMAP_MAX_COLS columns, at least
+// 2 rows) of 8 or 16 bit values, auto-ranging
+void lcd7735_heatmap_init(HeatMap *hm, const void *grid, uint8_t gw, uint8_t gh, uint8_t bits, const uint16_t *palette) {
+	hm->grid = grid;
+	hm->gw = gw > HEATMAP_MAX_COLS ? HEATMAP_MAX_COLS : gw;
+	hm->gh = gh;
+	hm->bits = bits == 16 ? 16 : 8;
+	hm->autorange = 1;
+	hm->palette = palette;
+	hm->lo = 0;
+	hm->hi = 1;
+}
+
+// Value range, at least one step wide without overflowing at the top
+static void hm_range(HeatMap *hm, int32_t lo, int32_t hi) {
+	if (hi <= lo) {
+		if (lo == INT16_MAX)
+			lo--;
+		hi = lo + 1;
+	}
+	hm->lo = lo;
+	hm->hi = hi;
+}
+
+// Map lo..hi onto the palette from now on, auto-ranging is turned off
+void lcd7735_heatmap_setRange(HeatMap *hm, int16_t lo, int16_t hi) {
+	hm->autorange = 0;
+	hm_range(hm, lo, hi);
+}
+
+// Grid position of the center of output pixel i of n, as index and weight of
+// the next grid value (0..256)
+static void hm_map(int i, int n, int size, uint8_t *idx, uint16_t *frac) {
+	int32_t step = ((int32_t)size << 16) / n;
+	int32_t pos = i * step + step / 2 - 0x8000;
+
+	if (pos < 0)
+		pos = 0;
+	if (pos >= (int32_t)(size - 1) << 16) {
+		*idx = size - 2;
+		*frac = 256;
+		return;
+	}
+	*idx = pos >> 16;
+	*frac = (pos >> 8) & 0xFF;
+}
+
+// Draw the grid scaled to w x h at x,y. With auto-ranging the lowest and the
+// highest value of the grid become the ends of the palette, hm->lo/hi.
+void lcd7735_heatmap_draw(HeatMap *hm, int x, int y, int w, int h) {
+	int cx = 0, cy = 0, vw = w, vh = h, gw = hm->gw, r, i, c, a;
+	int32_t lo, hi, p, v;
+	uint32_t m;
+	uint16_t f;
+	uint8_t gy;
+
+	if (gw < 2 || hm->gh < 2 || w <= 0 || h <= 0)
+		return;
+	if (hm->autorange) {
+		lo = hi = hm_value(hm, 0);
+		for (i = 1; i < gw * hm->gh; i++) {
+			v = hm_value(hm, i);
+			if (v < lo)
+				lo = v;
+			if (v > hi)
+				hi = v;
+		}
+		hm_range(hm, lo, hi);
+	}
+	lo = (int32_t)hm->lo << 4;
+	hi = (int32_t)hm->hi << 4;
+	m = (255UL << 16) / (hm->hi - hm->lo);
+
+	// visible part: columns cx..cx+vw-1 and rows cy..cy+vh-1 of the output
+	if (x < 0) {
+		cx = -x;
+		vw += x;
+		x = 0;
+	}
+	if (y < 0) {
+		cy = -y;
+		vh += y;
+		y = 0;
+	}
+	if (vw > lcd7735_getWidth() - x)
+		vw = lcd7735_getWidth() - x;
+	if (vh > lcd7735_getHeight() - y)
+		vh = lcd7735_getHeight() - y;
+	if (vw <= 0 || vh <= 0)
+		return;
+
+	for (i = 0; i < vw; i++)
+		hm_map(cx + i, w, gw, &hm_col[i], &hm_frac[i]);
+	lcd7735_setAddrWindow(x, y, x+vw-1, y+vh-1);
+	for (r = cy; r < cy + vh; r++) {
+		hm_map(r, h, hm->gh, &gy, &f);
+		a = gy * gw;
+		for (c = 0; c < gw; c++)
+			hm_row[c] = (hm_value(hm, a + c) * (256 - f) + hm_value(hm, a + gw + c) * f) >> 4;
+		for (i = 0; i < vw; i++) {
+			c = hm_col[i];
+			p = (hm_row[c] * (256 - hm_frac[i]) + hm_row[c + 1] * hm_frac[i]) >> 8;
+			if (p <= lo)
+				hm_line[i] = hm->palette[0];
+			else if (p >= hi)
+				hm_line[i] = hm->palette[255];
+			else
+				hm_line[i] = hm->palette[((uint32_t)(p - lo) * m) >> 20];
+		}
+		lcd7735_pushColors(hm_line, vw);
+	}
+}
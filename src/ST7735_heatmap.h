@@ -0,0 +1,45 @@
+/*********************************************************************************
+Heat map renderer for ST7735 driver
+
+Draws a small grid of scalar values, e.g. the 32x24 pixels of a thermal
+sensor, scaled to any size with bilinear interpolation and colored through a
+256-entry RGB565 palette. The grid is 8-bit unsigned or 16-bit signed. The
+value range mapped onto the palette is fixed or found in every frame
+(auto-ranging).
+
+Every output row is interpolated in fixed point straight from the grid: the
+two grid rows around it are mixed once per row, then every pixel mixes two
+neighbors of that and looks its color up. The rows are streamed into one
+window, no frame buffer is used.
+**********************************************************************************/
+
+#ifndef _ST7735_HEATMAP_H_
+#define _ST7735_HEATMAP_H_
+
+#include "ST7735.h"
+
+// Largest grid width
+#ifndef HEATMAP_MAX_COLS
+#define HEATMAP_MAX_COLS	64
+#endif
+
+// Palettes of lcd7735_heatmap_palette()
+#define HEATMAP_IRON		0
+#define HEATMAP_RAINBOW		1
+#define HEATMAP_GRAY		2
+
+typedef struct _heatmap {
+	const void	*grid;		// gw*gh values, row by row
+	uint8_t		gw, gh;
+	uint8_t		bits;		// 8: uint8_t values, 16: int16_t values
+	uint8_t		autorange;
+	const uint16_t	*palette;	// 256 colors, low values first
+	int16_t		lo, hi;		// values mapped to the first and the last color
+} HeatMap;
+
+extern void lcd7735_heatmap_palette(uint16_t *palette, uint8_t kind);
+extern void lcd7735_heatmap_init(HeatMap *hm, const void *grid, uint8_t gw, uint8_t gh, uint8_t bits, const uint16_t *palette);
+extern void lcd7735_heatmap_setRange(HeatMap *hm, int16_t lo, int16_t hi);
+extern void lcd7735_heatmap_draw(HeatMap *hm, int x, int y, int w, int h);
+
+#endif /* _ST7735_HEATMAP_H_ */
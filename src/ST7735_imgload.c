@@ -0,0 +1,324 @@
+/*********************************************************************************
+Image loader for ST7735 driver
+
+Sector reads go through two buffers, the least recently used one is replaced.
+Header fields and pixels crossing a sector boundary need both, and a row never
+causes a sector to be read twice. When the block device shares the SPI bus the
+panel chip select is released for the time of the read, the address window of
+the panel survives and the row continues after the bus is taken back.
+**********************************************************************************/
+
+#include <string.h>
+#include "ST7735.h"
+#include "ST7735_imgload.h"
+
+// pixel layouts
+#define PX_BGR24	0
+#define PX_BGRX32	1
+#define PX_RGB565	2
+#define PX_RGB555	3
+#define PX_RGB24	4	// PPM
+
+// pixels converted and sent at once
+#define IMG_CHUNK	32
+
+typedef struct _imginfo {
+	uint32_t	data;		// file offset of the first row
+	uint32_t	row;		// bytes per row in the file
+	uint16_t	w, h;
+	uint16_t	maxval;		// PPM sample range
+	uint8_t		fmt;
+	uint8_t		bpp;		// bytes per pixel
+	uint8_t		bottomup;
+} ImgInfo;
+
+typedef struct _imgcache {
+	const BlockDevice	*dev;
+	uint32_t	base;		// first sector of the image
+	uint32_t	sector[2];
+	uint8_t		valid[2];
+	uint8_t		last;		// buffer used most recently
+	uint8_t		err;
+	uint8_t		buf[2][IMG_SECTOR_SIZE];
+} ImgCache;
+
+static ImgCache cache;
+
+static void il_open(const BlockDevice *dev, uint32_t sector) {
+	cache.dev = dev;
+	cache.base = sector;
+	cache.valid[0] = 0;
+	cache.valid[1] = 0;
+	cache.err = 0;
+}
+
+// Buffer holding file offset pos
+static uint8_t *il_sector(uint32_t pos) {
+	uint32_t s = cache.base + pos / IMG_SECTOR_SIZE;
+	uint8_t i;
+
+	for (i = 0; i < 2; i++)
+		if (cache.valid[i] && cache.sector[i] == s)
+			break;
+	if (i == 2) {
+		i = !cache.last;
+		if (cache.dev->shared_bus)
+			lcd7735_releaseBus();
+		cache.valid[i] = cache.dev->read(cache.dev->ctx, s, cache.buf[i]) == 0;
+		if (cache.dev->shared_bus)
+			lcd7735_acquireBus();
+		if (!cache.valid[i]) {
+			cache.err = IMG_ERR_READ;
+			memset(cache.buf[i], 0, IMG_SECTOR_SIZE);
+		}
+		cache.sector[i] = s;
+	}
+	cache.last = i;
+	return cache.buf[i];
+}
+
+// Copy n bytes from file offset pos
+static void il_read(uint32_t pos, uint8_t *dst, uint16_t n) {
+	uint16_t off, part;
+
+	while (n) {
+		off = pos % IMG_SECTOR_SIZE;
+		part = IMG_SECTOR_SIZE - off;
+		if (part > n)
+			part = n;
+		memcpy(dst, il_sector(pos) + off, part);
+		pos += part;
+		dst += part;
+		n -= part;
+	}
+}
+
+static uint16_t il_le16(const uint8_t *p) {
+	return p[0] | (p[1] << 8);
+}
+
+static uint32_t il_le32(const uint8_t *p) {
+	return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int il_parseBMP(ImgInfo *ii) {
+	uint8_t hdr[66];
+	uint32_t hsize, comp, rmask = 0, gmask = 0;
+	int32_t w, h;
+	uint16_t bits;
+
+	il_read(0, hdr, sizeof(hdr));
+	hsize = il_le32(hdr + 14);
+	if (hsize < 40)
+		return IMG_ERR_UNSUPPORTED;	// OS/2 header
+	ii->data = il_le32(hdr + 10);
+	w = il_le32(hdr + 18);
+	h = il_le32(hdr + 22);
+	bits = il_le16(hdr + 28);
+	comp = il_le32(hdr + 30);
+	if (w <= 0 || w > 0xFFFF || h == 0 || h > 0xFFFF || h < -0xFFFF)
+		return IMG_ERR_FORMAT;
+	ii->w = w;
+	ii->bottomup = h > 0;
+	ii->h = h > 0 ? h : -h;
+	ii->row = ((uint32_t)w * bits + 31) / 32 * 4;
+
+	if (comp == 3) {
+		// BI_BITFIELDS, the masks follow the 40 bytes header
+		rmask = il_le32(hdr + 54);
+		gmask = il_le32(hdr + 58);
+	} else if (comp != 0) {
+		return IMG_ERR_UNSUPPORTED;	// RLE, JPEG or PNG
+	}
+	switch (bits) {
+	case 16:
+		ii->bpp = 2;
+		if (comp == 0 || (rmask == 0x7C00 && gmask == 0x03E0))
+			ii->fmt = PX_RGB555;
+		else if (rmask == 0xF800 && gmask == 0x07E0)
+			ii->fmt = PX_RGB565;
+		else
+			return IMG_ERR_UNSUPPORTED;
+		break;
+	case 24:
+		ii->bpp = 3;
+		ii->fmt = PX_BGR24;
+		break;
+	case 32:
+		if (comp == 3 && (rmask != 0x00FF0000 || gmask != 0x0000FF00))
+			return IMG_ERR_UNSUPPORTED;
+		ii->bpp = 4;
+		ii->fmt = PX_BGRX32;
+		break;
+	default:
+		return IMG_ERR_UNSUPPORTED;	// palette images
+	}
+	return IMG_OK;
+}
+
+// Next decimal number of a PPM header, comments are skipped
+static uint32_t il_ppmNumber(uint32_t *pos) {
+	uint32_t v = 0;
+	uint8_t c;
+
+	for (;;) {
+		il_read((*pos)++, &c, 1);
+		if (c == '#') {
+			do {
+				il_read((*pos)++, &c, 1);
+			} while (c != '\n' && c != '\r' && !cache.err);
+		} else if (c >= '0' && c <= '9') {
+			break;
+		} else if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+			return 0;
+		}
+		if (cache.err)
+			return 0;
+	}
+	while (c >= '0' && c <= '9' && v < 0x10000) {
+		v = v * 10 + c - '0';
+		il_read((*pos)++, &c, 1);
+	}
+	return v;	// the single whitespace after the number is consumed
+}
+
+static int il_parsePPM(ImgInfo *ii) {
+	uint32_t pos = 2, w, h, maxval;
+
+	w = il_ppmNumber(&pos);
+	h = il_ppmNumber(&pos);
+	maxval = il_ppmNumber(&pos);
+	if (w == 0 || w > 0xFFFF || h == 0 || h > 0xFFFF || maxval == 0)
+		return IMG_ERR_FORMAT;
+	if (maxval > 255)
+		return IMG_ERR_UNSUPPORTED;
+	ii->data = pos;
+	ii->w = w;
+	ii->h = h;
+	ii->maxval = maxval;
+	ii->bpp = 3;
+	ii->row = w * 3;
+	ii->fmt = PX_RGB24;
+	ii->bottomup = 0;
+	return IMG_OK;
+}
+
+static int il_parse(const BlockDevice *dev, uint32_t sector, ImgInfo *ii) {
+	uint8_t magic[2];
+	int res;
+
+	il_open(dev, sector);
+	il_read(0, magic, 2);
+	if (magic[0] == 'B' && magic[1] == 'M')
+		res = il_parseBMP(ii);
+	else if (magic[0] == 'P' && magic[1] == '6')
+		res = il_parsePPM(ii);
+	else
+		res = IMG_ERR_FORMAT;
+	return cache.err ? cache.err : res;
+}
+
+int lcd7735_imageSize(const BlockDevice *dev, uint32_t sector, uint16_t *w, uint16_t *h) {
+	ImgInfo ii;
+	int res = il_parse(dev, sector, &ii);
+
+	if (res == IMG_OK) {
+		*w = ii.w;
+		*h = ii.h;
+	}
+	return res;
+}
+
+// Convert n pixels of layout fmt to RGB565
+static void il_convert(const ImgInfo *ii, const uint8_t *src, uint16_t *dst, uint8_t n) {
+	uint16_t c;
+	uint8_t r, g, b;
+
+	while (n--) {
+		switch (ii->fmt) {
+		case PX_RGB565:
+			*dst++ = il_le16(src);
+			src += 2;
+			continue;
+		case PX_RGB555:
+			c = il_le16(src);
+			*dst++ = ((c & 0x7FE0) << 1) | ((c >> 4) & 0x20) | (c & 0x1F);
+			src += 2;
+			continue;
+		case PX_RGB24:
+			r = src[0];
+			g = src[1];
+			b = src[2];
+			if (ii->maxval != 255) {
+				r = r * 255 / ii->maxval;
+				g = g * 255 / ii->maxval;
+				b = b * 255 / ii->maxval;
+			}
+			break;
+		default:
+			b = src[0];
+			g = src[1];
+			r = src[2];
+			break;
+		}
+		*dst++ = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+		src += ii->bpp;
+	}
+}
+
+// Draw the image stored from sector on with its top left corner at x,y, the
+// part outside of the screen is skipped.
+int lcd7735_loadImage(const BlockDevice *dev, uint32_t sector, int x, int y) {
+	uint8_t raw[IMG_CHUNK * 4];
+	uint16_t px[IMG_CHUNK];
+	ImgInfo ii;
+	int cx = 0, cy = 0, w, h, r, i, n, fr;
+	uint32_t pos;
+	uint8_t flags;
+	int res;
+
+	res = il_parse(dev, sector, &ii);
+	if (res != IMG_OK)
+		return res;
+
+	// visible part: columns cx..cx+w-1 and rows cy..cy+h-1 of the image
+	w = ii.w;
+	h = ii.h;
+	if (x < 0) {
+		cx = -x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		cy = -y;
+		h += y;
+		y = 0;
+	}
+	if (w > lcd7735_getWidth() - x)
+		w = lcd7735_getWidth() - x;
+	if (h > lcd7735_getHeight() - y)
+		h = lcd7735_getHeight() - y;
+	if (w <= 0 || h <= 0)
+		return IMG_OK;
+
+	// mirrored in landscape like lcd7735_drawBitmap(), the visible columns
+	// are then taken from the other end of the rows
+	flags = lcd7735_bitmapFlags(ii.bottomup ? BLIT_FLIP_V : 0);
+	if (flags & BLIT_FLIP_H)
+		cx = ii.w - cx - w;
+	lcd7735_blitBegin(x, y, w, h, flags);
+	for (r = 0; r < h; r++) {
+		// rows in file order, the window flip puts bottom-up rows in place
+		fr = ii.bottomup ? ii.h - cy - h + r : cy + r;
+		pos = ii.data + fr * ii.row + cx * ii.bpp;
+		for (i = 0; i < w; i += n) {
+			n = w - i > IMG_CHUNK ? IMG_CHUNK : w - i;
+			il_read(pos, raw, n * ii.bpp);
+			il_convert(&ii, raw, px, n);
+			lcd7735_pushColors(px, n);
+			pos += n * ii.bpp;
+		}
+	}
+	lcd7735_blitEnd();
+	return cache.err;
+}
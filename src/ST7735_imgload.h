@@ -0,0 +1,38 @@
+/*********************************************************************************
+Image loader for ST7735 driver
+
+Draws uncompressed BMP (16, 24 or 32 bits per pixel, bottom-up or top-down) and
+binary PPM (P6) images stored on a block device, e.g. the SD card of the
+Adafruit breakout. The file is read sector by sector through a cache of two
+sectors and converted to RGB565 row by row, all rows go to one address window.
+Bottom-up bitmaps are written with a vertical flip of the panel scan, so the
+file is always read forward.
+
+The image has to be stored in consecutive sectors starting at a known sector,
+finding it in a file system is left to the caller.
+**********************************************************************************/
+
+#ifndef _ST7735_IMGLOAD_H_
+#define _ST7735_IMGLOAD_H_
+
+#include "ST7735.h"
+
+#define IMG_SECTOR_SIZE		512
+
+// Results of lcd7735_loadImage() and lcd7735_imageSize()
+#define IMG_OK			0
+#define IMG_ERR_READ		1	// block device error
+#define IMG_ERR_FORMAT		2	// not a BMP or PPM image
+#define IMG_ERR_UNSUPPORTED	3	// compressed, palette or 16-bit PPM
+
+typedef struct _blockdevice {
+	// read one IMG_SECTOR_SIZE bytes sector to buf, return 0 on success
+	uint8_t		(*read)(void *ctx, uint32_t sector, uint8_t *buf);
+	void		*ctx;
+	uint8_t		shared_bus;	// device is on the panel SPI bus, release the panel around reads
+} BlockDevice;
+
+extern int lcd7735_imageSize(const BlockDevice *dev, uint32_t sector, uint16_t *w, uint16_t *h);
+extern int lcd7735_loadImage(const BlockDevice *dev, uint32_t sector, int x, int y);
+
+#endif /* _ST7735_IMGLOAD_H_ */
@@ -0,0 +1,529 @@
+/*********************************************************************************
+Baseline JPEG decoder for ST7735 driver
+
+The IDCT is a separable matrix product evaluated only for the output samples
+of the selected scale: at 1/2 the 4x4 lowest frequencies give 4x4 pixels, at
+1/8 only the DC coefficient is used. Chroma is upsampled by replication.
+**********************************************************************************/
+
+#include <string.h>
+#include "ST7735.h"
+#include "ST7735_jpeg.h"
+
+#define M_SOF0	0xC0
+#define M_SOF1	0xC1
+#define M_DHT	0xC4
+#define M_RST0	0xD0
+#define M_SOI	0xD8
+#define M_EOI	0xD9
+#define M_SOS	0xDA
+#define M_DQT	0xDB
+#define M_DRI	0xDD
+
+// natural order index of the n-th coefficient in zigzag order
+static const uint8_t zigzag[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// 4096*cos(k*pi/16)
+static const int16_t cos32[32] = {
+	 4096,  4017,  3784,  3406,  2896,  2276,  1567,   799,
+	    0,  -799, -1567, -2276, -2896, -3406, -3784, -4017,
+	-4096, -4017, -3784, -3406, -2896, -2276, -1567,  -799,
+	    0,   799,  1567,  2276,  2896,  3406,  3784,  4017
+};
+
+uint16_t lcd7735_jpeg_memInput(void *ctx, uint8_t *buf, uint16_t len) {
+	JpegMem *m = (JpegMem *)ctx;
+
+	if (len > m->size - m->pos)
+		len = m->size - m->pos;
+	if (buf)
+		memcpy(buf, m->data + m->pos, len);
+	m->pos += len;
+	return len;
+}
+
+/******************** input ********************/
+
+static uint8_t jd_byte(JpegDec *jd) {
+	if (jd->inpos == jd->inlen) {
+		jd->inpos = 0;
+		jd->inlen = jd->input(jd->ctx, jd->inbuf, JPEG_INBUF);
+		if (jd->inlen == 0) {
+			jd->err = JPEG_ERR_INPUT;
+			return 0;
+		}
+	}
+	return jd->inbuf[jd->inpos++];
+}
+
+static uint16_t jd_word(JpegDec *jd) {
+	uint16_t w = jd_byte(jd) << 8;
+	return w | jd_byte(jd);
+}
+
+static void jd_skip(JpegDec *jd, uint16_t n) {
+	uint16_t left = jd->inlen - jd->inpos;
+
+	if (n <= left) {
+		jd->inpos += n;
+		return;
+	}
+	jd->inpos = jd->inlen;
+	for (n -= left; n; n -= left) {
+		left = jd->input(jd->ctx, NULL, n);
+		if (left == 0) {
+			jd->err = JPEG_ERR_INPUT;
+			return;
+		}
+	}
+}
+
+/******************** headers ********************/
+
+static int jd_readDQT(JpegDec *jd, uint16_t len) {
+	uint8_t pq, i;
+
+	while (len >= 65 && !jd->err) {
+		pq = jd_byte(jd);
+		if ((pq & 0x0F) > 3)
+			return JPEG_ERR_FORMAT;
+		if (pq >> 4) {
+			if (len < 129)
+				return JPEG_ERR_FORMAT;
+			for (i = 0; i < 64; i++)
+				jd->qt[pq & 3][i] = jd_word(jd);
+			len -= 129;
+		} else {
+			for (i = 0; i < 64; i++)
+				jd->qt[pq & 3][i] = jd_byte(jd);
+			len -= 65;
+		}
+	}
+	return len ? JPEG_ERR_FORMAT : JPEG_OK;
+}
+
+static int jd_readDHT(JpegDec *jd, uint16_t len) {
+	uint8_t tc, bits[17];
+	uint16_t i, n, code;
+	JpegHuff *h;
+
+	while (len >= 17 && !jd->err) {
+		tc = jd_byte(jd);
+		if ((tc >> 4) > 1 || (tc & 0x0F) > 1)
+			return JPEG_ERR_UNSUPPORTED;
+		h = &jd->huff[((tc >> 4) << 1) | (tc & 1)];
+		for (i = 1, n = 0; i <= 16; i++) {
+			bits[i] = jd_byte(jd);
+			n += bits[i];
+		}
+		if (n > sizeof(h->vals) || len < 17 + n)
+			return JPEG_ERR_FORMAT;
+		for (i = 0; i < n; i++)
+			h->vals[i] = jd_byte(jd);
+		// canonical codes, the codes of one length are consecutive
+		for (i = 1, n = 0, code = 0; i <= 16; i++) {
+			h->delta[i] = n - code;
+			code += bits[i];
+			n += bits[i];
+			h->maxcode[i] = bits[i] ? code - 1 : -1;
+			code <<= 1;
+		}
+		len -= 17 + n;
+	}
+	return len ? JPEG_ERR_FORMAT : JPEG_OK;
+}
+
+static int jd_readSOF(JpegDec *jd, uint16_t len) {
+	uint8_t i, hv;
+
+	if (jd_byte(jd) != 8)
+		return JPEG_ERR_UNSUPPORTED;
+	jd->height = jd_word(jd);
+	jd->width = jd_word(jd);
+	jd->ncomp = jd_byte(jd);
+	if (jd->ncomp != 1 && jd->ncomp != 3)
+		return JPEG_ERR_UNSUPPORTED;
+	if (len != 6 + jd->ncomp * 3 || jd->width == 0 || jd->height == 0)
+		return JPEG_ERR_FORMAT;
+	for (i = 0; i < jd->ncomp; i++) {
+		jd->comp[i].id = jd_byte(jd);
+		hv = jd_byte(jd);
+		jd->comp[i].h = hv >> 4;
+		jd->comp[i].v = hv & 0x0F;
+		jd->comp[i].tq = jd_byte(jd) & 3;
+	}
+	if (jd->ncomp == 1) {
+		// a single component scan is coded block by block
+		jd->comp[0].h = 1;
+		jd->comp[0].v = 1;
+	}
+	if (jd->comp[0].h < 1 || jd->comp[0].h > 2 || jd->comp[0].v < 1 || jd->comp[0].v > 2)
+		return JPEG_ERR_UNSUPPORTED;
+	for (i = 1; i < jd->ncomp; i++)
+		if (jd->comp[i].h != 1 || jd->comp[i].v != 1)
+			return JPEG_ERR_UNSUPPORTED;
+	return JPEG_OK;
+}
+
+static int jd_readSOS(JpegDec *jd, uint16_t len) {
+	uint8_t n, i, j, id, t;
+
+	n = jd_byte(jd);
+	if (n != jd->ncomp || len != 4 + n * 2)
+		return JPEG_ERR_UNSUPPORTED;	// more than one scan
+	for (i = 0; i < n; i++) {
+		id = jd_byte(jd);
+		t = jd_byte(jd);
+		for (j = 0; j < jd->ncomp && jd->comp[j].id != id; j++);
+		if (j == jd->ncomp || (t >> 4) > 1 || (t & 0x0F) > 1)
+			return JPEG_ERR_FORMAT;
+		jd->comp[j].td = t >> 4;
+		jd->comp[j].ta = 2 + (t & 0x0F);
+		jd->comp[j].dc = 0;
+	}
+	jd_skip(jd, 3);		// spectral selection and approximation
+	return JPEG_OK;
+}
+
+// Read the headers up to the start of the image data. On success jd->width
+// and jd->height are set and lcd7735_jpeg_draw() may be called.
+int lcd7735_jpeg_prepare(JpegDec *jd, JpegInput input, void *ctx) {
+	uint8_t m, sof = 0;
+	uint16_t len;
+	int res;
+
+	memset(jd, 0, sizeof(JpegDec) - sizeof(jd->inbuf));
+	jd->input = input;
+	jd->ctx = ctx;
+
+	if (jd_byte(jd) != 0xFF || jd_byte(jd) != M_SOI)
+		return jd->err ? jd->err : JPEG_ERR_FORMAT;
+	for (;;) {
+		if (jd_byte(jd) != 0xFF)
+			return jd->err ? jd->err : JPEG_ERR_FORMAT;
+		do {
+			m = jd_byte(jd);
+		} while (m == 0xFF);	// fill bytes
+		len = jd_word(jd);
+		if (jd->err)
+			return jd->err;
+		if (len < 2)
+			return JPEG_ERR_FORMAT;
+		len -= 2;
+		switch (m) {
+		case M_SOF0:
+		case M_SOF1:
+			res = jd_readSOF(jd, len);
+			sof = 1;
+			break;
+		case M_DHT:
+			res = jd_readDHT(jd, len);
+			break;
+		case M_DQT:
+			res = jd_readDQT(jd, len);
+			break;
+		case M_DRI:
+			jd->restart = jd_word(jd);
+			res = len == 2 ? JPEG_OK : JPEG_ERR_FORMAT;
+			break;
+		case M_SOS:
+			if (!sof)
+				return JPEG_ERR_FORMAT;
+			res = jd_readSOS(jd, len);
+			if (res == JPEG_OK && jd->err)
+				res = jd->err;
+			return res;
+		default:
+			// other frame types are progressive, lossless or arithmetic
+			if ((m & 0xF0) == 0xC0 && m != 0xC4 && m != 0xC8 && m != 0xCC)
+				return JPEG_ERR_UNSUPPORTED;
+			jd_skip(jd, len);
+			res = JPEG_OK;
+		}
+		if (res != JPEG_OK)
+			return res;
+		if (jd->err)
+			return jd->err;
+	}
+}
+
+/******************** entropy decoding ********************/
+
+// Keep at least 25 bits buffered. Once a marker is met only zeros are fed,
+// corrupted data then decodes to garbage but never runs past the marker.
+static void jd_fill(JpegDec *jd) {
+	uint8_t b;
+
+	while (jd->nbits <= 24) {
+		b = 0;
+		if (!jd->marker) {
+			b = jd_byte(jd);
+			if (b == 0xFF) {
+				do {
+					b = jd_byte(jd);
+				} while (b == 0xFF);
+				if (b == 0 || jd->err) {
+					b = 0xFF;	// stuffed byte
+				} else {
+					jd->marker = b;
+					b = 0;
+				}
+			}
+		}
+		jd->bits = (jd->bits << 8) | b;
+		jd->nbits += 8;
+	}
+}
+
+static uint16_t jd_getbits(JpegDec *jd, uint8_t n) {
+	if (jd->nbits < n)
+		jd_fill(jd);
+	jd->nbits -= n;
+	return (jd->bits >> jd->nbits) & ((1 << n) - 1);
+}
+
+static uint8_t jd_decode(JpegDec *jd, const JpegHuff *h) {
+	uint16_t peek;
+	int32_t code;
+	uint8_t l;
+
+	if (jd->nbits < 16)
+		jd_fill(jd);
+	peek = jd->bits >> (jd->nbits - 16);
+	for (l = 1; l <= 16; l++) {
+		code = peek >> (16 - l);
+		if (code <= h->maxcode[l]) {
+			jd->nbits -= l;
+			return h->vals[(uint8_t)(code + h->delta[l])];
+		}
+	}
+	jd->nbits -= 16;
+	jd->err = JPEG_ERR_FORMAT;
+	return 0;
+}
+
+// Value of an s-bit magnitude category
+static int16_t jd_extend(JpegDec *jd, uint8_t s) {
+	int16_t v = jd_getbits(jd, s);
+
+	if (v < (1 << (s - 1)))
+		v += 1 - (1 << s);
+	return v;
+}
+
+// Decode one block into jd->coef, returns 0 if all AC coefficients are zero
+static uint8_t jd_block(JpegDec *jd, JpegComp *c) {
+	const uint16_t *q = jd->qt[c->tq];
+	const JpegHuff *ac = &jd->huff[c->ta];
+	uint8_t s, rs, k, nz = 0;
+
+	s = jd_decode(jd, &jd->huff[c->td]);
+	if (s)
+		c->dc += jd_extend(jd, s);
+	memset(jd->coef, 0, sizeof(jd->coef));
+	jd->coef[0] = c->dc * q[0];
+
+	for (k = 1; k < 64; k++) {
+		rs = jd_decode(jd, ac);
+		s = rs & 0x0F;
+		if (s == 0) {
+			if (rs != 0xF0)
+				break;		// end of block
+			k += 15;		// run of 16 zeros
+			continue;
+		}
+		k += rs >> 4;
+		if (k > 63)
+			break;
+		jd->coef[zigzag[k]] = jd_extend(jd, s) * q[k];
+		nz = 1;
+	}
+	return nz;
+}
+
+/******************** IDCT and color ********************/
+
+static void jd_setScale(JpegDec *jd, uint8_t scale) {
+	uint8_t n = 8 >> scale;
+	uint8_t x, u;
+
+	// basis value of frequency u at output sample x, C(0) = 1/sqrt(2) included
+	for (x = 0; x < n; x++)
+		for (u = 0; u < n; u++)
+			jd->idct[x * 8 + u] = u ? cos32[(((2 * x + 1) << scale) * u) & 31] : 2896;
+}
+
+static uint8_t jd_clamp(int32_t v) {
+	return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+// n x n samples of the current block to dst, which is stride bytes wide
+static void jd_idct(JpegDec *jd, uint8_t n, uint8_t nz, uint8_t *dst, uint8_t stride) {
+	int32_t tmp[64], s;
+	const int16_t *m = jd->idct;
+	int16_t *f = jd->coef;
+	uint8_t x, y, u, v;
+
+	if (!nz) {
+		// DC only block, flat
+		s = jd_clamp(((f[0] + 4) >> 3) + 128);
+		for (y = 0; y < n; y++, dst += stride)
+			memset(dst, s, n);
+		return;
+	}
+	// columns, keep 1 fractional bit
+	for (u = 0; u < n; u++) {
+		for (v = 0; v < n && f[v * 8 + u] == 0; v++);
+		if (v == n) {
+			for (y = 0; y < n; y++)
+				tmp[y * 8 + u] = 0;
+			continue;
+		}
+		for (y = 0; y < n; y++) {
+			for (v = 0, s = 0; v < n; v++)
+				s += f[v * 8 + u] * m[y * 8 + v];
+			tmp[y * 8 + u] = (s + (1 << 10)) >> 11;
+		}
+	}
+	// rows, 1/4 of the 2D transform and the level shift
+	for (y = 0; y < n; y++, dst += stride) {
+		for (x = 0; x < n; x++) {
+			for (u = 0, s = 0; u < n; u++)
+				s += tmp[y * 8 + u] * m[x * 8 + u];
+			dst[x] = jd_clamp(((s + (1 << 14)) >> 15) + 128);
+		}
+	}
+}
+
+// Convert the MCU planes to RGB565, chroma is shared by hy x vy luma samples
+static void jd_color(JpegDec *jd, uint8_t n, uint8_t hy, uint8_t vy) {
+	uint8_t w = n * hy, h = n * vy;
+	const uint8_t *py = jd->plane;
+	const uint8_t *pcb = py + hy * vy * n * n;
+	const uint8_t *pcr = pcb + n * n;
+	uint16_t *out = jd->rgb;
+	uint8_t x, y, l;
+	int16_t cb, cr, c;
+	int32_t dr, dg, db;
+
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			l = *py++;
+			if (jd->ncomp == 1) {
+				*out++ = ((l & 0xF8) << 8) | ((l & 0xFC) << 3) | (l >> 3);
+				continue;
+			}
+			c = (y / vy) * n + x / hy;
+			cb = pcb[c] - 128;
+			cr = pcr[c] - 128;
+			dr = (91881 * cr) >> 16;
+			dg = (22554 * cb + 46802 * cr) >> 16;
+			db = (116130 * cb) >> 16;
+			*out++ = ((jd_clamp(l + dr) & 0xF8) << 8) | ((jd_clamp(l - dg) & 0xFC) << 3) | (jd_clamp(l + db) >> 3);
+		}
+	}
+}
+
+// Send the visible part of the w x h pixels MCU placed at screen position x,y
+// through a window blitted with flags
+static void jd_output(JpegDec *jd, int x, int y, uint8_t w, uint8_t h, uint8_t stride, uint8_t flags) {
+	int cx = 0, cy = 0, vw = w, vh = h;
+	const uint16_t *src;
+
+	// visible part: columns cx..cx+vw-1 and rows cy..cy+vh-1 of the MCU
+	if (x < 0) {
+		cx = -x;
+		vw += x;
+		x = 0;
+	}
+	if (y < 0) {
+		cy = -y;
+		vh += y;
+		y = 0;
+	}
+	if (vw > lcd7735_getWidth() - x)
+		vw = lcd7735_getWidth() - x;
+	if (vh > lcd7735_getHeight() - y)
+		vh = lcd7735_getHeight() - y;
+	if (vw <= 0 || vh <= 0)
+		return;
+	// a mirrored window shows the columns from the other end of the rows
+	if (flags & BLIT_FLIP_H)
+		cx = w - cx - vw;
+	lcd7735_blitBegin(x, y, vw, vh, flags);
+	for (src = jd->rgb + cy * stride + cx; vh--; src += stride)
+		lcd7735_pushColors(src, vw);
+	lcd7735_blitEnd();
+}
+
+// Resynchronize at a restart marker
+static int jd_restart(JpegDec *jd) {
+	uint8_t i;
+
+	while (!jd->marker && !jd->err) {
+		jd->nbits = 0;
+		jd_fill(jd);
+	}
+	if (jd->err)
+		return jd->err;
+	if ((jd->marker & 0xF8) != M_RST0)
+		return JPEG_ERR_FORMAT;
+	jd->marker = 0;
+	jd->nbits = 0;
+	for (i = 0; i < jd->ncomp; i++)
+		jd->comp[i].dc = 0;
+	return JPEG_OK;
+}
+
+// Decode the image prepared by lcd7735_jpeg_prepare() with its top left corner
+// at x,y. The scale selects 1/1, 1/2, 1/4 or 1/8 size (JPEG_SCALE_xxx). The
+// image is mirrored in landscape like lcd7735_drawBitmap(), the MCUs are then
+// placed from the right edge of the image.
+int lcd7735_jpeg_draw(JpegDec *jd, int x, int y, uint8_t scale) {
+	uint8_t n = 8 >> scale;
+	uint8_t hy = jd->comp[0].h, vy = jd->comp[0].v;
+	uint8_t mw = hy * n, mh = vy * n;
+	uint16_t iw = (jd->width + (1 << scale) - 1) >> scale;
+	uint16_t ih = (jd->height + (1 << scale) - 1) >> scale;
+	uint16_t ox, oy, rst = jd->restart;
+	uint8_t bx, by, i, nz, w, h;
+	uint8_t flags = lcd7735_bitmapFlags(0);
+	int res;
+
+	if (scale > JPEG_SCALE_1_8)
+		return JPEG_ERR_UNSUPPORTED;
+	jd_setScale(jd, scale);
+
+	for (oy = 0; oy < ih; oy += mh) {
+		for (ox = 0; ox < iw; ox += mw) {
+			if (jd->restart && rst-- == 0) {
+				res = jd_restart(jd);
+				if (res != JPEG_OK)
+					return res;
+				rst = jd->restart - 1;
+			}
+			for (by = 0; by < vy; by++) {
+				for (bx = 0; bx < hy; bx++) {
+					nz = jd_block(jd, &jd->comp[0]);
+					jd_idct(jd, n, nz, jd->plane + by * n * mw + bx * n, mw);
+				}
+			}
+			for (i = 1; i < jd->ncomp; i++) {
+				nz = jd_block(jd, &jd->comp[i]);
+				jd_idct(jd, n, nz, jd->plane + (hy * vy + i - 1) * n * n, n);
+			}
+			if (jd->err)
+				return jd->err;
+			jd_color(jd, n, hy, vy);
+			w = iw - ox < mw ? iw - ox : mw;
+			h = ih - oy < mh ? ih - oy : mh;
+			jd_output(jd, x + (flags & BLIT_FLIP_H ? iw - ox - w : ox), y + oy, w, h, mw, flags);
+		}
+	}
+	return JPEG_OK;
+}
@@ -0,0 +1,91 @@
+/*********************************************************************************
+Baseline JPEG decoder for ST7735 driver
+
+Decodes baseline (sequential, Huffman, 8-bit) JPEG images MCU by MCU and sends
+every MCU through its own address window, so no frame buffer is needed. All
+state lives in the JpegDec work area (about 3.4 KB), nothing is allocated.
+Grayscale and YCbCr 4:4:4, 4:2:2, 4:4:0 and 4:2:0 images are supported, the
+IDCT can scale the image down by 1/2, 1/4 or 1/8 at decoding time.
+
+The compressed data is pulled through an input callback, so it can come from
+flash, a file or a serial stream:
+
+	uint16_t input(void *ctx, uint8_t *buf, uint16_t len);
+
+It returns the number of bytes stored to buf (0 at the end of the stream). When
+buf is NULL len bytes have to be skipped and the number of skipped bytes is
+returned. lcd7735_jpeg_memInput() is such a callback for images in memory.
+**********************************************************************************/
+
+#ifndef _ST7735_JPEG_H_
+#define _ST7735_JPEG_H_
+
+#include "ST7735.h"
+
+// Size of the input buffer, one callback request reads up to this many bytes
+#ifndef JPEG_INBUF
+#define JPEG_INBUF	512
+#endif
+
+// Results of lcd7735_jpeg_prepare() and lcd7735_jpeg_draw()
+#define JPEG_OK			0
+#define JPEG_ERR_INPUT		1	// stream ended too early
+#define JPEG_ERR_FORMAT		2	// not a JPEG image or corrupted data
+#define JPEG_ERR_UNSUPPORTED	3	// progressive, 12-bit, arithmetic or odd sampling
+
+// Scale factors for lcd7735_jpeg_draw()
+#define JPEG_SCALE_1		0
+#define JPEG_SCALE_1_2		1
+#define JPEG_SCALE_1_4		2
+#define JPEG_SCALE_1_8		3
+
+typedef uint16_t (*JpegInput)(void *ctx, uint8_t *buf, uint16_t len);
+
+typedef struct _jpeghuff {
+	int32_t		maxcode[17];	// largest code of each length, -1 if none
+	int32_t		delta[17];	// vals index minus first code of each length
+	uint8_t		vals[162];
+} JpegHuff;
+
+typedef struct _jpegcomp {
+	uint8_t		id;
+	uint8_t		h, v;		// sampling factors
+	uint8_t		tq;		// quantization table
+	uint8_t		td, ta;		// DC and AC Huffman tables
+	int16_t		dc;		// DC predictor
+} JpegComp;
+
+typedef struct _jpegdec {
+	uint16_t	width;		// image size, valid after lcd7735_jpeg_prepare()
+	uint16_t	height;
+	JpegInput	input;
+	void		*ctx;
+	uint8_t		ncomp;
+	uint8_t		marker;		// marker met in entropy coded data, 0 if none
+	uint8_t		err;
+	uint8_t		nbits;
+	uint32_t	bits;
+	uint16_t	inpos, inlen;
+	uint16_t	restart;	// restart interval in MCUs, 0 if none
+	JpegComp	comp[3];
+	uint16_t	qt[4][64];	// quantization tables in zigzag order
+	JpegHuff	huff[4];	// DC0, DC1, AC0, AC1
+	int16_t		idct[64];	// IDCT basis for the selected scale
+	int16_t		coef[64];
+	uint8_t		plane[6 * 64];	// Y blocks followed by Cb and Cr of one MCU
+	uint16_t	rgb[256];	// one MCU converted to RGB565
+	uint8_t		inbuf[JPEG_INBUF];
+} JpegDec;
+
+// lcd7735_jpeg_memInput() context, set data and size, pos to 0
+typedef struct _jpegmem {
+	const uint8_t	*data;
+	uint32_t	size;
+	uint32_t	pos;
+} JpegMem;
+
+extern int lcd7735_jpeg_prepare(JpegDec *jd, JpegInput input, void *ctx);
+extern int lcd7735_jpeg_draw(JpegDec *jd, int x, int y, uint8_t scale);
+extern uint16_t lcd7735_jpeg_memInput(void *ctx, uint8_t *buf, uint16_t len);
+
+#endif /* _ST7735_JPEG_H_ */
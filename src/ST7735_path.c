@@ -0,0 +1,392 @@
+/*********************************************************************************
+Vector paths for ST7735 driver
+
+Curves are flattened by forward differencing with the number of lines taken
+from the second differences of the control points (Wang's formula), so the
+distance to the curve stays within PATH_TOLERANCE. The differences are kept
+in 64 bits with 16 fraction bits, so rounding doesn't add up along a curve.
+
+Edges are sorted by their first row. Every row the edges ending are dropped,
+the ones starting are added and the active edges are sorted by x again by
+insertion, which is linear since they rarely change order. Edge positions are
+16.16 fixed point pixels, stepped by their slope per row.
+**********************************************************************************/
+
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_path.h"
+
+typedef struct _path_edge {
+	int32_t		x, dx;		// x at the center of row y0 and its step per row
+	int16_t		y0, y1;		// rows y0..y1-1
+	int8_t		dir;		// 1 downwards, -1 upwards
+} PathEdge;
+
+static PathEdge path_edges[PATH_MAX_EDGES];
+static uint16_t path_active[PATH_MAX_EDGES];
+
+void lcd7735_path_init(Path *p, PathPoint *buf, uint16_t size) {
+	p->pts = buf;
+	p->size = size;
+	p->n = 0;
+	p->start = 0;
+	p->x = 0;
+	p->y = 0;
+	p->overflow = 0;
+}
+
+static void addPoint(Path *p, int x, int y) {
+	if (p->n >= p->size) {
+		p->overflow = 1;
+		return;
+	}
+	p->pts[p->n].x = x;
+	p->pts[p->n].y = y;
+	p->n++;
+}
+
+static void endContour(Path *p, uint8_t closed) {
+	if (p->n > p->start) {
+		addPoint(p, PATH_BREAK, closed);
+		p->start = p->n;
+	}
+}
+
+// Start a new contour at x,y, the open one is ended
+void lcd7735_path_moveTo(Path *p, int x, int y) {
+	endContour(p, 0);
+	p->x = x;
+	p->y = y;
+}
+
+void lcd7735_path_lineTo(Path *p, int x, int y) {
+	if (p->n == p->start)
+		addPoint(p, p->x, p->y);
+	if (p->n && (p->pts[p->n-1].x != x || p->pts[p->n-1].y != y))
+		addPoint(p, x, y);
+	p->x = x;
+	p->y = y;
+}
+
+// Lines for a curve whose second differences add up to d, k is 1 for
+// quadratic and 3 for cubic curves
+static int32_t curveSteps(int32_t d, int32_t k) {
+	int32_t n = 1;
+
+	while (n < PATH_MAX_STEPS && n * n * 4 * PATH_TOLERANCE < k * d)
+		n++;
+	return n;
+}
+
+#define iabs(v)	((v) < 0 ? -(v) : (v))
+
+void lcd7735_path_quadTo(Path *p, int cx, int cy, int x, int y) {
+	int32_t bx = p->x - 2 * cx + x, by = p->y - 2 * cy + y;
+	int32_t n = curveSteps(iabs(bx) + iabs(by), 1), i;
+	int64_t px = (int64_t)p->x * 65536, py = (int64_t)p->y * 65536;
+	int64_t d1x = (int64_t)(2 * (cx - p->x) * n + bx) * 65536 / (n * n);
+	int64_t d1y = (int64_t)(2 * (cy - p->y) * n + by) * 65536 / (n * n);
+	int64_t d2x = (int64_t)bx * 131072 / (n * n), d2y = (int64_t)by * 131072 / (n * n);
+
+	for (i = 1; i < n; i++) {
+		px += d1x;
+		py += d1y;
+		d1x += d2x;
+		d1y += d2y;
+		lcd7735_path_lineTo(p, (int)((px + 0x8000) >> 16), (int)((py + 0x8000) >> 16));
+	}
+	lcd7735_path_lineTo(p, x, y);
+}
+
+void lcd7735_path_cubicTo(Path *p, int c1x, int c1y, int c2x, int c2y, int x, int y) {
+	int32_t ax = 3 * (c1x - p->x), ay = 3 * (c1y - p->y);
+	int32_t bx = 3 * (p->x - 2 * c1x + c2x), by = 3 * (p->y - 2 * c1y + c2y);
+	int32_t cx = x - p->x + 3 * (c1x - c2x), cy = y - p->y + 3 * (c1y - c2y);
+	int32_t d = iabs(bx) + iabs(by), e = 3 * (iabs(c1x - 2 * c2x + x) + iabs(c1y - 2 * c2y + y)), n, i;
+	int64_t n3, px, py, d1x, d1y, d2x, d2y, d3x, d3y;
+
+	// b holds 3 times the second difference at the start
+	n = curveSteps((d > e ? d : e) / 3, 3);
+	n3 = (int64_t)n * n * n;
+	px = (int64_t)p->x * 65536;
+	py = (int64_t)p->y * 65536;
+	d1x = ((int64_t)ax * n * n + (int64_t)bx * n + cx) * 65536 / n3;
+	d1y = ((int64_t)ay * n * n + (int64_t)by * n + cy) * 65536 / n3;
+	d2x = ((int64_t)bx * 2 * n + 6 * (int64_t)cx) * 65536 / n3;
+	d2y = ((int64_t)by * 2 * n + 6 * (int64_t)cy) * 65536 / n3;
+	d3x = (int64_t)cx * 6 * 65536 / n3;
+	d3y = (int64_t)cy * 6 * 65536 / n3;
+	for (i = 1; i < n; i++) {
+		px += d1x;
+		py += d1y;
+		d1x += d2x;
+		d1y += d2y;
+		d2x += d3x;
+		d2y += d3y;
+		lcd7735_path_lineTo(p, (int)((px + 0x8000) >> 16), (int)((py + 0x8000) >> 16));
+	}
+	lcd7735_path_lineTo(p, x, y);
+}
+
+// Close the open contour, the current point goes back to its start
+void lcd7735_path_close(Path *p) {
+	if (p->n > p->start) {
+		p->x = p->pts[p->start].x;
+		p->y = p->pts[p->start].y;
+		endContour(p, 1);
+	}
+}
+
+// Append a path of the binary format with its origin at pixel x,y, scaled by
+// scale/256. Returns the fill rule stored with it.
+uint8_t lcd7735_path_load(Path *p, const uint8_t *data, int x, int y, uint16_t scale) {
+	uint8_t hdr = *data++, op, cnt, k, npts;
+	int32_t unit = PATH_ONE >> (hdr & 7), vx = 0, vy = 0;
+	int px[3], py[3];
+
+	x *= PATH_ONE;
+	y *= PATH_ONE;
+	while ((*data & 7) != PATH_OP_END) {
+		op = *data++;
+		for (cnt = (op >> 4) + 1; cnt; cnt--) {
+			if ((op & 7) == PATH_OP_CLOSE) {
+				lcd7735_path_close(p);
+				continue;
+			}
+			npts = (op & 7) == PATH_OP_CUBIC ? 3 : (op & 7) == PATH_OP_QUAD ? 2 : 1;
+			for (k = 0; k < npts; k++) {
+				if (op & PATH_FMT_WIDE) {
+					vx += (int16_t)(data[0] | data[1] << 8);
+					vy += (int16_t)(data[2] | data[3] << 8);
+					data += 4;
+				} else {
+					vx += (int8_t)data[0];
+					vy += (int8_t)data[1];
+					data += 2;
+				}
+				px[k] = x + ((vx * unit * scale) >> 8);
+				py[k] = y + ((vy * unit * scale) >> 8);
+			}
+			switch (op & 7) {
+			case PATH_OP_MOVE:
+				lcd7735_path_moveTo(p, px[0], py[0]);
+				break;
+			case PATH_OP_LINE:
+				lcd7735_path_lineTo(p, px[0], py[0]);
+				break;
+			case PATH_OP_QUAD:
+				lcd7735_path_quadTo(p, px[0], py[0], px[1], py[1]);
+				break;
+			case PATH_OP_CUBIC:
+				lcd7735_path_cubicTo(p, px[0], py[0], px[1], py[1], px[2], py[2]);
+				break;
+			}
+		}
+	}
+	return hdr & PATH_FMT_EVENODD ? PATH_EVENODD : PATH_NONZERO;
+}
+
+// Rows of the current band, the table holds the edges crossing rows
+// path_top.. and path_limit is the first row of an edge that didn't fit
+static int path_top, path_limit;
+
+// Edge from a to b into the table sorted by first row, horizontal edges and
+// the rows off the band and the screen are left out. When the table is full
+// the edge starting lowest is dropped and the band ends above it.
+static int addEdge(int ne, const PathPoint *a, const PathPoint *b) {
+	const PathPoint *t;
+	PathEdge e;
+	int8_t dir = 1;
+	int y0, y1, i;
+
+	if (a->y == b->y)
+		return ne;
+	if (a->y > b->y) {
+		t = a;
+		a = b;
+		b = t;
+		dir = -1;
+	}
+	// rows whose centers 16y+8 lie in a->y..b->y-1
+	y0 = (a->y + 7) >> 4;
+	y1 = (b->y + 7) >> 4;
+	if (y0 < path_top)
+		y0 = path_top;
+	if (y1 > path_limit)
+		y1 = path_limit;
+	if (y0 >= y1)
+		return ne;
+	if (ne == PATH_MAX_EDGES) {
+		if (y0 >= path_edges[ne-1].y0) {
+			// a full table of edges starting on the top row can't be split
+			if (y0 > path_top)
+				path_limit = y0;
+			return ne;
+		}
+		path_limit = path_edges[--ne].y0;
+	}
+	e.dx = (int32_t)((int64_t)(b->x - a->x) * 65536 / (b->y - a->y));
+	e.x = (int32_t)a->x * 4096 + (int32_t)(((int64_t)e.dx * (16 * y0 + 8 - a->y)) >> 4);
+	e.y0 = y0;
+	e.y1 = y1;
+	e.dir = dir;
+	for (i = ne; i > 0 && path_edges[i-1].y0 > y0; i--)
+		path_edges[i] = path_edges[i-1];
+	path_edges[i] = e;
+	return ne + 1;
+}
+
+// Fill the inside of the path by rule with f, every contour is closed. Paths
+// of more than PATH_MAX_EDGES edges are filled in bands of rows, as long as
+// no row is crossed by more edges than that.
+void lcd7735_path_fill(const Path *p, uint8_t rule, const Fill *f) {
+	const PathPoint *pts = p->pts;
+	PathEdge *e;
+	int32_t xs = 0;
+	int ne, na, next, i, j, s, w, in, y, xa, xb;
+	uint16_t k;
+
+	for (path_top = 0; path_top < lcd7735_getHeight(); path_top = path_limit) {
+		path_limit = lcd7735_getHeight();
+		ne = 0;
+		for (i = 0; i < p->n; i++) {
+			for (s = i; i < p->n && pts[i].x != PATH_BREAK; i++)
+				;
+			for (j = s; j < i; j++)
+				ne = addEdge(ne, &pts[j], &pts[j + 1 < i ? j + 1 : s]);
+		}
+		// edges that ended up below a later limit are cut there
+		while (ne && path_edges[ne-1].y0 >= path_limit)
+			ne--;
+		for (i = 0; i < ne; i++)
+			if (path_edges[i].y1 > path_limit)
+				path_edges[i].y1 = path_limit;
+
+		for (na = next = y = 0;; y++) {
+			if (na == 0) {
+				if (next >= ne)
+					break;
+				y = path_edges[next].y0;
+			}
+			for (i = j = 0; i < na; i++)
+				if (path_edges[path_active[i]].y1 > y)
+					path_active[j++] = path_active[i];
+			na = j;
+			while (next < ne && path_edges[next].y0 == y)
+				path_active[na++] = next++;
+			for (i = 1; i < na; i++) {
+				k = path_active[i];
+				for (j = i; j > 0 && path_edges[path_active[j-1]].x > path_edges[k].x; j--)
+					path_active[j] = path_active[j-1];
+				path_active[j] = k;
+			}
+
+			// spans where the winding number is nonzero or odd, pixels
+			// whose centers lie in xs..x-1
+			for (i = w = 0; i < na; i++) {
+				e = &path_edges[path_active[i]];
+				in = w != 0;
+				w = rule == PATH_EVENODD ? w ^ 1 : w + e->dir;
+				if (!in && w)
+					xs = e->x;
+				else if (in && !w) {
+					xa = (xs + 0x7FFF) >> 16;
+					xb = ((e->x + 0x7FFF) >> 16) - 1;
+					if (xa <= xb)
+						lcd7735_fill_hline(f, xa, xb, y);
+				}
+			}
+			for (i = 0; i < na; i++)
+				path_edges[path_active[i]].x += path_edges[path_active[i]].dx;
+		}
+	}
+}
+
+// Normal of segment a-b hw long, 0 for a point
+static void strokeNormal(const PathPoint *a, const PathPoint *b, float hw, int *nx, int *ny) {
+	float dx = b->x - a->x, dy = b->y - a->y, l = sqrtf(dx * dx + dy * dy);
+
+	*nx = l == 0 ? 0 : (int)lrintf(-dy * hw / l);
+	*ny = l == 0 ? 0 : (int)lrintf(dx * hw / l);
+}
+
+// Quad around segment a-b, clockwise on the screen like the joins
+static void strokeSegment(Path *o, const PathPoint *a, const PathPoint *b, float hw) {
+	int nx, ny;
+
+	strokeNormal(a, b, hw, &nx, &ny);
+	if (nx == 0 && ny == 0)
+		return;
+	lcd7735_path_moveTo(o, a->x + nx, a->y + ny);
+	lcd7735_path_lineTo(o, b->x + nx, b->y + ny);
+	lcd7735_path_lineTo(o, b->x - nx, b->y - ny);
+	lcd7735_path_lineTo(o, a->x - nx, a->y - ny);
+	lcd7735_path_close(o);
+}
+
+// Octagon around c whose sides touch the circle of radius hw
+static void strokeRound(Path *o, const PathPoint *c, float hw) {
+	static const int8_t oct[8][2] = {
+		{ 100, 41 }, { 100, -41 }, { 41, -100 }, { -41, -100 },
+		{ -100, -41 }, { -100, 41 }, { -41, 100 }, { 41, 100 }
+	};
+	int i;
+
+	lcd7735_path_moveTo(o, c->x + (int)lrintf(oct[0][0] * hw / 100), c->y + (int)lrintf(oct[0][1] * hw / 100));
+	for (i = 1; i < 8; i++)
+		lcd7735_path_lineTo(o, c->x + (int)lrintf(oct[i][0] * hw / 100), c->y + (int)lrintf(oct[i][1] * hw / 100));
+	lcd7735_path_close(o);
+}
+
+// Join of a-b and b-c: the wedges between the ends of the two quads for a
+// slight turn, round otherwise
+static void strokeJoin(Path *o, const PathPoint *a, const PathPoint *b, const PathPoint *c, float hw) {
+	float ux = b->x - a->x, uy = b->y - a->y, vx = c->x - b->x, vy = c->y - b->y;
+	float cross = ux * vy - uy * vx, dot = ux * vx + uy * vy;
+	int n1x, n1y, n2x, n2y, t, k;
+
+	// round when the turn opens a gap wider than a quarter pixel
+	if (dot <= 0 || fabsf(cross) * hw > 4 * sqrtf((ux * ux + uy * uy) * (vx * vx + vy * vy))) {
+		strokeRound(o, b, hw);
+		return;
+	}
+	strokeNormal(a, b, hw, &n1x, &n1y);
+	strokeNormal(b, c, hw, &n2x, &n2y);
+	if (n1x * n2y - n1y * n2x == 0)
+		return;
+	if (n1x * n2y - n1y * n2x > 0) {
+		t = n1x; n1x = n2x; n2x = t;
+		t = n1y; n1y = n2y; n2y = t;
+	}
+	for (k = 1; k >= -1; k -= 2) {
+		lcd7735_path_moveTo(o, b->x, b->y);
+		lcd7735_path_lineTo(o, b->x + k * n1x, b->y + k * n1y);
+		lcd7735_path_lineTo(o, b->x + k * n2x, b->y + k * n2y);
+		lcd7735_path_close(o);
+	}
+}
+
+// Build the outline of the path drawn width wide (1/16 pixel) in outline, to
+// be filled with PATH_NONZERO. Open contours get round caps.
+void lcd7735_path_stroke(const Path *p, Path *outline, int width) {
+	const PathPoint *pts = p->pts;
+	float hw = width / 2.0f;
+	int i, j, s, n, closed;
+
+	for (i = 0; i < p->n; i++) {
+		for (s = i; i < p->n && pts[i].x != PATH_BREAK; i++)
+			;
+		n = i - s;
+		closed = i < p->n && pts[i].y && n > 2;
+		for (j = 0; j < n; j++) {
+			if (j + 1 < n || closed)
+				strokeSegment(outline, &pts[s + j], &pts[s + (j + 1) % n], hw);
+			if (closed)
+				strokeJoin(outline, &pts[s + (j + n - 1) % n], &pts[s + j], &pts[s + (j + 1) % n], hw);
+			else if (j == 0 || j == n - 1)
+				strokeRound(outline, &pts[s + j], hw);
+			else
+				strokeJoin(outline, &pts[s + j - 1], &pts[s + j], &pts[s + j + 1], hw);
+		}
+	}
+}
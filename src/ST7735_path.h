@@ -0,0 +1,96 @@
+/*********************************************************************************
+Vector paths for ST7735 driver
+
+A path is built from move, line, quadratic and cubic Bezier and close
+commands, or loaded from the compact binary format below, e.g. icons and logos
+kept in flash instead of bitmaps. Curves are flattened to lines while they
+are added, into a point buffer given by the caller. Coordinates are in 1/16
+pixel (PATH_ONE), pixel x,y covers x..x+1, y..y+1.
+
+A path is filled with the nonzero or the even-odd rule by an active edge
+scanline: the edges crossing the center of a row are kept sorted by x and the
+spans between them are generated by a Fill of ST7735_fill.h, so paths can be
+filled with gradients and patterns. Pixels are filled when their centers are
+inside. lcd7735_path_stroke() builds the outline of a path drawn with a
+given width, a quad for every segment and round joins and caps, to be filled
+with the nonzero rule.
+
+Binary format (built by imgconv -v from SVG path data):
+
+	byte 0		bits 0-2: fraction bits s of the coordinates (units of 1/2^s
+			pixel, s <= 4), bit 7: PATH_FMT_EVENODD
+	then commands	bits 0-2: op, bit 3: PATH_FMT_WIDE, bits 4-7: repeat count - 1
+
+Every command stores the coordinates of its points (none for close and end,
+one for move and line, two for quad and three for cubic) as the difference
+to the previous point, int8_t, or little endian int16_t with PATH_FMT_WIDE.
+A repeated command, e.g. a polyline, stores the points of every repetition.
+**********************************************************************************/
+
+#ifndef _ST7735_PATH_H_
+#define _ST7735_PATH_H_
+
+#include "ST7735.h"
+#include "ST7735_fill.h"
+
+// Coordinates
+#define PATH_ONE	16
+#define PATH_PX(v)	((v) * PATH_ONE)
+
+// Fill rules
+#define PATH_NONZERO	0
+#define PATH_EVENODD	1
+
+// Largest distance of a flattened curve to its lines, 1/16 pixel
+#ifndef PATH_TOLERANCE
+#define PATH_TOLERANCE	4
+#endif
+
+// Most lines per curve
+#ifndef PATH_MAX_STEPS
+#define PATH_MAX_STEPS	64
+#endif
+
+// Edges of lcd7735_path_fill(), 16 bytes each
+#ifndef PATH_MAX_EDGES
+#define PATH_MAX_EDGES	256
+#endif
+
+// Binary format
+#define PATH_OP_MOVE	0
+#define PATH_OP_LINE	1
+#define PATH_OP_QUAD	2
+#define PATH_OP_CUBIC	3
+#define PATH_OP_CLOSE	4
+#define PATH_OP_END	7
+#define PATH_FMT_WIDE	0x08
+#define PATH_FMT_EVENODD	0x80
+
+// A contour ends with a point of x PATH_BREAK, y is 1 if it was closed
+#define PATH_BREAK	(-32768)
+
+typedef struct _path_point {
+	int16_t		x, y;
+} PathPoint;
+
+typedef struct _path {
+	PathPoint	*pts;
+	uint16_t	size;		// points the buffer holds
+	uint16_t	n;		// points used
+	uint16_t	start;		// first point of the open contour
+	int16_t		x, y;		// current point
+	uint8_t		overflow;	// set when points didn't fit
+} Path;
+
+extern void lcd7735_path_init(Path *p, PathPoint *buf, uint16_t size);
+extern void lcd7735_path_moveTo(Path *p, int x, int y);
+extern void lcd7735_path_lineTo(Path *p, int x, int y);
+extern void lcd7735_path_quadTo(Path *p, int cx, int cy, int x, int y);
+extern void lcd7735_path_cubicTo(Path *p, int c1x, int c1y, int c2x, int c2y, int x, int y);
+extern void lcd7735_path_close(Path *p);
+extern uint8_t lcd7735_path_load(Path *p, const uint8_t *data, int x, int y, uint16_t scale);
+
+extern void lcd7735_path_fill(const Path *p, uint8_t rule, const Fill *f);
+extern void lcd7735_path_stroke(const Path *p, Path *outline, int width);
+
+#endif /* _ST7735_PATH_H_ */
@@ -0,0 +1,233 @@
+/*********************************************************************************
+Text boxes and labels for ST7735 driver
+**********************************************************************************/
+
+#include <string.h>
+#include "ST7735.h"
+#include "ST7735_text.h"
+
+#define ELLIPSIS	"..."
+
+// Contents of the text, a layout is only reused for the same hash
+static uint16_t textHash(const char *st) {
+	uint32_t h = 2166136261u;
+
+	while (*st)
+		h = (h ^ (uint8_t)*st++) * 16777619u;
+	return (uint16_t)(h ^ (h >> 16));
+}
+
+// Byte after the UTF-8 char at st[i]
+static int nextChar(const char *st, int i) {
+	for (i++; (st[i] & 0xC0) == 0x80; i++)
+		;
+	return i;
+}
+
+static int prevChar(const char *st, int i) {
+	for (i--; i > 0 && (st[i] & 0xC0) == 0x80; i--)
+		;
+	return i;
+}
+
+void lcd7735_textbox_init(TextBox *tb, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t align, uint8_t spacing) {
+	tb->x = x;
+	tb->y = y;
+	tb->w = w;
+	tb->h = h;
+	tb->align = align;
+	tb->spacing = spacing;
+	tb->text = NULL;
+	tb->nlines = 0;
+}
+
+// Shorten line l so that it fits in the box followed by "..."
+static void cutLine(TextBox *tb, const char *st, TextLine *l) {
+	int end = l->start + l->len, dots = lcd7735_textWidthN(ELLIPSIS, -1);
+
+	if (l->len > TEXT_LINE_BYTES - sizeof(ELLIPSIS))
+		end = prevChar(st, l->start + TEXT_LINE_BYTES - sizeof(ELLIPSIS) + 1);
+	while (end > l->start && lcd7735_textWidthN(st + l->start, end - l->start) + dots > tb->w)
+		end = prevChar(st, end);
+	while (end > l->start && st[end - 1] == ' ')
+		end--;
+	l->len = end - l->start;
+	l->width = lcd7735_textWidthN(st + l->start, l->len) + dots;
+	l->flags = TEXT_LINE_CUT;
+}
+
+// Break st into the lines of the box, the last layout is reused if the text
+// and the font are the same. Returns the number of lines.
+uint8_t lcd7735_textbox_layout(TextBox *tb, const char *st) {
+	const uint8_t *font = lcd7735_getFont();
+	uint16_t hash = textHash(st);
+	int lh = lcd7735_getFontHeight() + tb->spacing, maxlines, pos = 0, end, k;
+	TextLine *l;
+
+	if (tb->text == st && tb->font == font && tb->hash == hash)
+		return tb->nlines;
+	tb->text = st;
+	tb->font = font;
+	tb->hash = hash;
+	tb->nlines = 0;
+
+	maxlines = (tb->h + tb->spacing) / lh;
+	if (maxlines > TEXT_MAX_LINES)
+		maxlines = TEXT_MAX_LINES;
+	while (st[pos] && tb->nlines < maxlines) {
+		l = &tb->lines[tb->nlines++];
+		l->start = pos;
+		l->flags = 0;
+		// add words while they fit, k is the end of the next word
+		for (end = pos;;) {
+			for (k = end; st[k] == ' '; k++)
+				;
+			for (; st[k] && st[k] != ' ' && st[k] != '\n'; k++)
+				;
+			if (k > end && lcd7735_textWidthN(st + pos, k - pos) > tb->w)
+				break;
+			end = k;
+			if (st[end] == 0 || st[end] == '\n') {
+				l->flags = TEXT_LINE_END;
+				break;
+			}
+		}
+		// a word wider than the box is cut between chars
+		if (end == pos && !l->flags) {
+			for (end = nextChar(st, pos); st[end] && st[end] != ' ' && st[end] != '\n'; end = k) {
+				k = nextChar(st, end);
+				if (lcd7735_textWidthN(st + pos, k - pos) > tb->w)
+					break;
+			}
+		}
+		for (k = end; k > pos && st[k - 1] == ' '; k--)
+			;
+		l->len = k - pos;
+		l->width = lcd7735_textWidthN(st + pos, l->len);
+		pos = end;
+		if (st[pos] == '\n')
+			pos++;
+		else
+			while (st[pos] == ' ')
+				pos++;
+	}
+	if (st[pos] && tb->nlines && (tb->align & TEXT_ELLIPSIS))
+		cutLine(tb, st, &tb->lines[tb->nlines - 1]);
+	return tb->nlines;
+}
+
+// Lay st out if needed and draw it in the current font and colors
+void lcd7735_textbox_draw(TextBox *tb, const char *st) {
+	char buf[TEXT_LINE_BYTES];
+	const char *p;
+	int lh = lcd7735_getFontHeight() + tb->spacing, y = tb->y, h, i, n, indent, extra;
+	TextLine *l;
+
+	lcd7735_textbox_layout(tb, st);
+	for (i = 0; i < tb->nlines; i++, y += lh) {
+		l = &tb->lines[i];
+		p = st + l->start;
+		n = l->len;
+		if (l->flags & TEXT_LINE_CUT) {
+			memcpy(buf, p, n);
+			strcpy(buf + n, ELLIPSIS);
+			p = buf;
+			n = -1;
+		}
+		indent = extra = 0;
+		switch (tb->align & 0x03) {
+		case TEXT_CENTER:
+			indent = (tb->w - l->width) / 2;
+			break;
+		case TEXT_RIGHT:
+			indent = tb->w - l->width;
+			break;
+		case TEXT_JUSTIFY:
+			if (!l->flags)
+				extra = tb->w - l->width;
+			break;
+		}
+		// the spacing below a line is cleared through its window
+		h = tb->y + tb->h - y < lh ? tb->y + tb->h - y : lh;
+		lcd7735_printLine(p, n, tb->x, y, tb->w, h, indent, extra);
+	}
+	if (y < tb->y + tb->h)
+		lcd7735_printLine("", 0, tb->x, y, tb->w, tb->y + tb->h - y, 0, 0);
+}
+
+#define fixedFont(f)	((f)[0] != 0 || !((f)[1] & FONT_PROP))
+
+void lcd7735_label_init(Label *lb, int16_t x, int16_t y) {
+	lb->x = x;
+	lb->y = y;
+	lb->font = NULL;
+	lb->width = 0;
+	lb->height = 0;
+	lb->text[0] = 0;
+}
+
+// Show st in the current font and colors, drawing only what differs from the
+// text shown before. Returns the number of glyph cells sent.
+int lcd7735_label_update(Label *lb, const char *st) {
+	const uint8_t *font = lcd7735_getFont();
+	const char *old = lb->text;
+	int h = lcd7735_getFontHeight(), w, cw, i, j, k, cell, run, from, sent = 0;
+
+	w = lcd7735_textWidthN(st, -1);
+	if (lb->font != font || lb->fg != lcd7735_getForeground() || lb->bg != lcd7735_getBackground()) {
+		// everything changes, the old text is overwritten or cleared
+		if (lb->height > h && lb->width)
+			lcd7735_printLine("", 0, lb->x, lb->y + h, lb->width, lb->height - h, 0, 0);
+		if (w || lb->width)
+			lcd7735_printLine(st, -1, lb->x, lb->y, w > lb->width ? w : lb->width, h, 0, 0);
+		for (i = 0; st[i]; i = nextChar(st, i))
+			sent++;
+	} else if (fixedFont(font)) {
+		// runs of changed cells, i and j walk the new and the old text
+		cw = lcd7735_textWidthN(" ", 1);
+		for (i = j = cell = 0; st[i]; cell += run) {
+			for (from = i, run = 0; st[i]; run++, i = k, j = old[j] ? nextChar(old, j) : j) {
+				k = nextChar(st, i);
+				if (old[j] && k - i == nextChar(old, j) - j && !memcmp(st + i, old + j, k - i))
+					break;
+			}
+			if (run) {
+				lcd7735_printLine(st + from, i - from, lb->x + cell * cw, lb->y, run * cw, h, 0, 0);
+				sent += run;
+				continue;
+			}
+			// unchanged char
+			i = nextChar(st, i);
+			j = nextChar(old, j);
+			run = 1;
+		}
+		if (w < lb->width)
+			lcd7735_printLine("", 0, lb->x + w, lb->y, lb->width - w, h, 0, 0);
+	} else {
+		// proportional: from the char before the first change to the end,
+		// drawn at the same positions as the whole text
+		for (i = 0; st[i] && st[i] == old[i]; i++)
+			;
+		if (st[i] == 0 && old[i] == 0)
+			return 0;
+		while (i > 0 && (st[i] & 0xC0) == 0x80)
+			i--;
+		if (i > 0)
+			i = prevChar(st, i);
+		from = lcd7735_textWidthN(st, i);
+		run = (w > lb->width ? w : lb->width) - from;
+		if (run > 0)
+			lcd7735_printLine(st, -1, lb->x + from, lb->y, run, h, -from, 0);
+		for (; st[i]; i = nextChar(st, i))
+			sent++;
+	}
+
+	lb->font = font;
+	lb->fg = lcd7735_getForeground();
+	lb->bg = lcd7735_getBackground();
+	lb->width = w;
+	lb->height = h;
+	strncpy(lb->text, st, LABEL_MAX_BYTES - 1);
+	lb->text[LABEL_MAX_BYTES - 1] = 0;
+	return sent;
+}
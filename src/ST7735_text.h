@@ -0,0 +1,92 @@
+/*********************************************************************************
+Text boxes and labels for ST7735 driver
+
+A text box lays a string out in a rectangle with the current font: lines are
+wrapped between words, or between chars when a word is wider than the box, and
+'\n' starts a new paragraph. Lines are aligned left, centered, right or
+justified (the last line of a paragraph is left aligned), line spacing adds
+pixels between lines. With TEXT_ELLIPSIS text that doesn't fit in the box ends
+in "..." on the last line.
+
+The line breaks are kept in the TextBox and reused while the text, its contents
+and the font stay the same, so redrawing a box costs no measuring. Call
+lcd7735_textbox_init() again to change the box. Opaque boxes are drawn one
+window per line, the box area below the text is cleared.
+
+A label is a line of text that is updated in place, like a readout. It keeps
+the text, font, colors and size it shows and redraws only what changed: in
+fixed width fonts the runs of changed chars, in proportional fonts everything
+from the char before the first change, because the following glyphs may move.
+A shorter text clears the rest of the old one. Labels need the opaque mode,
+transparent glyphs would not clear the old ones.
+**********************************************************************************/
+
+#ifndef _ST7735_TEXT_H_
+#define _ST7735_TEXT_H_
+
+#include "ST7735.h"
+
+// Alignment, TEXT_ELLIPSIS may be added
+#define TEXT_LEFT	0
+#define TEXT_CENTER	1
+#define TEXT_RIGHT	2
+#define TEXT_JUSTIFY	3
+#define TEXT_ELLIPSIS	0x10
+
+// Lines of a box
+#ifndef TEXT_MAX_LINES
+#define TEXT_MAX_LINES	12
+#endif
+
+// Bytes of a line that ends in an ellipsis
+#define TEXT_LINE_BYTES	128
+
+// TextLine flags
+#define TEXT_LINE_END	0x01	// last line of a paragraph
+#define TEXT_LINE_CUT	0x02	// followed by "..."
+
+typedef struct _textline {
+	uint16_t	start;		// byte offset in the text
+	uint16_t	len;		// bytes
+	int16_t		width;		// pixels, "..." included
+	uint8_t		flags;
+} TextLine;
+
+typedef struct _textbox {
+	int16_t		x, y;
+	uint8_t		w, h;
+	uint8_t		align;
+	uint8_t		spacing;	// pixels between lines
+	// layout of the last text
+	const char	*text;
+	const uint8_t	*font;
+	uint16_t	hash;
+	uint8_t		nlines;
+	TextLine	lines[TEXT_MAX_LINES];
+} TextBox;
+
+// Bytes of the text remembered by a label
+#ifndef LABEL_MAX_BYTES
+#define LABEL_MAX_BYTES	32
+#endif
+
+// A line of text that is rewritten in place, only the changed glyphs are sent
+typedef struct _label {
+	int16_t		x, y;
+	// what the label shows
+	const uint8_t	*font;		// NULL if nothing is drawn
+	uint16_t	fg;
+	uint16_t	bg;
+	int16_t		width;		// pixels
+	uint8_t		height;
+	char		text[LABEL_MAX_BYTES];
+} Label;
+
+extern void lcd7735_textbox_init(TextBox *tb, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t align, uint8_t spacing);
+extern uint8_t lcd7735_textbox_layout(TextBox *tb, const char *st);
+extern void lcd7735_textbox_draw(TextBox *tb, const char *st);
+
+extern void lcd7735_label_init(Label *lb, int16_t x, int16_t y);
+extern int lcd7735_label_update(Label *lb, const char *st);
+
+#endif /* _ST7735_TEXT_H_ */
@@ -0,0 +1,184 @@
+/*********************************************************************************
+Tile-map renderer for ST7735 driver
+
+Every visible line is streamed straight from the atlas (RGB565) or from the
+tile-row cache (indexed) into one address window, no frame buffer is used.
+The viewport always spans the whole screen across the scroll axis, because
+the panel scrolls complete lines only.
+**********************************************************************************/
+
+#include <string.h>
+#include "ST7735.h"
+#include "ST7735_tilemap.h"
+
+typedef struct _tilerow {
+	const void	*tiles;		// atlas the row has been decoded from, NULL if empty
+	const uint16_t	*palette;
+	uint8_t		tile;
+	uint8_t		row;
+	uint16_t	px[16];
+} TileRow;
+
+static TileRow tile_cache[TILEMAP_CACHE_ROWS];
+
+#define tm_landscape()	(lcd7735_getRotation() == LANDSAPE || lcd7735_getRotation() == LANDSAPE_FLIP)
+#define tm_band(tm)		(ST7735_TFTHEIGHT - (tm)->top - (tm)->bottom)
+
+// Pixels of one tile row, indexed atlases are decoded through the cache
+static const uint16_t *tm_tileRow(TileMap *tm, uint8_t tile, uint8_t row) {
+	const uint8_t *src;
+	TileRow *e;
+	uint8_t i;
+
+	if (tm->palette == NULL)
+		return (const uint16_t *)tm->tiles + (tile * tm->tile_size + row) * tm->tile_size;
+
+	e = &tile_cache[(tile + row * 8) & (TILEMAP_CACHE_ROWS - 1)];
+	if (e->tiles != tm->tiles || e->palette != tm->palette || e->tile != tile || e->row != row) {
+		src = (const uint8_t *)tm->tiles + (tile * tm->tile_size + row) * tm->tile_size;
+		for (i = 0; i < tm->tile_size; i++)
+			e->px[i] = tm->palette[src[i]];
+		e->tiles = tm->tiles;
+		e->palette = tm->palette;
+		e->tile = tile;
+		e->row = row;
+	}
+	return e->px;
+}
+
+// Render map pixels (mx,my)-(mx+w-1,my+h-1) into the window at (ax,ay)
+static void tm_render(TileMap *tm, int16_t mx, int16_t my, uint8_t ax, uint8_t ay, uint8_t w, uint8_t h) {
+	uint8_t ts = tm->tile_size;
+	int16_t x, y;
+	uint8_t i, n;
+	const uint16_t *src;
+
+	lcd7735_setAddrWindow(ax, ay, ax+w-1, ay+h-1);
+	for (y = my; y < my + h; y++) {
+		for (i = 0; i < w; i += n) {
+			x = mx + i;
+			n = ts - (x % ts);
+			if (n > w - i)
+				n = w - i;
+			if (y >= tm->map_h * ts || x >= tm->map_w * ts) {
+				for (x = n; x > 0; x--)
+					lcd7735_pushColor(ST7735_BLACK);
+			} else {
+				src = tm_tileRow(tm, tm->map[(y / ts) * tm->map_w + x / ts], y % ts);
+				lcd7735_pushColors(src + (x % ts), n);
+			}
+		}
+	}
+}
+
+// Draw n viewport lines starting at band line c, the hardware scroll maps
+// them onto frame memory as a ring, so the range may wrap around once.
+static void tm_drawBand(TileMap *tm, uint8_t c, uint8_t n) {
+	uint8_t band = tm_band(tm);
+	uint8_t a = (c + tm->offset) % band;
+	uint8_t part = n;
+
+	while (n) {
+		if (a + part > band)
+			part = band - a;
+		if (tm_landscape())
+			tm_render(tm, tm->view_x + c, tm->view_y, tm->top + a, 0, part, ST7735_TFTWIDTH);
+		else
+			tm_render(tm, tm->view_x, tm->view_y + c, 0, tm->top + a, ST7735_TFTWIDTH, part);
+		c += part;
+		n -= part;
+		part = n;
+		a = 0;
+	}
+}
+
+static int16_t tm_clamp(int16_t v, int16_t map_px, int16_t view_px) {
+	if (v > map_px - view_px)
+		v = map_px - view_px;
+	if (v < 0)
+		v = 0;
+	return v;
+}
+
+// Keep the viewport inside the map
+static void tm_clampView(TileMap *tm, int16_t *view_x, int16_t *view_y) {
+	int16_t band = tm_band(tm);
+
+	if (tm_landscape()) {
+		*view_x = tm_clamp(*view_x, tm->map_w * tm->tile_size, band);
+		*view_y = tm_clamp(*view_y, tm->map_h * tm->tile_size, ST7735_TFTWIDTH);
+	} else {
+		*view_x = tm_clamp(*view_x, tm->map_w * tm->tile_size, ST7735_TFTWIDTH);
+		*view_y = tm_clamp(*view_y, tm->map_h * tm->tile_size, band);
+	}
+}
+
+void lcd7735_tilemap_init(TileMap *tm, const uint8_t *map, uint16_t map_w, uint16_t map_h,
+						  const void *tiles, uint8_t tile_size, const uint16_t *palette) {
+	tm->map = map;
+	tm->map_w = map_w;
+	tm->map_h = map_h;
+	tm->tiles = tiles;
+	tm->tile_size = tile_size;
+	tm->palette = palette;
+	tm->top = 0;
+	tm->bottom = 0;
+	tm->offset = 0;
+	tm->view_x = 0;
+	tm->view_y = 0;
+	// palette contents may have changed under the same pointer
+	memset(tile_cache, 0, sizeof(tile_cache));
+}
+
+// Take over the screen between top and bottom fixed lines and draw the map
+void lcd7735_tilemap_show(TileMap *tm, uint8_t top, uint8_t bottom, int16_t view_x, int16_t view_y) {
+	tm->top = top;
+	tm->bottom = bottom;
+	tm->offset = 0;
+	lcd7735_setScrollArea(top, bottom);
+	lcd7735_scrollTo(0);
+	tm_clampView(tm, &view_x, &view_y);
+	tm->view_x = view_x;
+	tm->view_y = view_y;
+	lcd7735_tilemap_redraw(tm);
+}
+
+void lcd7735_tilemap_redraw(TileMap *tm) {
+	tm_drawBand(tm, 0, tm_band(tm));
+}
+
+void lcd7735_tilemap_scroll(TileMap *tm, int16_t dx, int16_t dy) {
+	lcd7735_tilemap_moveTo(tm, tm->view_x + dx, tm->view_y + dy);
+}
+
+// Pan to a new map position. Moves along the scroll axis shift the panel and
+// draw only the exposed lines, moves across it have to redraw the viewport.
+void lcd7735_tilemap_moveTo(TileMap *tm, int16_t view_x, int16_t view_y) {
+	int16_t band = tm_band(tm);
+	int16_t d, cross;
+
+	tm_clampView(tm, &view_x, &view_y);
+	if (tm_landscape()) {
+		d = view_x - tm->view_x;
+		cross = view_y - tm->view_y;
+	} else {
+		d = view_y - tm->view_y;
+		cross = view_x - tm->view_x;
+	}
+	tm->view_x = view_x;
+	tm->view_y = view_y;
+
+	if (cross != 0 || d >= band || d <= -band) {
+		lcd7735_tilemap_redraw(tm);
+		return;
+	}
+	if (d == 0)
+		return;
+
+	tm->offset = (tm->offset + band + d) % band;
+	lcd7735_scrollTo(tm->offset);
+	if (d > 0)
+		tm_drawBand(tm, band - d, d);
+	else
+		tm_drawBand(tm, 0, -d);
+}
@@ -0,0 +1,42 @@
+/*********************************************************************************
+Tile-map renderer for ST7735 driver
+
+A map is a grid of 8-bit tile indices referencing a tile atlas. The atlas holds
+square 8x8 or 16x16 tiles, one after another, either as RGB565 pixels or as
+8-bit indices into a palette. Panning along the panel scroll axis (screen Y in
+portrait, screen X in landscape) uses hardware vertical scrolling and draws only
+the newly exposed lines.
+**********************************************************************************/
+
+#ifndef _ST7735_TILEMAP_H_
+#define _ST7735_TILEMAP_H_
+
+#include "ST7735.h"
+
+// Decoded tile rows kept for indexed atlases, must be a power of 2
+#ifndef TILEMAP_CACHE_ROWS
+#define TILEMAP_CACHE_ROWS	32
+#endif
+
+typedef struct _tilemap {
+	const uint8_t	*map;		// tile indices, map_w*map_h, row by row
+	uint16_t	map_w;		// map size in tiles
+	uint16_t	map_h;
+	const void	*tiles;		// uint16_t RGB565 or uint8_t palette indices
+	const uint16_t	*palette;	// NULL for RGB565 atlas
+	uint8_t		tile_size;	// 8 or 16
+	uint8_t		top;		// fixed lines before the viewport along the scroll axis
+	uint8_t		bottom;		// fixed lines after the viewport along the scroll axis
+	uint8_t		offset;		// current hardware scroll offset
+	int16_t		view_x;		// map pixel shown at the top left of the viewport
+	int16_t		view_y;
+} TileMap;
+
+extern void lcd7735_tilemap_init(TileMap *tm, const uint8_t *map, uint16_t map_w, uint16_t map_h,
+								 const void *tiles, uint8_t tile_size, const uint16_t *palette);
+extern void lcd7735_tilemap_show(TileMap *tm, uint8_t top, uint8_t bottom, int16_t view_x, int16_t view_y);
+extern void lcd7735_tilemap_scroll(TileMap *tm, int16_t dx, int16_t dy);
+extern void lcd7735_tilemap_moveTo(TileMap *tm, int16_t view_x, int16_t view_y);
+extern void lcd7735_tilemap_redraw(TileMap *tm);
+
+#endif /* _ST7735_TILEMAP_H_ */
@@ -0,0 +1,595 @@
+/*********************************************************************************
+Retained widgets for ST7735 driver
+**********************************************************************************/
+
+#include <string.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_ui.h"
+
+// Pixels redrawn around changed text, for glyphs reaching out of their advance
+#define UI_MARGIN	2
+
+#define DEG(a)		((a) * 0.017453293f)
+
+// One row of a dirty rectangle
+static uint16_t ui_row[ST7735_TFTHEIGHT];
+
+static void fillRow(uint16_t *row, uint16_t c, int n) {
+	while (n--)
+		*row++ = c;
+}
+
+static void uiSize(Ui *ui, int *w, int *h) {
+	if (ui->target) {
+		*w = ui->target->w;
+		*h = ui->target->h;
+	} else {
+		*w = lcd7735_getWidth();
+		*h = lcd7735_getHeight();
+	}
+}
+
+// Make font current for measuring, returns the font to restore
+static uint8_t *useFont(const uint8_t *font) {
+	uint8_t *prev = lcd7735_getFont();
+
+	if (font && font != prev)
+		lcd7735_setFont((uint8_t *)font);
+	return prev;
+}
+
+static void restoreFont(uint8_t *prev, const uint8_t *font) {
+	if (prev && prev != font)
+		lcd7735_setFont(prev);
+}
+
+// Font and colors of wg for painting, fg and bg swapped when inverted
+static void useStyle(Widget *wg) {
+	uint16_t fg = wg->flags & WIDGET_INVERTED ? wg->bg : wg->fg;
+	uint16_t bg = wg->flags & WIDGET_INVERTED ? wg->fg : wg->bg;
+
+	if (wg->font && wg->font != lcd7735_getFont())
+		lcd7735_setFont((uint8_t *)wg->font);
+	if (lcd7735_getForeground() != fg)
+		lcd7735_setForeground(fg);
+	if (lcd7735_getBackground() != bg)
+		lcd7735_setBackground(bg);
+}
+
+static void widgetInit(Widget *wg, int16_t x, int16_t y, uint8_t w, uint8_t h,
+					   void (*paint)(Widget *wg, uint16_t *row, int ry, int rx, int n)) {
+	wg->next = NULL;
+	wg->ui = NULL;
+	wg->paint = paint;
+	wg->x = x;
+	wg->y = y;
+	wg->w = w;
+	wg->h = h;
+	wg->flags = WIDGET_VISIBLE;
+	wg->font = lcd7735_getFont();
+	wg->fg = lcd7735_getForeground();
+	wg->bg = lcd7735_getBackground();
+}
+
+// Invalidate a part of a widget in its own coordinates, clipped to it
+static void widgetDirty(Widget *wg, int x, int y, int w, int h) {
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (x + w > wg->w)
+		w = wg->w - x;
+	if (y + h > wg->h)
+		h = wg->h - y;
+	if (wg->ui && (wg->flags & WIDGET_VISIBLE) && w > 0 && h > 0)
+		lcd7735_ui_invalidate(wg->ui, wg->x + x, wg->y + y, w, h);
+}
+
+void lcd7735_ui_init(Ui *ui, uint16_t bg, const UiTarget *target) {
+	int w, h;
+
+	ui->first = NULL;
+	ui->target = target;
+	ui->bg = bg;
+	ui->ndirty = 0;
+	ui->pixels = 0;
+	uiSize(ui, &w, &h);
+	lcd7735_ui_invalidate(ui, 0, 0, w, h);
+}
+
+// Put wg on top of the widgets of ui
+void lcd7735_ui_add(Ui *ui, Widget *wg) {
+	Widget **p;
+
+	for (p = &ui->first; *p; p = &(*p)->next)
+		;
+	*p = wg;
+	wg->next = NULL;
+	wg->ui = ui;
+	widgetDirty(wg, 0, 0, wg->w, wg->h);
+}
+
+void lcd7735_ui_remove(Ui *ui, Widget *wg) {
+	Widget **p;
+
+	for (p = &ui->first; *p; p = &(*p)->next)
+		if (*p == wg) {
+			widgetDirty(wg, 0, 0, wg->w, wg->h);
+			*p = wg->next;
+			wg->next = NULL;
+			wg->ui = NULL;
+			return;
+		}
+}
+
+#define overlap(a, b)	((a)->x0 < (b)->x1 && (b)->x0 < (a)->x1 && (a)->y0 < (b)->y1 && (b)->y0 < (a)->y1)
+#define area(x0, y0, x1, y1)	((int32_t)((x1) - (x0)) * ((y1) - (y0)))
+#define min(a, b)	((a) < (b) ? (a) : (b))
+#define max(a, b)	((a) > (b) ? (a) : (b))
+
+// Add a rectangle to redraw. Overlapping rectangles are merged, so that no
+// pixel is sent twice, and when the list is full the one that grows least.
+void lcd7735_ui_invalidate(Ui *ui, int x, int y, int w, int h) {
+	UiRect r, *d;
+	int sw, sh, i, best;
+	int32_t a, ba;
+
+	uiSize(ui, &sw, &sh);
+	r.x0 = max(x, 0);
+	r.y0 = max(y, 0);
+	r.x1 = min(x + w, sw);
+	r.y1 = min(y + h, sh);
+	if (r.x0 >= r.x1 || r.y0 >= r.y1)
+		return;
+	for (;;) {
+		for (i = 0; i < ui->ndirty && !overlap(&ui->dirty[i], &r); i++)
+			;
+		if (i == ui->ndirty) {
+			if (ui->ndirty < UI_MAX_DIRTY)
+				break;
+			for (i = best = 0, ba = 0x7FFFFFFF; i < ui->ndirty; i++) {
+				d = &ui->dirty[i];
+				a = area(min(d->x0, r.x0), min(d->y0, r.y0), max(d->x1, r.x1), max(d->y1, r.y1))
+					- area(d->x0, d->y0, d->x1, d->y1);
+				if (a < ba) {
+					ba = a;
+					best = i;
+				}
+			}
+			i = best;
+		}
+		d = &ui->dirty[i];
+		r.x0 = min(d->x0, r.x0);
+		r.y0 = min(d->y0, r.y0);
+		r.x1 = max(d->x1, r.x1);
+		r.y1 = max(d->y1, r.y1);
+		*d = ui->dirty[--ui->ndirty];
+	}
+	ui->dirty[ui->ndirty++] = r;
+}
+
+// Redraw the dirty rectangles, returns the number of pixels sent
+uint32_t lcd7735_ui_update(Ui *ui) {
+	uint8_t *font = lcd7735_getFont();
+	uint16_t fg = lcd7735_getForeground(), bg = lcd7735_getBackground();
+	UiRect *d;
+	Widget *wg;
+	int i, y, x0, x1, n;
+
+	ui->pixels = 0;
+	for (i = 0; i < ui->ndirty; i++) {
+		d = &ui->dirty[i];
+		n = d->x1 - d->x0;
+		if (ui->target)
+			ui->target->window(ui->target->ctx, d->x0, d->y0, d->x1 - 1, d->y1 - 1);
+		else
+			lcd7735_setAddrWindow(d->x0, d->y0, d->x1 - 1, d->y1 - 1);
+		for (y = d->y0; y < d->y1; y++) {
+			fillRow(ui_row, ui->bg, n);
+			for (wg = ui->first; wg; wg = wg->next) {
+				if (!(wg->flags & WIDGET_VISIBLE) || y < wg->y || y >= wg->y + wg->h)
+					continue;
+				x0 = max(d->x0, wg->x);
+				x1 = min(d->x1, wg->x + wg->w);
+				if (x0 >= x1)
+					continue;
+				useStyle(wg);
+				wg->paint(wg, ui_row + x0 - d->x0, y - wg->y, x0 - wg->x, x1 - x0);
+			}
+			if (ui->target)
+				ui->target->pixels(ui->target->ctx, ui_row, n);
+			else
+				lcd7735_pushColors(ui_row, n);
+		}
+		ui->pixels += (uint32_t)n * (d->y1 - d->y0);
+	}
+	ui->ndirty = 0;
+
+	lcd7735_setForeground(fg);
+	lcd7735_setBackground(bg);
+	if (font)
+		lcd7735_setFont(font);
+	return ui->pixels;
+}
+
+// The topmost visible widget at x,y or NULL
+Widget *lcd7735_ui_hit(Ui *ui, int x, int y) {
+	Widget *wg, *top = NULL;
+
+	for (wg = ui->first; wg; wg = wg->next)
+		if ((wg->flags & WIDGET_VISIBLE) && x >= wg->x && x < wg->x + wg->w && y >= wg->y && y < wg->y + wg->h)
+			top = wg;
+	return top;
+}
+
+void lcd7735_ui_show(Widget *wg, uint8_t visible) {
+	if (!visible == !(wg->flags & WIDGET_VISIBLE))
+		return;
+	wg->flags ^= WIDGET_VISIBLE;
+	if (wg->ui)
+		lcd7735_ui_invalidate(wg->ui, wg->x, wg->y, wg->w, wg->h);
+}
+
+void lcd7735_ui_setColors(Widget *wg, uint16_t fg, uint16_t bg) {
+	if (wg->fg == fg && wg->bg == bg)
+		return;
+	wg->fg = fg;
+	wg->bg = bg;
+	widgetDirty(wg, 0, 0, wg->w, wg->h);
+}
+
+// Labels
+
+static void labelLayout(UiLabel *l) {
+	Widget *wg = &l->wg;
+	uint8_t *prev = useFont(wg->font);
+
+	l->tw = lcd7735_textWidthN(l->text, -1);
+	l->ty = (wg->h - lcd7735_getFontHeight()) / 2;
+	switch (l->align & 0x03) {
+	case TEXT_CENTER:
+		l->tx = (wg->w - l->tw) / 2;
+		break;
+	case TEXT_RIGHT:
+		l->tx = wg->w - l->tw;
+		break;
+	default:
+		l->tx = 0;
+	}
+	restoreFont(prev, wg->font);
+}
+
+static void paintLabel(Widget *wg, uint16_t *row, int ry, int rx, int n) {
+	UiLabel *l = (UiLabel *)wg;
+
+	if (!(wg->flags & WIDGET_TRANSPARENT))
+		fillRow(row, lcd7735_getBackground(), n);
+	lcd7735_textRow(l->text, -1, ry - l->ty, l->tx - rx, row, n);
+}
+
+void lcd7735_ui_labelInit(UiLabel *l, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t align, const char *st) {
+	widgetInit(&l->wg, x, y, w, h, paintLabel);
+	l->align = align;
+	strncpy(l->text, st, UI_TEXT_BYTES - 1);
+	l->text[UI_TEXT_BYTES - 1] = 0;
+	labelLayout(l);
+}
+
+// Change the text, the text rows are invalidated from the char before the
+// first change if the text doesn't move, else over the old and the new text
+void lcd7735_ui_setText(UiLabel *l, const char *st) {
+	Widget *wg = &l->wg;
+	int otx = l->tx, otw = l->tw, i, x0, x1, th;
+	uint8_t *prev;
+
+	if (!strncmp(l->text, st, UI_TEXT_BYTES - 1))
+		return;
+	for (i = 0; st[i] && st[i] == l->text[i]; i++)
+		;
+	while (i > 0 && (st[i] & 0xC0) == 0x80)
+		i--;
+	if (i > 0)
+		for (i--; i > 0 && (st[i] & 0xC0) == 0x80; i--)
+			;
+	prev = useFont(wg->font);
+	x0 = lcd7735_textWidthN(st, i);
+	th = lcd7735_getFontHeight();
+	restoreFont(prev, wg->font);
+
+	strncpy(l->text, st, UI_TEXT_BYTES - 1);
+	labelLayout(l);
+	if (l->tx == otx)
+		x0 += otx;
+	else
+		x0 = min(otx, l->tx);
+	x1 = max(otx + otw, l->tx + l->tw);
+	widgetDirty(wg, x0 - UI_MARGIN, l->ty, x1 - x0 + 2 * UI_MARGIN, th);
+}
+
+// Values
+
+static void valueText(UiValue *v, char *buf) {
+	char digits[12];
+	uint32_t u = v->value < 0 ? -(uint32_t)v->value : (uint32_t)v->value;
+	int n = 0, i = 0;
+	const char *p;
+
+	do {
+		digits[n++] = '0' + u % 10;
+		u /= 10;
+	} while (u || n <= v->decimals);
+	if (v->value < 0)
+		buf[i++] = '-';
+	while (n--) {
+		buf[i++] = digits[n];
+		if (n == v->decimals && n)
+			buf[i++] = '.';
+	}
+	for (p = v->unit; p && *p && i < UI_TEXT_BYTES - 1; )
+		buf[i++] = *p++;
+	buf[i] = 0;
+}
+
+void lcd7735_ui_valueInit(UiValue *v, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t decimals, const char *unit) {
+	char buf[UI_TEXT_BYTES];
+
+	v->value = 0;
+	v->decimals = decimals > 9 ? 9 : decimals;
+	v->unit = unit;
+	valueText(v, buf);
+	lcd7735_ui_labelInit(&v->label, x, y, w, h, TEXT_RIGHT, buf);
+}
+
+// Set the value in units of the last decimal, 1234 with 2 decimals is 12.34
+void lcd7735_ui_setValue(UiValue *v, int32_t value) {
+	char buf[UI_TEXT_BYTES];
+
+	if (v->value == value)
+		return;
+	v->value = value;
+	valueText(v, buf);
+	lcd7735_ui_setText(&v->label, buf);
+}
+
+// Bars
+
+#define barVertical(b)	((b)->wg.h > (b)->wg.w)
+
+static void paintBar(Widget *wg, uint16_t *row, int ry, int rx, int n) {
+	UiBar *b = (UiBar *)wg;
+	uint16_t ink = lcd7735_getForeground(), paper = lcd7735_getBackground();
+	uint8_t opaque = !(wg->flags & WIDGET_TRANSPARENT);
+	int i, c, on;
+
+	if (ry == 0 || ry == wg->h - 1) {
+		fillRow(row, ink, n);
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		c = rx + i;
+		if (c == 0 || c == wg->w - 1)
+			on = 1;
+		else if (barVertical(b))
+			on = wg->h - 2 - ry < b->fill;
+		else
+			on = c - 1 < b->fill;
+		if (on)
+			row[i] = ink;
+		else if (opaque)
+			row[i] = paper;
+	}
+}
+
+void lcd7735_ui_barInit(UiBar *b, int16_t x, int16_t y, uint8_t w, uint8_t h, uint16_t max) {
+	widgetInit(&b->wg, x, y, w, h, paintBar);
+	b->value = 0;
+	b->max = max ? max : 1;
+	b->fill = 0;
+}
+
+// Only the pixels between the old and the new end of the bar are invalidated
+void lcd7735_ui_setBar(UiBar *b, uint16_t value) {
+	int len = (barVertical(b) ? b->wg.h : b->wg.w) - 2, fill, lo, hi;
+
+	if (value > b->max)
+		value = b->max;
+	b->value = value;
+	fill = (uint32_t)value * len / b->max;
+	if (fill == b->fill)
+		return;
+	lo = min(fill, b->fill);
+	hi = max(fill, b->fill);
+	b->fill = fill;
+	if (barVertical(b))
+		widgetDirty(&b->wg, 1, b->wg.h - 1 - hi, b->wg.w - 2, hi - lo);
+	else
+		widgetDirty(&b->wg, 1 + lo, 1, hi - lo, b->wg.h - 2);
+}
+
+// Gauges
+
+static void paintGauge(Widget *wg, uint16_t *row, int ry, int rx, int n) {
+	UiGauge *g = (UiGauge *)wg;
+	uint16_t ink = lcd7735_getForeground(), paper = lcd7735_getBackground();
+	uint8_t opaque = !(wg->flags & WIDGET_TRANSPARENT);
+	// doubled coordinates of the pixel centers from the center of the ring
+	int r2 = wg->w, in2 = wg->w - 2 * g->thickness, dy = 2 * ry + 1 - wg->w, dx, d, i;
+	float a, end = (float)UI_GAUGE_SWEEP * g->value / g->max;
+
+	for (i = 0; i < n; i++) {
+		dx = 2 * (rx + i) + 1 - wg->w;
+		d = dx * dx + dy * dy;
+		if (d < r2 * r2 && d >= in2 * in2) {
+			a = atan2f(dy, dx) * 57.29578f - UI_GAUGE_START;
+			if (a < 0)
+				a += 360;
+			if (a < UI_GAUGE_SWEEP) {
+				row[i] = a < end ? ink : g->track;
+				continue;
+			}
+		}
+		if (opaque)
+			row[i] = paper;
+	}
+}
+
+// A gauge of size x size pixels at x,y
+void lcd7735_ui_gaugeInit(UiGauge *g, int16_t x, int16_t y, uint8_t size, uint8_t thickness, uint16_t max) {
+	widgetInit(&g->wg, x, y, size, size, paintGauge);
+	g->value = 0;
+	g->max = max ? max : 1;
+	g->thickness = thickness;
+	// half way between fg and bg
+	g->track = ((g->wg.fg >> 1) & 0x7BEF) + ((g->wg.bg >> 1) & 0x7BEF);
+}
+
+// Only the bounding box of the sector between the old and the new value is
+// invalidated: its corners and the points where it crosses an axis
+void lcd7735_ui_setGauge(UiGauge *g, uint16_t value) {
+	float r = g->wg.w / 2.0f, in = r - g->thickness, a0, a1, a, px[8], py[8], x0, y0, x1, y1;
+	int n = 0, i, k;
+
+	if (value > g->max)
+		value = g->max;
+	if (value == g->value)
+		return;
+	a0 = UI_GAUGE_START + (float)UI_GAUGE_SWEEP * min(value, g->value) / g->max;
+	a1 = UI_GAUGE_START + (float)UI_GAUGE_SWEEP * max(value, g->value) / g->max;
+	g->value = value;
+	for (a = a0, i = 0; i < 2; i++, a = a1) {
+		px[n] = r * cosf(DEG(a));
+		py[n++] = r * sinf(DEG(a));
+		px[n] = in * cosf(DEG(a));
+		py[n++] = in * sinf(DEG(a));
+	}
+	for (k = 90 * (int)(a0 / 90 + 1); k < a1; k += 90) {
+		px[n] = r * cosf(DEG(k));
+		py[n++] = r * sinf(DEG(k));
+	}
+	x0 = x1 = px[0];
+	y0 = y1 = py[0];
+	for (i = 1; i < n; i++) {
+		x0 = min(x0, px[i]);
+		x1 = max(x1, px[i]);
+		y0 = min(y0, py[i]);
+		y1 = max(y1, py[i]);
+	}
+	widgetDirty(&g->wg, (int)floorf(r + x0) - 1, (int)floorf(r + y0) - 1,
+				(int)ceilf(x1 - x0) + 3, (int)ceilf(y1 - y0) + 3);
+}
+
+// Buttons
+
+static void paintButton(Widget *wg, uint16_t *row, int ry, int rx, int n) {
+	uint16_t ink = lcd7735_getForeground();
+
+	if (ry == 0 || ry == wg->h - 1) {
+		fillRow(row, ink, n);
+		return;
+	}
+	paintLabel(wg, row, ry, rx, n);
+	if (rx == 0)
+		row[0] = ink;
+	if (rx + n == wg->w)
+		row[n - 1] = ink;
+}
+
+void lcd7735_ui_buttonInit(UiButton *b, int16_t x, int16_t y, uint8_t w, uint8_t h, const char *st) {
+	lcd7735_ui_labelInit(&b->label, x, y, w, h, TEXT_CENTER, st);
+	b->label.wg.paint = paintButton;
+}
+
+void lcd7735_ui_setPressed(UiButton *b, uint8_t pressed) {
+	Widget *wg = &b->label.wg;
+
+	if (!pressed == !(wg->flags & WIDGET_INVERTED))
+		return;
+	wg->flags ^= WIDGET_INVERTED;
+	widgetDirty(wg, 0, 0, wg->w, wg->h);
+}
+
+// Lists
+
+static void paintList(Widget *wg, uint16_t *row, int ry, int rx, int n) {
+	UiList *l = (UiList *)wg;
+	uint16_t ink = lcd7735_getForeground(), paper = lcd7735_getBackground();
+	int item = l->top + ry / l->row_h;
+
+	if (item >= l->count) {
+		if (!(wg->flags & WIDGET_TRANSPARENT))
+			fillRow(row, paper, n);
+		return;
+	}
+	if (item == l->sel) {
+		// the selected item is inverted
+		fillRow(row, ink, n);
+		lcd7735_setForeground(paper);
+		lcd7735_setBackground(ink);
+		lcd7735_textRow(l->items[item], -1, ry % l->row_h - 1, 2 - rx, row, n);
+		lcd7735_setForeground(ink);
+		lcd7735_setBackground(paper);
+		return;
+	}
+	if (!(wg->flags & WIDGET_TRANSPARENT))
+		fillRow(row, paper, n);
+	lcd7735_textRow(l->items[item], -1, ry % l->row_h - 1, 2 - rx, row, n);
+}
+
+// A list of count items, each a row of the font height + 2 pixels
+void lcd7735_ui_listInit(UiList *l, int16_t x, int16_t y, uint8_t w, uint8_t h, const char * const *items, uint8_t count) {
+	widgetInit(&l->wg, x, y, w, h, paintList);
+	l->items = items;
+	l->count = count;
+	l->sel = 0;
+	l->top = 0;
+	l->row_h = lcd7735_getFontHeight() + 2;
+}
+
+// Select an item, only the old and the new selection are invalidated unless
+// the list has to scroll
+void lcd7735_ui_select(UiList *l, uint8_t sel) {
+	int rows = l->wg.h / l->row_h, old = l->sel;
+
+	if (sel >= l->count)
+		sel = l->count ? l->count - 1 : 0;
+	if (sel == old)
+		return;
+	l->sel = sel;
+	if (sel < l->top || sel >= l->top + rows) {
+		l->top = sel < l->top ? sel : sel - rows + 1;
+		widgetDirty(&l->wg, 0, 0, l->wg.w, l->wg.h);
+		return;
+	}
+	if (old >= l->top && old < l->top + rows)
+		widgetDirty(&l->wg, 0, (old - l->top) * l->row_h, l->wg.w, l->row_h);
+	widgetDirty(&l->wg, 0, (sel - l->top) * l->row_h, l->wg.w, l->row_h);
+}
+
+// Frame buffer target, pixels past the end of the window are dropped
+
+void lcd7735_ui_frameWindow(void *ctx, int x0, int y0, int x1, int y1) {
+	UiFrame *f = (UiFrame *)ctx;
+
+	f->x0 = x0;
+	f->x1 = x1;
+	f->y1 = y1;
+	f->x = x0;
+	f->y = y0;
+}
+
+void lcd7735_ui_framePixels(void *ctx, const uint16_t *p, int n) {
+	UiFrame *f = (UiFrame *)ctx;
+
+	while (n-- && f->y <= f->y1) {
+		f->pixels[f->y * f->w + f->x] = *p++;
+		if (++f->x > f->x1) {
+			f->x = f->x0;
+			f->y++;
+		}
+	}
+}
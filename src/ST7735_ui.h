@@ -0,0 +1,165 @@
+/*********************************************************************************
+Retained widgets for ST7735 driver
+
+Widgets are structs owned by the caller (no heap) that are added to a Ui, the
+last one added is on top. Changing a property invalidates only the part of the
+screen it affects: the changed text of a label, the columns between the old and
+the new end of a bar, the sector between the old and the new gauge value, the
+old and the new selected item of a list. lcd7735_ui_update() redraws the dirty
+rectangles, merged where they overlap, one window each: every row is composed
+in RAM from the Ui background and the widgets under it in z-order and sent
+once, so nothing flickers and covered pixels cost nothing on the bus.
+
+Widgets take the current font and colors when they are initialized. The output
+goes to the panel or to a UiTarget, e.g. a UiFrame in RAM, so screens can be
+tested on a host with the driver's fonts and no panel.
+**********************************************************************************/
+
+#ifndef _ST7735_UI_H_
+#define _ST7735_UI_H_
+
+#include "ST7735.h"
+#include "ST7735_text.h"
+
+// Dirty rectangles kept between updates, more are merged
+#ifndef UI_MAX_DIRTY
+#define UI_MAX_DIRTY	8
+#endif
+
+// Bytes of the text of a label
+#ifndef UI_TEXT_BYTES
+#define UI_TEXT_BYTES	24
+#endif
+
+// Widget flags
+#define WIDGET_VISIBLE		0x01
+#define WIDGET_TRANSPARENT	0x02	// the background isn't filled, only glyphs and marks are drawn
+#define WIDGET_INVERTED		0x04	// fg and bg swapped
+
+// Gauge arc: clockwise from the bottom left to the bottom right
+#define UI_GAUGE_START	135
+#define UI_GAUGE_SWEEP	270
+
+struct _ui;
+
+typedef struct _widget {
+	struct _widget	*next;		// the widget above
+	struct _ui	*ui;
+	// draw n pixels of row ry of the widget from column rx into row
+	void		(*paint)(struct _widget *wg, uint16_t *row, int ry, int rx, int n);
+	int16_t		x, y;
+	uint8_t		w, h;
+	uint8_t		flags;
+	const uint8_t	*font;
+	uint16_t	fg;
+	uint16_t	bg;
+} Widget;
+
+// Text in the font of the widget, left, centered or right aligned (TEXT_*)
+// and centered vertically
+typedef struct _uilabel {
+	Widget		wg;
+	uint8_t		align;
+	int16_t		tx, ty;		// text position in the widget
+	int16_t		tw;		// text width
+	char		text[UI_TEXT_BYTES];
+} UiLabel;
+
+// A number with a fixed number of decimals and a unit, right aligned
+typedef struct _uivalue {
+	UiLabel		label;
+	int32_t		value;
+	uint8_t		decimals;
+	const char	*unit;
+} UiValue;
+
+// A 1 pixel frame filled from the left, or from the bottom if it is taller
+// than wide
+typedef struct _uibar {
+	Widget		wg;
+	uint16_t	value;
+	uint16_t	max;
+	uint8_t		fill;		// filled pixels
+} UiBar;
+
+// A ring of UI_GAUGE_SWEEP degrees, filled in fg up to the value, the rest
+// in the track color
+typedef struct _uigauge {
+	Widget		wg;
+	uint16_t	value;
+	uint16_t	max;
+	uint16_t	track;
+	uint8_t		thickness;
+} UiGauge;
+
+// A framed label, inverted while pressed
+typedef struct _uibutton {
+	UiLabel		label;
+} UiButton;
+
+// Rows of items, the selected one inverted, scrolled to keep it visible
+typedef struct _uilist {
+	Widget		wg;
+	const char * const *items;
+	uint8_t		count;
+	uint8_t		sel;
+	uint8_t		top;		// first visible item
+	uint8_t		row_h;
+} UiList;
+
+// Output of lcd7735_ui_update(), a window is opened and filled row by row
+typedef struct _uitarget {
+	void		*ctx;
+	uint16_t	w, h;
+	void		(*window)(void *ctx, int x0, int y0, int x1, int y1);
+	void		(*pixels)(void *ctx, const uint16_t *p, int n);
+} UiTarget;
+
+// A frame buffer target, ctx of lcd7735_ui_frameWindow/framePixels
+typedef struct _uiframe {
+	uint16_t	*pixels;	// w*h, row by row
+	uint16_t	w;
+	int16_t		x0, x1, y1;	// current window
+	int16_t		x, y;		// next pixel
+} UiFrame;
+
+typedef struct _uirect {
+	int16_t		x0, y0, x1, y1;	// x1, y1 excluded
+} UiRect;
+
+typedef struct _ui {
+	Widget		*first;		// bottom of the z-order
+	const UiTarget	*target;	// NULL for the panel
+	uint16_t	bg;
+	uint8_t		ndirty;
+	UiRect		dirty[UI_MAX_DIRTY];
+	uint32_t	pixels;		// sent by the last update
+} Ui;
+
+extern void lcd7735_ui_init(Ui *ui, uint16_t bg, const UiTarget *target);
+extern void lcd7735_ui_add(Ui *ui, Widget *wg);
+extern void lcd7735_ui_remove(Ui *ui, Widget *wg);
+extern void lcd7735_ui_invalidate(Ui *ui, int x, int y, int w, int h);
+extern uint32_t lcd7735_ui_update(Ui *ui);
+extern Widget *lcd7735_ui_hit(Ui *ui, int x, int y);
+
+extern void lcd7735_ui_show(Widget *wg, uint8_t visible);
+extern void lcd7735_ui_setColors(Widget *wg, uint16_t fg, uint16_t bg);
+
+extern void lcd7735_ui_labelInit(UiLabel *l, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t align, const char *st);
+extern void lcd7735_ui_setText(UiLabel *l, const char *st);
+extern void lcd7735_ui_valueInit(UiValue *v, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t decimals, const char *unit);
+extern void lcd7735_ui_setValue(UiValue *v, int32_t value);
+extern void lcd7735_ui_barInit(UiBar *b, int16_t x, int16_t y, uint8_t w, uint8_t h, uint16_t max);
+extern void lcd7735_ui_setBar(UiBar *b, uint16_t value);
+extern void lcd7735_ui_gaugeInit(UiGauge *g, int16_t x, int16_t y, uint8_t size, uint8_t thickness, uint16_t max);
+extern void lcd7735_ui_setGauge(UiGauge *g, uint16_t value);
+extern void lcd7735_ui_buttonInit(UiButton *b, int16_t x, int16_t y, uint8_t w, uint8_t h, const char *st);
+extern void lcd7735_ui_setPressed(UiButton *b, uint8_t pressed);
+extern void lcd7735_ui_listInit(UiList *l, int16_t x, int16_t y, uint8_t w, uint8_t h, const char * const *items, uint8_t count);
+extern void lcd7735_ui_select(UiList *l, uint8_t sel);
+
+extern void lcd7735_ui_frameWindow(void *ctx, int x0, int y0, int x1, int y1);
+extern void lcd7735_ui_framePixels(void *ctx, const uint16_t *p, int n);
+
+#endif /* _ST7735_UI_H_ */
@@ -0,0 +1,483 @@
+// Generated by  : imgconv
+// Generated from: SourceCodePro-64.bdf
+// Format        : anti-aliased font, see lcd7735_setFont()
+// Size          : 7606 Bytes
+
+const unsigned char AAFont16[0x1DB6] ={
+0x00, 0x04, 0x0A, 0x10, 0x20, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0010 (16)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0020 (32)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0030 (48)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0040 (64)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0050 (80)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0060 (96)
+0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x00, 0x00,   // 0x0070 (112)
+0x04, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,   // 0x0080 (128)
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE4, 0x00, 0x00, 0x00, 0x09, 0xF6,   // 0x0090 (144)
+0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00A0 (160)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00B0 (176)
+0x04, 0xF8, 0x0B, 0xF0, 0x00, 0x04, 0xF5, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x08, 0xB0, 0x00, 0x00,   // 0x00C0 (192)
+0xF3, 0x08, 0xA0, 0x00, 0x00, 0x90, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00D0 (208)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00E0 (224)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00F0 (240)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0100 (256)
+0x00, 0x06, 0x01, 0x60, 0x00, 0x00, 0x0C, 0x04, 0x80, 0x00, 0x00, 0x0B, 0x05, 0x80, 0x00, 0x06,   // 0x0110 (272)
+0xBE, 0xBD, 0xC6, 0x00, 0x02, 0x79, 0x49, 0x72, 0x00, 0x00, 0x67, 0x0B, 0x10, 0x00, 0x08, 0xDC,   // 0x0120 (288)
+0xBE, 0xB3, 0x00, 0x03, 0xB6, 0x4C, 0x41, 0x00, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x00, 0xC0, 0x48,   // 0x0130 (304)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0140 (320)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,   // 0x0150 (336)
+0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x4A, 0xEA, 0x30, 0x00, 0x02, 0xF7, 0x47, 0xD1, 0x00, 0x04,   // 0x0160 (352)
+0xC0, 0x00, 0x00, 0x00, 0x01, 0xCB, 0x50, 0x00, 0x00, 0x00, 0x17, 0xDE, 0x60, 0x00, 0x00, 0x00,   // 0x0170 (368)
+0x05, 0xE4, 0x00, 0x03, 0x10, 0x00, 0xC7, 0x00, 0x07, 0xE9, 0x8A, 0xC1, 0x00, 0x00, 0x27, 0xD6,   // 0x0180 (384)
+0x10, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0190 (400)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x01A0 (416)
+0x02, 0x40, 0x00, 0x00, 0x00, 0x3B, 0x8B, 0x10, 0x1B, 0x10, 0x95, 0x08, 0x40, 0x96, 0x00, 0xA4,   // 0x01B0 (432)
+0x08, 0x48, 0x80, 0x00, 0x5B, 0x5D, 0x14, 0x00, 0x00, 0x05, 0x82, 0x05, 0x82, 0x00, 0x00, 0x74,   // 0x01C0 (448)
+0x5A, 0x5C, 0x20, 0x06, 0xB0, 0xA4, 0x08, 0x40, 0x5D, 0x10, 0x95, 0x08, 0x40, 0x13, 0x00, 0x3C,   // 0x01D0 (464)
+0x8C, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x01E0 (480)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x01F0 (496)
+0x00, 0x4B, 0x91, 0x00, 0x00, 0x01, 0xE5, 0x98, 0x00, 0x00, 0x04, 0xB0, 0x5A, 0x00, 0x00, 0x02,   // 0x0200 (512)
+0xE1, 0xC5, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x06, 0xDD, 0x10, 0x0F, 0x20, 0x2F, 0x28,   // 0x0210 (528)
+0x90, 0x6A, 0x00, 0x7B, 0x00, 0xC9, 0xD4, 0x00, 0x3F, 0x30, 0x2E, 0xD3, 0x00, 0x08, 0xFB, 0xE8,   // 0x0220 (544)
+0x8E, 0x30, 0x00, 0x24, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0230 (560)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0240 (576)
+0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00,   // 0x0250 (592)
+0x04, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0260 (608)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0270 (624)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0280 (640)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,   // 0x0290 (656)
+0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x00,   // 0x02A0 (672)
+0x0A, 0x70, 0x00, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F,   // 0x02B0 (688)
+0x10, 0x00, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x00, 0x03, 0xD1,   // 0x02C0 (704)
+0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x01, 0x50,   // 0x02D0 (720)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x00,   // 0x02E0 (736)
+0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE1, 0x00, 0x00, 0x00,   // 0x02F0 (752)
+0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00,   // 0x0300 (768)
+0x8B, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x04, 0xD0,   // 0x0310 (784)
+0x00, 0x00, 0x00, 0x1C, 0x40, 0x00, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,   // 0x0320 (800)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0330 (816)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x04,   // 0x0340 (832)
+0x10, 0xB0, 0x32, 0x00, 0x05, 0xDB, 0xED, 0xB3, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x3D,   // 0x0350 (848)
+0x5C, 0x00, 0x00, 0x00, 0xC3, 0x08, 0x80, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,   // 0x0360 (864)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0370 (880)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0380 (896)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00,   // 0x0390 (912)
+0x04, 0xB0, 0x00, 0x00, 0x06, 0x89, 0xD8, 0x84, 0x00, 0x06, 0x89, 0xD8, 0x84, 0x00, 0x00, 0x04,   // 0x03A0 (928)
+0xB0, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x03B0 (944)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x03C0 (960)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x03D0 (976)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x03E0 (992)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x03F0 (1008)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFB,   // 0x0400 (1024)
+0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x01, 0xC4, 0x00, 0x00, 0x00, 0x1D, 0x60, 0x00,   // 0x0410 (1040)
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0420 (1056)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0430 (1072)
+0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x44, 0x42, 0x00, 0x08, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00,   // 0x0440 (1088)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0450 (1104)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0460 (1120)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0470 (1136)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0480 (1152)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0490 (1168)
+0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x0A, 0xF7,   // 0x04A0 (1184)
+0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x04B0 (1200)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,   // 0x04C0 (1216)
+0x00, 0x00, 0x02, 0xE1, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00,   // 0x04D0 (1232)
+0x00, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x06,   // 0x04E0 (1248)
+0xA0, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,   // 0x04F0 (1264)
+0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x05, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,   // 0x0500 (1280)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0510 (1296)
+0x00, 0x16, 0x84, 0x00, 0x00, 0x01, 0xCB, 0x8D, 0x90, 0x00, 0x08, 0xB0, 0x01, 0xE3, 0x00, 0x0B,   // 0x0520 (1312)
+0x50, 0x00, 0x98, 0x00, 0x0F, 0x44, 0xA1, 0x8A, 0x00, 0x0F, 0x48, 0xF3, 0x8B, 0x00, 0x0E, 0x40,   // 0x0530 (1328)
+0x30, 0x88, 0x00, 0x0B, 0x60, 0x00, 0xA7, 0x00, 0x06, 0xD1, 0x03, 0xE1, 0x00, 0x00, 0x9E, 0xBE,   // 0x0540 (1344)
+0x60, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0550 (1360)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0560 (1376)
+0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xCF, 0xF4, 0x00, 0x00, 0x00, 0x44, 0xF4, 0x00, 0x00, 0x00,   // 0x0570 (1392)
+0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,   // 0x0580 (1408)
+0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF,   // 0x0590 (1424)
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x05A0 (1440)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x05B0 (1456)
+0x00, 0x28, 0x83, 0x00, 0x00, 0x08, 0xD8, 0x8E, 0x60, 0x00, 0x05, 0x10, 0x05, 0xE0, 0x00, 0x00,   // 0x05C0 (1472)
+0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x01,   // 0x05D0 (1488)
+0xC6, 0x00, 0x00, 0x00, 0x1C, 0x60, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF,   // 0x05E0 (1504)
+0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x05F0 (1520)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0600 (1536)
+0x00, 0x28, 0x85, 0x00, 0x00, 0x08, 0xD8, 0x8D, 0x90, 0x00, 0x03, 0x10, 0x02, 0xF3, 0x00, 0x00,   // 0x0610 (1552)
+0x00, 0x02, 0xF2, 0x00, 0x00, 0x04, 0x7D, 0x60, 0x00, 0x00, 0x0B, 0xDB, 0x40, 0x00, 0x00, 0x00,   // 0x0620 (1568)
+0x04, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x19, 0x20, 0x03, 0xE6, 0x00, 0x08, 0xEB, 0xBF,   // 0x0630 (1584)
+0x80, 0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0640 (1600)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0650 (1616)
+0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x03, 0xCA, 0x80, 0x00, 0x00,   // 0x0660 (1632)
+0x1C, 0x3B, 0x80, 0x00, 0x00, 0xB6, 0x0B, 0x80, 0x00, 0x08, 0x90, 0x0B, 0x80, 0x00, 0x5F, 0x88,   // 0x0670 (1648)
+0x8D, 0xB8, 0x00, 0x48, 0x88, 0x8D, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B,   // 0x0680 (1664)
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0690 (1680)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x06A0 (1696)
+0x01, 0x44, 0x44, 0x40, 0x00, 0x04, 0xFB, 0xBB, 0xB0, 0x00, 0x04, 0xD0, 0x00, 0x00, 0x00, 0x04,   // 0x06B0 (1712)
+0xB0, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xFD, 0x50, 0x00, 0x03, 0x81, 0x07, 0xF4, 0x00, 0x00, 0x00,   // 0x06C0 (1728)
+0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x09, 0x10, 0x03, 0xF4, 0x00, 0x18, 0xEB, 0xCE,   // 0x06D0 (1744)
+0x60, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x06E0 (1760)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x06F0 (1776)
+0x00, 0x03, 0x88, 0x30, 0x00, 0x00, 0x8E, 0x88, 0xD5, 0x00, 0x04, 0xE1, 0x00, 0x10, 0x00, 0x09,   // 0x0700 (1792)
+0x80, 0x00, 0x00, 0x00, 0x0B, 0x46, 0xBA, 0x50, 0x00, 0x0E, 0xC8, 0x46, 0xE5, 0x00, 0x0C, 0x70,   // 0x0710 (1808)
+0x00, 0x8A, 0x00, 0x0A, 0x70, 0x00, 0x8B, 0x00, 0x04, 0xD2, 0x01, 0xC7, 0x00, 0x00, 0x7E, 0xBE,   // 0x0720 (1824)
+0x90, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0730 (1840)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0740 (1856)
+0x04, 0x44, 0x44, 0x43, 0x00, 0x0B, 0xBB, 0xBB, 0xE8, 0x00, 0x00, 0x00, 0x04, 0xC1, 0x00, 0x00,   // 0x0750 (1872)
+0x00, 0x1D, 0x30, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x04,   // 0x0760 (1888)
+0xE0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80,   // 0x0770 (1904)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0780 (1920)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0790 (1936)
+0x00, 0x16, 0x86, 0x00, 0x00, 0x01, 0xCA, 0x8B, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0xD4, 0x00, 0x06,   // 0x07A0 (1952)
+0xC0, 0x00, 0xC3, 0x00, 0x01, 0xCA, 0x36, 0x90, 0x00, 0x00, 0x89, 0xCF, 0x50, 0x00, 0x08, 0x70,   // 0x07B0 (1968)
+0x03, 0xD5, 0x00, 0x0F, 0x00, 0x00, 0x8B, 0x00, 0x0D, 0x70, 0x00, 0xB8, 0x00, 0x03, 0xDD, 0xBE,   // 0x07C0 (1984)
+0xB1, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x07D0 (2000)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x07E0 (2016)
+0x00, 0x27, 0x83, 0x00, 0x00, 0x04, 0xD8, 0x8E, 0x60, 0x00, 0x0D, 0x60, 0x02, 0xF2, 0x00, 0x0F,   // 0x07F0 (2032)
+0x10, 0x00, 0xA7, 0x00, 0x0E, 0x50, 0x01, 0xC8, 0x00, 0x06, 0xE8, 0x8D, 0xA8, 0x00, 0x00, 0x48,   // 0x0800 (2048)
+0x71, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x03, 0x10, 0x09, 0xB0, 0x00, 0x08, 0xEB, 0xDB,   // 0x0810 (2064)
+0x10, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0820 (2080)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0830 (2096)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00,   // 0x0840 (2112)
+0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0850 (2128)
+0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x0A, 0xF7,   // 0x0860 (2144)
+0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0870 (2160)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0880 (2176)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x00,   // 0x0890 (2192)
+0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x08A0 (2208)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xFB,   // 0x08B0 (2224)
+0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x01, 0xC4, 0x00, 0x00, 0x00, 0x1D, 0x60, 0x00,   // 0x08C0 (2240)
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x08D0 (2256)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1A, 0xA1, 0x00, 0x00,   // 0x08E0 (2272)
+0x07, 0xD6, 0x00, 0x00, 0x01, 0xBB, 0x20, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4D,   // 0x08F0 (2288)
+0x81, 0x00, 0x00, 0x00, 0x01, 0x8C, 0x30, 0x00, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x00, 0x00,   // 0x0900 (2304)
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0910 (2320)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0920 (2336)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,   // 0x0930 (2352)
+0xBB, 0xBB, 0xB6, 0x00, 0x03, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBB,   // 0x0940 (2368)
+0xBB, 0xB6, 0x00, 0x03, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0950 (2384)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0960 (2400)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0970 (2416)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x00, 0x03, 0xD8, 0x00, 0x00, 0x00, 0x00,   // 0x0980 (2432)
+0x18, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x80, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x02,   // 0x0990 (2448)
+0xBA, 0x20, 0x00, 0x00, 0x7D, 0x50, 0x00, 0x00, 0x07, 0xA1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,   // 0x09A0 (2464)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x09B0 (2480)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x09C0 (2496)
+0x00, 0x8E, 0xFB, 0x30, 0x00, 0x03, 0x82, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00,   // 0x09D0 (2512)
+0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x06,   // 0x09E0 (2528)
+0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x00, 0x0D, 0xF2,   // 0x09F0 (2544)
+0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0A00 (2560)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0A10 (2576)
+0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x6E, 0xBC, 0xC1, 0x00, 0x04, 0xE3, 0x00, 0x79, 0x00, 0x0C,   // 0x0A20 (2592)
+0x40, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x27, 0xAF, 0x00, 0x4B, 0x05, 0xD8, 0x5F, 0x00, 0x4B, 0x0B,   // 0x0A30 (2608)
+0x50, 0x1F, 0x00, 0x4B, 0x09, 0x94, 0xBF, 0x00, 0x1D, 0x01, 0x9A, 0x46, 0x00, 0x0B, 0x40, 0x00,   // 0x0A40 (2624)
+0x00, 0x00, 0x04, 0xE3, 0x00, 0x31, 0x00, 0x00, 0x5E, 0xCB, 0xD3, 0x00, 0x00, 0x00, 0x43, 0x00,   // 0x0A50 (2640)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0A60 (2656)
+0x00, 0x04, 0x81, 0x00, 0x00, 0x00, 0x0A, 0xD6, 0x00, 0x00, 0x00, 0x1F, 0x6A, 0x00, 0x00, 0x00,   // 0x0A70 (2672)
+0x6A, 0x1F, 0x10, 0x00, 0x00, 0xA6, 0x0A, 0x60, 0x00, 0x01, 0xF1, 0x06, 0xA0, 0x00, 0x06, 0xFF,   // 0x0A80 (2688)
+0xFF, 0xF1, 0x00, 0x0A, 0x70, 0x00, 0xC6, 0x00, 0x1F, 0x20, 0x00, 0x8A, 0x00, 0x6D, 0x00, 0x00,   // 0x0A90 (2704)
+0x3F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0AA0 (2720)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0AB0 (2736)
+0x04, 0x88, 0x86, 0x10, 0x00, 0x08, 0xD8, 0x8C, 0xC1, 0x00, 0x08, 0xB0, 0x00, 0xD4, 0x00, 0x08,   // 0x0AC0 (2752)
+0xB0, 0x01, 0xE3, 0x00, 0x08, 0xD8, 0x8C, 0x80, 0x00, 0x08, 0xD8, 0x8A, 0xD3, 0x00, 0x08, 0xB0,   // 0x0AD0 (2768)
+0x00, 0x7C, 0x00, 0x08, 0xB0, 0x00, 0x5D, 0x00, 0x08, 0xB0, 0x03, 0xC8, 0x00, 0x08, 0xFF, 0xFD,   // 0x0AE0 (2784)
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0AF0 (2800)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0B00 (2816)
+0x00, 0x06, 0xAB, 0x81, 0x00, 0x00, 0xCC, 0x64, 0xA8, 0x00, 0x08, 0xD1, 0x00, 0x00, 0x00, 0x0C,   // 0x0B10 (2832)
+0x70, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0E, 0x50,   // 0x0B20 (2848)
+0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x28, 0x00, 0x00, 0x5E, 0xDB,   // 0x0B30 (2864)
+0xE6, 0x00, 0x00, 0x00, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0B40 (2880)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0B50 (2896)
+0x06, 0x88, 0x73, 0x00, 0x00, 0x0B, 0xB8, 0x9E, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xE6, 0x00, 0x0B,   // 0x0B60 (2912)
+0x80, 0x00, 0x8B, 0x00, 0x0B, 0x80, 0x00, 0x5F, 0x00, 0x0B, 0x80, 0x00, 0x4F, 0x00, 0x0B, 0x80,   // 0x0B70 (2928)
+0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x29, 0xE1, 0x00, 0x0B, 0xFF, 0xE9,   // 0x0B80 (2944)
+0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0B90 (2960)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0BA0 (2976)
+0x02, 0x88, 0x88, 0x84, 0x00, 0x04, 0xF8, 0x88, 0x84, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04,   // 0x0BB0 (2992)
+0xF0, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x88, 0x60, 0x00, 0x04, 0xF8, 0x88, 0x60, 0x00, 0x04, 0xF0,   // 0x0BC0 (3008)
+0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,   // 0x0BD0 (3024)
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0BE0 (3040)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0BF0 (3056)
+0x00, 0x88, 0x88, 0x86, 0x00, 0x00, 0xF9, 0x88, 0x86, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,   // 0x0C00 (3072)
+0xF4, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x44, 0x40, 0x00, 0x00, 0xFC, 0xBB, 0xB0, 0x00, 0x00, 0xF4,   // 0x0C10 (3088)
+0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,   // 0x0C20 (3104)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0C30 (3120)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0C40 (3136)
+0x00, 0x17, 0xBB, 0x60, 0x00, 0x01, 0xCA, 0x55, 0xB6, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x0F,   // 0x0C50 (3152)
+0x50, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x4F, 0xFB, 0x00, 0x2F, 0x20,   // 0x0C60 (3168)
+0x00, 0x8B, 0x00, 0x0D, 0x70, 0x00, 0x8B, 0x00, 0x06, 0xE3, 0x00, 0x8B, 0x00, 0x00, 0x8E, 0xBC,   // 0x0C70 (3184)
+0xE5, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0C80 (3200)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0C90 (3216)
+0x06, 0x20, 0x00, 0x64, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B,   // 0x0CA0 (3232)
+0x40, 0x00, 0xB8, 0x00, 0x0B, 0x98, 0x88, 0xD8, 0x00, 0x0B, 0x98, 0x88, 0xD8, 0x00, 0x0B, 0x40,   // 0x0CB0 (3248)
+0x00, 0xB8, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x40, 0x00,   // 0x0CC0 (3264)
+0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0CD0 (3280)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0CE0 (3296)
+0x04, 0x88, 0x88, 0x82, 0x00, 0x04, 0x89, 0xF8, 0x82, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00,   // 0x0CF0 (3312)
+0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04,   // 0x0D00 (3328)
+0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xFF,   // 0x0D10 (3344)
+0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0D20 (3360)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0D30 (3376)
+0x00, 0x88, 0x88, 0x82, 0x00, 0x00, 0x88, 0x88, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,   // 0x0D40 (3392)
+0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,   // 0x0D50 (3408)
+0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF2, 0x00, 0x08, 0x60, 0x07, 0xD0, 0x00, 0x03, 0xDC, 0xCE,   // 0x0D60 (3424)
+0x40, 0x00, 0x00, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0D70 (3440)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0D80 (3456)
+0x04, 0x60, 0x00, 0x57, 0x00, 0x08, 0xB0, 0x03, 0xE3, 0x00, 0x08, 0xB0, 0x1E, 0x60, 0x00, 0x08,   // 0x0D90 (3472)
+0xB1, 0xC9, 0x00, 0x00, 0x08, 0xB9, 0xF4, 0x00, 0x00, 0x08, 0xFC, 0x8C, 0x00, 0x00, 0x08, 0xE3,   // 0x0DA0 (3488)
+0x0D, 0x60, 0x00, 0x08, 0xB0, 0x06, 0xE1, 0x00, 0x08, 0xB0, 0x00, 0xB8, 0x00, 0x08, 0xB0, 0x00,   // 0x0DB0 (3504)
+0x4F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0DC0 (3520)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0DD0 (3536)
+0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,   // 0x0DE0 (3552)
+0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4,   // 0x0DF0 (3568)
+0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,   // 0x0E00 (3584)
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0E10 (3600)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0E20 (3616)
+0x06, 0x50, 0x00, 0x74, 0x00, 0x0B, 0xC0, 0x02, 0xE8, 0x00, 0x0B, 0x93, 0x07, 0xC8, 0x00, 0x0B,   // 0x0E30 (3632)
+0x88, 0x0B, 0x88, 0x00, 0x0B, 0x4C, 0x29, 0x88, 0x00, 0x0B, 0x49, 0x95, 0x88, 0x00, 0x0B, 0x44,   // 0x0E40 (3648)
+0xE0, 0x88, 0x00, 0x0B, 0x40, 0x30, 0x88, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x0B, 0x40, 0x00,   // 0x0E50 (3664)
+0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0E60 (3680)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0E70 (3696)
+0x06, 0x50, 0x00, 0x64, 0x00, 0x0B, 0xE1, 0x00, 0xB8, 0x00, 0x0B, 0xB8, 0x00, 0xB8, 0x00, 0x0B,   // 0x0E80 (3712)
+0x6E, 0x10, 0xB8, 0x00, 0x0B, 0x49, 0x80, 0xB8, 0x00, 0x0B, 0x41, 0xD1, 0xB8, 0x00, 0x0B, 0x40,   // 0x0E90 (3728)
+0x88, 0x98, 0x00, 0x0B, 0x40, 0x1D, 0x88, 0x00, 0x0B, 0x40, 0x08, 0xE8, 0x00, 0x0B, 0x40, 0x01,   // 0x0EA0 (3744)
+0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0EB0 (3760)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0EC0 (3776)
+0x00, 0x39, 0xB8, 0x10, 0x00, 0x04, 0xF8, 0x4A, 0xC1, 0x00, 0x0C, 0x80, 0x00, 0xD8, 0x00, 0x2F,   // 0x0ED0 (3792)
+0x20, 0x00, 0x7C, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x4F, 0x00,   // 0x0EE0 (3808)
+0x00, 0x5E, 0x00, 0x0E, 0x50, 0x00, 0x9A, 0x00, 0x08, 0xC1, 0x03, 0xF4, 0x00, 0x00, 0x9E, 0xBE,   // 0x0EF0 (3824)
+0x60, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0F00 (3840)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0F10 (3856)
+0x04, 0x88, 0x87, 0x20, 0x00, 0x08, 0xD8, 0x89, 0xF5, 0x00, 0x08, 0xB0, 0x00, 0x8C, 0x00, 0x08,   // 0x0F20 (3872)
+0xB0, 0x00, 0x4E, 0x00, 0x08, 0xB0, 0x00, 0xAA, 0x00, 0x08, 0xEB, 0xBE, 0xB1, 0x00, 0x08, 0xC4,   // 0x0F30 (3888)
+0x42, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00,   // 0x0F40 (3904)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0F50 (3920)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0F60 (3936)
+0x00, 0x39, 0xB8, 0x10, 0x00, 0x04, 0xF8, 0x4A, 0xC1, 0x00, 0x0D, 0x80, 0x00, 0xD7, 0x00, 0x2F,   // 0x0F70 (3952)
+0x20, 0x00, 0x8B, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x4F, 0x00, 0x00, 0x4F, 0x00, 0x3F, 0x10,   // 0x0F80 (3968)
+0x00, 0x7C, 0x00, 0x0E, 0x60, 0x00, 0xB8, 0x00, 0x07, 0xE4, 0x07, 0xE2, 0x00, 0x00, 0x8E, 0xFD,   // 0x0F90 (3984)
+0x30, 0x00, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x43,   // 0x0FA0 (4000)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0FB0 (4016)
+0x04, 0x88, 0x87, 0x20, 0x00, 0x08, 0xD8, 0x8A, 0xE3, 0x00, 0x08, 0xB0, 0x00, 0x9A, 0x00, 0x08,   // 0x0FC0 (4032)
+0xB0, 0x00, 0x8B, 0x00, 0x08, 0xB0, 0x04, 0xE7, 0x00, 0x08, 0xFF, 0xFD, 0x80, 0x00, 0x08, 0xB0,   // 0x0FD0 (4048)
+0x6E, 0x10, 0x00, 0x08, 0xB0, 0x0B, 0x80, 0x00, 0x08, 0xB0, 0x04, 0xF2, 0x00, 0x08, 0xB0, 0x00,   // 0x0FE0 (4064)
+0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0FF0 (4080)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1000 (4096)
+0x00, 0x39, 0xBA, 0x40, 0x00, 0x03, 0xE8, 0x46, 0xD4, 0x00, 0x08, 0xB0, 0x00, 0x10, 0x00, 0x07,   // 0x1010 (4112)
+0xD1, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x92, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xA1, 0x00, 0x00, 0x00,   // 0x1020 (4128)
+0x04, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x09, 0x50, 0x00, 0xB9, 0x00, 0x05, 0xDD, 0xBE,   // 0x1030 (4144)
+0xB1, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1040 (4160)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1050 (4176)
+0x48, 0x88, 0x88, 0x88, 0x00, 0x48, 0x89, 0xF8, 0x88, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00,   // 0x1060 (4192)
+0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04,   // 0x1070 (4208)
+0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0,   // 0x1080 (4224)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1090 (4240)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x10A0 (4256)
+0x06, 0x20, 0x00, 0x44, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x0B,   // 0x10B0 (4272)
+0x40, 0x00, 0x88, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x0B, 0x40, 0x00, 0x88, 0x00, 0x0B, 0x40,   // 0x10C0 (4288)
+0x00, 0x98, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x08, 0xD1, 0x03, 0xF3, 0x00, 0x01, 0xBE, 0xBF,   // 0x10D0 (4304)
+0x80, 0x00, 0x00, 0x03, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x10E0 (4320)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x10F0 (4336)
+0x38, 0x00, 0x00, 0x28, 0x00, 0x1F, 0x30, 0x00, 0x7C, 0x00, 0x0A, 0x70, 0x00, 0xB7, 0x00, 0x07,   // 0x1100 (4352)
+0xC0, 0x01, 0xF2, 0x00, 0x02, 0xF1, 0x05, 0xC0, 0x00, 0x00, 0xC6, 0x09, 0x70, 0x00, 0x00, 0x79,   // 0x1110 (4368)
+0x0D, 0x30, 0x00, 0x00, 0x2E, 0x2D, 0x00, 0x00, 0x00, 0x0C, 0x98, 0x00, 0x00, 0x00, 0x08, 0xF3,   // 0x1120 (4384)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1130 (4400)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1140 (4416)
+0x63, 0x00, 0x00, 0x05, 0x40, 0xB8, 0x00, 0x00, 0x0B, 0x70, 0x88, 0x00, 0x00, 0x0C, 0x40, 0x6B,   // 0x1150 (4432)
+0x03, 0xE0, 0x0F, 0x20, 0x4C, 0x07, 0xC4, 0x0F, 0x00, 0x1F, 0x0A, 0x78, 0x4B, 0x00, 0x0E, 0x1C,   // 0x1160 (4448)
+0x2C, 0x4A, 0x00, 0x0B, 0x88, 0x0D, 0x88, 0x00, 0x09, 0xB5, 0x08, 0xC6, 0x00, 0x08, 0xF1, 0x05,   // 0x1170 (4464)
+0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1180 (4480)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1190 (4496)
+0x07, 0x40, 0x00, 0x55, 0x00, 0x08, 0xD0, 0x02, 0xF2, 0x00, 0x00, 0xD6, 0x09, 0x90, 0x00, 0x00,   // 0x11A0 (4512)
+0x4E, 0x3E, 0x10, 0x00, 0x00, 0x0B, 0xE8, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x3E,   // 0x11B0 (4528)
+0x7D, 0x00, 0x00, 0x00, 0xB8, 0x0C, 0x80, 0x00, 0x06, 0xD0, 0x04, 0xE1, 0x00, 0x1D, 0x60, 0x00,   // 0x11C0 (4544)
+0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x11D0 (4560)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x11E0 (4576)
+0x38, 0x00, 0x00, 0x28, 0x10, 0x0D, 0x60, 0x00, 0x99, 0x00, 0x06, 0xD0, 0x02, 0xF2, 0x00, 0x00,   // 0x11F0 (4592)
+0xD6, 0x09, 0x90, 0x00, 0x00, 0x6D, 0x2E, 0x20, 0x00, 0x00, 0x0D, 0xD8, 0x00, 0x00, 0x00, 0x06,   // 0x1200 (4608)
+0xF1, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0,   // 0x1210 (4624)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1220 (4640)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1230 (4656)
+0x04, 0x88, 0x88, 0x86, 0x00, 0x04, 0x88, 0x88, 0xE8, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,   // 0x1240 (4672)
+0x00, 0x2E, 0x30, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, 0x3E,   // 0x1250 (4688)
+0x30, 0x00, 0x00, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,   // 0x1260 (4704)
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1270 (4720)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x41, 0x00,   // 0x1280 (4736)
+0x00, 0x0B, 0x98, 0x82, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,   // 0x1290 (4752)
+0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B,   // 0x12A0 (4768)
+0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40,   // 0x12B0 (4784)
+0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x98, 0x82, 0x00, 0x00, 0x03, 0x44, 0x41,   // 0x12C0 (4800)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,   // 0x12D0 (4816)
+0x05, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,   // 0x12E0 (4832)
+0x2E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x01,   // 0x12F0 (4848)
+0xE2, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x0D,   // 0x1300 (4864)
+0x30, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x31,   // 0x1310 (4880)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x42, 0x00, 0x00,   // 0x1320 (4896)
+0x04, 0x88, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,   // 0x1330 (4912)
+0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,   // 0x1340 (4928)
+0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88,   // 0x1350 (4944)
+0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x04, 0x88, 0xB8, 0x00, 0x00, 0x02, 0x44, 0x42, 0x00,   // 0x1360 (4960)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1370 (4976)
+0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xC6, 0x00, 0x00, 0x00, 0x2D, 0x3C, 0x00, 0x00, 0x00,   // 0x1380 (4992)
+0x88, 0x0C, 0x30, 0x00, 0x00, 0xD2, 0x07, 0x90, 0x00, 0x04, 0x90, 0x01, 0xA0, 0x00, 0x00, 0x00,   // 0x1390 (5008)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13A0 (5024)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13B0 (5040)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13C0 (5056)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13D0 (5072)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13E0 (5088)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x13F0 (5104)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1400 (5120)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00,   // 0x1410 (5136)
+0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1420 (5152)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1430 (5168)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1440 (5184)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1450 (5200)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1460 (5216)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x03,   // 0x1470 (5232)
+0xBD, 0xBE, 0x90, 0x00, 0x02, 0x40, 0x01, 0xE5, 0x00, 0x00, 0x01, 0x48, 0xD8, 0x00, 0x01, 0xAE,   // 0x1480 (5248)
+0xB8, 0xD8, 0x00, 0x0A, 0xA1, 0x00, 0xB8, 0x00, 0x0B, 0x70, 0x05, 0xE8, 0x00, 0x05, 0xFB, 0xC9,   // 0x1490 (5264)
+0x88, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x14A0 (5280)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00,   // 0x14B0 (5296)
+0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x43, 0x00, 0x00, 0x0B,   // 0x14C0 (5312)
+0xAD, 0xBE, 0xC1, 0x00, 0x0B, 0xC2, 0x01, 0xD8, 0x00, 0x0B, 0x80, 0x00, 0x8B, 0x00, 0x0B, 0x80,   // 0x14D0 (5328)
+0x00, 0x8B, 0x00, 0x0B, 0x80, 0x00, 0x8A, 0x00, 0x0B, 0xC1, 0x03, 0xE6, 0x00, 0x0B, 0xAD, 0xBE,   // 0x14E0 (5344)
+0x80, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x14F0 (5360)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1500 (5376)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,   // 0x1510 (5392)
+0x6E, 0xCB, 0xE6, 0x00, 0x05, 0xE4, 0x00, 0x33, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80,   // 0x1520 (5408)
+0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0xE4, 0x00, 0x26, 0x00, 0x00, 0x8E, 0xCB,   // 0x1530 (5424)
+0xE6, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1540 (5440)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,   // 0x1550 (5456)
+0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x03, 0x40, 0xB4, 0x00, 0x01,   // 0x1560 (5472)
+0xBE, 0xBC, 0xD4, 0x00, 0x09, 0xB1, 0x03, 0xE4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x3F, 0x00,   // 0x1570 (5488)
+0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xA0, 0x04, 0xE4, 0x00, 0x03, 0xDD, 0xCB,   // 0x1580 (5504)
+0xC4, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1590 (5520)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x15A0 (5536)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x00,   // 0x15B0 (5552)
+0x8E, 0xBD, 0xA0, 0x00, 0x08, 0xC1, 0x00, 0xA7, 0x00, 0x0D, 0x84, 0x44, 0x8B, 0x00, 0x0F, 0xCB,   // 0x15C0 (5568)
+0xBB, 0xB8, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x00, 0x08, 0xD2, 0x00, 0x31, 0x00, 0x00, 0x8F, 0xBB,   // 0x15D0 (5584)
+0xD3, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x15E0 (5600)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x86, 0x10,   // 0x15F0 (5616)
+0x00, 0x01, 0xDB, 0x89, 0x40, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x08,   // 0x1600 (5632)
+0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08,   // 0x1610 (5648)
+0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0,   // 0x1620 (5664)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1630 (5680)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1640 (5696)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01,   // 0x1650 (5712)
+0xBD, 0xCF, 0xFF, 0x40, 0x07, 0xD1, 0x07, 0x90, 0x00, 0x08, 0x90, 0x04, 0xF0, 0x00, 0x03, 0xE6,   // 0x1660 (5728)
+0x4C, 0x90, 0x00, 0x03, 0xB9, 0xB8, 0x10, 0x00, 0x08, 0x90, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF,   // 0x1670 (5744)
+0xE8, 0x00, 0x0B, 0x40, 0x00, 0x2F, 0x40, 0x0E, 0x40, 0x00, 0x6E, 0x10, 0x06, 0xEC, 0xBD, 0xD3,   // 0x1680 (5760)
+0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00,   // 0x1690 (5776)
+0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x34, 0x00, 0x00, 0x0B,   // 0x16A0 (5792)
+0x8B, 0xBD, 0xD1, 0x00, 0x0B, 0xE3, 0x00, 0xD7, 0x00, 0x0B, 0x80, 0x00, 0x98, 0x00, 0x0B, 0x80,   // 0x16B0 (5808)
+0x00, 0x88, 0x00, 0x0B, 0x80, 0x00, 0x88, 0x00, 0x0B, 0x80, 0x00, 0x88, 0x00, 0x0B, 0x80, 0x00,   // 0x16C0 (5824)
+0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x16D0 (5840)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,   // 0x16E0 (5856)
+0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,   // 0x16F0 (5872)
+0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00,   // 0x1700 (5888)
+0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B,   // 0x1710 (5904)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1720 (5920)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,   // 0x1730 (5936)
+0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,   // 0x1740 (5952)
+0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00,   // 0x1750 (5968)
+0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x8B,   // 0x1760 (5984)
+0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x00, 0x1F, 0xBC, 0xD2, 0x00,   // 0x1770 (6000)
+0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,   // 0x1780 (6016)
+0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08,   // 0x1790 (6032)
+0xB0, 0x01, 0xC7, 0x00, 0x08, 0xB0, 0x1C, 0x60, 0x00, 0x08, 0xB2, 0xC7, 0x00, 0x00, 0x08, 0xDE,   // 0x17A0 (6048)
+0xBA, 0x00, 0x00, 0x08, 0xF6, 0x1C, 0x70, 0x00, 0x08, 0xB0, 0x03, 0xE3, 0x00, 0x08, 0xB0, 0x00,   // 0x17B0 (6064)
+0x6D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x17C0 (6080)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x30, 0x00, 0x00,   // 0x17D0 (6096)
+0x08, 0xBD, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00,   // 0x17E0 (6112)
+0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x08,   // 0x17F0 (6128)
+0xB0, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xCD,   // 0x1800 (6144)
+0xBA, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1810 (6160)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1820 (6176)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x41, 0x00, 0x4C,   // 0x1830 (6192)
+0xBD, 0xAB, 0xDB, 0x00, 0x4F, 0x41, 0xF4, 0x2F, 0x00, 0x4F, 0x00, 0xF0, 0x0F, 0x00, 0x4F, 0x00,   // 0x1840 (6208)
+0xF0, 0x0F, 0x00, 0x4F, 0x00, 0xF0, 0x0F, 0x00, 0x4F, 0x00, 0xF0, 0x0F, 0x00, 0x4F, 0x00, 0xF0,   // 0x1850 (6224)
+0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1860 (6240)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1870 (6256)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0B,   // 0x1880 (6272)
+0x7B, 0xBD, 0xD1, 0x00, 0x0B, 0xE3, 0x00, 0xD7, 0x00, 0x0B, 0x80, 0x00, 0x98, 0x00, 0x0B, 0x80,   // 0x1890 (6288)
+0x00, 0x88, 0x00, 0x0B, 0x80, 0x00, 0x88, 0x00, 0x0B, 0x80, 0x00, 0x88, 0x00, 0x0B, 0x80, 0x00,   // 0x18A0 (6304)
+0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x18B0 (6320)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x18C0 (6336)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x01,   // 0x18D0 (6352)
+0xBE, 0xBF, 0x80, 0x00, 0x09, 0xB0, 0x03, 0xE5, 0x00, 0x0F, 0x40, 0x00, 0x8A, 0x00, 0x2F, 0x00,   // 0x18E0 (6368)
+0x00, 0x8B, 0x00, 0x0F, 0x40, 0x00, 0x8A, 0x00, 0x09, 0xB1, 0x03, 0xE5, 0x00, 0x01, 0xBD, 0xBF,   // 0x18F0 (6384)
+0x80, 0x00, 0x00, 0x02, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1900 (6400)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1910 (6416)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x0B,   // 0x1920 (6432)
+0x9D, 0xBE, 0xC1, 0x00, 0x0B, 0xC2, 0x01, 0xD8, 0x00, 0x0B, 0x80, 0x00, 0x8B, 0x00, 0x0B, 0x80,   // 0x1930 (6448)
+0x00, 0x8B, 0x00, 0x0B, 0x80, 0x00, 0x8A, 0x00, 0x0B, 0xB1, 0x03, 0xE6, 0x00, 0x0B, 0xCD, 0xBE,   // 0x1940 (6464)
+0x80, 0x00, 0x0B, 0x81, 0x42, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,   // 0x1950 (6480)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1960 (6496)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01,   // 0x1970 (6512)
+0xBE, 0xBC, 0xD4, 0x00, 0x09, 0xB1, 0x03, 0xE4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x3F, 0x00,   // 0x1980 (6528)
+0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x0B, 0xA0, 0x04, 0xE4, 0x00, 0x03, 0xDD, 0xCB,   // 0x1990 (6544)
+0xC4, 0x00, 0x00, 0x04, 0x30, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4,   // 0x19A0 (6560)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x19B0 (6576)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00,   // 0x19C0 (6592)
+0xF3, 0xAC, 0xB9, 0x00, 0x00, 0xFB, 0x50, 0x00, 0x00, 0x00, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xF4,   // 0x19D0 (6608)
+0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,   // 0x19E0 (6624)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x19F0 (6640)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1A00 (6656)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x02,   // 0x1A10 (6672)
+0xCD, 0xBE, 0xB1, 0x00, 0x08, 0xC0, 0x00, 0x50, 0x00, 0x05, 0xE8, 0x20, 0x00, 0x00, 0x00, 0x49,   // 0x1A20 (6688)
+0xDC, 0x60, 0x00, 0x00, 0x00, 0x04, 0xD7, 0x00, 0x07, 0x40, 0x00, 0xA8, 0x00, 0x06, 0xDC, 0xBD,   // 0x1A30 (6704)
+0xC1, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1A40 (6720)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1A50 (6736)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F,   // 0x1A60 (6752)
+0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F,   // 0x1A70 (6768)
+0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x06, 0xFB,   // 0x1A80 (6784)
+0xBC, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1A90 (6800)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1AA0 (6816)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,   // 0x1AB0 (6832)
+0x40, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0x0F, 0x40,   // 0x1AC0 (6848)
+0x00, 0xB4, 0x00, 0x0E, 0x40, 0x00, 0xC4, 0x00, 0x0B, 0x80, 0x07, 0xF4, 0x00, 0x05, 0xFC, 0xC8,   // 0x1AD0 (6864)
+0xB4, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1AE0 (6880)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1AF0 (6896)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,   // 0x1B00 (6912)
+0x20, 0x00, 0x6B, 0x00, 0x09, 0x80, 0x00, 0xC6, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0xB6,   // 0x1B10 (6928)
+0x09, 0x80, 0x00, 0x00, 0x6C, 0x1F, 0x20, 0x00, 0x00, 0x0D, 0x89, 0x00, 0x00, 0x00, 0x08, 0xF4,   // 0x1B20 (6944)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1B30 (6960)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1B40 (6976)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7,   // 0x1B50 (6992)
+0x03, 0xB0, 0x0A, 0x80, 0x8A, 0x07, 0xD3, 0x0D, 0x40, 0x5D, 0x09, 0x87, 0x1F, 0x00, 0x1F, 0x1C,   // 0x1B60 (7008)
+0x49, 0x4C, 0x00, 0x0D, 0x6A, 0x0D, 0x89, 0x00, 0x09, 0xC8, 0x0B, 0xB6, 0x00, 0x07, 0xF4, 0x08,   // 0x1B70 (7024)
+0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1B80 (7040)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1B90 (7056)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,   // 0x1BA0 (7072)
+0xC0, 0x02, 0xE3, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x1E, 0x9B, 0x00, 0x00, 0x00, 0x08,   // 0x1BB0 (7088)
+0xF4, 0x00, 0x00, 0x00, 0x4E, 0x8C, 0x10, 0x00, 0x01, 0xE4, 0x0A, 0x90, 0x00, 0x0A, 0x80, 0x01,   // 0x1BC0 (7104)
+0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1BD0 (7120)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1BE0 (7136)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,   // 0x1BF0 (7152)
+0x20, 0x00, 0x6C, 0x00, 0x09, 0x90, 0x00, 0xB6, 0x00, 0x02, 0xE1, 0x02, 0xE0, 0x00, 0x00, 0x98,   // 0x1C00 (7168)
+0x08, 0x80, 0x00, 0x00, 0x2D, 0x0D, 0x20, 0x00, 0x00, 0x0B, 0xAB, 0x00, 0x00, 0x00, 0x04, 0xF6,   // 0x1C10 (7184)
+0x00, 0x00, 0x00, 0x04, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x0E, 0xE8, 0x00, 0x00,   // 0x1C20 (7200)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1C30 (7216)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,   // 0x1C40 (7232)
+0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x09, 0xC1, 0x00, 0x00, 0x00, 0x8C, 0x10, 0x00, 0x00, 0x06,   // 0x1C50 (7248)
+0xE1, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x00, 0x00, 0x03, 0xE3, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF,   // 0x1C60 (7264)
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1C70 (7280)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x41, 0x00,   // 0x1C80 (7296)
+0x00, 0x01, 0xD9, 0x82, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00,   // 0x1C90 (7312)
+0x04, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x02, 0x8D, 0x70, 0x00, 0x00, 0x02, 0x8C,   // 0x1CA0 (7328)
+0x70, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xB0,   // 0x1CB0 (7344)
+0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xD9, 0x82, 0x00, 0x00, 0x00, 0x04, 0x41,   // 0x1CC0 (7360)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00,   // 0x1CD0 (7376)
+0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00,   // 0x1CE0 (7392)
+0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04,   // 0x1CF0 (7408)
+0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0,   // 0x1D00 (7424)
+0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00,   // 0x1D10 (7440)
+0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x00,   // 0x1D20 (7456)
+0x04, 0x8B, 0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,   // 0x1D30 (7472)
+0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x00, 0x00,   // 0x1D40 (7488)
+0xBB, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0,   // 0x1D50 (7504)
+0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x8B, 0x90, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00,   // 0x1D60 (7520)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1D70 (7536)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1D80 (7552)
+0x23, 0x00, 0x11, 0x00, 0x05, 0xDD, 0x91, 0x87, 0x00, 0x0B, 0x20, 0x8F, 0xB0, 0x00, 0x00, 0x00,   // 0x1D90 (7568)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1DA0 (7584)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1DB0 (7600)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x1DB6 (7606)
+};
@@ -0,0 +1,139 @@
+// Generated by  : imgconv
+// Generated from: src/DefaultFonts.c:BigFont
+// Format        : proportional font, see lcd7735_setFont()
+// Size          : 2107 Bytes
+
+const unsigned char BigFontRLE[0x83B] ={
+0x00, 0xC1, 0x10, 0x10, 0x01, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x00, 0x00,   // 0x0010 (16)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x0D, 0x04, 0x02, 0x10,   // 0x0020 (32)
+0x09, 0x00, 0x00, 0x09, 0x05, 0x04, 0x01, 0x10, 0x10, 0x00, 0x00, 0x0E, 0x0E, 0x01, 0x01, 0x10,   // 0x0030 (48)
+0x28, 0x00, 0x00, 0x0A, 0x0E, 0x03, 0x01, 0x10, 0x3A, 0x00, 0x00, 0x08, 0x0A, 0x04, 0x03, 0x10,   // 0x0040 (64)
+0x46, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x57, 0x00, 0x00, 0x04, 0x04, 0x04, 0x02, 0x10,   // 0x0050 (80)
+0x5A, 0x00, 0x00, 0x08, 0x0C, 0x04, 0x02, 0x10, 0x68, 0x00, 0x00, 0x08, 0x0C, 0x04, 0x02, 0x10,   // 0x0060 (96)
+0x76, 0x00, 0x00, 0x0C, 0x0C, 0x02, 0x02, 0x10, 0x89, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x10,   // 0x0070 (112)
+0x92, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0B, 0x10, 0x95, 0x00, 0x00, 0x0A, 0x02, 0x03, 0x07, 0x10,   // 0x0080 (128)
+0x96, 0x00, 0x00, 0x03, 0x03, 0x05, 0x0B, 0x10, 0x97, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x02, 0x10,   // 0x0090 (144)
+0xAB, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xBC, 0x00, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10,   // 0x00A0 (160)
+0xCC, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xDD, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x00B0 (176)
+0xEE, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xFE, 0x00, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x00C0 (192)
+0x0F, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x20, 0x01, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10,   // 0x00D0 (208)
+0x32, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x43, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x00E0 (224)
+0x54, 0x01, 0x00, 0x03, 0x08, 0x06, 0x04, 0x10, 0x57, 0x01, 0x00, 0x04, 0x09, 0x05, 0x04, 0x10,   // 0x00F0 (240)
+0x5D, 0x01, 0x00, 0x09, 0x0E, 0x03, 0x01, 0x10, 0x6F, 0x01, 0x00, 0x0C, 0x06, 0x02, 0x05, 0x10,   // 0x0100 (256)
+0x72, 0x01, 0x00, 0x09, 0x0E, 0x03, 0x01, 0x10, 0x84, 0x01, 0x00, 0x0A, 0x0E, 0x03, 0x01, 0x10,   // 0x0110 (272)
+0x97, 0x01, 0x00, 0x0B, 0x0E, 0x03, 0x01, 0x10, 0xAE, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0120 (288)
+0xBF, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xD0, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0130 (304)
+0xE1, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xF2, 0x01, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0140 (320)
+0x03, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x14, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0150 (336)
+0x25, 0x02, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10, 0x34, 0x02, 0x00, 0x07, 0x0C, 0x04, 0x02, 0x10,   // 0x0160 (352)
+0x41, 0x02, 0x00, 0x0C, 0x0C, 0x02, 0x02, 0x10, 0x56, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0170 (368)
+0x67, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x78, 0x02, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10,   // 0x0180 (384)
+0x8A, 0x02, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10, 0x9D, 0x02, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10,   // 0x0190 (400)
+0xB0, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xC1, 0x02, 0x00, 0x0B, 0x0D, 0x03, 0x02, 0x10,   // 0x01A0 (416)
+0xD6, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xE7, 0x02, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x01B0 (432)
+0xF8, 0x02, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10, 0x0A, 0x03, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10,   // 0x01C0 (448)
+0x1A, 0x03, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10, 0x2A, 0x03, 0x00, 0x0B, 0x0C, 0x03, 0x02, 0x10,   // 0x01D0 (464)
+0x3D, 0x03, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10, 0x4D, 0x03, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10,   // 0x01E0 (480)
+0x5D, 0x03, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x6D, 0x03, 0x00, 0x07, 0x0C, 0x05, 0x02, 0x10,   // 0x01F0 (496)
+0x79, 0x03, 0x00, 0x0D, 0x0C, 0x03, 0x02, 0x10, 0x8F, 0x03, 0x00, 0x07, 0x0C, 0x05, 0x02, 0x10,   // 0x0200 (512)
+0x9B, 0x03, 0x00, 0x0A, 0x05, 0x03, 0x01, 0x10, 0xA3, 0x03, 0x00, 0x0F, 0x02, 0x01, 0x0E, 0x10,   // 0x0210 (528)
+0xA4, 0x03, 0x00, 0x05, 0x04, 0x03, 0x02, 0x10, 0xA8, 0x03, 0x00, 0x0A, 0x08, 0x03, 0x06, 0x10,   // 0x0220 (544)
+0xB4, 0x03, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xC5, 0x03, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10,   // 0x0230 (560)
+0xD0, 0x03, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0xE1, 0x03, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10,   // 0x0240 (576)
+0xEC, 0x03, 0x00, 0x09, 0x0C, 0x03, 0x02, 0x10, 0xFC, 0x03, 0x00, 0x0A, 0x0A, 0x03, 0x06, 0x10,   // 0x0250 (592)
+0x0B, 0x04, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10, 0x1C, 0x04, 0x00, 0x09, 0x0C, 0x04, 0x02, 0x10,   // 0x0260 (608)
+0x2B, 0x04, 0x00, 0x09, 0x0E, 0x03, 0x02, 0x10, 0x3D, 0x04, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0270 (624)
+0x4E, 0x04, 0x00, 0x09, 0x0C, 0x04, 0x02, 0x10, 0x5E, 0x04, 0x00, 0x0B, 0x08, 0x03, 0x06, 0x10,   // 0x0280 (640)
+0x6B, 0x04, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10, 0x75, 0x04, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10,   // 0x0290 (656)
+0x80, 0x04, 0x00, 0x0A, 0x0A, 0x03, 0x06, 0x10, 0x8F, 0x04, 0x00, 0x0A, 0x0A, 0x02, 0x06, 0x10,   // 0x02A0 (672)
+0x9E, 0x04, 0x00, 0x0A, 0x08, 0x03, 0x06, 0x10, 0xAA, 0x04, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10,   // 0x02B0 (688)
+0xB5, 0x04, 0x00, 0x09, 0x0B, 0x03, 0x03, 0x10, 0xC4, 0x04, 0x00, 0x0A, 0x08, 0x03, 0x06, 0x10,   // 0x02C0 (704)
+0xD0, 0x04, 0x00, 0x09, 0x08, 0x03, 0x06, 0x10, 0xDB, 0x04, 0x00, 0x0B, 0x08, 0x03, 0x06, 0x10,   // 0x02D0 (720)
+0xE8, 0x04, 0x00, 0x08, 0x08, 0x03, 0x06, 0x10, 0xF1, 0x04, 0x00, 0x0A, 0x0A, 0x03, 0x06, 0x10,   // 0x02E0 (736)
+0x00, 0x05, 0x00, 0x08, 0x08, 0x03, 0x06, 0x10, 0x09, 0x05, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x02F0 (752)
+0x1A, 0x05, 0x00, 0x03, 0x0E, 0x07, 0x01, 0x10, 0x1B, 0x05, 0x00, 0x0A, 0x0C, 0x03, 0x02, 0x10,   // 0x0300 (768)
+0x2C, 0x05, 0x00, 0x0C, 0x04, 0x02, 0x02, 0x10, 0x84, 0x70, 0x58, 0xA2, 0x73, 0x80, 0x07, 0x39,   // 0x0310 (784)
+0xC0, 0xAC, 0xE3, 0xF1, 0xF8, 0xFC, 0x76, 0x30, 0xA6, 0x18, 0x60, 0x61, 0x81, 0x86, 0x02, 0x5B,   // 0x0320 (800)
+0xB7, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x5B, 0xA6, 0x18, 0x60, 0x61, 0x81, 0x86, 0x02,   // 0x0330 (816)
+0x94, 0x12, 0x04, 0x80, 0x54, 0xB7, 0x48, 0xD2, 0x3F, 0xE7, 0xFC, 0x4B, 0x12, 0x54, 0x94, 0x09,   // 0x0340 (832)
+0x02, 0x40, 0xBF, 0xE1, 0xE3, 0xE7, 0x0E, 0x1C, 0x38, 0x70, 0xE7, 0x8F, 0xC7, 0x87, 0xBF, 0x78,   // 0x0350 (848)
+0x33, 0x0C, 0xC3, 0x30, 0x78, 0x1E, 0x17, 0xB7, 0xCF, 0x3F, 0xC7, 0xB1, 0xCC, 0xF9, 0xF3, 0x8F,   // 0x0360 (864)
+0x77, 0x7E, 0xBF, 0x0F, 0x1C, 0x38, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0x9F, 0x70, 0x38, 0x1C, 0x0F,   // 0x0370 (880)
+0xBF, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x07, 0x07, 0x07, 0x9F, 0x0E, 0x1C, 0x38, 0xF0, 0x04, 0xB6,   // 0x0380 (896)
+0xC0, 0x8C, 0x44, 0xC8, 0x3F, 0x03, 0xF0, 0x57, 0xB6, 0x1F, 0x81, 0xF8, 0x26, 0x44, 0x62, 0x06,   // 0x0390 (912)
+0x04, 0x97, 0x18, 0x18, 0x18, 0x4F, 0x97, 0x18, 0x18, 0x18, 0x8F, 0x77, 0x7E, 0x53, 0x48, 0x0A,   // 0x03A0 (928)
+0xBF, 0x80, 0x18, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0xBB, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,   // 0x03B0 (944)
+0x80, 0x70, 0x08, 0xBF, 0x7F, 0xB8, 0x7E, 0x3F, 0x9F, 0xE7, 0xFB, 0x7E, 0xB7, 0xDF, 0xE7, 0xF9,   // 0x03C0 (960)
+0xFC, 0x7E, 0x1D, 0xFE, 0xBF, 0x0C, 0x06, 0x07, 0x1F, 0x8F, 0xC0, 0xE0, 0x70, 0x9F, 0x38, 0x1C,   // 0x03D0 (976)
+0x0E, 0x07, 0x02, 0x48, 0xBF, 0x7F, 0x38, 0xEE, 0x1C, 0x07, 0x03, 0x81, 0xC0, 0xA6, 0xE0, 0x70,   // 0x03E0 (992)
+0x38, 0x1C, 0x7E, 0x03, 0x4C, 0xBF, 0x7F, 0x38, 0xEE, 0x1C, 0x07, 0x03, 0x87, 0x81, 0xB7, 0xE0,   // 0x03F0 (1008)
+0x0E, 0x01, 0xF8, 0x7E, 0x39, 0xFC, 0x04, 0xB6, 0xE0, 0x78, 0x3E, 0x1B, 0x8C, 0xE6, 0x38, 0x53,   // 0x0400 (1024)
+0xA7, 0x07, 0x01, 0xC0, 0x70, 0x7F, 0x4C, 0x06, 0xBF, 0xE0, 0x38, 0x0E, 0x03, 0xFC, 0xFF, 0x80,   // 0x0410 (1040)
+0xF0, 0xA3, 0x1F, 0x87, 0xE3, 0x9F, 0xC0, 0xBB, 0x1F, 0x0E, 0x07, 0x03, 0x80, 0xE0, 0x3F, 0xE0,   // 0x0420 (1056)
+0x4C, 0xAE, 0x0F, 0xC3, 0xF0, 0xFC, 0x3B, 0xFC, 0x4D, 0xBF, 0x07, 0xE0, 0xFC, 0x1C, 0x03, 0x80,   // 0x0430 (1072)
+0xE0, 0x38, 0xB5, 0x0E, 0x03, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xBF, 0x7F, 0xB8, 0x7E, 0x1F, 0x87,   // 0x0440 (1088)
+0xF9, 0xCF, 0xC3, 0xB7, 0xF3, 0x9F, 0xE1, 0xF8, 0x7E, 0x1D, 0xFE, 0xBF, 0x7F, 0xB8, 0x7E, 0x1F,   // 0x0450 (1104)
+0x87, 0xE1, 0xFF, 0xF7, 0xB7, 0xFC, 0x07, 0x01, 0xC0, 0xE0, 0x70, 0xF8, 0x48, 0x05, 0x48, 0xA3,   // 0x0460 (1120)
+0x77, 0x70, 0x07, 0x77, 0xE0, 0x05, 0xBF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0xB7,   // 0x0470 (1136)
+0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x57, 0x17, 0x57, 0xBF, 0xE0, 0x38, 0x0E, 0x03, 0x80,   // 0x0480 (1152)
+0xE0, 0x38, 0x0E, 0xB7, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x05, 0xBF, 0x1E, 0x1F, 0xEF,   // 0x0490 (1168)
+0x3F, 0x07, 0x01, 0xC0, 0xE0, 0x96, 0x70, 0x38, 0x0E, 0x1A, 0x96, 0xE0, 0x38, 0x0E, 0x02, 0xBB,   // 0x04A0 (1184)
+0x7F, 0xDC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC0, 0x48, 0xB6, 0x3F, 0xE7, 0xFC, 0xFF, 0x80, 0x70,   // 0x04B0 (1200)
+0x0E, 0x07, 0x48, 0x03, 0x47, 0x00, 0xBE, 0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xE1, 0xF8, 0x7E, 0x03,   // 0x04C0 (1216)
+0x4F, 0xA4, 0x0F, 0xC3, 0xF0, 0xFC, 0x38, 0x48, 0xBF, 0x38, 0xEE, 0x3B, 0x8E, 0xE3, 0xBF, 0xCF,   // 0x04D0 (1232)
+0xF3, 0xAE, 0x8E, 0xE3, 0xB8, 0xEE, 0x3F, 0xFC, 0xBF, 0x3F, 0x9C, 0x7E, 0x1F, 0x80, 0xE0, 0x38,   // 0x04E0 (1248)
+0x0E, 0xB7, 0x03, 0x80, 0xE0, 0x38, 0x77, 0x1C, 0xFE, 0x47, 0xBF, 0x1C, 0xE7, 0x1D, 0xC7, 0x71,   // 0x04F0 (1264)
+0xDC, 0x77, 0x1D, 0xAF, 0xC7, 0x71, 0xDC, 0x77, 0x3B, 0xFC, 0x49, 0xBF, 0x70, 0xDC, 0x17, 0x01,   // 0x0500 (1280)
+0xC6, 0x7F, 0x9F, 0xE7, 0x9D, 0x19, 0xC0, 0x70, 0x5C, 0x03, 0x4B, 0x49, 0xBF, 0x70, 0xDC, 0x17,   // 0x0510 (1296)
+0x01, 0xC6, 0x7F, 0x9F, 0xE7, 0xAD, 0x19, 0xC0, 0x70, 0x1C, 0x0F, 0x80, 0xBF, 0x3F, 0x9C, 0x7E,   // 0x0520 (1312)
+0x1F, 0x87, 0xE0, 0x38, 0x0E, 0xAF, 0x03, 0x9F, 0xE1, 0xF8, 0x77, 0x1C, 0x47, 0xA6, 0xE3, 0xF1,   // 0x0530 (1328)
+0xF8, 0xFC, 0x7E, 0x02, 0x57, 0xA6, 0x1F, 0x8F, 0xC7, 0xE3, 0xF0, 0x42, 0x46, 0xBF, 0x38, 0x70,   // 0x0540 (1344)
+0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x85, 0x70, 0x46, 0xBF, 0x07, 0xF0, 0x1C, 0x01, 0xC0, 0x1C,   // 0x0550 (1360)
+0x01, 0xC0, 0xBF, 0x1C, 0x01, 0xCE, 0x1C, 0xE1, 0xCE, 0x1C, 0xE1, 0x8F, 0xC3, 0xF8, 0xBF, 0xF1,   // 0x0560 (1376)
+0xDC, 0x77, 0x39, 0xDC, 0x7E, 0x1F, 0x07, 0xB7, 0xC1, 0xF8, 0x77, 0x1C, 0xE7, 0x1F, 0xC7, 0xBF,   // 0x0570 (1392)
+0xF8, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0xA7, 0x01, 0xC0, 0x70, 0x5C, 0x37, 0x02, 0x4C,   // 0x0580 (1408)
+0x9B, 0xE0, 0xFE, 0x3F, 0xE0, 0x5D, 0xB6, 0x77, 0xE4, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x04, 0x45,   // 0x0590 (1424)
+0x04, 0x42, 0xBE, 0xE0, 0xFC, 0x1F, 0xC3, 0xFC, 0x7F, 0xCF, 0xDC, 0x45, 0xBE, 0x3F, 0xE3, 0xFC,   // 0x05A0 (1440)
+0x3F, 0x83, 0xF0, 0x7E, 0x0E, 0xBE, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x7E, 0x0F, 0xC0, 0x45, 0xBE,   // 0x05B0 (1456)
+0x07, 0xE0, 0xFC, 0x1D, 0xC7, 0x1F, 0xC1, 0xF0, 0x48, 0xBF, 0x38, 0xEE, 0x3B, 0x8E, 0xE3, 0xBF,   // 0x05C0 (1472)
+0xCF, 0xF3, 0xAE, 0x80, 0xE0, 0x38, 0x0E, 0x07, 0xC0, 0xBF, 0x1F, 0x0F, 0x79, 0xC7, 0x70, 0x7E,   // 0x05D0 (1488)
+0x0F, 0xC1, 0xAE, 0xF8, 0x3F, 0x1F, 0xE7, 0xEF, 0xF8, 0x48, 0x07, 0x42, 0x05, 0x45, 0x48, 0xBF,   // 0x05E0 (1504)
+0x38, 0xEE, 0x3B, 0x8E, 0xE3, 0xBF, 0xCF, 0xF3, 0xAE, 0x9C, 0xE3, 0xB8, 0xEE, 0x3F, 0x8E, 0xBF,   // 0x05F0 (1520)
+0x7F, 0xB8, 0x7E, 0x1F, 0x87, 0xE0, 0x1F, 0xC3, 0xB7, 0xF8, 0x07, 0xE1, 0xF8, 0x7E, 0x1D, 0xFE,   // 0x0600 (1536)
+0x4C, 0xBF, 0x39, 0xC7, 0x10, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0xB6, 0x0E, 0x01, 0xC0, 0x38, 0x07,   // 0x0610 (1552)
+0x03, 0xF8, 0xBF, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xAB, 0xC7, 0xE3, 0xF1, 0xF8,   // 0x0620 (1568)
+0xEF, 0xE0, 0xBF, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xAB, 0xC7, 0xE3, 0xBB, 0x8F,   // 0x0630 (1584)
+0x83, 0x80, 0xBE, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC8, 0x45, 0xBE, 0x27, 0xE4, 0xEF,   // 0x0640 (1600)
+0xF9, 0xFF, 0x1D, 0xC3, 0xB8, 0xBF, 0xE3, 0xF1, 0xF8, 0xEE, 0xE3, 0xE0, 0xE0, 0x70, 0xAB, 0x7C,   // 0x0650 (1616)
+0x77, 0x71, 0xF8, 0xFC, 0x70, 0xBF, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3B, 0xB8, 0xF8, 0xAB, 0x38,   // 0x0660 (1632)
+0x1C, 0x0E, 0x07, 0x0F, 0xE0, 0x4C, 0xBF, 0x0F, 0x83, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x9D,   // 0x0670 (1648)
+0x0E, 0x0F, 0x07, 0xC0, 0x4C, 0x49, 0xBE, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x03,   // 0x0680 (1664)
+0x46, 0xBF, 0x80, 0x06, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0xBE, 0x0E, 0x00, 0x38, 0x00, 0xE0,   // 0x0690 (1680)
+0x03, 0x80, 0x0E, 0x0A, 0x42, 0x0B, 0x42, 0x46, 0xBE, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,   // 0x06A0 (1696)
+0x0E, 0x03, 0x49, 0xAE, 0x0C, 0x07, 0x83, 0xF1, 0xCE, 0xE0, 0x42, 0x5D, 0x93, 0xE7, 0x0E, 0x70,   // 0x06B0 (1712)
+0xBF, 0x7F, 0x00, 0xE0, 0x39, 0xFE, 0xE3, 0xB8, 0xEE, 0x8F, 0x39, 0xFB, 0xBF, 0xF0, 0x1C, 0x07,   // 0x06C0 (1728)
+0x01, 0xC0, 0x7F, 0x9C, 0x77, 0xB7, 0x1D, 0xC7, 0x71, 0xDC, 0x77, 0x1F, 0x7E, 0xBF, 0x7F, 0x71,   // 0x06D0 (1744)
+0xF8, 0xFC, 0x0E, 0x07, 0x1F, 0x8E, 0x46, 0x00, 0xBF, 0x07, 0xC0, 0xE0, 0x38, 0x0E, 0x7F, 0xB8,   // 0x06E0 (1760)
+0xEE, 0xB7, 0x3B, 0x8E, 0xE3, 0xB8, 0xEE, 0x39, 0xFB, 0xBF, 0x7F, 0x71, 0xF8, 0xFF, 0xFE, 0x07,   // 0x06F0 (1776)
+0x1F, 0x8E, 0x46, 0x00, 0xBF, 0x1F, 0x1D, 0xCE, 0xE7, 0x03, 0x87, 0xFB, 0xFC, 0xAB, 0x70, 0x38,   // 0x0700 (1792)
+0x1C, 0x0E, 0x1F, 0xC0, 0xBD, 0x7E, 0xF8, 0xEE, 0x3B, 0x8E, 0xE3, 0x9F, 0xE0, 0x46, 0x06, 0x97,   // 0x0710 (1808)
+0xEE, 0x39, 0xFC, 0xBF, 0xF0, 0x1C, 0x07, 0x01, 0xC0, 0x77, 0x9E, 0x77, 0xB7, 0x9D, 0xC7, 0x71,   // 0x0720 (1824)
+0xDC, 0x77, 0x1F, 0xC7, 0x97, 0x1C, 0x0E, 0x07, 0x0B, 0xBE, 0xFC, 0x0E, 0x07, 0x03, 0x81, 0xC0,   // 0x0730 (1840)
+0xE0, 0x70, 0x48, 0x05, 0xBF, 0xE0, 0x70, 0x38, 0x00, 0x7E, 0x07, 0x03, 0x81, 0xB7, 0xC0, 0xE0,   // 0x0740 (1856)
+0x70, 0x3F, 0x1D, 0x9E, 0x7E, 0xBF, 0xF0, 0x1C, 0x07, 0x01, 0xC0, 0x71, 0xDC, 0xE7, 0xB7, 0x71,   // 0x0750 (1872)
+0xF8, 0x77, 0x1C, 0xE7, 0x1F, 0xC7, 0xBF, 0xFC, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x9F,   // 0x0760 (1888)
+0x38, 0x1C, 0x0E, 0x07, 0x02, 0x48, 0x49, 0xBF, 0x72, 0x7E, 0x4F, 0xC9, 0xF9, 0x3F, 0x27, 0xE4,   // 0x0770 (1904)
+0x45, 0x87, 0x27, 0x47, 0xBF, 0x71, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0xBF, 0x7F, 0x71,   // 0x0780 (1920)
+0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8E, 0x46, 0x00, 0xBF, 0xDF, 0x9C, 0x77, 0x1D, 0xC7, 0x71, 0xDC,   // 0x0790 (1936)
+0x77, 0x9E, 0xF9, 0xC0, 0x70, 0x3E, 0x04, 0xBF, 0x7E, 0xF8, 0xEE, 0x3B, 0x8E, 0xE3, 0xB8, 0xE7,   // 0x07A0 (1952)
+0x9E, 0xF8, 0x0E, 0x03, 0x80, 0x44, 0xBF, 0xF7, 0x9F, 0xF7, 0x9D, 0xC0, 0x70, 0x1C, 0x07, 0x05,   // 0x07B0 (1968)
+0x44, 0x04, 0xBF, 0x7F, 0x70, 0xF8, 0x6F, 0x81, 0xF6, 0x1F, 0x0E, 0x46, 0x00, 0x03, 0xBF, 0x80,   // 0x07C0 (1984)
+0xC0, 0xE1, 0xFF, 0x38, 0x1C, 0x0E, 0x07, 0x9E, 0x03, 0xB9, 0xDC, 0x7C, 0xBF, 0xE3, 0xB8, 0xEE,   // 0x07D0 (2000)
+0x3B, 0x8E, 0xE3, 0xB8, 0xEE, 0x8F, 0x39, 0xFB, 0xBF, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3B, 0xB8,   // 0x07E0 (2016)
+0xF8, 0x87, 0x38, 0xB7, 0xE0, 0xFC, 0x1F, 0x83, 0xF2, 0x7E, 0x4E, 0x48, 0x96, 0x1D, 0xC3, 0xB8,   // 0x07F0 (2032)
+0xBF, 0xE7, 0xE7, 0x7E, 0x3C, 0x3C, 0x7E, 0xE7, 0xE7, 0xBF, 0x71, 0xDC, 0x77, 0x1D, 0xC7, 0x71,   // 0x0800 (2048)
+0xCF, 0xE1, 0x9F, 0xF0, 0x1C, 0x0E, 0x3F, 0x03, 0x49, 0xAB, 0x1E, 0x38, 0x70, 0xE1, 0xC7, 0x80,   // 0x0810 (2064)
+0x49, 0xBE, 0x0F, 0xC7, 0x01, 0xC0, 0x70, 0x38, 0x38, 0x0E, 0x08, 0xAF, 0xE0, 0x1C, 0x07, 0x01,   // 0x0820 (2080)
+0xC0, 0x3F, 0x69, 0xBF, 0xFC, 0x03, 0x80, 0xE0, 0x38, 0x07, 0x00, 0x70, 0xB7, 0x1C, 0x1C, 0x0E,   // 0x0830 (2096)
+0x03, 0x80, 0xE3, 0xF0, 0xAF, 0x7C, 0x7E, 0xE7, 0xE7, 0x7E, 0x3E,   // 0x083B (2107)
+};
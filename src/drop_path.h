@@ -0,0 +1,11 @@
+// Generated by  : imgconv
+// Generated from: drop.svg
+// Dimensions    : 30x46 pixels
+// Format        : vector path, even-odd, 0 fraction bits, see lcd7735_path_load()
+// Size          : 36 Bytes
+
+const unsigned char drop_path[0x24] ={
+0x80, 0x00, 0x10, 0x02, 0x32, 0x0E, 0x14, 0xFF, 0x0A, 0xFF, 0x0A, 0xF4, 0x04, 0xF3, 0xFF, 0x00,   // 0x0010 (16)
+0xF3, 0x00, 0xF3, 0x0D, 0xEF, 0x04, 0x00, 0xF9, 0x1D, 0x12, 0x00, 0x07, 0x06, 0x02, 0xFC, 0xFD,   // 0x0020 (32)
+0x00, 0xFA, 0x04, 0x07,   // 0x0024 (36)
+};
@@ -0,0 +1,15 @@
+// Generated by  : imgconv
+// Generated from: gear.txt
+// Dimensions    : 47x47 pixels
+// Format        : vector path, nonzero, 4 fraction bits, see lcd7735_path_load()
+// Size          : 103 Bytes
+
+const unsigned char gear_path[0x67] ={
+0x04, 0x08, 0x84, 0x02, 0x30, 0x01, 0xF1, 0x67, 0x12, 0x00, 0x7C, 0x99, 0x12, 0xED, 0x2F, 0x3B,   // 0x0010 (16)
+0x55, 0xA8, 0x58, 0xAB, 0xC5, 0xD1, 0x13, 0xEE, 0x67, 0x84, 0x00, 0xEE, 0x99, 0xD1, 0xED, 0xAB,   // 0x0020 (32)
+0x3B, 0xA8, 0xA8, 0x3B, 0xAB, 0xED, 0xD1, 0xE1, 0x99, 0xEE, 0x00, 0x84, 0x67, 0xEE, 0x13, 0xD1,   // 0x0030 (48)
+0xC5, 0xAB, 0x58, 0xA8, 0x55, 0x3B, 0x2F, 0xED, 0x12, 0x99, 0x7C, 0x00, 0x12, 0x67, 0x2F, 0x13,   // 0x0040 (64)
+0x55, 0xC5, 0x58, 0x58, 0xC5, 0x55, 0x04, 0x08, 0x7F, 0xFF, 0x7F, 0x00, 0x33, 0x00, 0xC2, 0xCE,   // 0x0050 (80)
+0xCE, 0xC2, 0x00, 0xC2, 0x00, 0xCE, 0x32, 0x00, 0x3E, 0x00, 0x3E, 0x32, 0x32, 0x3E, 0x00, 0x3E,   // 0x0060 (96)
+0x00, 0x32, 0xCE, 0x00, 0xC2, 0x04, 0x07,   // 0x0067 (103)
+};
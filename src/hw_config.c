@@ -12,10 +12,15 @@
 #include "stm32f30x_gpio.h"
 #include "stm32f30x_rcc.h"
 #include "stm32f30x_spi.h"
+#include "stm32f30x_dma.h"
 
 #include "hw_config.h"
 
 static __IO uint32_t TimingDelay;
+static __IO uint32_t TickCount;
+
+// Bytes sent to the controller, commands and parameters included, for benchmarks
+uint32_t lcd7735_bytes;
 
 #ifndef __ENABLE_NOT_STABLE
 // not work :( It is possible that GPIO pin doesn't switch to input mode, but I don't know hot to do it.
@@ -53,6 +58,7 @@ void receive_data(const uint8_t cmd, uint8_t *data, uint8_t cnt) {
 
 // Send byte via SPI to controller
 void lcd7735_senddata(const uint8_t data) {
+    lcd7735_bytes++;
 #ifdef LCD_TO_SPI2
     while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
     SPI_SendData(SPI2, data);
@@ -71,6 +77,7 @@ void lcd7735_senddata(const uint8_t data) {
 // Send byte via SPI to controller
 void lcd7735_senddata16(const uint16_t data) {
 #ifdef LCD_TO_SPI2
+    lcd7735_bytes += 2;
     while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
     SPI_I2S_SendData(SPI2, data);
 #else
@@ -79,6 +86,78 @@ void lcd7735_senddata16(const uint16_t data) {
 #endif
 }
 
+// Send a block of bytes to controller as is, DC has to be set by caller.
+// DMA reads the block directly, so it may be placed in flash, but not in
+// CCM RAM which only the core can access.
+void lcd7735_senddatabuf(const uint8_t *data, uint32_t len) {
+#ifdef LCD_TO_SPI2
+    lcd7735_bytes += len;
+#ifdef LCD_USE_DMA
+    DMA_InitTypeDef DMA_InitStructure;
+    uint16_t n;
+
+    if (((uint32_t)data & 0xFFFF0000) == CCMDATARAM_BASE) {
+        while (len--) {
+            while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+            SPI_SendData(SPI2, *data++);
+        }
+        while(SPI2->SR & SPI_SR_BSY);
+        return;
+    }
+
+    DMA_InitStructure.DMA_PeripheralBaseAddr    = (uint32_t)&SPI2->DR;
+    DMA_InitStructure.DMA_DIR                   = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_PeripheralInc         = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc             = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize    = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize        = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode                  = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority              = DMA_Priority_High;
+    DMA_InitStructure.DMA_M2M                   = DMA_M2M_Disable;
+    SPI_I2S_DMACmd(SPI2, SPI_I2S_DMAReq_Tx, ENABLE);
+    while (len) {
+        n = len > 0xFFFF ? 0xFFFF : len;
+        DMA_InitStructure.DMA_MemoryBaseAddr    = (uint32_t)data;
+        DMA_InitStructure.DMA_BufferSize        = n;
+        DMA_DeInit(DMA1_Channel5);
+        DMA_Init(DMA1_Channel5, &DMA_InitStructure);
+        DMA_Cmd(DMA1_Channel5, ENABLE);
+        while (DMA_GetFlagStatus(DMA1_FLAG_TC5) == RESET);
+        DMA_ClearFlag(DMA1_FLAG_TC5);
+        DMA_Cmd(DMA1_Channel5, DISABLE);
+        data += n;
+        len -= n;
+    }
+    SPI_I2S_DMACmd(SPI2, SPI_I2S_DMAReq_Tx, DISABLE);
+#else
+    while (len--) {
+        while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+        SPI_SendData(SPI2, *data++);
+    }
+#endif
+    while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+    while(SPI2->SR & SPI_SR_BSY);
+#else
+    while (len--)
+        lcd7735_senddata(*data++);
+#endif
+}
+
+// Deselect the panel so another device on the SPI bus (SD card of the Adafruit
+// breakout) can be used. The panel keeps its address window and a pending
+// RAMWR continues after lcd7735_acquireBus().
+void lcd7735_releaseBus(void) {
+#ifdef LCD_TO_SPI2
+    while(SPI_I2S_GetFlagStatus(SPI2, SPI_I2S_FLAG_TXE) == RESET);
+    while(SPI2->SR & SPI_SR_BSY);
+#endif
+    LCD_CS1;
+}
+
+void lcd7735_acquireBus(void) {
+    LCD_CS0;
+}
+
 // Send control command to controller
 void lcd7735_sendCmd(const uint8_t cmd) {
     LCD_DC0;
@@ -127,6 +206,9 @@ void lcd7735_setup(void) {
 #ifdef LCD_TO_SPI2  // hardware SIP
 
     RCC_APB1PeriphClockCmd(RCC_APB1Periph_SPI2, ENABLE);
+#ifdef LCD_USE_DMA
+    RCC_AHB1PeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+#endif
     // SCK (Pin_13), MOSI (Pin_15) SPI2
     GPIO_PinAFConfig(GPIOB, GPIO_PinSource13, GPIO_AF_SPI2);   // SPI2_CLK
     GPIO_PinAFConfig(GPIOB, GPIO_PinSource15, GPIO_AF_SPI2);   // SPI2_MOSI
@@ -182,7 +264,25 @@ void delay_ms(uint32_t delay_value) {
     while( TimingDelay != 0 );
 }
 
+// milliseconds since lcd7735_setup(), used for benchmarks
+uint32_t get_tick_ms(void) {
+    return TickCount;
+}
+
+// microseconds since lcd7735_setup(), from the tick count and the SysTick
+// counter, read again if a tick came in between
+uint32_t get_tick_us(void) {
+    uint32_t ms, val;
+
+    do {
+        ms = TickCount;
+        val = SysTick->VAL;
+    } while (ms != TickCount);
+    return ms * 1000 + (SysTick->LOAD - val) / (SystemCoreClock / 1000000);
+}
+
 void TimingDelay_Decrement(void) {
+    TickCount++;
     if (TimingDelay != 0x00) TimingDelay--;
     else STM_EVAL_LEDToggle(LED4);
 }
@@ -9,6 +9,23 @@
 // Can't be less 6 MGz according to datasheet on SR7755 controller
 #define SPI2_BaudRatePrescaler   SPI_BaudRatePrescaler_2
 
+// Bulk pixel data (lcd7735_senddatabuf) is sent by DMA1 channel 5, hardware SPI only
+#define LCD_USE_DMA
+
+// Bytes of RAM for glyphs expanded to RGB565 by lcd7735_print() and the terminal,
+// 0 disables the glyph cache
+#ifndef LCD_GLYPH_CACHE
+#define LCD_GLYPH_CACHE		8192
+#endif
+
+// Placement of the glyph cache, by default the 8 KB CCM RAM (IRAM2). DMA can't
+// read CCM RAM, lcd7735_senddatabuf() sends blocks there by polling.
+#if defined(__CC_ARM)
+#define LCD_GLYPH_CACHE_SECTION	__attribute__((at(0x10000000)))
+#else
+#define LCD_GLYPH_CACHE_SECTION
+#endif
+
 // CS will be set every time before and and of operation
 //#define LCD_SEL_AUTO
 
@@ -66,9 +83,16 @@
 extern void lcd7735_setup(void);
 extern void lcd7735_senddata(const uint8_t cmd);
 extern void lcd7735_senddata16(const uint16_t data);
+extern void lcd7735_senddatabuf(const uint8_t *data, uint32_t len);
 extern void lcd7735_sendCmd(const uint8_t cmd);
 extern void lcd7735_sendData(const uint8_t data);
 
+extern uint32_t get_tick_ms(void);
+extern uint32_t get_tick_us(void);
+extern uint32_t lcd7735_bytes;
+extern void lcd7735_releaseBus(void);
+extern void lcd7735_acquireBus(void);
+
 extern void receive_data(const uint8_t cmd, uint8_t *data, uint8_t cnt);
 
 #endif /* __VCP_HW_CONFIG__ */
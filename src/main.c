@@ -1,16 +1,58 @@
 #include "main.h"
 #include "hw_config.h"
 #include "ST7735.h"
+#include "ST7735_jpeg.h"
+#include "ST7735_anim.h"
+#include "ST7735_blend.h"
+#include "ST7735_text.h"
+#include "ST7735_ui.h"
+#include "ST7735_chart.h"
+#include "ST7735_heatmap.h"
+#include "ST7735_convert.h"
+#include "ST7735_fill.h"
+#include "ST7735_aa.h"
+#include "ST7735_path.h"
 
 #include <stdio.h>
+#include <math.h>
 
 #include "tux_50_ad.h"
+#include "tux_50_rle.h"
+#include "tux_50_be.h"
+#include "tux_50_jpg.h"
+#include "spinner_32.h"
+#include "aa_font_16.h"
+#include "opensans_16.h"
+#include "bigfont_rle.h"
+#include "sevenseg_rle.h"
+#include "gear_path.h"
+#include "drop_path.h"
+
+#define BENCH_LOOPS	20
+#define BLEND_LOOPS	500
 
 __IO uint32_t UserButtonPressed = 0;
 
+static JpegDec jpeg;
+static AnimPlayer spinner;
+static StripChart chart;
+static int16_t thermal[24][32];
+static uint16_t heat_palette[256];
+static uint8_t tux_alpha[50*52];
+
 /* Private function prototypes -----------------------------------------------*/
 void test_ascii_screen(void);
 void test_graphics(void);
+void test_benchmark(void);
+void test_blend(void);
+void test_fonts(void);
+void test_widgets(void);
+void test_chart(void);
+void test_heatmap(void);
+void test_convert(void);
+void test_fills(void);
+void test_gauge(void);
+void test_paths(void);
 
 int main(void) {
 
@@ -31,11 +73,42 @@ int main(void) {
 		} else if( UserButtonPressed == 0x02 ) {
 			STM_EVAL_LEDToggle(LED3);
 			test_ascii_screen();
+		} else if( UserButtonPressed == 0x03 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_benchmark();
+		} else if( UserButtonPressed == 0x04 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_blend();
+		} else if( UserButtonPressed == 0x05 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_fonts();
+		} else if( UserButtonPressed == 0x06 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_widgets();
+		} else if( UserButtonPressed == 0x07 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_chart();
+		} else if( UserButtonPressed == 0x08 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_heatmap();
+		} else if( UserButtonPressed == 0x09 ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_convert();
+		} else if( UserButtonPressed == 0x0A ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_fills();
+		} else if( UserButtonPressed == 0x0B ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_gauge();
+		} else if( UserButtonPressed == 0x0C ) {
+			STM_EVAL_LEDToggle(LED3);
+			test_paths();
 		}
 	}
 }
 
 void test_ascii_screen(void) {
+	GlyphCacheStats st;
 	unsigned char x;
 	int i;
 
@@ -47,7 +120,10 @@ void test_ascii_screen(void) {
 			lcd7735_putc(x+i);
 			delay_ms(50);
 		}
-		if( UserButtonPressed == 0x01 ) 
+		// scrolling redraws the screen from cached glyphs
+		lcd7735_getGlyphCacheStats(&st);
+		printf("\nglyph cache %lu/%lu hits\n", (unsigned long)st.hits, (unsigned long)(st.hits + st.misses));
+		if( UserButtonPressed != 0x02 ) 
 			return;
 	}
 }	
@@ -56,20 +132,32 @@ void test_graphics(void) {
 	unsigned char y;
 	unsigned char x;
 	uint8_t r = 0;
+	TextBox help;
 	//	uint8_t m[16];
 
 	//	receive_data(0x0B,m,2);
 	//	delay_ms(2000);
 	lcd7735_fillScreen(ST7735_BLACK);
 	lcd7735_setFont((uint8_t *)&BigFont[0]);
+	lcd7735_textbox_init(&help, 4, 60, 120, 96, TEXT_JUSTIFY | TEXT_ELLIPSIS, 2);
 	while(1) {
 		lcd7735_print("Hello!",10,10,0);
 		delay_ms(1000);
 		lcd7735_print("Hello!",10,10,30);
 		delay_ms(1000);
+		lcd7735_setFont((uint8_t *)&OpenSans16[0]);
+		lcd7735_print("Привет! Günaydın!",10,40,0);
+		lcd7735_textbox_draw(&help, "Press the user button to go to the next test. "
+				"Each test runs until the button is pressed again, the last one "
+				"returns to this screen.");
+		lcd7735_setFont((uint8_t *)&BigFont[0]);
+		delay_ms(1000);
 		lcd7735_drawBitmap(0,0,50,52,(bitmapdatatype)tux_50_ad,1);
 		delay_ms(1000);
 		lcd7735_drawBitmap(0,0,50,52,(bitmapdatatype)tux_50_ad,2);
+		lcd7735_setFont((uint8_t *)&SmallFont[0]);
+		lcd7735_printScaled("23.5V",CENTER,108,3);
+		lcd7735_setFont((uint8_t *)&BigFont[0]);
 		delay_ms(1000);
 		for (y=0;y<160;y++) {
 			for (x=0;x<128;x++) {
@@ -112,8 +200,515 @@ void test_graphics(void) {
 		r = (r+1) & 0x03;
 		lcd7735_setRotation(r);
 		delay_ms(1000);
-		if( UserButtonPressed == 0x02 )
+		if( UserButtonPressed != 0x01 )
 			return;
 	}
 }
 
+// Print the average time of one call, "t" is the total time of BENCH_LOOPS calls
+static void bench_report(char *name, uint32_t t, uint32_t bytes, int y) {
+	char buf[32];
+
+	sprintf(buf, "%s %luus %luB", name, (unsigned long)(t * 1000 / BENCH_LOOPS), (unsigned long)bytes);
+	lcd7735_print(buf, 0, y, 0);
+}
+
+void test_benchmark(void) {
+	char buf[32];
+	uint32_t t, t1;
+	int i;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_fillScreen(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawBitmap(0,0,50,52,(bitmapdatatype)tux_50_ad,1);
+	bench_report("raw", get_tick_ms() - t, sizeof(tux_50_ad), 60);
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawRLE565(0,0,(const uint16_t *)tux_50_rle);
+	bench_report("rle", get_tick_ms() - t, sizeof(tux_50_rle), 72);
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawBitmapSwapped(0,0,50,52,tux_50_be);
+	bench_report("swap", get_tick_ms() - t, sizeof(tux_50_be), 84);
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++) {
+		JpegMem src = { tux_50_jpg, sizeof(tux_50_jpg), 0 };
+		if (lcd7735_jpeg_prepare(&jpeg, lcd7735_jpeg_memInput, &src) == JPEG_OK)
+			lcd7735_jpeg_draw(&jpeg, 0, 0, JPEG_SCALE_1);
+	}
+	bench_report("jpeg", get_tick_ms() - t, sizeof(tux_50_jpg), 96);
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++) {
+		JpegMem src = { tux_50_jpg, sizeof(tux_50_jpg), 0 };
+		if (lcd7735_jpeg_prepare(&jpeg, lcd7735_jpeg_memInput, &src) == JPEG_OK)
+			lcd7735_jpeg_draw(&jpeg, 64, 0, JPEG_SCALE_1_2);
+	}
+	bench_report("jpeg/2", get_tick_ms() - t, sizeof(tux_50_jpg), 108);
+
+	lcd7735_setColorMode(12);
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawBitmap(0,0,50,52,(bitmapdatatype)tux_50_ad,1);
+	lcd7735_setColorMode(16);
+	bench_report("raw12", get_tick_ms() - t, sizeof(tux_50_ad) * 3 / 4, 132);
+
+	// 1-bpp BigFont against the 4-bpp anti-aliased font, same string and place
+	lcd7735_setFont((uint8_t *)&BigFont[0]);
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_print("Tux 42", 0, 144, 0);
+	t1 = get_tick_ms() - t;
+	lcd7735_setFont((uint8_t *)&AAFont16[0]);
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_print("Tux 42", 0, 144, 0);
+	t = get_tick_ms() - t;
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	sprintf(buf, "txt %lu/%luus", (unsigned long)(t1 * 1000 / BENCH_LOOPS),
+			(unsigned long)(t * 1000 / BENCH_LOOPS));
+	lcd7735_fillRect(0, 144, 128, 16, ST7735_BLACK);
+	lcd7735_print(buf, 0, 144, 0);
+
+	// delta frames against full frames of the same animation
+	sprintf(buf, "anim %luB of %luB", (unsigned long)sizeof(spinner_32),
+			(unsigned long)spinner_32[0] * spinner_32[1] * spinner_32[2] * 2);
+	lcd7735_print(buf, 0, 120, 0);
+	lcd7735_anim_start(&spinner, spinner_32, 96, 0, 1);
+	while( UserButtonPressed == 0x03 )
+		lcd7735_anim_update(&spinner);
+}
+
+
+// Print the blending rate in thousands of pixels per second, "t" is the total
+// time of BLEND_LOOPS rows of "n" pixels
+static void blend_report(char *name, uint32_t t, uint32_t n, int y) {
+	char buf[32];
+
+	if (t == 0)
+		t = 1;
+	sprintf(buf, "%s %lukpx/s", name, (unsigned long)(n * BLEND_LOOPS / t));
+	lcd7735_print(buf, 0, y, 0);
+}
+
+void test_blend(void) {
+	static uint16_t row[128];
+	Blend b;
+	uint32_t t;
+	int i, x, y;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_fillScreen(ST7735_BLUE);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+
+	// alpha fading out from the middle of the bitmap
+	for (y=0; y<52; y++)
+		for (x=0; x<50; x++) {
+			i = 255 - ((x-25)*(x-25) + (y-26)*(y-26)) * 255 / 676;
+			tux_alpha[y*50+x] = i < 0 ? 0 : i;
+		}
+
+	b.bg = NULL;
+	b.bg_color = ST7735_BLUE;
+	b.mode = BLEND_ALPHA;
+	b.alpha = 128;
+	lcd7735_drawBitmapBlend(0,0,50,52,(bitmapdatatype)tux_50_ad,&b);
+	b.mode = BLEND_KEY;
+	b.key = ST7735_WHITE;
+	lcd7735_drawBitmapBlend(52,0,50,52,(bitmapdatatype)tux_50_ad,&b);
+	b.mode = BLEND_ALPHA8;
+	b.map = tux_alpha;
+	lcd7735_drawBitmapBlend(26,54,50,52,(bitmapdatatype)tux_50_ad,&b);
+
+	for (i=0; i<128; i++)
+		row[i] = ST7735_BLUE;
+	t = get_tick_ms();
+	for (i=0; i<BLEND_LOOPS; i++)
+		lcd7735_blend(row, (const uint16_t *)tux_50_ad, 128, 128);
+	blend_report("alpha", get_tick_ms() - t, 128, 112);
+
+	t = get_tick_ms();
+	for (i=0; i<BLEND_LOOPS; i++)
+		lcd7735_blendAlpha8(row, (const uint16_t *)tux_50_ad, tux_alpha + 1300, 128);
+	blend_report("map8", get_tick_ms() - t, 128, 124);
+
+	t = get_tick_ms();
+	for (i=0; i<BLEND_LOOPS; i++)
+		lcd7735_blendAlpha4(row, (const uint16_t *)tux_50_ad, tux_alpha + 1300, 0, 128);
+	blend_report("map4", get_tick_ms() - t, 128, 136);
+
+	t = get_tick_ms();
+	for (i=0; i<BLEND_LOOPS; i++)
+		lcd7735_blendKey(row, (const uint16_t *)tux_50_ad, 128, ST7735_WHITE);
+	blend_report("key", get_tick_ms() - t, 128, 148);
+
+	while( UserButtonPressed == 0x04 );
+}
+
+// Time "st" printed BENCH_LOOPS times in font f, opaque or transparent
+static uint32_t bench_print(const unsigned char *f, char *st, int y, uint8_t transparent) {
+	uint32_t t;
+	int i;
+
+	lcd7735_setFont((uint8_t *)f);
+	lcd7735_setTransparent(transparent);
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_print(st, 0, y, 0);
+	t = get_tick_ms() - t;
+	lcd7735_setTransparent(0);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	return t;
+}
+
+// Bytes of a UTFT font: header, then x_size/8 * y_size bytes per char
+#define utftSize(f)	(4 + (f)[0] / 8 * (f)[1] * (f)[3])
+
+// UTFT fonts against the same glyphs run length encoded ("z")
+void test_fonts(void) {
+	Label counter;
+	char buf[8];
+	uint32_t t;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_fillScreen(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+
+	bench_report("big", bench_print(BigFont, "Tux 42", 0, 0), utftSize(BigFont), 64);
+	bench_report("bigz", bench_print(BigFontRLE, "Tux 42", 0, 0), sizeof(BigFontRLE), 76);
+	bench_report("big/t", bench_print(BigFont, "Tux 42", 0, 1), utftSize(BigFont), 88);
+	bench_report("bigz/t", bench_print(BigFontRLE, "Tux 42", 0, 1), sizeof(BigFontRLE), 100);
+	bench_report("7seg", bench_print(SevenSegNumFont, "1234", 14, 0), utftSize(SevenSegNumFont), 112);
+	bench_report("7segz", bench_print(SevenSegRLE, "1234", 14, 0), sizeof(SevenSegRLE), 124);
+	bench_report("7seg/t", bench_print(SevenSegNumFont, "1234", 14, 1), utftSize(SevenSegNumFont), 136);
+	bench_report("7segz/t", bench_print(SevenSegRLE, "1234", 14, 1), sizeof(SevenSegRLE), 148);
+
+	// a counter of tenths of a second, only the digits that change are sent
+	lcd7735_fillRect(0, 0, 128, 64, ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&SevenSegNumFont[0]);
+	lcd7735_label_init(&counter, 0, 7);
+	t = get_tick_ms();
+	while( UserButtonPressed == 0x05 ) {
+		sprintf(buf, "%04lu", (unsigned long)((get_tick_ms() - t) / 100 % 10000));
+		lcd7735_label_update(&counter, buf);
+	}
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+}
+
+static const char * const menu_items[] = { "Output", "Limits", "Presets", "Logging", "Display", "About" };
+
+// A screen of widgets animated from the tick, the pixels sent by each update
+// are shown in the title
+void test_widgets(void) {
+	Ui ui;
+	UiLabel title;
+	UiValue volts, percent;
+	UiBar bar;
+	UiGauge gauge;
+	UiButton run;
+	UiList menu;
+	char buf[24];
+	uint32_t t, t0, pixels = 0;
+
+	lcd7735_setRotation(LANDSAPE);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_setForeground(ST7735_WHITE);
+	lcd7735_setBackground(ST7735_BLACK);
+	lcd7735_ui_init(&ui, ST7735_BLACK, NULL);
+	lcd7735_ui_labelInit(&title, 0, 0, 160, 14, TEXT_LEFT, "");
+	lcd7735_ui_listInit(&menu, 0, 84, 76, 42, menu_items, 6);
+	lcd7735_setBackground(ST7735_BLUE);
+	lcd7735_ui_buttonInit(&run, 0, 62, 50, 18, "RUN");
+	lcd7735_setBackground(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&OpenSans16[0]);
+	lcd7735_setForeground(ST7735_YELLOW);
+	lcd7735_ui_valueInit(&volts, 0, 16, 76, 24, 2, " V");
+	lcd7735_setForeground(ST7735_GREEN);
+	lcd7735_ui_barInit(&bar, 0, 44, 76, 10, 1500);
+	lcd7735_setForeground(ST7735_CYAN);
+	lcd7735_ui_gaugeInit(&gauge, 90, 20, 64, 8, 100);
+	// drawn over the middle of the gauge
+	lcd7735_setFont((uint8_t *)&AAFont16[0]);
+	lcd7735_setForeground(ST7735_WHITE);
+	lcd7735_ui_valueInit(&percent, 100, 42, 44, 20, 0, "%");
+	percent.label.wg.flags |= WIDGET_TRANSPARENT;
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+
+	lcd7735_ui_add(&ui, &title.wg);
+	lcd7735_ui_add(&ui, &volts.label.wg);
+	lcd7735_ui_add(&ui, &bar.wg);
+	lcd7735_ui_add(&ui, &gauge.wg);
+	lcd7735_ui_add(&ui, &percent.label.wg);
+	lcd7735_ui_add(&ui, &run.label.wg);
+	lcd7735_ui_add(&ui, &menu.wg);
+
+	t0 = get_tick_ms();
+	while( UserButtonPressed == 0x06 ) {
+		t = (get_tick_ms() - t0) / 50;
+		lcd7735_ui_setValue(&volts, t * 7 % 1500);
+		lcd7735_ui_setBar(&bar, t * 7 % 1500);
+		lcd7735_ui_setGauge(&gauge, t % 200 < 100 ? t % 100 : 100 - t % 100);
+		lcd7735_ui_setValue(&percent, gauge.value);
+		lcd7735_ui_setPressed(&run, t / 20 % 2);
+		lcd7735_ui_select(&menu, t / 20 % 6);
+		sprintf(buf, "Last update %lupx", (unsigned long)pixels);
+		lcd7735_ui_setText(&title, buf);
+		pixels = lcd7735_ui_update(&ui);
+	}
+	lcd7735_setRotation(PORTRAIT);
+}
+
+// Two traces on a strip chart, the right 40 columns stay fixed and show the
+// time of a sample from the call until its column is on the panel, the
+// worst of them and the bytes sent per sample
+void test_chart(void) {
+	char buf[16];
+	int16_t v[2];
+	uint32_t t, t_max = 0, t_sum = 0, bytes, i;
+
+	lcd7735_setRotation(LANDSAPE);
+	lcd7735_fillScreen(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_chart_init(&chart, 2, -100, 100);
+	lcd7735_chart_show(&chart, 0, 40);
+
+	bytes = lcd7735_bytes;
+	for (i=0; i<BENCH_LOOPS * 10; i++) {
+		v[0] = 90 * sinf(i * 0.1f);
+		v[1] = (i * 13) % 200 - 100;
+		t = get_tick_us();
+		lcd7735_chart_add(&chart, v);
+		t = get_tick_us() - t;
+		t_sum += t;
+		if (t > t_max)
+			t_max = t;
+	}
+	bytes = lcd7735_bytes - bytes;
+	sprintf(buf, "%luus", (unsigned long)(t_sum / (BENCH_LOOPS * 10)));
+	lcd7735_print(buf, 120, 0, 0);
+	sprintf(buf, "<%luus", (unsigned long)t_max);
+	lcd7735_print(buf, 120, 12, 0);
+	sprintf(buf, "%luB", (unsigned long)(bytes / (BENCH_LOOPS * 10)));
+	lcd7735_print(buf, 120, 24, 0);
+
+	for (i=BENCH_LOOPS * 10; UserButtonPressed == 0x07; i++) {
+		v[0] = 90 * sinf(i * 0.1f);
+		v[1] = (i * 13) % 200 - 100;
+		lcd7735_chart_add(&chart, v);
+		delay_ms(20);
+	}
+	lcd7735_setScrollArea(0, 0);
+	lcd7735_scrollTo(0);
+	lcd7735_setRotation(PORTRAIT);
+}
+
+// A 32x24 thermal frame in hundredths of a degree: 25C with a warm spot
+// moving in a circle
+static void thermal_frame(uint32_t n) {
+	int x, y, dx, dy;
+	int sx = 16 + 10 * cosf(n * 0.05f), sy = 12 + 7 * sinf(n * 0.05f);
+
+	for (y=0; y<24; y++)
+		for (x=0; x<32; x++) {
+			dx = x - sx;
+			dy = y - sy;
+			thermal[y][x] = 2500 + 1000 * 16 / (16 + dx * dx + dy * dy) + (x * 7 + y * 13 + n) % 10;
+		}
+}
+
+// The thermal frame scaled to the full landscape screen, the palette changes
+// every 100 frames, the frame rate and the range are shown on top
+void test_heatmap(void) {
+	HeatMap hm;
+	char buf[32];
+	uint32_t n, t = 0, t0;
+
+	lcd7735_setRotation(LANDSAPE);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_heatmap_init(&hm, thermal, 32, 24, 16, heat_palette);
+	for (n=0; UserButtonPressed == 0x08; n++) {
+		if (n % 100 == 0)
+			lcd7735_heatmap_palette(heat_palette, n / 100 % 3);
+		thermal_frame(n);
+		t0 = get_tick_ms();
+		lcd7735_heatmap_draw(&hm, 0, 0, 160, 128);
+		t += get_tick_ms() - t0;
+		if (n % 20 == 19) {
+			sprintf(buf, "%lufps %d-%dC", (unsigned long)(20000 / (t ? t : 1)), hm.lo / 100, hm.hi / 100);
+			t = 0;
+		}
+		if (n >= 19)
+			lcd7735_print(buf, 0, 0, 0);
+	}
+	lcd7735_setRotation(PORTRAIT);
+}
+
+// Time BENCH_LOOPS blits of a 128x8 strip of format at y
+static uint32_t bench_strip(const void *strip, uint8_t format, int y) {
+	uint32_t t = get_tick_ms();
+	int i;
+
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawBitmapRGB(0, y, 128, 8, strip, 0, format);
+	return get_tick_ms() - t;
+}
+
+// A dark gradient as RGB888 and YUYV strips, converted while streamed, plain
+// and dithered, with the time of one strip
+void test_convert(void) {
+	static uint8_t rgb[128 * 8 * 3], yuv[128 * 8 * 2];
+	uint8_t *p;
+	int x, y;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_fillScreen(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	for (y=0; y<8; y++)
+		for (x=0; x<128; x++) {
+			p = rgb + (y * 128 + x) * 3;
+			p[0] = x / 4;
+			p[1] = x / 2;
+			p[2] = x;
+			// gray ramp, U and V neutral
+			p = yuv + (y * 128 + x) * 2;
+			p[0] = 16 + x / 2;
+			p[1] = 128;
+		}
+	bench_report("888", bench_strip(rgb, PIXEL_RGB888, 0), sizeof(rgb), 24);
+	bench_report("888/d", bench_strip(rgb, PIXEL_RGB888 | CONVERT_DITHER, 8), sizeof(rgb), 36);
+	bench_report("yuv", bench_strip(yuv, PIXEL_YUYV, 60), sizeof(yuv), 84);
+	bench_report("yuv/d", bench_strip(yuv, PIXEL_YUYV | CONVERT_DITHER, 68), sizeof(yuv), 96);
+
+	while( UserButtonPressed == 0x09 );
+}
+
+static const uint8_t hatch[8] = { 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81 };
+
+// Gradient and pattern fills of rectangles, circles and a star, with the time
+// of a full screen gradient
+void test_fills(void) {
+	static const int16_t star[] = { 64, 70, 78, 108, 118, 108, 86, 130, 98, 156, 64, 140, 30, 156, 42, 130, 10, 108, 50, 108 };
+	Fill f;
+	uint32_t t;
+	int i;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_fill_linear(&f, 0, 0, ST7735_BLUE, 127, 159, ST7735_BLACK);
+	f.type |= FILL_DITHER;
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_fill_rect(&f, 0, 0, 128, 160);
+	t = get_tick_ms() - t;
+
+	lcd7735_fill_pattern(&f, hatch, ST7735_YELLOW, ST7735_BLACK);
+	lcd7735_fill_rect(&f, 4, 16, 56, 40);
+	lcd7735_fill_radial(&f, 88, 30, 28, ST7735_WHITE, ST7735_RED);
+	lcd7735_fill_circle(&f, 96, 36, 24);
+	lcd7735_fill_linear(&f, 10, 70, ST7735_RED, 118, 156, ST7735_GREEN);
+	f.type |= FILL_DITHER;
+	lcd7735_fill_polygon(&f, star, 10);
+	bench_report("grad", t, 128 * 160 * 2, 0);
+
+	while( UserButtonPressed == 0x0A );
+}
+
+#define GAUGE_BG	0x18C6
+
+// An anti-aliased gauge with a sweeping needle, erased by drawing it again in
+// the face color, and the time of 20 needles aliased and anti-aliased
+void test_gauge(void) {
+	char buf[32];
+	uint32_t t, t1;
+	int i, x0 = 0, y0 = 0, x, y;
+	float a;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_fillScreen(GAUGE_BG);
+	lcd7735_aa_circle(64, 90, 60, ST7735_WHITE, GAUGE_BG);
+	lcd7735_aa_circle(64, 90, 58, ST7735_YELLOW, GAUGE_BG);
+	for (i=0; i<24; i++) {
+		a = i * 3.14159f / 12;
+		lcd7735_aa_line(64 + 48 * cosf(a), 90 + 48 * sinf(a), 64 + 56 * cosf(a), 90 + 56 * sinf(a), ST7735_WHITE, GAUGE_BG);
+	}
+
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_drawFastLine(64, 90, 64 + i * 2, 45, ST7735_WHITE);
+	t = get_tick_ms() - t;
+	t1 = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_aa_line(64, 90, 64 + i * 2, 45, ST7735_WHITE, GAUGE_BG);
+	t1 = get_tick_ms() - t1;
+	for (i=0; i<BENCH_LOOPS; i++) {
+		lcd7735_drawFastLine(64, 90, 64 + i * 2, 45, GAUGE_BG);
+		lcd7735_aa_line(64, 90, 64 + i * 2, 45, GAUGE_BG, GAUGE_BG);
+	}
+	sprintf(buf, "line %luus aa %luus", (unsigned long)(t * 1000 / BENCH_LOOPS), (unsigned long)(t1 * 1000 / BENCH_LOOPS));
+	lcd7735_print(buf, 0, 0, 0);
+
+	for (i=0; UserButtonPressed == 0x0B; i++) {
+		a = 3.14159f * (0.75f + (i % 300) / 200.0f);
+		x = 64 + 44 * cosf(a);
+		y = 90 + 44 * sinf(a);
+		if (i)
+			lcd7735_aa_line(64, 90, x0, y0, GAUGE_BG, GAUGE_BG);
+		lcd7735_aa_line(64, 90, x, y, ST7735_RED, GAUGE_BG);
+		x0 = x;
+		y0 = y;
+		delay_ms(20);
+	}
+}
+
+static PathPoint path_pts[128], outline_pts[640];
+
+// Path icons loaded from flash at two scales, filled solid and with
+// gradients, a stroked wave, and the time of the small gear
+void test_paths(void) {
+	Path p, o;
+	Fill f;
+	uint32_t t;
+	uint8_t rule;
+	int i;
+
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_fillScreen(ST7735_BLACK);
+	lcd7735_path_init(&p, path_pts, sizeof(path_pts) / sizeof(path_pts[0]));
+	rule = lcd7735_path_load(&p, gear_path, 2, 12, 256);
+	lcd7735_fill_solid(&f, ST7735_WHITE);
+	t = get_tick_ms();
+	for (i=0; i<BENCH_LOOPS; i++)
+		lcd7735_path_fill(&p, rule, &f);
+	t = get_tick_ms() - t;
+
+	lcd7735_path_init(&p, path_pts, sizeof(path_pts) / sizeof(path_pts[0]));
+	rule = lcd7735_path_load(&p, drop_path, 52, 12, 256);
+	lcd7735_fill_linear(&f, 0, 12, ST7735_CYAN, 0, 58, ST7735_BLUE);
+	lcd7735_path_fill(&p, rule, &f);
+
+	lcd7735_path_init(&p, path_pts, sizeof(path_pts) / sizeof(path_pts[0]));
+	lcd7735_path_moveTo(&p, PATH_PX(88), PATH_PX(36));
+	lcd7735_path_cubicTo(&p, PATH_PX(96), PATH_PX(8), PATH_PX(104), PATH_PX(8), PATH_PX(106), PATH_PX(36));
+	lcd7735_path_cubicTo(&p, PATH_PX(108), PATH_PX(64), PATH_PX(116), PATH_PX(64), PATH_PX(124), PATH_PX(36));
+	lcd7735_path_init(&o, outline_pts, sizeof(outline_pts) / sizeof(outline_pts[0]));
+	lcd7735_path_stroke(&p, &o, PATH_PX(3));
+	lcd7735_fill_solid(&f, ST7735_YELLOW);
+	lcd7735_path_fill(&o, PATH_NONZERO, &f);
+
+	lcd7735_path_init(&p, path_pts, sizeof(path_pts) / sizeof(path_pts[0]));
+	rule = lcd7735_path_load(&p, gear_path, 16, 62, 512);
+	lcd7735_fill_radial(&f, 64, 110, 48, ST7735_WHITE, ST7735_RED);
+	lcd7735_path_fill(&p, rule, &f);
+	bench_report("gear", t, sizeof(gear_path), 0);
+
+	while( UserButtonPressed == 0x0C );
+}
@@ -0,0 +1,408 @@
+// Generated by  : imgconv
+// Generated from: OpenSans-64.bdf
+// Format        : proportional font, see lcd7735_setFont()
+// Size          : 6408 Bytes
+
+const unsigned char OpenSans16[0x1908] ={
+0x00, 0x84, 0x10, 0x0C, 0x0D, 0x00, 0xAD, 0x00, 0x17, 0x00, 0x20, 0x00, 0x5F, 0x00, 0x00, 0x00,   // 0x0010 (16)
+0xC7, 0x00, 0x01, 0x00, 0x5F, 0x00, 0xD6, 0x00, 0x01, 0x00, 0x60, 0x00, 0xDC, 0x00, 0x01, 0x00,   // 0x0020 (32)
+0x61, 0x00, 0xE7, 0x00, 0x01, 0x00, 0x62, 0x00, 0xF6, 0x00, 0x01, 0x00, 0x63, 0x00, 0xFC, 0x00,   // 0x0030 (48)
+0x01, 0x00, 0x64, 0x00, 0x1E, 0x01, 0x02, 0x00, 0x65, 0x00, 0x30, 0x01, 0x02, 0x00, 0x67, 0x00,   // 0x0040 (64)
+0x5E, 0x01, 0x02, 0x00, 0x69, 0x00, 0x01, 0x04, 0x01, 0x00, 0x6B, 0x00, 0x10, 0x04, 0x40, 0x00,   // 0x0050 (80)
+0x6C, 0x00, 0x51, 0x04, 0x01, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,   // 0x0060 (96)
+0x00, 0x00, 0x00, 0x03, 0x09, 0x00, 0x04, 0x03, 0x12, 0x00, 0x00, 0x04, 0x03, 0x00, 0x04, 0x05,   // 0x0070 (112)
+0x18, 0x00, 0x00, 0x08, 0x09, 0x00, 0x04, 0x08, 0x3C, 0x00, 0x00, 0x06, 0x0A, 0x00, 0x03, 0x07,   // 0x0080 (128)
+0x5A, 0x00, 0x00, 0x09, 0x09, 0x00, 0x04, 0x0A, 0x87, 0x00, 0x00, 0x09, 0x09, 0x00, 0x04, 0x09,   // 0x0090 (144)
+0xB4, 0x00, 0x00, 0x02, 0x03, 0x00, 0x04, 0x03, 0xB7, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x04, 0x04,   // 0x00A0 (160)
+0xCB, 0x00, 0x00, 0x03, 0x0A, 0x00, 0x04, 0x04, 0xDF, 0x00, 0x00, 0x06, 0x06, 0x00, 0x03, 0x06,   // 0x00B0 (176)
+0xF1, 0x00, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07, 0x03, 0x01, 0x00, 0x02, 0x03, 0x00, 0x0B, 0x03,   // 0x00C0 (192)
+0x06, 0x01, 0x00, 0x04, 0x02, 0x00, 0x08, 0x04, 0x0A, 0x01, 0x00, 0x03, 0x03, 0x00, 0x0A, 0x03,   // 0x00D0 (208)
+0x10, 0x01, 0x00, 0x04, 0x09, 0x00, 0x04, 0x04, 0x22, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x00E0 (224)
+0x3D, 0x01, 0x00, 0x03, 0x09, 0x01, 0x04, 0x07, 0x4F, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x00F0 (240)
+0x6A, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07, 0x85, 0x01, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07,   // 0x0100 (256)
+0xA9, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07, 0xC4, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x0110 (272)
+0xDF, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07, 0xFA, 0x01, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x0120 (288)
+0x15, 0x02, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07, 0x30, 0x02, 0x00, 0x03, 0x07, 0x00, 0x06, 0x03,   // 0x0130 (304)
+0x3E, 0x02, 0x00, 0x03, 0x08, 0x00, 0x06, 0x03, 0x4E, 0x02, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07,   // 0x0140 (320)
+0x60, 0x02, 0x00, 0x06, 0x04, 0x00, 0x06, 0x07, 0x6C, 0x02, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07,   // 0x0150 (336)
+0x7E, 0x02, 0x00, 0x05, 0x09, 0x00, 0x04, 0x05, 0x99, 0x02, 0x00, 0x0A, 0x0A, 0x00, 0x04, 0x0A,   // 0x0160 (352)
+0xCB, 0x02, 0x00, 0x08, 0x09, 0x00, 0x04, 0x07, 0xEF, 0x02, 0x00, 0x06, 0x09, 0x01, 0x04, 0x08,   // 0x0170 (368)
+0x0A, 0x03, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0x2E, 0x03, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09,   // 0x0180 (384)
+0x52, 0x03, 0x00, 0x05, 0x09, 0x01, 0x04, 0x07, 0x6D, 0x03, 0x00, 0x05, 0x09, 0x01, 0x04, 0x06,   // 0x0190 (400)
+0x88, 0x03, 0x00, 0x08, 0x09, 0x00, 0x04, 0x08, 0xAC, 0x03, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09,   // 0x01A0 (416)
+0xD0, 0x03, 0x00, 0x01, 0x09, 0x01, 0x04, 0x03, 0xD9, 0x03, 0x00, 0x03, 0x0B, 0xFF, 0x04, 0x03,   // 0x01B0 (432)
+0xEF, 0x03, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07, 0x0A, 0x04, 0x00, 0x05, 0x09, 0x01, 0x04, 0x06,   // 0x01C0 (448)
+0x25, 0x04, 0x00, 0x09, 0x09, 0x01, 0x04, 0x0B, 0x52, 0x04, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09,   // 0x01D0 (464)
+0x76, 0x04, 0x00, 0x09, 0x09, 0x00, 0x04, 0x09, 0xA3, 0x04, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07,   // 0x01E0 (480)
+0xBE, 0x04, 0x00, 0x09, 0x0A, 0x00, 0x04, 0x09, 0xF0, 0x04, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07,   // 0x01F0 (496)
+0x0B, 0x05, 0x00, 0x06, 0x09, 0x00, 0x04, 0x06, 0x26, 0x05, 0x00, 0x07, 0x09, 0x00, 0x04, 0x06,   // 0x0200 (512)
+0x4A, 0x05, 0x00, 0x07, 0x09, 0x01, 0x04, 0x08, 0x6E, 0x05, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07,   // 0x0210 (528)
+0x92, 0x05, 0x00, 0x0B, 0x09, 0x00, 0x04, 0x0B, 0xC8, 0x05, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07,   // 0x0220 (544)
+0xEC, 0x05, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0x10, 0x06, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x0230 (560)
+0x2B, 0x06, 0x00, 0x03, 0x0A, 0x01, 0x04, 0x04, 0x3F, 0x06, 0x00, 0x04, 0x09, 0x00, 0x04, 0x04,   // 0x0240 (576)
+0x51, 0x06, 0x00, 0x03, 0x0A, 0x00, 0x04, 0x04, 0x65, 0x06, 0x00, 0x06, 0x06, 0x00, 0x04, 0x06,   // 0x0250 (592)
+0x77, 0x06, 0x00, 0x06, 0x01, 0xFF, 0x0D, 0x05, 0x7A, 0x06, 0x00, 0x03, 0x03, 0x02, 0x03, 0x07,   // 0x0260 (608)
+0x80, 0x06, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0x95, 0x06, 0x00, 0x06, 0x0A, 0x01, 0x03, 0x07,   // 0x0270 (624)
+0xB3, 0x06, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06, 0xC8, 0x06, 0x00, 0x06, 0x0A, 0x00, 0x03, 0x07,   // 0x0280 (640)
+0xE6, 0x06, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0xFB, 0x06, 0x00, 0x05, 0x0A, 0x00, 0x03, 0x04,   // 0x0290 (656)
+0x19, 0x07, 0x00, 0x06, 0x09, 0x00, 0x06, 0x06, 0x34, 0x07, 0x00, 0x05, 0x0A, 0x01, 0x03, 0x07,   // 0x02A0 (672)
+0x52, 0x07, 0x00, 0x01, 0x0A, 0x01, 0x03, 0x03, 0x5C, 0x07, 0x00, 0x03, 0x0C, 0xFF, 0x03, 0x03,   // 0x02B0 (688)
+0x74, 0x07, 0x00, 0x05, 0x0A, 0x01, 0x03, 0x06, 0x92, 0x07, 0x00, 0x01, 0x0A, 0x01, 0x03, 0x03,   // 0x02C0 (704)
+0x9C, 0x07, 0x00, 0x09, 0x07, 0x01, 0x06, 0x0B, 0xBF, 0x07, 0x00, 0x05, 0x07, 0x01, 0x06, 0x07,   // 0x02D0 (720)
+0xD4, 0x07, 0x00, 0x07, 0x07, 0x00, 0x06, 0x07, 0xF0, 0x07, 0x00, 0x06, 0x09, 0x01, 0x06, 0x07,   // 0x02E0 (736)
+0x0B, 0x08, 0x00, 0x06, 0x09, 0x00, 0x06, 0x07, 0x26, 0x08, 0x00, 0x04, 0x07, 0x01, 0x06, 0x05,   // 0x02F0 (752)
+0x34, 0x08, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06, 0x49, 0x08, 0x00, 0x04, 0x09, 0x00, 0x04, 0x04,   // 0x0300 (768)
+0x5B, 0x08, 0x00, 0x05, 0x07, 0x01, 0x06, 0x07, 0x70, 0x08, 0x00, 0x06, 0x07, 0x00, 0x06, 0x06,   // 0x0310 (784)
+0x85, 0x08, 0x00, 0x09, 0x07, 0x00, 0x06, 0x09, 0xA8, 0x08, 0x00, 0x06, 0x07, 0x00, 0x06, 0x06,   // 0x0320 (800)
+0xBD, 0x08, 0x00, 0x06, 0x09, 0x00, 0x06, 0x06, 0xD8, 0x08, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06,   // 0x0330 (816)
+0xED, 0x08, 0x00, 0x04, 0x0A, 0x00, 0x04, 0x04, 0x01, 0x09, 0x00, 0x02, 0x0C, 0x02, 0x03, 0x06,   // 0x0340 (832)
+0x0D, 0x09, 0x00, 0x04, 0x0A, 0x00, 0x04, 0x04, 0x21, 0x09, 0x00, 0x06, 0x02, 0x00, 0x07, 0x07,   // 0x0350 (848)
+0x27, 0x09, 0x00, 0x07, 0x0B, 0x00, 0x04, 0x07, 0x53, 0x09, 0x00, 0x09, 0x0B, 0x00, 0x02, 0x09,   // 0x0360 (864)
+0x8A, 0x09, 0x00, 0x07, 0x0B, 0x01, 0x02, 0x08, 0xB6, 0x09, 0x00, 0x05, 0x09, 0x00, 0x06, 0x06,   // 0x0370 (880)
+0xD1, 0x09, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0xF5, 0x09, 0x00, 0x05, 0x09, 0x01, 0x04, 0x07,   // 0x0380 (896)
+0x10, 0x0A, 0x00, 0x08, 0x0C, 0x00, 0x01, 0x08, 0x40, 0x0A, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x06,   // 0x0390 (912)
+0x64, 0x0A, 0x00, 0x02, 0x0C, 0x01, 0x01, 0x03, 0x70, 0x0A, 0x00, 0x01, 0x07, 0x01, 0x06, 0x03,   // 0x03A0 (928)
+0x77, 0x0A, 0x00, 0x06, 0x0B, 0x00, 0x04, 0x06, 0x98, 0x0A, 0x00, 0x05, 0x09, 0x00, 0x06, 0x06,   // 0x03B0 (944)
+0xB3, 0x0A, 0x00, 0x05, 0x0B, 0x01, 0x02, 0x07, 0xD4, 0x0A, 0x00, 0x08, 0x09, 0x00, 0x04, 0x07,   // 0x03C0 (960)
+0xF8, 0x0A, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07, 0x13, 0x0B, 0x00, 0x06, 0x09, 0x01, 0x04, 0x08,   // 0x03D0 (976)
+0x2E, 0x0B, 0x00, 0x05, 0x09, 0x01, 0x04, 0x06, 0x49, 0x0B, 0x00, 0x08, 0x0B, 0x00, 0x04, 0x08,   // 0x03E0 (992)
+0x75, 0x0B, 0x00, 0x05, 0x09, 0x01, 0x04, 0x07, 0x90, 0x0B, 0x00, 0x0A, 0x09, 0x00, 0x04, 0x0A,   // 0x03F0 (1008)
+0xBD, 0x0B, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07, 0xD8, 0x0B, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09,   // 0x0400 (1024)
+0xFC, 0x0B, 0x00, 0x07, 0x0C, 0x01, 0x01, 0x09, 0x2C, 0x0C, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07,   // 0x0410 (1040)
+0x47, 0x0C, 0x00, 0x07, 0x09, 0x00, 0x04, 0x08, 0x6B, 0x0C, 0x00, 0x09, 0x09, 0x01, 0x04, 0x0B,   // 0x0420 (1056)
+0x98, 0x0C, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09, 0xBC, 0x0C, 0x00, 0x09, 0x09, 0x00, 0x04, 0x09,   // 0x0430 (1072)
+0xE9, 0x0C, 0x00, 0x07, 0x09, 0x01, 0x04, 0x09, 0x0D, 0x0D, 0x00, 0x06, 0x09, 0x01, 0x04, 0x07,   // 0x0440 (1088)
+0x28, 0x0D, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0x4C, 0x0D, 0x00, 0x07, 0x09, 0x00, 0x04, 0x06,   // 0x0450 (1104)
+0x70, 0x0D, 0x00, 0x08, 0x09, 0x00, 0x04, 0x07, 0x94, 0x0D, 0x00, 0x09, 0x09, 0x00, 0x04, 0x09,   // 0x0460 (1120)
+0xC1, 0x0D, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0xE5, 0x0D, 0x00, 0x08, 0x0B, 0x01, 0x04, 0x09,   // 0x0470 (1136)
+0x11, 0x0E, 0x00, 0x06, 0x09, 0x01, 0x04, 0x08, 0x2C, 0x0E, 0x00, 0x0A, 0x09, 0x01, 0x04, 0x0C,   // 0x0480 (1152)
+0x59, 0x0E, 0x00, 0x0B, 0x0B, 0x01, 0x04, 0x0C, 0x9B, 0x0E, 0x00, 0x08, 0x09, 0x00, 0x04, 0x08,   // 0x0490 (1168)
+0xBF, 0x0E, 0x00, 0x08, 0x09, 0x01, 0x04, 0x0A, 0xE3, 0x0E, 0x00, 0x06, 0x09, 0x01, 0x04, 0x08,   // 0x04A0 (1184)
+0xFE, 0x0E, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0x22, 0x0F, 0x00, 0x0B, 0x09, 0x01, 0x04, 0x0C,   // 0x04B0 (1200)
+0x58, 0x0F, 0x00, 0x07, 0x09, 0x00, 0x04, 0x07, 0x7C, 0x0F, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07,   // 0x04C0 (1216)
+0x91, 0x0F, 0x00, 0x06, 0x0A, 0x00, 0x03, 0x07, 0xAF, 0x0F, 0x00, 0x06, 0x07, 0x01, 0x06, 0x07,   // 0x04D0 (1232)
+0xC4, 0x0F, 0x00, 0x04, 0x07, 0x01, 0x06, 0x05, 0xD2, 0x0F, 0x00, 0x07, 0x09, 0x00, 0x06, 0x07,   // 0x04E0 (1248)
+0xF6, 0x0F, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0x0B, 0x10, 0x00, 0x09, 0x07, 0x00, 0x06, 0x09,   // 0x04F0 (1264)
+0x2E, 0x10, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06, 0x43, 0x10, 0x00, 0x06, 0x07, 0x01, 0x06, 0x07,   // 0x0500 (1280)
+0x58, 0x10, 0x00, 0x06, 0x0A, 0x01, 0x03, 0x07, 0x76, 0x10, 0x00, 0x05, 0x07, 0x01, 0x06, 0x06,   // 0x0510 (1296)
+0x8B, 0x10, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0xA0, 0x10, 0x00, 0x07, 0x07, 0x01, 0x06, 0x09,   // 0x0520 (1312)
+0xBC, 0x10, 0x00, 0x06, 0x07, 0x01, 0x06, 0x07, 0xD1, 0x10, 0x00, 0x07, 0x07, 0x00, 0x06, 0x07,   // 0x0530 (1328)
+0xED, 0x10, 0x00, 0x06, 0x07, 0x01, 0x06, 0x07, 0x02, 0x11, 0x00, 0x06, 0x09, 0x01, 0x06, 0x07,   // 0x0540 (1344)
+0x1D, 0x11, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06, 0x32, 0x11, 0x00, 0x05, 0x07, 0x00, 0x06, 0x05,   // 0x0550 (1360)
+0x47, 0x11, 0x00, 0x06, 0x09, 0x00, 0x06, 0x06, 0x62, 0x11, 0x00, 0x08, 0x0C, 0x00, 0x03, 0x08,   // 0x0560 (1376)
+0x92, 0x11, 0x00, 0x06, 0x07, 0x00, 0x06, 0x06, 0xA7, 0x11, 0x00, 0x06, 0x09, 0x01, 0x06, 0x07,   // 0x0570 (1392)
+0xC2, 0x11, 0x00, 0x05, 0x07, 0x01, 0x06, 0x07, 0xD7, 0x11, 0x00, 0x09, 0x07, 0x01, 0x06, 0x0A,   // 0x0580 (1408)
+0xFA, 0x11, 0x00, 0x09, 0x09, 0x01, 0x06, 0x0A, 0x27, 0x12, 0x00, 0x08, 0x07, 0x00, 0x06, 0x08,   // 0x0590 (1424)
+0x43, 0x12, 0x00, 0x07, 0x07, 0x01, 0x06, 0x09, 0x5F, 0x12, 0x00, 0x05, 0x07, 0x01, 0x06, 0x07,   // 0x05A0 (1440)
+0x74, 0x12, 0x00, 0x05, 0x07, 0x00, 0x06, 0x06, 0x89, 0x12, 0x00, 0x08, 0x07, 0x01, 0x06, 0x0A,   // 0x05B0 (1456)
+0xA5, 0x12, 0x00, 0x06, 0x07, 0x00, 0x06, 0x07, 0xBA, 0x12, 0x00, 0x06, 0x09, 0x00, 0x04, 0x07,   // 0x05C0 (1472)
+0x21, 0x00, 0x34, 0x00, 0xFF, 0x21, 0x00, 0x36, 0x00, 0xFF, 0x21, 0x00, 0x37, 0x00, 0xFF, 0x21,   // 0x05D0 (1488)
+0x00, 0x39, 0x00, 0xFF, 0x26, 0x00, 0x41, 0x00, 0xFF, 0x2C, 0x00, 0x34, 0x00, 0xFF, 0x2C, 0x00,   // 0x05E0 (1504)
+0x36, 0x00, 0xFF, 0x2C, 0x00, 0x39, 0x00, 0xFF, 0x30, 0x00, 0x41, 0x00, 0xFF, 0x34, 0x00, 0x21,   // 0x05F0 (1520)
+0x00, 0xFF, 0x34, 0x00, 0x41, 0x00, 0xFF, 0x34, 0x00, 0x45, 0x00, 0xFF, 0x34, 0x00, 0x4F, 0x00,   // 0x0600 (1536)
+0xFF, 0x34, 0x00, 0x59, 0x00, 0xFF, 0x36, 0x00, 0x21, 0x00, 0xFF, 0x36, 0x00, 0x4F, 0x00, 0xFF,   // 0x0610 (1552)
+0x37, 0x00, 0x21, 0x00, 0xFF, 0x39, 0x00, 0x21, 0x00, 0xFF, 0x39, 0x00, 0x4F, 0x00, 0xFF, 0x6F,   // 0x0620 (1568)
+0x00, 0x8C, 0x00, 0xFF, 0x6F, 0x00, 0x9A, 0x00, 0xFF, 0x7E, 0x00, 0x8C, 0x00, 0xFF, 0x7E, 0x00,   // 0x0630 (1584)
+0x9A, 0x00, 0xFF, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x06, 0x00, 0x04,   // 0x0640 (1600)
+0x00, 0x2F, 0x20, 0x04, 0x00, 0x4B, 0x4B, 0x4B, 0x4B, 0x08, 0x08, 0x00, 0x48, 0x0A, 0x10, 0x00,   // 0x0650 (1616)
+0x67, 0x0B, 0x00, 0x28, 0xB9, 0x8D, 0x82, 0x14, 0xC4, 0x79, 0x41, 0x00, 0xC0, 0x84, 0x00, 0x8C,   // 0x0660 (1632)
+0xDB, 0xEB, 0x80, 0x06, 0x70, 0xC0, 0x00, 0x08, 0x41, 0xB0, 0x00, 0x03, 0x01, 0x20, 0x00, 0x00,   // 0x0670 (1648)
+0x04, 0x00, 0x01, 0x7B, 0x72, 0x1E, 0x69, 0x64, 0x3C, 0x08, 0x00, 0x08, 0xA9, 0x00, 0x00, 0x2B,   // 0x0680 (1664)
+0xC3, 0x00, 0x08, 0x5B, 0x23, 0x08, 0x88, 0x29, 0xBD, 0x71, 0x00, 0x08, 0x00, 0x1B, 0xC6, 0x00,   // 0x0690 (1680)
+0x93, 0x00, 0x58, 0x0B, 0x04, 0x90, 0x00, 0x84, 0x0B, 0x0A, 0x20, 0x00, 0x58, 0x0B, 0x58, 0x8A,   // 0x06A0 (1696)
+0x30, 0x0B, 0xC6, 0xC6, 0x81, 0xA0, 0x00, 0x07, 0x68, 0x40, 0xC0, 0x00, 0x1C, 0x07, 0x60, 0xB0,   // 0x06B0 (1712)
+0x00, 0x84, 0x02, 0xB8, 0x80, 0x00, 0x40, 0x00, 0x23, 0x00, 0x02, 0xDB, 0xC2, 0x00, 0x00, 0x08,   // 0x06C0 (1728)
+0x60, 0x88, 0x00, 0x00, 0x07, 0x90, 0xA5, 0x00, 0x00, 0x00, 0xDD, 0x70, 0x00, 0x00, 0x09, 0xAC,   // 0x06D0 (1744)
+0x80, 0x19, 0x00, 0x4B, 0x01, 0xB9, 0x88, 0x00, 0x4A, 0x00, 0x0B, 0xE1, 0x00, 0x1C, 0x98, 0xBB,   // 0x06E0 (1760)
+0x99, 0x00, 0x00, 0x34, 0x20, 0x04, 0x10, 0x4B, 0x3B, 0x08, 0x03, 0xB0, 0x0B, 0x40, 0x2D, 0x00,   // 0x06F0 (1776)
+0x78, 0x00, 0x88, 0x00, 0x88, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x0B, 0x40, 0x03, 0xB0, 0x5A, 0x00,   // 0x0700 (1792)
+0x0B, 0x40, 0x06, 0x90, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x06, 0xA0, 0x0B, 0x40,   // 0x0710 (1808)
+0x4A, 0x00, 0x00, 0x44, 0x00, 0x00, 0x58, 0x00, 0x69, 0x8A, 0x88, 0x24, 0xBC, 0x43, 0x04, 0xB8,   // 0x0720 (1824)
+0x80, 0x05, 0x41, 0x80, 0x00, 0x38, 0x00, 0x00, 0x4B, 0x00, 0x24, 0x7C, 0x44, 0x48, 0x9D, 0x88,   // 0x0730 (1840)
+0x00, 0x4B, 0x00, 0x00, 0x4B, 0x00, 0x3D, 0x68, 0x72, 0x24, 0x41, 0x48, 0x82, 0x04, 0x00, 0x2F,   // 0x0740 (1856)
+0x20, 0x04, 0x00, 0x00, 0x1D, 0x00, 0x68, 0x00, 0xB3, 0x02, 0xD0, 0x08, 0x70, 0x0D, 0x20, 0x4A,   // 0x0750 (1872)
+0x00, 0x96, 0x00, 0x30, 0x00, 0x06, 0xCC, 0x90, 0x1D, 0x10, 0x88, 0x49, 0x00, 0x3B, 0x88, 0x00,   // 0x0760 (1888)
+0x0F, 0x88, 0x00, 0x0F, 0x58, 0x00, 0x2C, 0x2D, 0x00, 0x69, 0x08, 0xA8, 0xD2, 0x00, 0x24, 0x10,   // 0x0770 (1904)
+0x08, 0xF0, 0xA7, 0xF0, 0x10, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,   // 0x0780 (1920)
+0x00, 0x40, 0x19, 0xBC, 0x91, 0x14, 0x00, 0x87, 0x00, 0x00, 0x88, 0x00, 0x00, 0xB4, 0x00, 0x09,   // 0x0790 (1936)
+0x80, 0x00, 0x99, 0x00, 0x09, 0x90, 0x00, 0x7E, 0x88, 0x88, 0x24, 0x44, 0x44, 0x3A, 0xCC, 0xB1,   // 0x07A0 (1952)
+0x12, 0x00, 0x88, 0x00, 0x00, 0x87, 0x02, 0x89, 0xA1, 0x01, 0x45, 0xC6, 0x00, 0x00, 0x4B, 0x00,   // 0x07B0 (1968)
+0x00, 0x5A, 0x8A, 0x88, 0xC3, 0x02, 0x44, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x1C, 0xB0, 0x00,   // 0x07C0 (1984)
+0x00, 0xA4, 0xB0, 0x00, 0x06, 0x80, 0xB0, 0x00, 0x2B, 0x10, 0xB0, 0x00, 0xAA, 0x88, 0xD8, 0x20,   // 0x07D0 (2000)
+0x34, 0x44, 0xC4, 0x10, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0B, 0xBB, 0xB3, 0x0D,   // 0x07E0 (2016)
+0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xBB, 0x80, 0x01, 0x01, 0x98, 0x00, 0x00, 0x2B, 0x00, 0x00,   // 0x07F0 (2032)
+0x5A, 0x4A, 0x88, 0xC3, 0x02, 0x44, 0x00, 0x01, 0x8C, 0xB3, 0x09, 0x70, 0x00, 0x1D, 0x00, 0x00,   // 0x0800 (2048)
+0x4A, 0x8B, 0x91, 0x4D, 0x40, 0x6A, 0x49, 0x00, 0x0F, 0x1D, 0x00, 0x2C, 0x06, 0xB8, 0xC5, 0x00,   // 0x0810 (2064)
+0x24, 0x10, 0x6B, 0xBB, 0xCE, 0x00, 0x00, 0x69, 0x00, 0x00, 0xD2, 0x00, 0x05, 0xA0, 0x00, 0x0B,   // 0x0820 (2080)
+0x40, 0x00, 0x3D, 0x00, 0x00, 0x96, 0x00, 0x02, 0xE0, 0x00, 0x01, 0x30, 0x00, 0x07, 0xCB, 0xB2,   // 0x0830 (2096)
+0x2D, 0x00, 0x69, 0x1D, 0x10, 0x78, 0x06, 0xC9, 0x91, 0x09, 0x87, 0xD3, 0x69, 0x00, 0x3C, 0x68,   // 0x0840 (2112)
+0x00, 0x1D, 0x1C, 0x98, 0xC6, 0x00, 0x34, 0x10, 0x06, 0xCC, 0x80, 0x3B, 0x00, 0x78, 0x88, 0x00,   // 0x0850 (2128)
+0x1B, 0x5B, 0x00, 0x6F, 0x08, 0xCB, 0x8B, 0x00, 0x00, 0x4A, 0x00, 0x00, 0xA5, 0x06, 0x8C, 0x80,   // 0x0860 (2144)
+0x03, 0x41, 0x00, 0x2F, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2F, 0x20, 0x04,   // 0x0870 (2160)
+0x00, 0x3F, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x68, 0x00, 0x72,   // 0x0880 (2176)
+0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0xA5, 0x18, 0xA4, 0x00, 0x5D, 0x60, 0x00, 0x01, 0x7B, 0x81,   // 0x0890 (2192)
+0x00, 0x00, 0x6C, 0x14, 0x44, 0x43, 0x28, 0x88, 0x86, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x54,   // 0x08A0 (2208)
+0x00, 0x00, 0x29, 0xB4, 0x00, 0x00, 0x18, 0xA4, 0x00, 0x02, 0x9B, 0x04, 0xA9, 0x40, 0x79, 0x20,   // 0x08B0 (2224)
+0x00, 0x8B, 0xBC, 0x30, 0x10, 0x05, 0x90, 0x00, 0x05, 0x90, 0x00, 0x3D, 0x20, 0x02, 0xC2, 0x00,   // 0x08C0 (2240)
+0x04, 0x60, 0x00, 0x02, 0x20, 0x00, 0x09, 0xB0, 0x00, 0x02, 0x20, 0x00, 0x00, 0x29, 0xBB, 0xC8,   // 0x08D0 (2256)
+0x10, 0x03, 0xB2, 0x00, 0x06, 0xB0, 0x0B, 0x21, 0x9B, 0x90, 0x85, 0x29, 0x0B, 0x40, 0xB0, 0x48,   // 0x08E0 (2272)
+0x48, 0x0C, 0x00, 0xC0, 0x48, 0x48, 0x0C, 0x01, 0xF0, 0x66, 0x2A, 0x06, 0xCA, 0x6C, 0xA0, 0x0B,   // 0x08F0 (2288)
+0x60, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x88, 0xA3, 0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x00, 0x0E,   // 0x0900 (2304)
+0x40, 0x00, 0x00, 0x6B, 0x90, 0x00, 0x00, 0xB2, 0xC1, 0x00, 0x02, 0xC0, 0x86, 0x00, 0x08, 0x84,   // 0x0910 (2320)
+0x6C, 0x00, 0x0D, 0x88, 0x8C, 0x30, 0x59, 0x00, 0x06, 0x80, 0xA4, 0x00, 0x01, 0xE0, 0x40, 0x00,   // 0x0920 (2336)
+0x00, 0x31, 0xBB, 0xBC, 0xA1, 0xB0, 0x00, 0x88, 0xB0, 0x00, 0x88, 0xB8, 0x88, 0x81, 0xB4, 0x45,   // 0x0930 (2352)
+0xB6, 0xB0, 0x00, 0x4B, 0xB0, 0x00, 0x5B, 0xB8, 0x88, 0xD3, 0x34, 0x44, 0x10, 0x00, 0x8C, 0xBD,   // 0x0940 (2368)
+0x80, 0x08, 0x90, 0x00, 0x10, 0x1E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00,   // 0x0950 (2384)
+0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x01, 0xCA, 0x88, 0x60, 0x00, 0x03, 0x44,   // 0x0960 (2400)
+0x00, 0xBB, 0xBD, 0xA3, 0x00, 0xB0, 0x00, 0x4D, 0x20, 0xB0, 0x00, 0x08, 0x80, 0xB0, 0x00, 0x04,   // 0x0970 (2416)
+0xB0, 0xB0, 0x00, 0x04, 0xB0, 0xB0, 0x00, 0x07, 0x90, 0xB0, 0x00, 0x2D, 0x30, 0xB8, 0x89, 0xC5,   // 0x0980 (2432)
+0x00, 0x34, 0x43, 0x00, 0x00, 0xBB, 0xBB, 0x80, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB8, 0x88,   // 0x0990 (2448)
+0x40, 0xB4, 0x44, 0x20, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB8, 0x88, 0x60, 0x34, 0x44, 0x30,   // 0x09A0 (2464)
+0xBB, 0xBB, 0x80, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB4, 0x44, 0x20, 0xB8, 0x88, 0x40, 0xB0,   // 0x09B0 (2480)
+0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6B, 0xBB, 0xC2, 0x08,   // 0x09C0 (2496)
+0x91, 0x00, 0x10, 0x1E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x3B, 0xD8, 0x3D,   // 0x09D0 (2512)
+0x00, 0x00, 0x88, 0x0B, 0x60, 0x00, 0x88, 0x01, 0xBA, 0x88, 0xD7, 0x00, 0x02, 0x44, 0x10, 0xB0,   // 0x09E0 (2528)
+0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB8, 0x88, 0x8B, 0x80, 0xB4,   // 0x09F0 (2544)
+0x44, 0x49, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0x30,   // 0x0A00 (2560)
+0x00, 0x02, 0x20, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0x30, 0x00, 0xF0, 0x00, 0xF0,   // 0x0A10 (2576)
+0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x47, 0xB0,   // 0x0A20 (2592)
+0x87, 0x10, 0xF0, 0x00, 0x96, 0xF0, 0x09, 0x80, 0xF0, 0x89, 0x00, 0xF6, 0xC0, 0x00, 0xF9, 0xC4,   // 0x0A30 (2608)
+0x00, 0xF0, 0x3E, 0x10, 0xF0, 0x07, 0xB0, 0xF0, 0x00, 0xA7, 0x40, 0x00, 0x14, 0xB0, 0x00, 0x00,   // 0x0A40 (2624)
+0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0,   // 0x0A50 (2640)
+0x00, 0x00, 0xB8, 0x88, 0x60, 0x34, 0x44, 0x30, 0xBC, 0x00, 0x00, 0x4F, 0x40, 0xBC, 0x20, 0x00,   // 0x0A60 (2656)
+0x9B, 0x40, 0xB6, 0x80, 0x01, 0xD8, 0x40, 0xB1, 0xE0, 0x07, 0x78, 0x40, 0xB0, 0x96, 0x0D, 0x18,   // 0x0A70 (2672)
+0x40, 0xB0, 0x4A, 0x39, 0x08, 0x40, 0xB0, 0x0D, 0xB5, 0x08, 0x40, 0xB0, 0x07, 0xD0, 0x08, 0x40,   // 0x0A80 (2688)
+0x30, 0x01, 0x30, 0x02, 0x10, 0xB8, 0x00, 0x04, 0x80, 0xBD, 0x30, 0x04, 0x80, 0xB4, 0xC0, 0x04,   // 0x0A90 (2704)
+0x80, 0xB0, 0x88, 0x04, 0x80, 0xB0, 0x1D, 0x34, 0x80, 0xB0, 0x04, 0xC4, 0x80, 0xB0, 0x00, 0xAB,   // 0x0AA0 (2720)
+0x80, 0xB0, 0x00, 0x1E, 0x80, 0x30, 0x00, 0x02, 0x20, 0x00, 0x8C, 0xBC, 0x80, 0x00, 0x08, 0x90,   // 0x0AB0 (2736)
+0x00, 0x98, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x10, 0x4B, 0x00, 0x00, 0x0B, 0x40, 0x4B, 0x00, 0x00,   // 0x0AC0 (2752)
+0x0B, 0x40, 0x2D, 0x00, 0x00, 0x0D, 0x20, 0x0B, 0x60, 0x00, 0x6B, 0x00, 0x01, 0xB9, 0x89, 0xB1,   // 0x0AD0 (2768)
+0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0xBB, 0xBC, 0x80, 0xB0, 0x01, 0xD3, 0xB0, 0x00, 0x87, 0xB0,   // 0x0AE0 (2784)
+0x01, 0xD2, 0xBB, 0xBB, 0x50, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x30, 0x00,   // 0x0AF0 (2800)
+0x00, 0x00, 0x8C, 0xBC, 0x80, 0x00, 0x08, 0x90, 0x00, 0x98, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x10,   // 0x0B00 (2816)
+0x4B, 0x00, 0x00, 0x0B, 0x40, 0x4B, 0x00, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x0D, 0x20, 0x0B,   // 0x0B10 (2832)
+0x60, 0x00, 0x6B, 0x00, 0x01, 0xB9, 0x89, 0xB1, 0x00, 0x00, 0x03, 0x4C, 0x60, 0x00, 0x00, 0x00,   // 0x0B20 (2848)
+0x03, 0xE6, 0x00, 0xFB, 0xBC, 0x60, 0xF0, 0x01, 0xD2, 0xF0, 0x00, 0xB4, 0xF0, 0x04, 0xD0, 0xFB,   // 0x0B30 (2864)
+0xCD, 0x10, 0xF0, 0x0D, 0x40, 0xF0, 0x04, 0xB0, 0xF0, 0x00, 0xB6, 0x40, 0x00, 0x23, 0x08, 0xCB,   // 0x0B40 (2880)
+0xC5, 0x3C, 0x00, 0x01, 0x4C, 0x00, 0x00, 0x0B, 0xB5, 0x00, 0x00, 0x5A, 0xD3, 0x00, 0x00, 0x79,   // 0x0B50 (2896)
+0x00, 0x00, 0x59, 0x7A, 0x88, 0xC3, 0x03, 0x44, 0x00, 0xBB, 0xCD, 0xBB, 0x30, 0x00, 0x48, 0x00,   // 0x0B60 (2912)
+0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00,   // 0x0B70 (2928)
+0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0xF0, 0x00, 0x0B,   // 0x0B80 (2944)
+0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B,   // 0x0B90 (2960)
+0x40, 0xF0, 0x00, 0x0B, 0x40, 0xB4, 0x00, 0x1D, 0x00, 0x3C, 0x88, 0xC6, 0x00, 0x00, 0x44, 0x10,   // 0x0BA0 (2976)
+0x00, 0xC3, 0x00, 0x07, 0x80, 0x78, 0x00, 0x0C, 0x30, 0x2D, 0x00, 0x2D, 0x00, 0x0C, 0x30, 0x78,   // 0x0BB0 (2992)
+0x00, 0x06, 0x80, 0xD2, 0x00, 0x01, 0xD3, 0xC0, 0x00, 0x00, 0xAA, 0x70, 0x00, 0x00, 0x6F, 0x20,   // 0x0BC0 (3008)
+0x00, 0x00, 0x14, 0x00, 0x00, 0xA5, 0x00, 0x5F, 0x00, 0x08, 0x70, 0x78, 0x00, 0x9D, 0x50, 0x0C,   // 0x0BD0 (3024)
+0x30, 0x3C, 0x00, 0xE5, 0x90, 0x1E, 0x00, 0x0E, 0x13, 0xA1, 0xE0, 0x59, 0x00, 0x09, 0x58, 0x70,   // 0x0BE0 (3040)
+0xA3, 0x86, 0x00, 0x06, 0x8C, 0x20, 0x68, 0xC2, 0x00, 0x02, 0xBC, 0x00, 0x2B, 0xD0, 0x00, 0x00,   // 0x0BF0 (3056)
+0xD8, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x31, 0x00, 0x02, 0x20, 0x00, 0x79, 0x00, 0x0C, 0x30, 0x0B,   // 0x0C00 (3072)
+0x40, 0x88, 0x00, 0x02, 0xD4, 0xC0, 0x00, 0x00, 0x8E, 0x30, 0x00, 0x00, 0x8E, 0x50, 0x00, 0x03,   // 0x0C10 (3088)
+0xC2, 0xC1, 0x00, 0x0C, 0x30, 0x88, 0x00, 0x88, 0x00, 0x0D, 0x40, 0x41, 0x00, 0x02, 0x30, 0xB5,   // 0x0C20 (3104)
+0x00, 0x0C, 0x40, 0x3D, 0x00, 0x6A, 0x00, 0x09, 0x60, 0xD2, 0x00, 0x02, 0xD6, 0x90, 0x00, 0x00,   // 0x0C30 (3120)
+0x8E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00,   // 0x0C40 (3136)
+0x13, 0x00, 0x00, 0x6B, 0xBB, 0xCE, 0x00, 0x00, 0xB7, 0x00, 0x05, 0xC0, 0x00, 0x1E, 0x30, 0x00,   // 0x0C50 (3152)
+0xA8, 0x00, 0x04, 0xD1, 0x00, 0x1D, 0x40, 0x00, 0x7D, 0x88, 0x88, 0x24, 0x44, 0x44, 0xEB, 0x60,   // 0x0C60 (3168)
+0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00,   // 0x0C70 (3184)
+0xEB, 0x60, 0xA4, 0x00, 0x59, 0x00, 0x0D, 0x10, 0x08, 0x60, 0x03, 0xB0, 0x00, 0xC2, 0x00, 0x78,   // 0x0C80 (3200)
+0x00, 0x1D, 0x00, 0x03, 0x8B, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0,   // 0x0C90 (3216)
+0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x8B, 0xB0, 0x00, 0x88, 0x00, 0x01, 0xBA, 0x10, 0x07, 0x64,   // 0x0CA0 (3232)
+0x80, 0x0B, 0x00, 0xB2, 0x68, 0x00, 0x49, 0x31, 0x00, 0x04, 0x3B, 0xBB, 0xBB, 0x54, 0x00, 0x1B,   // 0x0CB0 (3248)
+0x10, 0x01, 0x20, 0x07, 0xCB, 0xB2, 0x01, 0x00, 0x88, 0x01, 0x68, 0x98, 0x2D, 0x74, 0x98, 0x88,   // 0x0CC0 (3264)
+0x00, 0x88, 0x3D, 0x89, 0x98, 0x01, 0x42, 0x12, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,   // 0x0CD0 (3280)
+0x00, 0xE8, 0xBC, 0x60, 0xF4, 0x01, 0xD2, 0xF0, 0x00, 0xA4, 0xF0, 0x00, 0x94, 0xF2, 0x00, 0xD3,   // 0x0CE0 (3296)
+0xCA, 0x8A, 0x90, 0x30, 0x43, 0x00, 0x05, 0xCB, 0xC0, 0x1D, 0x10, 0x00, 0x4A, 0x00, 0x00, 0x49,   // 0x0CF0 (3312)
+0x00, 0x00, 0x2D, 0x00, 0x00, 0x08, 0xB8, 0x90, 0x00, 0x24, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00,   // 0x0D00 (3328)
+0x0F, 0x00, 0x00, 0x0F, 0x06, 0xDB, 0x8E, 0x2E, 0x10, 0x4F, 0x4A, 0x00, 0x0F, 0x49, 0x00, 0x0F,   // 0x0D10 (3344)
+0x3C, 0x00, 0x2F, 0x09, 0xA8, 0xAC, 0x00, 0x34, 0x03, 0x05, 0xCB, 0xB1, 0x1C, 0x10, 0x6A, 0x4D,   // 0x0D20 (3360)
+0x88, 0x8E, 0x4B, 0x44, 0x44, 0x2D, 0x10, 0x00, 0x06, 0xC8, 0x89, 0x00, 0x24, 0x30, 0x00, 0x68,   // 0x0D30 (3376)
+0x20, 0x07, 0x94, 0x20, 0x0B, 0x40, 0x00, 0x7E, 0xC8, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0x40, 0x00,   // 0x0D40 (3392)
+0x0B, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x10, 0x00, 0x08, 0xCC, 0xFA, 0x4B,   // 0x0D50 (3408)
+0x00, 0xC3, 0x4B, 0x00, 0xC3, 0x09, 0xCB, 0x80, 0x0B, 0x10, 0x00, 0x0C, 0xBB, 0xA3, 0x87, 0x00,   // 0x0D60 (3424)
+0x3D, 0xB4, 0x00, 0x3C, 0x3C, 0xBB, 0xA3, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,   // 0x0D70 (3440)
+0xE8, 0xBC, 0x60, 0xF4, 0x01, 0xF0, 0xF0, 0x00, 0xB0, 0xF0, 0x00, 0xB0, 0xF0, 0x00, 0xB0, 0xF0,   // 0x0D80 (3456)
+0x00, 0xB0, 0x40, 0x00, 0x30, 0x20, 0xD0, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x00,   // 0x0D90 (3472)
+0x20, 0x03, 0xA0, 0x00, 0x00, 0x04, 0xB0, 0x04, 0xB0, 0x04, 0xB0, 0x04, 0xB0, 0x04, 0xB0, 0x04,   // 0x0DA0 (3488)
+0xB0, 0x04, 0xB0, 0x04, 0xA0, 0x8C, 0x50, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,   // 0x0DB0 (3504)
+0xF0, 0x1C, 0x40, 0xF1, 0xC6, 0x00, 0xEA, 0x80, 0x00, 0xF8, 0xC1, 0x00, 0xF0, 0x88, 0x00, 0xF0,   // 0x0DC0 (3520)
+0x0C, 0x50, 0x40, 0x01, 0x30, 0x80, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0xC8,   // 0x0DD0 (3536)
+0xBD, 0x68, 0xBC, 0x30, 0xF4, 0x04, 0xF3, 0x05, 0xB0, 0xF0, 0x00, 0xD0, 0x01, 0xB0, 0xF0, 0x00,   // 0x0DE0 (3552)
+0xB0, 0x00, 0xB0, 0xF0, 0x00, 0xB0, 0x00, 0xB0, 0xF0, 0x00, 0xB0, 0x00, 0xB0, 0x40, 0x00, 0x30,   // 0x0DF0 (3568)
+0x00, 0x30, 0xC8, 0xBC, 0x60, 0xF4, 0x01, 0xF0, 0xF0, 0x00, 0xB0, 0xF0, 0x00, 0xB0, 0xF0, 0x00,   // 0x0E00 (3584)
+0xB0, 0xF0, 0x00, 0xB0, 0x40, 0x00, 0x30, 0x05, 0xCB, 0xC3, 0x00, 0x1D, 0x10, 0x1D, 0x10, 0x4A,   // 0x0E10 (3600)
+0x00, 0x0B, 0x40, 0x4A, 0x00, 0x0A, 0x40, 0x2D, 0x00, 0x0D, 0x20, 0x06, 0xB8, 0xB6, 0x00, 0x00,   // 0x0E20 (3616)
+0x24, 0x20, 0x00, 0xB8, 0xBD, 0x60, 0xF3, 0x01, 0xE2, 0xF0, 0x00, 0xA4, 0xF0, 0x00, 0x94, 0xF2,   // 0x0E30 (3632)
+0x00, 0xD3, 0xDA, 0x8B, 0x90, 0xF0, 0x43, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x06, 0xDB,   // 0x0E40 (3648)
+0x8B, 0x2E, 0x10, 0x4F, 0x4A, 0x00, 0x0F, 0x49, 0x00, 0x0F, 0x3D, 0x00, 0x2F, 0x09, 0xB8, 0xAE,   // 0x0E50 (3664)
+0x00, 0x34, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xB6, 0xA6, 0xE7, 0x00, 0xF0, 0x00, 0xF0,   // 0x0E60 (3680)
+0x00, 0xF0, 0x00, 0xF0, 0x00, 0x40, 0x00, 0x1B, 0xBC, 0x80, 0x78, 0x00, 0x00, 0x2C, 0x82, 0x00,   // 0x0E70 (3696)
+0x00, 0x6C, 0x80, 0x00, 0x00, 0xF0, 0x79, 0x8A, 0x80, 0x03, 0x42, 0x00, 0x05, 0x00, 0x0D, 0x00,   // 0x0E80 (3712)
+0x8F, 0xB8, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0B, 0xA6, 0x00, 0x43, 0xB0, 0x00,   // 0x0E90 (3728)
+0xF0, 0xB0, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0xE0, 0x02, 0xF0, 0xAA, 0x8A, 0xD0,   // 0x0EA0 (3744)
+0x03, 0x40, 0x30, 0xC3, 0x00, 0x78, 0x78, 0x00, 0xC3, 0x1D, 0x02, 0xC0, 0x0A, 0x48, 0x70, 0x05,   // 0x0EB0 (3760)
+0x9D, 0x10, 0x00, 0xCA, 0x00, 0x00, 0x32, 0x00, 0xB4, 0x02, 0xF3, 0x04, 0xB0, 0x78, 0x07, 0xB7,   // 0x0EC0 (3776)
+0x08, 0x70, 0x3B, 0x0C, 0x4C, 0x0B, 0x30, 0x0E, 0x2C, 0x0C, 0x2E, 0x00, 0x09, 0x97, 0x08, 0x99,   // 0x0ED0 (3792)
+0x00, 0x06, 0xE2, 0x03, 0xF6, 0x00, 0x01, 0x40, 0x00, 0x41, 0x00, 0x5B, 0x00, 0xB5, 0x09, 0x77,   // 0x0EE0 (3808)
+0x90, 0x01, 0xCC, 0x10, 0x00, 0xCC, 0x00, 0x08, 0x88, 0x80, 0x4B, 0x00, 0xC4, 0x31, 0x00, 0x13,   // 0x0EF0 (3824)
+0xC3, 0x00, 0x78, 0x68, 0x00, 0xC3, 0x1D, 0x02, 0xC0, 0x09, 0x57, 0x70, 0x03, 0xAC, 0x10, 0x00,   // 0x0F00 (3840)
+0xBA, 0x00, 0x00, 0x96, 0x00, 0x01, 0xD0, 0x00, 0xBD, 0x40, 0x00, 0x3B, 0xBC, 0xE0, 0x00, 0x09,   // 0x0F10 (3856)
+0x70, 0x00, 0x5A, 0x00, 0x01, 0xD1, 0x00, 0x0B, 0x40, 0x00, 0x6D, 0x88, 0x80, 0x24, 0x44, 0x40,   // 0x0F20 (3872)
+0x00, 0x99, 0x04, 0xC0, 0x04, 0xB0, 0x04, 0x90, 0x6B, 0x50, 0x6B, 0x50, 0x04, 0x90, 0x04, 0xB0,   // 0x0F30 (3888)
+0x04, 0xB0, 0x00, 0x99, 0x24, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,   // 0x0F40 (3904)
+0x6B, 0x20, 0x08, 0x80, 0x04, 0x80, 0x04, 0x80, 0x02, 0xC8, 0x02, 0xC8, 0x04, 0x80, 0x04, 0x80,   // 0x0F50 (3920)
+0x07, 0x80, 0x6B, 0x20, 0x17, 0x71, 0x03, 0x76, 0x6C, 0xBB, 0x00, 0x8C, 0xBD, 0x80, 0x08, 0x90,   // 0x0F60 (3936)
+0x00, 0x10, 0x1E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x3D, 0x00,   // 0x0F70 (3952)
+0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x01, 0xCA, 0x88, 0x60, 0x00, 0x04, 0xA4, 0x00, 0x00, 0x02,   // 0x0F80 (3968)
+0xA3, 0x00, 0x00, 0x06, 0xB2, 0x00, 0x00, 0x0D, 0x0B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0F90 (3984)
+0x00, 0x8C, 0xBC, 0x80, 0x00, 0x08, 0x90, 0x00, 0x98, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x10, 0x4B,   // 0x0FA0 (4000)
+0x00, 0x00, 0x0B, 0x40, 0x4B, 0x00, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x0D, 0x20, 0x0B, 0x60,   // 0x0FB0 (4016)
+0x00, 0x6B, 0x00, 0x01, 0xB9, 0x89, 0xB1, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x06, 0x84, 0x90,   // 0x0FC0 (4032)
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B,   // 0x0FD0 (4048)
+0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x0B, 0x40, 0xB4, 0x00, 0x1D,   // 0x0FE0 (4064)
+0x00, 0x3C, 0x88, 0xC6, 0x00, 0x00, 0x44, 0x10, 0x00, 0x05, 0xCB, 0xC0, 0x1D, 0x10, 0x00, 0x4A,   // 0x0FF0 (4080)
+0x00, 0x00, 0x49, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x08, 0xB8, 0x90, 0x00, 0x68, 0x20, 0x00, 0x4B,   // 0x1000 (4096)
+0x00, 0x00, 0x8A, 0x00, 0x00, 0xD0, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCB, 0xC3, 0x00,   // 0x1010 (4112)
+0x1D, 0x10, 0x1D, 0x10, 0x4A, 0x00, 0x0B, 0x40, 0x4A, 0x00, 0x0A, 0x40, 0x2D, 0x00, 0x0D, 0x20,   // 0x1020 (4128)
+0x06, 0xB8, 0xB6, 0x00, 0x00, 0x24, 0x20, 0x00, 0x0D, 0x0B, 0x20, 0x00, 0x00, 0x00, 0xB0, 0x00,   // 0x1030 (4144)
+0xF0, 0xB0, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0xE0, 0x02, 0xF0, 0xAA, 0x8A, 0xD0,   // 0x1040 (4160)
+0x03, 0x40, 0x30, 0x00, 0x02, 0x00, 0x20, 0x00, 0x08, 0x8A, 0x50, 0x00, 0x00, 0x43, 0x00, 0x00,   // 0x1050 (4176)
+0x6B, 0xBB, 0xC2, 0x08, 0x91, 0x00, 0x10, 0x1E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B,   // 0x1060 (4192)
+0x00, 0x3B, 0xD8, 0x3D, 0x00, 0x00, 0x88, 0x0B, 0x60, 0x00, 0x88, 0x01, 0xBA, 0x88, 0xD7, 0x00,   // 0x1070 (4208)
+0x02, 0x44, 0x10, 0x02, 0x00, 0x20, 0x06, 0x88, 0x80, 0x00, 0x34, 0x00, 0x08, 0xCC, 0xFA, 0x4B,   // 0x1080 (4224)
+0x00, 0xC3, 0x4B, 0x00, 0xC3, 0x09, 0xCB, 0x80, 0x0B, 0x10, 0x00, 0x0C, 0xBB, 0xA3, 0x87, 0x00,   // 0x1090 (4240)
+0x3D, 0xB4, 0x00, 0x3C, 0x3C, 0xBB, 0xA3, 0x20, 0xA3, 0x00, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,   // 0x10A0 (4256)
+0xB0, 0xB0, 0x30, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x08, 0xCB, 0xC5, 0x3C, 0x00, 0x01,   // 0x10B0 (4272)
+0x4C, 0x00, 0x00, 0x0B, 0xB5, 0x00, 0x00, 0x5A, 0xD3, 0x00, 0x00, 0x79, 0x00, 0x00, 0x59, 0x7A,   // 0x10C0 (4288)
+0x88, 0xC3, 0x03, 0x88, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x8A, 0x00, 0x1B, 0xBC, 0x80, 0x78, 0x00,   // 0x10D0 (4304)
+0x00, 0x2C, 0x82, 0x00, 0x00, 0x6C, 0x80, 0x00, 0x00, 0xF0, 0x79, 0x8A, 0x80, 0x03, 0xB2, 0x00,   // 0x10E0 (4320)
+0x00, 0x96, 0x00, 0x04, 0xA5, 0x00, 0x0D, 0x0B, 0x20, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x80, 0xB0,   // 0x10F0 (4336)
+0x00, 0x00, 0xB0, 0x00, 0x00, 0xB8, 0x88, 0x40, 0xB4, 0x44, 0x20, 0xB0, 0x00, 0x00, 0xB0, 0x00,   // 0x1100 (4352)
+0x00, 0xB8, 0x88, 0x60, 0x34, 0x44, 0x30, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x6B, 0x90, 0x00, 0x00,   // 0x1110 (4368)
+0xB2, 0xC1, 0x00, 0x02, 0xC0, 0x86, 0x00, 0x08, 0x84, 0x6C, 0x00, 0x0D, 0x88, 0x8C, 0x30, 0x59,   // 0x1120 (4384)
+0x00, 0x06, 0x80, 0xA4, 0x00, 0x01, 0xE0, 0x40, 0x00, 0x00, 0x31, 0xFB, 0xBB, 0xB0, 0xF0, 0x00,   // 0x1130 (4400)
+0x00, 0xF0, 0x00, 0x00, 0xF8, 0x87, 0x10, 0xF4, 0x47, 0xD2, 0xF0, 0x00, 0x97, 0xF0, 0x00, 0xA5,   // 0x1140 (4416)
+0xF8, 0x89, 0xB0, 0x44, 0x43, 0x00, 0xBB, 0xBC, 0xA1, 0xB0, 0x00, 0x88, 0xB0, 0x00, 0x88, 0xB8,   // 0x1150 (4432)
+0x88, 0x81, 0xB4, 0x45, 0xB6, 0xB0, 0x00, 0x4B, 0xB0, 0x00, 0x5B, 0xB8, 0x88, 0xD3, 0x34, 0x44,   // 0x1160 (4448)
+0x10, 0xBB, 0xBB, 0x80, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00,   // 0x1170 (4464)
+0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x4E, 0xBD, 0x80,   // 0x1180 (4480)
+0x00, 0x49, 0x08, 0x80, 0x00, 0x87, 0x08, 0x80, 0x00, 0xB3, 0x08, 0x80, 0x01, 0xE0, 0x08, 0x80,   // 0x1190 (4496)
+0x06, 0x90, 0x08, 0x80, 0x0B, 0x30, 0x08, 0x80, 0x8E, 0x88, 0x8B, 0xB4, 0xF4, 0x44, 0x44, 0x98,   // 0x11A0 (4512)
+0xF0, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x44, 0xBB, 0xBB, 0x80, 0xB0, 0x00, 0x00, 0xB0, 0x00,   // 0x11B0 (4528)
+0x00, 0xB8, 0x88, 0x40, 0xB4, 0x44, 0x20, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB8, 0x88, 0x60,   // 0x11C0 (4544)
+0x34, 0x44, 0x30, 0x79, 0x00, 0x84, 0x01, 0xC3, 0x09, 0x60, 0x84, 0x09, 0x60, 0x01, 0xC3, 0x84,   // 0x11D0 (4560)
+0x79, 0x00, 0x00, 0x2D, 0x88, 0xC0, 0x00, 0x00, 0x1D, 0xA9, 0xB0, 0x00, 0x00, 0xC5, 0x84, 0x88,   // 0x11E0 (4576)
+0x00, 0x09, 0x80, 0x84, 0x0B, 0x60, 0x6B, 0x00, 0x84, 0x01, 0xD3, 0x41, 0x00, 0x21, 0x00, 0x23,   // 0x11F0 (4592)
+0x3A, 0xCB, 0xC3, 0x12, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x06, 0x88, 0xA3, 0x03, 0x45, 0xA8, 0x00,   // 0x1200 (4608)
+0x00, 0x0F, 0x00, 0x00, 0x1E, 0x7A, 0x88, 0xC6, 0x03, 0x44, 0x00, 0xB0, 0x00, 0x0B, 0xB0, 0xB0,   // 0x1210 (4624)
+0x00, 0x7D, 0xB0, 0xB0, 0x02, 0xD5, 0xB0, 0xB0, 0x0B, 0x54, 0xB0, 0xB0, 0x7A, 0x04, 0xB0, 0xB2,   // 0x1220 (4640)
+0xD1, 0x04, 0xB0, 0xBB, 0x50, 0x04, 0xB0, 0xBA, 0x00, 0x04, 0xB0, 0x31, 0x00, 0x01, 0x30, 0x04,   // 0x1230 (4656)
+0x40, 0x26, 0x00, 0x04, 0xC8, 0xA5, 0x00, 0x00, 0x24, 0x20, 0x00, 0xB0, 0x00, 0x0B, 0xB0, 0xB0,   // 0x1240 (4672)
+0x00, 0x7D, 0xB0, 0xB0, 0x02, 0xD5, 0xB0, 0xB0, 0x0B, 0x54, 0xB0, 0xB0, 0x7A, 0x04, 0xB0, 0xB2,   // 0x1250 (4688)
+0xD1, 0x04, 0xB0, 0xBB, 0x50, 0x04, 0xB0, 0xBA, 0x00, 0x04, 0xB0, 0x31, 0x00, 0x01, 0x30, 0xF0,   // 0x1260 (4704)
+0x00, 0x96, 0xF0, 0x09, 0x80, 0xF0, 0x99, 0x00, 0xF7, 0x90, 0x00, 0xF9, 0x90, 0x00, 0xF0, 0x99,   // 0x1270 (4720)
+0x00, 0xF0, 0x0A, 0x60, 0xF0, 0x01, 0xC6, 0x40, 0x00, 0x14, 0x00, 0x8C, 0xBB, 0xF0, 0x00, 0xB4,   // 0x1280 (4736)
+0x00, 0xF0, 0x00, 0xB1, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x02, 0xB0, 0x00, 0xF0, 0x04, 0x90,   // 0x1290 (4752)
+0x00, 0xF0, 0x08, 0x70, 0x00, 0xF0, 0x8D, 0x10, 0x00, 0xF0, 0x42, 0x00, 0x00, 0x40, 0xBC, 0x00,   // 0x12A0 (4768)
+0x00, 0x4F, 0x40, 0xBC, 0x20, 0x00, 0x9B, 0x40, 0xB6, 0x80, 0x01, 0xD8, 0x40, 0xB1, 0xE0, 0x07,   // 0x12B0 (4784)
+0x78, 0x40, 0xB0, 0x96, 0x0D, 0x18, 0x40, 0xB0, 0x4A, 0x39, 0x08, 0x40, 0xB0, 0x0D, 0xB5, 0x08,   // 0x12C0 (4800)
+0x40, 0xB0, 0x07, 0xD0, 0x08, 0x40, 0x30, 0x01, 0x30, 0x02, 0x10, 0xB0, 0x00, 0x08, 0x80, 0xB0,   // 0x12D0 (4816)
+0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB8, 0x88, 0x8B, 0x80, 0xB4, 0x44, 0x49, 0x80, 0xB0,   // 0x12E0 (4832)
+0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0xB0, 0x00, 0x08, 0x80, 0x30, 0x00, 0x02, 0x20, 0x00,   // 0x12F0 (4848)
+0x8C, 0xBC, 0x80, 0x00, 0x08, 0x90, 0x00, 0x98, 0x00, 0x1E, 0x00, 0x00, 0x0E, 0x10, 0x4B, 0x00,   // 0x1300 (4864)
+0x00, 0x0B, 0x40, 0x4B, 0x00, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x00, 0x0D, 0x20, 0x0B, 0x60, 0x00,   // 0x1310 (4880)
+0x6B, 0x00, 0x01, 0xB9, 0x89, 0xB1, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0xBB, 0xBB, 0xBD, 0x40,   // 0x1320 (4896)
+0xB0, 0x00, 0x08, 0x40, 0xB0, 0x00, 0x08, 0x40, 0xB0, 0x00, 0x08, 0x40, 0xB0, 0x00, 0x08, 0x40,   // 0x1330 (4912)
+0xB0, 0x00, 0x08, 0x40, 0xB0, 0x00, 0x08, 0x40, 0xB0, 0x00, 0x08, 0x40, 0x30, 0x00, 0x02, 0x10,   // 0x1340 (4928)
+0xBB, 0xBC, 0x80, 0xB0, 0x01, 0xD3, 0xB0, 0x00, 0x87, 0xB0, 0x01, 0xD2, 0xBB, 0xBB, 0x50, 0xB0,   // 0x1350 (4944)
+0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x8C, 0xBD, 0x80, 0x08,   // 0x1360 (4960)
+0x90, 0x00, 0x10, 0x1E, 0x10, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x3D,   // 0x1370 (4976)
+0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x01, 0xCA, 0x88, 0x60, 0x00, 0x03, 0x44, 0x00, 0xBB,   // 0x1380 (4992)
+0xCD, 0xBB, 0x30, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,   // 0x1390 (5008)
+0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,   // 0x13A0 (5024)
+0x12, 0x00, 0x00, 0x98, 0x00, 0x01, 0xD1, 0x1D, 0x10, 0x07, 0x90, 0x08, 0x80, 0x0D, 0x20, 0x01,   // 0x13B0 (5040)
+0xE2, 0x69, 0x00, 0x00, 0x79, 0xC3, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x58,   // 0x13C0 (5056)
+0xB8, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x03, 0xCB, 0xEB, 0xC6,   // 0x13D0 (5072)
+0x00, 0x1D, 0x30, 0xB0, 0x1C, 0x40, 0x69, 0x00, 0xB0, 0x06, 0x90, 0x6A, 0x00, 0xB0, 0x06, 0x80,   // 0x13E0 (5088)
+0x1D, 0x30, 0xB0, 0x1C, 0x40, 0x03, 0xCB, 0xEB, 0xC5, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,   // 0x13F0 (5104)
+0x00, 0x30, 0x00, 0x00, 0x79, 0x00, 0x0C, 0x30, 0x0B, 0x40, 0x88, 0x00, 0x02, 0xD4, 0xC0, 0x00,   // 0x1400 (5120)
+0x00, 0x8E, 0x30, 0x00, 0x00, 0x8E, 0x50, 0x00, 0x03, 0xC2, 0xC1, 0x00, 0x0C, 0x30, 0x88, 0x00,   // 0x1410 (5136)
+0x88, 0x00, 0x0D, 0x40, 0x41, 0x00, 0x02, 0x30, 0xB0, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0B, 0x40,   // 0x1420 (5152)
+0xB0, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x0B, 0x40,   // 0x1430 (5168)
+0xB0, 0x00, 0x0B, 0x40, 0xB8, 0x88, 0x8D, 0x92, 0x34, 0x44, 0x44, 0xC4, 0x00, 0x00, 0x00, 0xB4,   // 0x1440 (5184)
+0x00, 0x00, 0x00, 0x62, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,   // 0x1450 (5200)
+0x8A, 0x88, 0xBF, 0x03, 0x43, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xF0,   // 0x1460 (5216)
+0x00, 0x84, 0x00, 0x4B, 0xF0, 0x00, 0x84, 0x00, 0x4B, 0xF0, 0x00, 0x84, 0x00, 0x4B, 0xF0, 0x00,   // 0x1470 (5232)
+0x84, 0x00, 0x4B, 0xF0, 0x00, 0x84, 0x00, 0x4B, 0xF0, 0x00, 0x84, 0x00, 0x4B, 0xF0, 0x00, 0x84,   // 0x1480 (5248)
+0x00, 0x4B, 0xF8, 0x88, 0xB9, 0x88, 0x9B, 0x44, 0x44, 0x44, 0x44, 0x43, 0xB0, 0x00, 0x88, 0x00,   // 0x1490 (5264)
+0x4B, 0x00, 0xB0, 0x00, 0x88, 0x00, 0x4B, 0x00, 0xB0, 0x00, 0x88, 0x00, 0x4B, 0x00, 0xB0, 0x00,   // 0x14A0 (5280)
+0x88, 0x00, 0x4B, 0x00, 0xB0, 0x00, 0x88, 0x00, 0x4B, 0x00, 0xB0, 0x00, 0x88, 0x00, 0x4B, 0x00,   // 0x14B0 (5296)
+0xB0, 0x00, 0x88, 0x00, 0x4B, 0x00, 0xB8, 0x88, 0xBB, 0x88, 0x9D, 0x60, 0x34, 0x44, 0x44, 0x44,   // 0x14C0 (5312)
+0x47, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0xBB, 0xF0,   // 0x14D0 (5328)
+0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x86, 0x10, 0x00, 0xF4,   // 0x14E0 (5344)
+0x47, 0xD1, 0x00, 0xF0, 0x00, 0x96, 0x00, 0xF0, 0x00, 0xB5, 0x00, 0xF8, 0x8A, 0xB0, 0x00, 0x44,   // 0x14F0 (5360)
+0x43, 0x00, 0xF0, 0x00, 0x00, 0x4B, 0xF0, 0x00, 0x00, 0x4B, 0xF0, 0x00, 0x00, 0x4B, 0xF8, 0x86,   // 0x1500 (5376)
+0x10, 0x4B, 0xF4, 0x47, 0xD1, 0x4B, 0xF0, 0x00, 0x96, 0x4B, 0xF0, 0x00, 0xB5, 0x4B, 0xF8, 0x8A,   // 0x1510 (5392)
+0xB0, 0x4B, 0x44, 0x43, 0x00, 0x13, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB8,   // 0x1520 (5408)
+0x88, 0x30, 0xB4, 0x45, 0xC7, 0xB0, 0x00, 0x2D, 0xB0, 0x00, 0x4B, 0xB8, 0x88, 0xD3, 0x34, 0x44,   // 0x1530 (5424)
+0x00, 0x6D, 0xBC, 0x91, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x04, 0x88, 0x8B,   // 0x1540 (5440)
+0x80, 0x02, 0x44, 0x49, 0x80, 0x00, 0x00, 0x0A, 0x60, 0x00, 0x00, 0x3E, 0x10, 0x68, 0x89, 0xD3,   // 0x1550 (5456)
+0x00, 0x04, 0x43, 0x00, 0x00, 0xF0, 0x00, 0x6C, 0xBC, 0x80, 0x00, 0xF0, 0x05, 0xC1, 0x00, 0x88,   // 0x1560 (5472)
+0x00, 0xF0, 0x0B, 0x50, 0x00, 0x0E, 0x10, 0xF8, 0x8F, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x4F, 0x00,   // 0x1570 (5488)
+0x00, 0x0B, 0x40, 0xF0, 0x0C, 0x30, 0x00, 0x0D, 0x20, 0xF0, 0x07, 0xA0, 0x00, 0x4B, 0x00, 0xF0,   // 0x1580 (5504)
+0x00, 0x8B, 0x89, 0xC2, 0x00, 0x40, 0x00, 0x02, 0x43, 0x00, 0x00, 0x05, 0xCB, 0xBE, 0x40, 0x0E,   // 0x1590 (5520)
+0x20, 0x0B, 0x40, 0x3D, 0x00, 0x0B, 0x40, 0x0D, 0x70, 0x0B, 0x40, 0x01, 0xBD, 0xBE, 0x40, 0x01,   // 0x15A0 (5536)
+0xD2, 0x0B, 0x40, 0x09, 0x80, 0x0B, 0x40, 0x4D, 0x00, 0x0B, 0x40, 0x32, 0x00, 0x03, 0x10, 0x07,   // 0x15B0 (5552)
+0xCB, 0xB2, 0x01, 0x00, 0x88, 0x01, 0x68, 0x98, 0x2D, 0x74, 0x98, 0x88, 0x00, 0x88, 0x3D, 0x89,   // 0x15C0 (5568)
+0x98, 0x01, 0x42, 0x12, 0x00, 0x00, 0x47, 0x03, 0xBB, 0x86, 0x0B, 0x40, 0x00, 0x2C, 0x28, 0x60,   // 0x15D0 (5584)
+0x4E, 0xA4, 0x9A, 0x49, 0x00, 0x0F, 0x4B, 0x00, 0x0D, 0x1E, 0x10, 0x1E, 0x06, 0xC8, 0xC6, 0x00,   // 0x15E0 (5600)
+0x24, 0x10, 0xFB, 0xBC, 0x70, 0xF0, 0x00, 0xF0, 0xF8, 0x89, 0x70, 0xF4, 0x46, 0xB0, 0xF0, 0x00,   // 0x15F0 (5616)
+0xC2, 0xF8, 0x89, 0xA0, 0x44, 0x43, 0x00, 0xFB, 0xB8, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,   // 0x1600 (5632)
+0x00, 0xF0, 0x00, 0x40, 0x00, 0x00, 0xBC, 0xD8, 0x00, 0x00, 0xB0, 0x88, 0x00, 0x00, 0xD0, 0x88,   // 0x1610 (5648)
+0x00, 0x05, 0x90, 0x88, 0x00, 0x0B, 0x40, 0x88, 0x00, 0x7E, 0x88, 0xBB, 0x20, 0xB7, 0x44, 0x4C,   // 0x1620 (5664)
+0x40, 0xB4, 0x00, 0x0B, 0x40, 0x62, 0x00, 0x06, 0x20, 0x05, 0xCB, 0xB1, 0x1C, 0x10, 0x6A, 0x4D,   // 0x1630 (5680)
+0x88, 0x8E, 0x4B, 0x44, 0x44, 0x2D, 0x10, 0x00, 0x06, 0xC8, 0x89, 0x00, 0x24, 0x30, 0x6A, 0x04,   // 0x1640 (5696)
+0xB0, 0x3C, 0x10, 0x08, 0x84, 0xB2, 0xD1, 0x00, 0x00, 0x99, 0xCB, 0x30, 0x00, 0x00, 0x9A, 0xCC,   // 0x1650 (5712)
+0x30, 0x00, 0x07, 0x94, 0xB3, 0xC1, 0x00, 0x6B, 0x04, 0xB0, 0x4C, 0x10, 0x31, 0x01, 0x30, 0x03,   // 0x1660 (5728)
+0x10, 0x5C, 0xBC, 0x40, 0x00, 0x04, 0xB0, 0x04, 0x8A, 0x40, 0x02, 0x48, 0x90, 0x00, 0x00, 0xF0,   // 0x1670 (5744)
+0x79, 0x8B, 0x80, 0x04, 0x42, 0x00, 0xB0, 0x04, 0xF4, 0xB0, 0x0B, 0x94, 0xB0, 0x78, 0x84, 0xB2,   // 0x1680 (5760)
+0xB0, 0x84, 0xBA, 0x40, 0x84, 0xE9, 0x00, 0x84, 0x41, 0x00, 0x21, 0x44, 0x02, 0x60, 0x4C, 0x8A,   // 0x1690 (5776)
+0x50, 0x02, 0x42, 0x00, 0xB0, 0x04, 0xF4, 0xB0, 0x0B, 0x94, 0xB0, 0x78, 0x84, 0xB2, 0xB0, 0x84,   // 0x16A0 (5792)
+0xBA, 0x40, 0x84, 0xE9, 0x00, 0x84, 0x41, 0x00, 0x21, 0xF0, 0x1B, 0x30, 0xF0, 0xA6, 0x00, 0xF9,   // 0x16B0 (5808)
+0x60, 0x00, 0xF9, 0x60, 0x00, 0xF1, 0xC5, 0x00, 0xF0, 0x1B, 0x30, 0x40, 0x01, 0x30, 0x00, 0xEB,   // 0x16C0 (5824)
+0xD8, 0x04, 0xB0, 0x88, 0x04, 0x80, 0x88, 0x08, 0x70, 0x88, 0x0B, 0x30, 0x88, 0x8B, 0x00, 0x88,   // 0x16D0 (5840)
+0x41, 0x00, 0x22, 0xF6, 0x00, 0x0D, 0x80, 0xCB, 0x00, 0x5C, 0x80, 0xB9, 0x20, 0xA6, 0x80, 0xB4,   // 0x16E0 (5856)
+0x82, 0xB4, 0x80, 0xB0, 0xC8, 0x64, 0x80, 0xB0, 0x7E, 0x04, 0x80, 0x30, 0x13, 0x01, 0x20, 0xF0,   // 0x16F0 (5872)
+0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF8, 0x88, 0xD4, 0xF4, 0x44, 0xC4, 0xF0, 0x00, 0xB4, 0xF0, 0x00,   // 0x1700 (5888)
+0xB4, 0x40, 0x00, 0x31, 0x05, 0xCB, 0xC3, 0x00, 0x1D, 0x10, 0x1D, 0x10, 0x4A, 0x00, 0x0B, 0x40,   // 0x1710 (5904)
+0x4A, 0x00, 0x0A, 0x40, 0x2D, 0x00, 0x0D, 0x20, 0x06, 0xB8, 0xB6, 0x00, 0x00, 0x24, 0x20, 0x00,   // 0x1720 (5920)
+0xFB, 0xBB, 0xE4, 0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF0,   // 0x1730 (5936)
+0x00, 0xB4, 0x40, 0x00, 0x31, 0xB8, 0xBD, 0x60, 0xF3, 0x01, 0xE2, 0xF0, 0x00, 0xA4, 0xF0, 0x00,   // 0x1740 (5952)
+0x94, 0xF2, 0x00, 0xD3, 0xDA, 0x8B, 0x90, 0xF0, 0x43, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,   // 0x1750 (5968)
+0x05, 0xCB, 0xC0, 0x1D, 0x10, 0x00, 0x4A, 0x00, 0x00, 0x49, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x08,   // 0x1760 (5984)
+0xB8, 0x90, 0x00, 0x24, 0x20, 0x8B, 0xEB, 0xB0, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0,   // 0x1770 (6000)
+0x00, 0x00, 0xB0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x30, 0x00, 0xC3, 0x00, 0x78, 0x68, 0x00, 0xC3,   // 0x1780 (6016)
+0x1D, 0x02, 0xC0, 0x09, 0x57, 0x70, 0x03, 0xAC, 0x10, 0x00, 0xBA, 0x00, 0x00, 0x96, 0x00, 0x01,   // 0x1790 (6032)
+0xD0, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0x80,   // 0x17A0 (6048)
+0x00, 0x03, 0xAC, 0xDB, 0x50, 0x1D, 0x34, 0x81, 0xC4, 0x4A, 0x04, 0x80, 0x78, 0x4A, 0x04, 0x80,   // 0x17B0 (6064)
+0x68, 0x2D, 0x14, 0x80, 0xA6, 0x06, 0xC9, 0xBB, 0x80, 0x00, 0x17, 0x92, 0x00, 0x00, 0x04, 0x80,   // 0x17C0 (6080)
+0x00, 0x00, 0x04, 0x80, 0x00, 0x5B, 0x00, 0xB5, 0x09, 0x77, 0x90, 0x01, 0xCC, 0x10, 0x00, 0xCC,   // 0x17D0 (6096)
+0x00, 0x08, 0x88, 0x80, 0x4B, 0x00, 0xC4, 0x31, 0x00, 0x13, 0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4,   // 0x17E0 (6112)
+0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF0, 0x00, 0xB4, 0xF8, 0x88, 0xD9, 0x44, 0x44, 0x4F, 0x00,   // 0x17F0 (6128)
+0x00, 0x0F, 0x00, 0x00, 0x08, 0xB0, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0xD0, 0x02, 0xF0, 0x8C, 0xB9,   // 0x1800 (6144)
+0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x40, 0xF0, 0x04, 0x80, 0x0B, 0x40, 0xF0,   // 0x1810 (6160)
+0x04, 0x80, 0x0B, 0x40, 0xF0, 0x04, 0x80, 0x0B, 0x40, 0xF0, 0x04, 0x80, 0x0B, 0x40, 0xF0, 0x04,   // 0x1820 (6176)
+0x80, 0x0B, 0x40, 0xF8, 0x89, 0xB8, 0x8D, 0x40, 0x44, 0x44, 0x44, 0x44, 0x10, 0xF0, 0x08, 0x80,   // 0x1830 (6192)
+0x0B, 0x40, 0xF0, 0x08, 0x80, 0x0B, 0x40, 0xF0, 0x08, 0x80, 0x0B, 0x40, 0xF0, 0x08, 0x80, 0x0B,   // 0x1840 (6208)
+0x40, 0xF0, 0x08, 0x80, 0x0B, 0x40, 0xF8, 0x8B, 0xB8, 0x8D, 0x90, 0x44, 0x44, 0x44, 0x44, 0xF0,   // 0x1850 (6224)
+0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x8B, 0xE4, 0x00, 0x00, 0x00, 0xB4,   // 0x1860 (6240)
+0x00, 0x00, 0x00, 0xB9, 0x88, 0x30, 0x00, 0xB7, 0x45, 0xD3, 0x00, 0xB4, 0x00, 0x84, 0x00, 0xB9,   // 0x1870 (6256)
+0x88, 0xC1, 0x00, 0x34, 0x44, 0x00, 0xF0, 0x00, 0x04, 0xB0, 0xF0, 0x00, 0x04, 0xB0, 0xF8, 0x87,   // 0x1880 (6272)
+0x14, 0xB0, 0xF4, 0x48, 0xA4, 0xB0, 0xF0, 0x01, 0xB4, 0xB0, 0xF8, 0x8B, 0x74, 0xB0, 0x44, 0x42,   // 0x1890 (6288)
+0x01, 0x30, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x87, 0x20, 0xF4, 0x46, 0xE0, 0xF0, 0x00,   // 0x18A0 (6304)
+0xC0, 0xF8, 0x89, 0xA0, 0x44, 0x43, 0x00, 0x6C, 0xBB, 0x30, 0x00, 0x04, 0xB0, 0x04, 0x44, 0xF0,   // 0x18B0 (6320)
+0x08, 0x88, 0xF0, 0x00, 0x02, 0xD0, 0x88, 0x8D, 0x30, 0x14, 0x40, 0x00, 0xF0, 0x07, 0xCB, 0x91,   // 0x18C0 (6336)
+0xF0, 0x3C, 0x00, 0x78, 0xF8, 0xB8, 0x00, 0x3B, 0xF4, 0x98, 0x00, 0x2B, 0xF0, 0x4A, 0x00, 0x59,   // 0x18D0 (6352)
+0xF0, 0x09, 0x98, 0xC2, 0x40, 0x00, 0x34, 0x00, 0x1B, 0xBB, 0xD8, 0x78, 0x00, 0x88, 0x6A, 0x10,   // 0x18E0 (6368)
+0x88, 0x08, 0xFB, 0xD8, 0x08, 0x80, 0x88, 0x4C, 0x00, 0x88, 0x32, 0x00, 0x22, 0x02, 0xB0, 0xD0,   // 0x18F0 (6384)
+0x00, 0x00, 0x00, 0x05, 0xCB, 0xB1, 0x1C, 0x10, 0x6A, 0x4D, 0x88, 0x8E, 0x4B, 0x44, 0x44, 0x2D,   // 0x1900 (6400)
+0x10, 0x00, 0x06, 0xC8, 0x89, 0x00, 0x24, 0x30,   // 0x1908 (6408)
+};
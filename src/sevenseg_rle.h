@@ -0,0 +1,71 @@
+// Generated by  : imgconv
+// Generated from: src/DefaultFonts.c:SevenSegNumFont
+// Format        : proportional font, see lcd7735_setFont()
+// Size          : 1009 Bytes
+
+const unsigned char SevenSegRLE[0x3F1] ={
+0x00, 0xC1, 0x32, 0x32, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0A, 0x00, 0x00, 0x00,   // 0x0010 (16)
+0x00, 0x00, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20, 0x65, 0x00, 0x00, 0x06, 0x27, 0x17, 0x05, 0x20,   // 0x0020 (32)
+0x75, 0x00, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20, 0xDC, 0x00, 0x00, 0x19, 0x2E, 0x04, 0x02, 0x20,   // 0x0030 (48)
+0x41, 0x01, 0x00, 0x1B, 0x27, 0x02, 0x05, 0x20, 0x98, 0x01, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20,   // 0x0040 (64)
+0xFE, 0x01, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20, 0x68, 0x02, 0x00, 0x17, 0x2A, 0x06, 0x02, 0x20,   // 0x0050 (80)
+0xBD, 0x02, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20, 0x29, 0x03, 0x00, 0x1B, 0x2E, 0x02, 0x02, 0x20,   // 0x0060 (96)
+0x05, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x08, 0x50, 0xA4, 0x61, 0x9F, 0xFF, 0xDE, 0x78, 0x0F, 0x4B,   // 0x0070 (112)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x0080 (128)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4A, 0x11, 0x46, 0x15, 0x42, 0x18, 0x40,   // 0x0090 (144)
+0x1A, 0x40, 0x19, 0x42, 0x15, 0x46, 0x11, 0x49, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x00A0 (160)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x00B0 (176)
+0x0E, 0x4B, 0x0E, 0xA6, 0xFD, 0xE0, 0x00, 0x0F, 0x18, 0x4E, 0x01, 0x41, 0x06, 0x50, 0x08, 0x52,   // 0x00C0 (192)
+0x08, 0x50, 0x0A, 0x4E, 0x05, 0x8B, 0x31, 0xE0, 0x53, 0x7F, 0xA5, 0x3C, 0x30, 0x40, 0x00, 0x30,   // 0x00D0 (208)
+0x57, 0x7F, 0x8B, 0x78, 0xC0, 0x05, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x08, 0x50, 0x9E, 0x60, 0x1F,   // 0x00E0 (224)
+0xFF, 0xDE, 0x15, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x00F0 (240)
+0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x16, 0x43,   // 0x0100 (256)
+0x04, 0x4F, 0x03, 0x41, 0x03, 0x52, 0x85, 0x10, 0x56, 0x84, 0x20, 0x54, 0x87, 0x1C, 0x50, 0x04,   // 0x0110 (272)
+0x44, 0x15, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14,   // 0x0120 (288)
+0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x15, 0x43, 0x17,   // 0x0130 (304)
+0x41, 0x01, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x08, 0x50, 0x0A, 0x4E, 0x05, 0x03, 0x4E, 0x08, 0x50,   // 0x0140 (320)
+0x06, 0x52, 0x06, 0x50, 0x9C, 0x60, 0x7F, 0xFF, 0x78, 0x13, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12,   // 0x0150 (336)
+0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12,   // 0x0160 (352)
+0x45, 0x12, 0x45, 0x12, 0x45, 0x14, 0x43, 0x02, 0x4F, 0x87, 0x0C, 0x52, 0x02, 0x57, 0x02, 0x54,   // 0x0170 (368)
+0x05, 0x50, 0x02, 0x41, 0x14, 0x43, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45,   // 0x0180 (384)
+0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45,   // 0x0190 (400)
+0x12, 0x45, 0x13, 0x43, 0x04, 0x4E, 0x01, 0x41, 0x04, 0x50, 0x06, 0x52, 0x06, 0x50, 0x08, 0x4E,   // 0x01A0 (416)
+0x05, 0x16, 0x87, 0xC3, 0x11, 0x43, 0x01, 0x43, 0x0F, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x01B0 (432)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x01C0 (448)
+0x0E, 0x4B, 0x0E, 0x4A, 0x11, 0x46, 0x01, 0x4F, 0x03, 0x42, 0x02, 0x52, 0x85, 0x10, 0x56, 0x04,   // 0x01D0 (464)
+0x54, 0x07, 0x50, 0x02, 0x41, 0x16, 0x43, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14,   // 0x01E0 (480)
+0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14,   // 0x01F0 (496)
+0x45, 0x14, 0x45, 0x15, 0x43, 0x17, 0x41, 0x01, 0x05, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x08, 0x50,   // 0x0200 (512)
+0x06, 0x41, 0x01, 0x4E, 0x06, 0x43, 0x15, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x0210 (528)
+0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x0220 (544)
+0x14, 0x44, 0x15, 0x9E, 0xE7, 0xFF, 0xF8, 0x10, 0x52, 0x05, 0x56, 0x04, 0x54, 0x07, 0x50, 0x02,   // 0x0230 (560)
+0x41, 0x16, 0x43, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14,   // 0x0240 (576)
+0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x15,   // 0x0250 (592)
+0x43, 0x06, 0x4E, 0x01, 0x41, 0x06, 0x50, 0x08, 0x52, 0x08, 0x50, 0x0A, 0x4E, 0x05, 0x05, 0x4E,   // 0x0260 (608)
+0x0A, 0x50, 0x08, 0x52, 0x08, 0x50, 0x06, 0x41, 0x01, 0x4E, 0x06, 0x43, 0x15, 0x45, 0x14, 0x45,   // 0x0270 (624)
+0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x0280 (640)
+0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x44, 0x15, 0x9E, 0xE7, 0xFF, 0xF8, 0x10, 0x52, 0x05,   // 0x0290 (656)
+0x56, 0x84, 0x20, 0x54, 0x87, 0x1C, 0x50, 0x02, 0x46, 0x11, 0x49, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x02A0 (672)
+0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x02B0 (688)
+0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0xA6, 0xFD, 0xE0, 0x00, 0x0F, 0x18, 0x4E, 0x01, 0x41, 0x06,   // 0x02C0 (704)
+0x50, 0x08, 0x52, 0x08, 0x50, 0x0A, 0x4E, 0x05, 0x01, 0x4E, 0x06, 0x50, 0x04, 0x52, 0x04, 0x50,   // 0x02D0 (720)
+0x86, 0x60, 0x4E, 0x00, 0x43, 0x11, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10,   // 0x02E0 (736)
+0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10,   // 0x02F0 (752)
+0x45, 0x12, 0x43, 0x14, 0x41, 0x15, 0x40, 0x02, 0x3F, 0x41, 0x12, 0x43, 0x10, 0x45, 0x10, 0x45,   // 0x0300 (768)
+0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45,   // 0x0310 (784)
+0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x10, 0x45, 0x11, 0x43, 0x13, 0x41, 0x01, 0x05, 0x4E, 0x0A,   // 0x0320 (800)
+0x50, 0x08, 0x52, 0x08, 0x50, 0xA4, 0x61, 0x9F, 0xFF, 0xDE, 0x78, 0x0F, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x0330 (816)
+0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x0340 (832)
+0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4A, 0x11, 0x46, 0x01, 0x4F, 0x03, 0x42, 0x02, 0x52, 0x85,   // 0x0350 (848)
+0x10, 0x56, 0x84, 0x20, 0x54, 0x87, 0x1C, 0x50, 0x02, 0x46, 0x11, 0x49, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x0360 (864)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B,   // 0x0370 (880)
+0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0xA6, 0xFD, 0xE0, 0x00, 0x0F, 0x18, 0x4E, 0x01, 0x41,   // 0x0380 (896)
+0x06, 0x50, 0x08, 0x52, 0x08, 0x50, 0x0A, 0x4E, 0x05, 0x05, 0x4E, 0x0A, 0x50, 0x08, 0x52, 0x08,   // 0x0390 (912)
+0x50, 0xA4, 0x61, 0x9F, 0xFF, 0xDE, 0x78, 0x0F, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x03A0 (928)
+0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E, 0x4B, 0x0E,   // 0x03B0 (944)
+0x4B, 0x0E, 0x4A, 0x11, 0x46, 0x01, 0x4F, 0x03, 0x42, 0x02, 0x52, 0x85, 0x10, 0x56, 0x04, 0x54,   // 0x03C0 (960)
+0x07, 0x50, 0x02, 0x41, 0x16, 0x43, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x03D0 (976)
+0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45, 0x14, 0x45,   // 0x03E0 (992)
+0x14, 0x45, 0x15, 0x43, 0x06, 0x4E, 0x01, 0x41, 0x06, 0x50, 0x08, 0x52, 0x08, 0x50, 0x0A, 0x4E,   // 0x03F0 (1008)
+0x05,   // 0x03F1 (1009)
+};
@@ -0,0 +1,126 @@
+// Generated by  : imgconv
+// Generated from: spinner_32_0.png
+// Dimensions    : 32x32 pixels
+// Format        : 8 frames every 100 ms, see ST7735_anim.h
+// Size          : 3776 Bytes
+
+const unsigned short spinner_32[0x760] ={
+0x0020, 0x0020, 0x0008, 0x0064, 0x00EF, 0x8001, 0x0000, 0x0000, 0x8020, 0x0020, 0x804E, 0x0000, 0x8004, 0x3618, 0x801B, 0x0000,   // 0x0010 (16)
+0x8006, 0x3618, 0x8019, 0x0000, 0x8008, 0x3618, 0x8013, 0x0000, 0x8003, 0x2D34, 0x0002, 0x0000, 0x0000, 0x8008, 0x3618, 0x0002,   // 0x0020 (32)
+0x0000, 0x0000, 0x8003, 0x3F1B, 0x800D, 0x0000, 0x8005, 0x2D34, 0x0001, 0x0000, 0x8008, 0x3618, 0x0001, 0x0000, 0x8005, 0x3F1B,   // 0x0030 (48)
+0x800B, 0x0000, 0x8007, 0x2D34, 0x0001, 0x0000, 0x8006, 0x3618, 0x0001, 0x0000, 0x8007, 0x3F1B, 0x800A, 0x0000, 0x8007, 0x2D34,   // 0x0040 (64)
+0x0002, 0x0000, 0x0000, 0x8004, 0x3618, 0x0002, 0x0000, 0x0000, 0x8007, 0x3F1B, 0x800A, 0x0000, 0x8007, 0x2D34, 0x8008, 0x0000,   // 0x0050 (80)
+0x8007, 0x3F1B, 0x800B, 0x0000, 0x8005, 0x2D34, 0x800A, 0x0000, 0x8005, 0x3F1B, 0x800D, 0x0000, 0x8003, 0x2D34, 0x800C, 0x0000,   // 0x0060 (96)
+0x8003, 0x3F1B, 0x802B, 0x0000, 0x8003, 0x2430, 0x8013, 0x0000, 0x8003, 0x47FF, 0x8006, 0x0000, 0x8005, 0x2430, 0x8011, 0x0000,   // 0x0070 (112)
+0x8005, 0x47FF, 0x8004, 0x0000, 0x8007, 0x2430, 0x800F, 0x0000, 0x8007, 0x47FF, 0x8003, 0x0000, 0x8007, 0x2430, 0x800F, 0x0000,   // 0x0080 (128)
+0x8007, 0x47FF, 0x8003, 0x0000, 0x8007, 0x2430, 0x800F, 0x0000, 0x8007, 0x47FF, 0x8004, 0x0000, 0x8005, 0x2430, 0x8011, 0x0000,   // 0x0090 (144)
+0x8005, 0x47FF, 0x8006, 0x0000, 0x8003, 0x2430, 0x8013, 0x0000, 0x8003, 0x47FF, 0x800A, 0x0000, 0x8003, 0x1B4D, 0x800C, 0x0000,   // 0x00A0 (160)
+0x8003, 0x0965, 0x800D, 0x0000, 0x8005, 0x1B4D, 0x800A, 0x0000, 0x8005, 0x0965, 0x800B, 0x0000, 0x8007, 0x1B4D, 0x8008, 0x0000,   // 0x00B0 (176)
+0x8007, 0x0965, 0x800A, 0x0000, 0x8007, 0x1B4D, 0x8008, 0x0000, 0x8007, 0x0965, 0x800A, 0x0000, 0x8007, 0x1B4D, 0x8003, 0x0000,   // 0x00C0 (192)
+0x8003, 0x1269, 0x0002, 0x0000, 0x0000, 0x8007, 0x0965, 0x800B, 0x0000, 0x8005, 0x1B4D, 0x8003, 0x0000, 0x8005, 0x1269, 0x0002,   // 0x00D0 (208)
+0x0000, 0x0000, 0x8005, 0x0965, 0x800D, 0x0000, 0x8003, 0x1B4D, 0x8003, 0x0000, 0x8007, 0x1269, 0x0002, 0x0000, 0x0000, 0x8003,   // 0x00E0 (224)
+0x0965, 0x8014, 0x0000, 0x8007, 0x1269, 0x8019, 0x0000, 0x8007, 0x1269, 0x801A, 0x0000, 0x8005, 0x1269, 0x801C, 0x0000, 0x8003,   // 0x00F0 (240)
+0x1269, 0x802E, 0x0000, 0x00EB, 0x0001, 0x0002, 0x0002, 0x801D, 0x001D, 0x800C, 0x0000, 0x8004, 0x2D34, 0x8018, 0x0000, 0x8006,   // 0x0100 (256)
+0x2D34, 0x8016, 0x0000, 0x8008, 0x2D34, 0x8010, 0x0000, 0x8003, 0x2430, 0x0002, 0x0000, 0x0000, 0x8008, 0x2D34, 0x0002, 0x0000,   // 0x0110 (272)
+0x0000, 0x8003, 0x3618, 0x800A, 0x0000, 0x8005, 0x2430, 0x0001, 0x0000, 0x8008, 0x2D34, 0x0001, 0x0000, 0x8005, 0x3618, 0x8008,   // 0x0120 (288)
+0x0000, 0x8007, 0x2430, 0x0001, 0x0000, 0x8006, 0x2D34, 0x0001, 0x0000, 0x8007, 0x3618, 0x8007, 0x0000, 0x8007, 0x2430, 0x0002,   // 0x0130 (304)
+0x0000, 0x0000, 0x8004, 0x2D34, 0x0002, 0x0000, 0x0000, 0x8007, 0x3618, 0x8007, 0x0000, 0x8007, 0x2430, 0x8008, 0x0000, 0x8007,   // 0x0140 (320)
+0x3618, 0x8008, 0x0000, 0x8005, 0x2430, 0x800A, 0x0000, 0x8005, 0x3618, 0x800A, 0x0000, 0x8003, 0x2430, 0x800C, 0x0000, 0x8003,   // 0x0150 (336)
+0x3618, 0x8025, 0x0000, 0x8003, 0x1B4D, 0x8013, 0x0000, 0x8003, 0x3F1B, 0x8003, 0x0000, 0x8005, 0x1B4D, 0x8011, 0x0000, 0x8005,   // 0x0160 (352)
+0x3F1B, 0x0001, 0x0000, 0x8007, 0x1B4D, 0x800F, 0x0000, 0x8007, 0x3F1B, 0x8007, 0x1B4D, 0x800F, 0x0000, 0x8007, 0x3F1B, 0x8007,   // 0x0170 (368)
+0x1B4D, 0x800F, 0x0000, 0x8007, 0x3F1B, 0x0001, 0x0000, 0x8005, 0x1B4D, 0x8011, 0x0000, 0x8005, 0x3F1B, 0x8003, 0x0000, 0x8003,   // 0x0180 (384)
+0x1B4D, 0x8013, 0x0000, 0x8003, 0x3F1B, 0x8007, 0x0000, 0x8003, 0x1269, 0x800C, 0x0000, 0x8003, 0x47FF, 0x800A, 0x0000, 0x8005,   // 0x0190 (400)
+0x1269, 0x800A, 0x0000, 0x8005, 0x47FF, 0x8008, 0x0000, 0x8007, 0x1269, 0x8008, 0x0000, 0x8007, 0x47FF, 0x8007, 0x0000, 0x8007,   // 0x01A0 (416)
+0x1269, 0x8008, 0x0000, 0x8007, 0x47FF, 0x8007, 0x0000, 0x8007, 0x1269, 0x8003, 0x0000, 0x8003, 0x0965, 0x0002, 0x0000, 0x0000,   // 0x01B0 (432)
+0x8007, 0x47FF, 0x8008, 0x0000, 0x8005, 0x1269, 0x8003, 0x0000, 0x8005, 0x0965, 0x0002, 0x0000, 0x0000, 0x8005, 0x47FF, 0x800A,   // 0x01C0 (448)
+0x0000, 0x8003, 0x1269, 0x8003, 0x0000, 0x8007, 0x0965, 0x0002, 0x0000, 0x0000, 0x8003, 0x47FF, 0x8011, 0x0000, 0x8007, 0x0965,   // 0x01D0 (464)
+0x8016, 0x0000, 0x8007, 0x0965, 0x8017, 0x0000, 0x8005, 0x0965, 0x8019, 0x0000, 0x8003, 0x0965, 0x800D, 0x0000, 0x00EB, 0x0001,   // 0x01E0 (480)
+0x0002, 0x0002, 0x801D, 0x001D, 0x800C, 0x0000, 0x8004, 0x2430, 0x8018, 0x0000, 0x8006, 0x2430, 0x8016, 0x0000, 0x8008, 0x2430,   // 0x01F0 (496)
+0x8010, 0x0000, 0x8003, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8008, 0x2430, 0x0002, 0x0000, 0x0000, 0x8003, 0x2D34, 0x800A, 0x0000,   // 0x0200 (512)
+0x8005, 0x1B4D, 0x0001, 0x0000, 0x8008, 0x2430, 0x0001, 0x0000, 0x8005, 0x2D34, 0x8008, 0x0000, 0x8007, 0x1B4D, 0x0001, 0x0000,   // 0x0210 (528)
+0x8006, 0x2430, 0x0001, 0x0000, 0x8007, 0x2D34, 0x8007, 0x0000, 0x8007, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8004, 0x2430, 0x0002,   // 0x0220 (544)
+0x0000, 0x0000, 0x8007, 0x2D34, 0x8007, 0x0000, 0x8007, 0x1B4D, 0x8008, 0x0000, 0x8007, 0x2D34, 0x8008, 0x0000, 0x8005, 0x1B4D,   // 0x0230 (560)
+0x800A, 0x0000, 0x8005, 0x2D34, 0x800A, 0x0000, 0x8003, 0x1B4D, 0x800C, 0x0000, 0x8003, 0x2D34, 0x8025, 0x0000, 0x8003, 0x1269,   // 0x0240 (576)
+0x8013, 0x0000, 0x8003, 0x3618, 0x8003, 0x0000, 0x8005, 0x1269, 0x8011, 0x0000, 0x8005, 0x3618, 0x0001, 0x0000, 0x8007, 0x1269,   // 0x0250 (592)
+0x800F, 0x0000, 0x8007, 0x3618, 0x8007, 0x1269, 0x800F, 0x0000, 0x8007, 0x3618, 0x8007, 0x1269, 0x800F, 0x0000, 0x8007, 0x3618,   // 0x0260 (608)
+0x0001, 0x0000, 0x8005, 0x1269, 0x8011, 0x0000, 0x8005, 0x3618, 0x8003, 0x0000, 0x8003, 0x1269, 0x8013, 0x0000, 0x8003, 0x3618,   // 0x0270 (624)
+0x8007, 0x0000, 0x8003, 0x0965, 0x800C, 0x0000, 0x8003, 0x3F1B, 0x800A, 0x0000, 0x8005, 0x0965, 0x800A, 0x0000, 0x8005, 0x3F1B,   // 0x0280 (640)
+0x8008, 0x0000, 0x8007, 0x0965, 0x8008, 0x0000, 0x8007, 0x3F1B, 0x8007, 0x0000, 0x8007, 0x0965, 0x8008, 0x0000, 0x8007, 0x3F1B,   // 0x0290 (656)
+0x8007, 0x0000, 0x8007, 0x0965, 0x8003, 0x0000, 0x8003, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8007, 0x3F1B, 0x8008, 0x0000, 0x8005,   // 0x02A0 (672)
+0x0965, 0x8003, 0x0000, 0x8005, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8005, 0x3F1B, 0x800A, 0x0000, 0x8003, 0x0965, 0x8003, 0x0000,   // 0x02B0 (688)
+0x8007, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8003, 0x3F1B, 0x8011, 0x0000, 0x8007, 0x47FF, 0x8016, 0x0000, 0x8007, 0x47FF, 0x8017,   // 0x02C0 (704)
+0x0000, 0x8005, 0x47FF, 0x8019, 0x0000, 0x8003, 0x47FF, 0x800D, 0x0000, 0x00EB, 0x0001, 0x0002, 0x0002, 0x801D, 0x001D, 0x800C,   // 0x02D0 (720)
+0x0000, 0x8004, 0x1B4D, 0x8018, 0x0000, 0x8006, 0x1B4D, 0x8016, 0x0000, 0x8008, 0x1B4D, 0x8010, 0x0000, 0x8003, 0x1269, 0x0002,   // 0x02E0 (736)
+0x0000, 0x0000, 0x8008, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8003, 0x2430, 0x800A, 0x0000, 0x8005, 0x1269, 0x0001, 0x0000, 0x8008,   // 0x02F0 (752)
+0x1B4D, 0x0001, 0x0000, 0x8005, 0x2430, 0x8008, 0x0000, 0x8007, 0x1269, 0x0001, 0x0000, 0x8006, 0x1B4D, 0x0001, 0x0000, 0x8007,   // 0x0300 (768)
+0x2430, 0x8007, 0x0000, 0x8007, 0x1269, 0x0002, 0x0000, 0x0000, 0x8004, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8007, 0x2430, 0x8007,   // 0x0310 (784)
+0x0000, 0x8007, 0x1269, 0x8008, 0x0000, 0x8007, 0x2430, 0x8008, 0x0000, 0x8005, 0x1269, 0x800A, 0x0000, 0x8005, 0x2430, 0x800A,   // 0x0320 (800)
+0x0000, 0x8003, 0x1269, 0x800C, 0x0000, 0x8003, 0x2430, 0x8025, 0x0000, 0x8003, 0x0965, 0x8013, 0x0000, 0x8003, 0x2D34, 0x8003,   // 0x0330 (816)
+0x0000, 0x8005, 0x0965, 0x8011, 0x0000, 0x8005, 0x2D34, 0x0001, 0x0000, 0x8007, 0x0965, 0x800F, 0x0000, 0x8007, 0x2D34, 0x8007,   // 0x0340 (832)
+0x0965, 0x800F, 0x0000, 0x8007, 0x2D34, 0x8007, 0x0965, 0x800F, 0x0000, 0x8007, 0x2D34, 0x0001, 0x0000, 0x8005, 0x0965, 0x8011,   // 0x0350 (848)
+0x0000, 0x8005, 0x2D34, 0x8003, 0x0000, 0x8003, 0x0965, 0x8013, 0x0000, 0x8003, 0x2D34, 0x8007, 0x0000, 0x8003, 0x47FF, 0x800C,   // 0x0360 (864)
+0x0000, 0x8003, 0x3618, 0x800A, 0x0000, 0x8005, 0x47FF, 0x800A, 0x0000, 0x8005, 0x3618, 0x8008, 0x0000, 0x8007, 0x47FF, 0x8008,   // 0x0370 (880)
+0x0000, 0x8007, 0x3618, 0x8007, 0x0000, 0x8007, 0x47FF, 0x8008, 0x0000, 0x8007, 0x3618, 0x8007, 0x0000, 0x8007, 0x47FF, 0x8003,   // 0x0380 (896)
+0x0000, 0x8003, 0x3F1B, 0x0002, 0x0000, 0x0000, 0x8007, 0x3618, 0x8008, 0x0000, 0x8005, 0x47FF, 0x8003, 0x0000, 0x8005, 0x3F1B,   // 0x0390 (912)
+0x0002, 0x0000, 0x0000, 0x8005, 0x3618, 0x800A, 0x0000, 0x8003, 0x47FF, 0x8003, 0x0000, 0x8007, 0x3F1B, 0x0002, 0x0000, 0x0000,   // 0x03A0 (928)
+0x8003, 0x3618, 0x8011, 0x0000, 0x8007, 0x3F1B, 0x8016, 0x0000, 0x8007, 0x3F1B, 0x8017, 0x0000, 0x8005, 0x3F1B, 0x8019, 0x0000,   // 0x03B0 (944)
+0x8003, 0x3F1B, 0x800D, 0x0000, 0x00EB, 0x0001, 0x0002, 0x0002, 0x801D, 0x001D, 0x800C, 0x0000, 0x8004, 0x1269, 0x8018, 0x0000,   // 0x03C0 (960)
+0x8006, 0x1269, 0x8016, 0x0000, 0x8008, 0x1269, 0x8010, 0x0000, 0x8003, 0x0965, 0x0002, 0x0000, 0x0000, 0x8008, 0x1269, 0x0002,   // 0x03D0 (976)
+0x0000, 0x0000, 0x8003, 0x1B4D, 0x800A, 0x0000, 0x8005, 0x0965, 0x0001, 0x0000, 0x8008, 0x1269, 0x0001, 0x0000, 0x8005, 0x1B4D,   // 0x03E0 (992)
+0x8008, 0x0000, 0x8007, 0x0965, 0x0001, 0x0000, 0x8006, 0x1269, 0x0001, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x0000, 0x8007, 0x0965,   // 0x03F0 (1008)
+0x0002, 0x0000, 0x0000, 0x8004, 0x1269, 0x0002, 0x0000, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x0000, 0x8007, 0x0965, 0x8008, 0x0000,   // 0x0400 (1024)
+0x8007, 0x1B4D, 0x8008, 0x0000, 0x8005, 0x0965, 0x800A, 0x0000, 0x8005, 0x1B4D, 0x800A, 0x0000, 0x8003, 0x0965, 0x800C, 0x0000,   // 0x0410 (1040)
+0x8003, 0x1B4D, 0x8025, 0x0000, 0x8003, 0x47FF, 0x8013, 0x0000, 0x8003, 0x2430, 0x8003, 0x0000, 0x8005, 0x47FF, 0x8011, 0x0000,   // 0x0420 (1056)
+0x8005, 0x2430, 0x0001, 0x0000, 0x8007, 0x47FF, 0x800F, 0x0000, 0x8007, 0x2430, 0x8007, 0x47FF, 0x800F, 0x0000, 0x8007, 0x2430,   // 0x0430 (1072)
+0x8007, 0x47FF, 0x800F, 0x0000, 0x8007, 0x2430, 0x0001, 0x0000, 0x8005, 0x47FF, 0x8011, 0x0000, 0x8005, 0x2430, 0x8003, 0x0000,   // 0x0440 (1088)
+0x8003, 0x47FF, 0x8013, 0x0000, 0x8003, 0x2430, 0x8007, 0x0000, 0x8003, 0x3F1B, 0x800C, 0x0000, 0x8003, 0x2D34, 0x800A, 0x0000,   // 0x0450 (1104)
+0x8005, 0x3F1B, 0x800A, 0x0000, 0x8005, 0x2D34, 0x8008, 0x0000, 0x8007, 0x3F1B, 0x8008, 0x0000, 0x8007, 0x2D34, 0x8007, 0x0000,   // 0x0460 (1120)
+0x8007, 0x3F1B, 0x8008, 0x0000, 0x8007, 0x2D34, 0x8007, 0x0000, 0x8007, 0x3F1B, 0x8003, 0x0000, 0x8003, 0x3618, 0x0002, 0x0000,   // 0x0470 (1136)
+0x0000, 0x8007, 0x2D34, 0x8008, 0x0000, 0x8005, 0x3F1B, 0x8003, 0x0000, 0x8005, 0x3618, 0x0002, 0x0000, 0x0000, 0x8005, 0x2D34,   // 0x0480 (1152)
+0x800A, 0x0000, 0x8003, 0x3F1B, 0x8003, 0x0000, 0x8007, 0x3618, 0x0002, 0x0000, 0x0000, 0x8003, 0x2D34, 0x8011, 0x0000, 0x8007,   // 0x0490 (1168)
+0x3618, 0x8016, 0x0000, 0x8007, 0x3618, 0x8017, 0x0000, 0x8005, 0x3618, 0x8019, 0x0000, 0x8003, 0x3618, 0x800D, 0x0000, 0x00EB,   // 0x04A0 (1184)
+0x0001, 0x0002, 0x0002, 0x801D, 0x001D, 0x800C, 0x0000, 0x8004, 0x0965, 0x8018, 0x0000, 0x8006, 0x0965, 0x8016, 0x0000, 0x8008,   // 0x04B0 (1200)
+0x0965, 0x8010, 0x0000, 0x8003, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8008, 0x0965, 0x0002, 0x0000, 0x0000, 0x8003, 0x1269, 0x800A,   // 0x04C0 (1216)
+0x0000, 0x8005, 0x47FF, 0x0001, 0x0000, 0x8008, 0x0965, 0x0001, 0x0000, 0x8005, 0x1269, 0x8008, 0x0000, 0x8007, 0x47FF, 0x0001,   // 0x04D0 (1232)
+0x0000, 0x8006, 0x0965, 0x0001, 0x0000, 0x8007, 0x1269, 0x8007, 0x0000, 0x8007, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8004, 0x0965,   // 0x04E0 (1248)
+0x0002, 0x0000, 0x0000, 0x8007, 0x1269, 0x8007, 0x0000, 0x8007, 0x47FF, 0x8008, 0x0000, 0x8007, 0x1269, 0x8008, 0x0000, 0x8005,   // 0x04F0 (1264)
+0x47FF, 0x800A, 0x0000, 0x8005, 0x1269, 0x800A, 0x0000, 0x8003, 0x47FF, 0x800C, 0x0000, 0x8003, 0x1269, 0x8025, 0x0000, 0x8003,   // 0x0500 (1280)
+0x3F1B, 0x8013, 0x0000, 0x8003, 0x1B4D, 0x8003, 0x0000, 0x8005, 0x3F1B, 0x8011, 0x0000, 0x8005, 0x1B4D, 0x0001, 0x0000, 0x8007,   // 0x0510 (1296)
+0x3F1B, 0x800F, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x3F1B, 0x800F, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x3F1B, 0x800F, 0x0000, 0x8007,   // 0x0520 (1312)
+0x1B4D, 0x0001, 0x0000, 0x8005, 0x3F1B, 0x8011, 0x0000, 0x8005, 0x1B4D, 0x8003, 0x0000, 0x8003, 0x3F1B, 0x8013, 0x0000, 0x8003,   // 0x0530 (1328)
+0x1B4D, 0x8007, 0x0000, 0x8003, 0x3618, 0x800C, 0x0000, 0x8003, 0x2430, 0x800A, 0x0000, 0x8005, 0x3618, 0x800A, 0x0000, 0x8005,   // 0x0540 (1344)
+0x2430, 0x8008, 0x0000, 0x8007, 0x3618, 0x8008, 0x0000, 0x8007, 0x2430, 0x8007, 0x0000, 0x8007, 0x3618, 0x8008, 0x0000, 0x8007,   // 0x0550 (1360)
+0x2430, 0x8007, 0x0000, 0x8007, 0x3618, 0x8003, 0x0000, 0x8003, 0x2D34, 0x0002, 0x0000, 0x0000, 0x8007, 0x2430, 0x8008, 0x0000,   // 0x0560 (1376)
+0x8005, 0x3618, 0x8003, 0x0000, 0x8005, 0x2D34, 0x0002, 0x0000, 0x0000, 0x8005, 0x2430, 0x800A, 0x0000, 0x8003, 0x3618, 0x8003,   // 0x0570 (1392)
+0x0000, 0x8007, 0x2D34, 0x0002, 0x0000, 0x0000, 0x8003, 0x2430, 0x8011, 0x0000, 0x8007, 0x2D34, 0x8016, 0x0000, 0x8007, 0x2D34,   // 0x0580 (1408)
+0x8017, 0x0000, 0x8005, 0x2D34, 0x8019, 0x0000, 0x8003, 0x2D34, 0x800D, 0x0000, 0x00EB, 0x0001, 0x0002, 0x0002, 0x801D, 0x001D,   // 0x0590 (1424)
+0x800C, 0x0000, 0x8004, 0x47FF, 0x8018, 0x0000, 0x8006, 0x47FF, 0x8016, 0x0000, 0x8008, 0x47FF, 0x8010, 0x0000, 0x8003, 0x3F1B,   // 0x05A0 (1440)
+0x0002, 0x0000, 0x0000, 0x8008, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8003, 0x0965, 0x800A, 0x0000, 0x8005, 0x3F1B, 0x0001, 0x0000,   // 0x05B0 (1456)
+0x8008, 0x47FF, 0x0001, 0x0000, 0x8005, 0x0965, 0x8008, 0x0000, 0x8007, 0x3F1B, 0x0001, 0x0000, 0x8006, 0x47FF, 0x0001, 0x0000,   // 0x05C0 (1472)
+0x8007, 0x0965, 0x8007, 0x0000, 0x8007, 0x3F1B, 0x0002, 0x0000, 0x0000, 0x8004, 0x47FF, 0x0002, 0x0000, 0x0000, 0x8007, 0x0965,   // 0x05D0 (1488)
+0x8007, 0x0000, 0x8007, 0x3F1B, 0x8008, 0x0000, 0x8007, 0x0965, 0x8008, 0x0000, 0x8005, 0x3F1B, 0x800A, 0x0000, 0x8005, 0x0965,   // 0x05E0 (1504)
+0x800A, 0x0000, 0x8003, 0x3F1B, 0x800C, 0x0000, 0x8003, 0x0965, 0x8025, 0x0000, 0x8003, 0x3618, 0x8013, 0x0000, 0x8003, 0x1269,   // 0x05F0 (1520)
+0x8003, 0x0000, 0x8005, 0x3618, 0x8011, 0x0000, 0x8005, 0x1269, 0x0001, 0x0000, 0x8007, 0x3618, 0x800F, 0x0000, 0x8007, 0x1269,   // 0x0600 (1536)
+0x8007, 0x3618, 0x800F, 0x0000, 0x8007, 0x1269, 0x8007, 0x3618, 0x800F, 0x0000, 0x8007, 0x1269, 0x0001, 0x0000, 0x8005, 0x3618,   // 0x0610 (1552)
+0x8011, 0x0000, 0x8005, 0x1269, 0x8003, 0x0000, 0x8003, 0x3618, 0x8013, 0x0000, 0x8003, 0x1269, 0x8007, 0x0000, 0x8003, 0x2D34,   // 0x0620 (1568)
+0x800C, 0x0000, 0x8003, 0x1B4D, 0x800A, 0x0000, 0x8005, 0x2D34, 0x800A, 0x0000, 0x8005, 0x1B4D, 0x8008, 0x0000, 0x8007, 0x2D34,   // 0x0630 (1584)
+0x8008, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x0000, 0x8007, 0x2D34, 0x8008, 0x0000, 0x8007, 0x1B4D, 0x8007, 0x0000, 0x8007, 0x2D34,   // 0x0640 (1600)
+0x8003, 0x0000, 0x8003, 0x2430, 0x0002, 0x0000, 0x0000, 0x8007, 0x1B4D, 0x8008, 0x0000, 0x8005, 0x2D34, 0x8003, 0x0000, 0x8005,   // 0x0650 (1616)
+0x2430, 0x0002, 0x0000, 0x0000, 0x8005, 0x1B4D, 0x800A, 0x0000, 0x8003, 0x2D34, 0x8003, 0x0000, 0x8007, 0x2430, 0x0002, 0x0000,   // 0x0660 (1632)
+0x0000, 0x8003, 0x1B4D, 0x8011, 0x0000, 0x8007, 0x2430, 0x8016, 0x0000, 0x8007, 0x2430, 0x8017, 0x0000, 0x8005, 0x2430, 0x8019,   // 0x0670 (1648)
+0x0000, 0x8003, 0x2430, 0x800D, 0x0000, 0x00EB, 0x0001, 0x0002, 0x0002, 0x801D, 0x001D, 0x800C, 0x0000, 0x8004, 0x3F1B, 0x8018,   // 0x0680 (1664)
+0x0000, 0x8006, 0x3F1B, 0x8016, 0x0000, 0x8008, 0x3F1B, 0x8010, 0x0000, 0x8003, 0x3618, 0x0002, 0x0000, 0x0000, 0x8008, 0x3F1B,   // 0x0690 (1680)
+0x0002, 0x0000, 0x0000, 0x8003, 0x47FF, 0x800A, 0x0000, 0x8005, 0x3618, 0x0001, 0x0000, 0x8008, 0x3F1B, 0x0001, 0x0000, 0x8005,   // 0x06A0 (1696)
+0x47FF, 0x8008, 0x0000, 0x8007, 0x3618, 0x0001, 0x0000, 0x8006, 0x3F1B, 0x0001, 0x0000, 0x8007, 0x47FF, 0x8007, 0x0000, 0x8007,   // 0x06B0 (1712)
+0x3618, 0x0002, 0x0000, 0x0000, 0x8004, 0x3F1B, 0x0002, 0x0000, 0x0000, 0x8007, 0x47FF, 0x8007, 0x0000, 0x8007, 0x3618, 0x8008,   // 0x06C0 (1728)
+0x0000, 0x8007, 0x47FF, 0x8008, 0x0000, 0x8005, 0x3618, 0x800A, 0x0000, 0x8005, 0x47FF, 0x800A, 0x0000, 0x8003, 0x3618, 0x800C,   // 0x06D0 (1744)
+0x0000, 0x8003, 0x47FF, 0x8025, 0x0000, 0x8003, 0x2D34, 0x8013, 0x0000, 0x8003, 0x0965, 0x8003, 0x0000, 0x8005, 0x2D34, 0x8011,   // 0x06E0 (1760)
+0x0000, 0x8005, 0x0965, 0x0001, 0x0000, 0x8007, 0x2D34, 0x800F, 0x0000, 0x8007, 0x0965, 0x8007, 0x2D34, 0x800F, 0x0000, 0x8007,   // 0x06F0 (1776)
+0x0965, 0x8007, 0x2D34, 0x800F, 0x0000, 0x8007, 0x0965, 0x0001, 0x0000, 0x8005, 0x2D34, 0x8011, 0x0000, 0x8005, 0x0965, 0x8003,   // 0x0700 (1792)
+0x0000, 0x8003, 0x2D34, 0x8013, 0x0000, 0x8003, 0x0965, 0x8007, 0x0000, 0x8003, 0x2430, 0x800C, 0x0000, 0x8003, 0x1269, 0x800A,   // 0x0710 (1808)
+0x0000, 0x8005, 0x2430, 0x800A, 0x0000, 0x8005, 0x1269, 0x8008, 0x0000, 0x8007, 0x2430, 0x8008, 0x0000, 0x8007, 0x1269, 0x8007,   // 0x0720 (1824)
+0x0000, 0x8007, 0x2430, 0x8008, 0x0000, 0x8007, 0x1269, 0x8007, 0x0000, 0x8007, 0x2430, 0x8003, 0x0000, 0x8003, 0x1B4D, 0x0002,   // 0x0730 (1840)
+0x0000, 0x0000, 0x8007, 0x1269, 0x8008, 0x0000, 0x8005, 0x2430, 0x8003, 0x0000, 0x8005, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8005,   // 0x0740 (1856)
+0x1269, 0x800A, 0x0000, 0x8003, 0x2430, 0x8003, 0x0000, 0x8007, 0x1B4D, 0x0002, 0x0000, 0x0000, 0x8003, 0x1269, 0x8011, 0x0000,   // 0x0750 (1872)
+0x8007, 0x1B4D, 0x8016, 0x0000, 0x8007, 0x1B4D, 0x8017, 0x0000, 0x8005, 0x1B4D, 0x8019, 0x0000, 0x8003, 0x1B4D, 0x800D, 0x0000,   // 0x0760 (1888)
+};
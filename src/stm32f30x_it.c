@@ -171,7 +171,7 @@ void EXTI0_IRQHandler(void) {
     for(i=0; i<0x7FFFF; i++);
     UserButtonPressed++;
     
-    if (UserButtonPressed > 0x2)
+    if (UserButtonPressed > 0xC)
 		UserButtonPressed = 0x1;
     
     /* Clear the EXTI line pending bit */
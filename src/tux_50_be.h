@@ -0,0 +1,333 @@
+// Generated by  : imgconv
+// Generated from: tux_50_ad.png
+// Dimensions    : 50x52 pixels
+// Format        : RGB565 panel byte order, see lcd7735_drawBitmapSwapped()
+// Size          : 5200 Bytes
+
+const unsigned char tux_50_be[0x1450] ={
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0010 (16)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0020 (32)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0030 (48)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0040 (64)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0050 (80)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0060 (96)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0070 (112)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0080 (128)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0090 (144)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00A0 (160)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00B0 (176)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00C0 (192)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00D0 (208)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00E0 (224)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x00F0 (240)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0100 (256)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0110 (272)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0120 (288)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0130 (304)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0140 (320)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0150 (336)
+0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBE, 0xEE, 0x59, 0xED, 0x55, 0xE4, 0x51, 0xE4, 0x10, 0xE4, 0x30,   // 0x0160 (352)
+0xDC, 0x31, 0xE4, 0xF3, 0xE5, 0xB7, 0xEE, 0xFC, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0170 (368)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0180 (384)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0190 (400)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x01A0 (416)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x01B0 (432)
+0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x3D, 0xE4, 0xD3, 0xE3, 0x6D, 0xEB, 0x4D, 0xF3, 0xEF, 0xF4, 0x92,   // 0x01C0 (448)
+0xFD, 0x34, 0xFD, 0x75, 0xF5, 0x55, 0xF5, 0x14, 0xEC, 0x71, 0xE3, 0xEF, 0xDC, 0x30, 0xE5, 0xF7,   // 0x01D0 (464)
+0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x01E0 (480)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x01F0 (496)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0200 (512)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0210 (528)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0xE2, 0x49, 0xE9, 0xC7, 0xF2, 0x28, 0xF2, 0x49,   // 0x0220 (544)
+0xF2, 0x8A, 0xF3, 0x2C, 0xF4, 0x30, 0xFD, 0x14, 0xFD, 0xF7, 0xFE, 0x59, 0xFE, 0x79, 0xFE, 0x59,   // 0x0230 (560)
+0xFD, 0x96, 0xE4, 0x10, 0xD4, 0x10, 0xE6, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0240 (576)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0250 (592)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0260 (608)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0270 (624)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xE3, 0x8E, 0xE0, 0x41, 0xF0, 0x20, 0xF0, 0x20,   // 0x0280 (640)
+0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x20, 0xF0, 0xC3, 0xF2, 0x08, 0xF3, 0xEF,   // 0x0290 (656)
+0xFD, 0x96, 0xFE, 0x18, 0xFE, 0x79, 0xFE, 0x9A, 0xF5, 0x34, 0xDB, 0x8E, 0xDD, 0xF7, 0xF7, 0xFF,   // 0x02A0 (672)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x02B0 (688)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x02C0 (704)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x02D0 (720)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7E, 0xE2, 0xAA, 0xE8, 0x00, 0xF0, 0x00,   // 0x02E0 (736)
+0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x20, 0xE8, 0x20, 0xE8, 0x00, 0xE8, 0x00,   // 0x02F0 (752)
+0xE8, 0x00, 0xE8, 0x41, 0xF1, 0xC7, 0xF4, 0x71, 0xFD, 0xB6, 0xFD, 0xF7, 0xFE, 0x79, 0xFD, 0xD7,   // 0x0300 (768)
+0xE3, 0x8E, 0xD5, 0x96, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0310 (784)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0320 (800)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0330 (816)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xDB, 0xFF, 0x1C, 0xFF, 0x9E, 0xEC, 0xD3, 0xF2, 0x28,   // 0x0340 (832)
+0xF2, 0xCB, 0xF3, 0x4D, 0xF3, 0x8E, 0xF3, 0xCF, 0xF3, 0xEF, 0xF4, 0x10, 0xF4, 0x30, 0xF4, 0x51,   // 0x0350 (848)
+0xF4, 0x51, 0xF4, 0x51, 0xF4, 0x51, 0xF4, 0x30, 0xF3, 0xCF, 0xF4, 0x51, 0xFD, 0x55, 0xFD, 0xD7,   // 0x0360 (864)
+0xFD, 0xD7, 0xFD, 0xF7, 0xFD, 0x75, 0xDB, 0xAE, 0xDE, 0x38, 0xF7, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0370 (880)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0380 (896)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0390 (912)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x10, 0xF3, 0x8E, 0xF4, 0x10,   // 0x03A0 (928)
+0xF2, 0xEB, 0xF2, 0xCB, 0xF2, 0x8A, 0xF2, 0x49, 0xF1, 0xE7, 0xF1, 0xA6, 0xF1, 0x86, 0xF1, 0x65,   // 0x03B0 (944)
+0xF1, 0x45, 0xF1, 0x24, 0xF1, 0x24, 0xF1, 0x24, 0xF1, 0x24, 0xF1, 0x45, 0xF1, 0x45, 0xF1, 0x45,   // 0x03C0 (960)
+0xF1, 0x65, 0xF2, 0xCB, 0xFC, 0x92, 0xFC, 0xD3, 0xFD, 0x14, 0xFC, 0xF3, 0xF3, 0xCF, 0xED, 0xD7,   // 0x03D0 (976)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x03E0 (992)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x03F0 (1008)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xFF, 0x1C, 0xF2, 0xEB,   // 0x0400 (1024)
+0xF2, 0x28, 0xF0, 0xA2, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00,   // 0x0410 (1040)
+0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00,   // 0x0420 (1056)
+0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xF1, 0xC7, 0xF3, 0x2C, 0xF3, 0x6D, 0xF3, 0xAE,   // 0x0430 (1072)
+0xF2, 0x28, 0xEA, 0x8A, 0xEF, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0440 (1088)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0450 (1104)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xF3, 0x8E,   // 0x0460 (1120)
+0xF1, 0xA6, 0xE8, 0x41, 0xF1, 0xE7, 0xF1, 0xA6, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00,   // 0x0470 (1136)
+0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,   // 0x0480 (1152)
+0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x00, 0xE8, 0x20, 0xF2, 0x28,   // 0x0490 (1168)
+0xF2, 0xEB, 0xF3, 0x0C, 0xF2, 0xEB, 0xF0, 0xE3, 0xE4, 0xD3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x04A0 (1184)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x04B0 (1200)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x04C0 (1216)
+0xFF, 0xFF, 0xFF, 0x5D, 0xFD, 0xF7, 0xF1, 0x45, 0xE8, 0x00, 0xF0, 0x61, 0xF0, 0x00, 0xF0, 0x00,   // 0x04D0 (1232)
+0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xE8, 0x00,   // 0x04E0 (1248)
+0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,   // 0x04F0 (1264)
+0xF0, 0x00, 0xF8, 0xA2, 0xFA, 0x08, 0xF2, 0x49, 0xF2, 0xAA, 0xF1, 0x65, 0xE2, 0x28, 0xEF, 0x3C,   // 0x0500 (1280)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0510 (1296)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0520 (1312)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x8A, 0xF8, 0x00, 0xF8, 0x00,   // 0x0530 (1328)
+0xF0, 0x00, 0xE0, 0x00, 0xD0, 0x40, 0xC8, 0xC3, 0xC1, 0x24, 0xC1, 0xA6, 0xC2, 0x28, 0xC2, 0xAA,   // 0x0540 (1344)
+0xC2, 0xEB, 0xC3, 0x0C, 0x89, 0xA6, 0x60, 0x61, 0x70, 0xC3, 0x89, 0x65, 0xA1, 0xE7, 0xBA, 0x08,   // 0x0550 (1360)
+0xD2, 0x49, 0xD1, 0xC7, 0xC8, 0xE3, 0xC0, 0x00, 0xD8, 0x20, 0xE8, 0x61, 0xF0, 0xC3, 0xF8, 0xC3,   // 0x0560 (1376)
+0xF0, 0x82, 0xE6, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0570 (1392)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0580 (1408)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x4D,   // 0x0590 (1424)
+0x98, 0x00, 0x70, 0x00, 0x48, 0x00, 0x30, 0x41, 0x6A, 0xEB, 0x94, 0x71, 0xA5, 0x14, 0xAD, 0x96,   // 0x05A0 (1440)
+0xB5, 0xF7, 0xC6, 0x79, 0xD6, 0xFB, 0xCE, 0xBA, 0x84, 0xB2, 0x21, 0xA6, 0x53, 0x0B, 0x8C, 0xB2,   // 0x05B0 (1456)
+0x95, 0x14, 0x9D, 0x34, 0xBE, 0x38, 0xCE, 0xBA, 0xBD, 0xF7, 0x73, 0x6D, 0x30, 0xC2, 0x40, 0x20,   // 0x05C0 (1472)
+0x58, 0x00, 0x80, 0x00, 0xB1, 0x45, 0xE6, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x05D0 (1488)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x05E0 (1504)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x05F0 (1520)
+0xFF, 0xFF, 0x9D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0x94, 0xD2, 0xBD, 0xF8,   // 0x0600 (1536)
+0xCE, 0x7A, 0xD6, 0xBA, 0xD6, 0xBA, 0xDE, 0xDB, 0xCE, 0x79, 0x9C, 0xF3, 0x9C, 0xF3, 0x42, 0x28,   // 0x0610 (1552)
+0x73, 0xAE, 0xA5, 0x14, 0xC6, 0x38, 0xCE, 0x59, 0xCE, 0x59, 0xE7, 0x3D, 0xEF, 0x9E, 0xD6, 0xFB,   // 0x0620 (1568)
+0x4A, 0xCA, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xAB, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0630 (1584)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0640 (1600)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0650 (1616)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3,   // 0x0660 (1632)
+0xAD, 0x55, 0xCE, 0x79, 0xDE, 0xBB, 0xDE, 0xDB, 0xDE, 0xDB, 0xE6, 0xFC, 0x73, 0xAE, 0x18, 0xE3,   // 0x0670 (1648)
+0x42, 0x28, 0x18, 0xC2, 0x4A, 0x49, 0x63, 0x0C, 0xC5, 0xF8, 0xD6, 0x9A, 0xD6, 0x7A, 0xDE, 0xDB,   // 0x0680 (1664)
+0xEF, 0x5D, 0xEF, 0x5D, 0x8C, 0x71, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x08, 0xF7, 0xBF,   // 0x0690 (1680)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x06A0 (1696)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x06B0 (1712)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x8E, 0x00, 0x00, 0x00, 0x00,   // 0x06C0 (1728)
+0x00, 0x00, 0x18, 0xE3, 0xAD, 0x75, 0xD6, 0x9A, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xE6, 0xFC,   // 0x06D0 (1744)
+0x6B, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0xB5, 0x96, 0xD6, 0xBA,   // 0x06E0 (1760)
+0xD6, 0x9A, 0xD6, 0x9A, 0xE6, 0xFC, 0xDE, 0xFB, 0x8C, 0x71, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,   // 0x06F0 (1776)
+0x29, 0x86, 0xEF, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0700 (1792)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0710 (1808)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0x8A,   // 0x0720 (1824)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA2, 0xA5, 0x34, 0xD6, 0x9A, 0xDE, 0xFB, 0xDE, 0xDB,   // 0x0730 (1840)
+0xDE, 0xDB, 0xE6, 0xFC, 0x9C, 0xD3, 0x42, 0x29, 0x18, 0xE4, 0x10, 0xA3, 0x31, 0xA7, 0x39, 0xE8,   // 0x0740 (1856)
+0xBD, 0xD7, 0xD6, 0x7A, 0xD6, 0x7A, 0xCE, 0x59, 0xCE, 0x79, 0xCE, 0x59, 0x73, 0x8D, 0x00, 0x00,   // 0x0750 (1872)
+0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xDE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0760 (1888)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0770 (1904)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0780 (1920)
+0xF7, 0xBE, 0x29, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7C, 0x0F, 0xCE, 0x79,   // 0x0790 (1936)
+0xDE, 0xDB, 0xE7, 0x1C, 0xDE, 0xFC, 0xDE, 0xDC, 0xC6, 0x17, 0x94, 0x2E, 0x83, 0x89, 0x62, 0xA5,   // 0x07A0 (1952)
+0x83, 0xAA, 0xA4, 0xB0, 0xBD, 0xD7, 0xC6, 0x39, 0xCE, 0x59, 0xC6, 0x18, 0xC6, 0x38, 0xA5, 0x34,   // 0x07B0 (1968)
+0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xC6, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x07C0 (1984)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x07D0 (2000)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x07E0 (2016)
+0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xBB, 0x10, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x07F0 (2032)
+0x3A, 0x07, 0xB5, 0xD6, 0xD6, 0xBA, 0xE6, 0xFC, 0xDE, 0xDB, 0xD5, 0xF2, 0xDD, 0xAB, 0xEE, 0x2D,   // 0x0800 (2048)
+0xF6, 0xD1, 0xF7, 0x34, 0xF7, 0x35, 0xEE, 0xD4, 0xD6, 0x11, 0xBD, 0xB4, 0xB5, 0xB6, 0xAD, 0x55,   // 0x0810 (2064)
+0x8C, 0x50, 0x3A, 0x07, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x94, 0xF4,   // 0x0820 (2080)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0830 (2096)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0840 (2112)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x75, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00,   // 0x0850 (2128)
+0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x52, 0xCA, 0xBD, 0xD7, 0xD6, 0x9A, 0xDE, 0x14, 0xE5, 0x45,   // 0x0860 (2144)
+0xED, 0xA1, 0xF6, 0x44, 0xFE, 0xEA, 0xFF, 0x92, 0xFF, 0xD8, 0xFF, 0xFB, 0xFF, 0xDB, 0xC5, 0x8E,   // 0x0870 (2160)
+0x94, 0x91, 0x7B, 0xEF, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x0880 (2176)
+0x00, 0x00, 0x52, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0890 (2192)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x08A0 (2208)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x73, 0xEF, 0x10, 0xC2,   // 0x08B0 (2224)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x4C, 0xAD, 0x74, 0xA5, 0x54,   // 0x08C0 (2240)
+0xAC, 0xCF, 0xDD, 0x46, 0xED, 0xA0, 0xF6, 0x00, 0xF6, 0x60, 0xF6, 0xE3, 0xFF, 0x8E, 0xFF, 0xB6,   // 0x08D0 (2256)
+0xF7, 0x35, 0xCD, 0xB0, 0xBD, 0xD7, 0xC6, 0x38, 0xA5, 0x34, 0x31, 0x85, 0x00, 0x00, 0x00, 0x00,   // 0x08E0 (2272)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x31, 0xA6, 0xBE, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x08F0 (2288)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0900 (2304)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x95,   // 0x0910 (2320)
+0x84, 0x30, 0x19, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xEF, 0xF7, 0x7D,   // 0x0920 (2336)
+0xE7, 0x1C, 0xBD, 0xF7, 0xA5, 0x14, 0xB4, 0xCC, 0xE5, 0x65, 0xED, 0xE0, 0xF6, 0x60, 0xF6, 0xC0,   // 0x0930 (2352)
+0xEE, 0xE2, 0xEE, 0xEE, 0xD5, 0xEE, 0xD6, 0x99, 0xEF, 0x7D, 0xF7, 0x9E, 0xFF, 0xDF, 0xDE, 0xDB,   // 0x0940 (2368)
+0x39, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x5A, 0xEB, 0x7C, 0x0F, 0xDF, 0x1B,   // 0x0950 (2384)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0960 (2400)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0970 (2416)
+0xC6, 0x38, 0x8C, 0x71, 0x94, 0x92, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x4C,   // 0x0980 (2432)
+0xF7, 0xBE, 0xF7, 0xBE, 0xF7, 0x9E, 0xEF, 0x5D, 0xDE, 0xFB, 0xBD, 0xD7, 0xC5, 0x2D, 0xE5, 0x85,   // 0x0990 (2448)
+0xEE, 0x20, 0xEE, 0x80, 0xE6, 0x00, 0xD5, 0x88, 0xCE, 0x37, 0xEF, 0x7E, 0xF7, 0xBE, 0xF7, 0xBE,   // 0x09A0 (2464)
+0xF7, 0xBE, 0xFF, 0xFF, 0xD6, 0xBA, 0x29, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x49,   // 0x09B0 (2480)
+0xA5, 0x14, 0x7C, 0x0F, 0xEF, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x09C0 (2496)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x09D0 (2512)
+0xFF, 0xFF, 0xC6, 0x38, 0x84, 0x50, 0x9C, 0xD3, 0x29, 0x65, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,   // 0x09E0 (2528)
+0x39, 0xC6, 0xE7, 0x3C, 0xF7, 0xBE, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x7D, 0xE7, 0x3C,   // 0x09F0 (2544)
+0xC6, 0x18, 0xC5, 0x4D, 0xE5, 0xA4, 0xE5, 0xC0, 0xD5, 0x44, 0xC5, 0xF4, 0xE7, 0x1D, 0xF7, 0x9E,   // 0x0A00 (2560)
+0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x9E, 0xF7, 0x9E, 0xFF, 0xDF, 0xB5, 0x95, 0x08, 0x41, 0x00, 0x00,   // 0x0A10 (2576)
+0x00, 0x00, 0x00, 0x41, 0x6B, 0x6D, 0x94, 0xB2, 0x7C, 0x0F, 0xE6, 0x9A, 0xFF, 0x5D, 0xFF, 0xFF,   // 0x0A20 (2592)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0A30 (2608)
+0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x96, 0x84, 0x30, 0x8C, 0x71, 0x29, 0x65, 0x00, 0x00, 0x00, 0x20,   // 0x0A40 (2624)
+0x00, 0x00, 0x08, 0x41, 0xB5, 0xB6, 0xF7, 0xBE, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D,   // 0x0A50 (2640)
+0xEF, 0x7D, 0xEF, 0x7D, 0xDE, 0xFC, 0xC6, 0x18, 0xC5, 0x6F, 0xCD, 0x4A, 0xC5, 0xD3, 0xDE, 0xDB,   // 0x0A60 (2656)
+0xEF, 0x5D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xF7, 0xBE,   // 0x0A70 (2672)
+0x63, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x6B, 0x4D, 0x8C, 0x71, 0xCB, 0x0B,   // 0x0A80 (2688)
+0xFC, 0xB2, 0xFE, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0A90 (2704)
+0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7D, 0x94, 0xD2, 0x84, 0x30, 0x7B, 0xEF, 0x21, 0x04, 0x00, 0x00,   // 0x0AA0 (2720)
+0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x5A, 0xCA, 0xEF, 0x7D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D,   // 0x0AB0 (2736)
+0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xE7, 0x3C, 0xDE, 0xDB, 0xC6, 0x39, 0xC6, 0x18,   // 0x0AC0 (2752)
+0xD6, 0xBB, 0xE7, 0x3C, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D, 0xEF, 0x5D,   // 0x0AD0 (2768)
+0xEF, 0x5D, 0xEF, 0x7D, 0xCE, 0x59, 0x18, 0xC3, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,   // 0x0AE0 (2784)
+0x52, 0xAA, 0xCA, 0x49, 0xFC, 0xD3, 0xFD, 0x75, 0xFD, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0AF0 (2800)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x5D, 0x84, 0x71, 0x8C, 0x51, 0x63, 0x0C, 0x08, 0x61,   // 0x0B00 (2816)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0xAD, 0x55, 0xEF, 0x7D, 0xE7, 0x3C,   // 0x0B10 (2832)
+0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x1C,   // 0x0B20 (2848)
+0xDE, 0xDB, 0xD6, 0xBB, 0xE7, 0x1C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C,   // 0x0B30 (2864)
+0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xE7, 0x3C, 0xEF, 0x7D, 0x62, 0xEB, 0x00, 0x00, 0x00, 0x20,   // 0x0B40 (2880)
+0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x98, 0x20, 0xFA, 0xAA, 0xFE, 0x18, 0xF4, 0x10, 0xFD, 0xD7,   // 0x0B50 (2896)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9E, 0x84, 0x50, 0x84, 0x30, 0x4A, 0x69,   // 0x0B60 (2912)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x29, 0x45, 0xD6, 0x9A,   // 0x0B70 (2928)
+0xE7, 0x3C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C,   // 0x0B80 (2944)
+0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C,   // 0x0B90 (2960)
+0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C, 0xEF, 0x5D, 0xA5, 0x13,   // 0x0BA0 (2976)
+0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xFB, 0x2C, 0xF4, 0x10,   // 0x0BB0 (2992)
+0xF3, 0x6D, 0xE4, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0xB2, 0x73, 0xAE,   // 0x0BC0 (3008)
+0x4A, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,   // 0x0BD0 (3024)
+0x63, 0x0B, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB,   // 0x0BE0 (3040)
+0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB,   // 0x0BF0 (3056)
+0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB, 0xDE, 0xFB,   // 0x0C00 (3072)
+0xE7, 0x1C, 0xCE, 0x59, 0x21, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x40, 0x41, 0xE0, 0x61,   // 0x0C10 (3088)
+0xFC, 0x10, 0xF2, 0xEB, 0xF2, 0x49, 0x92, 0x49, 0xC6, 0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xBA,   // 0x0C20 (3104)
+0x5A, 0xEB, 0x42, 0x28, 0x00, 0x00, 0x00, 0x41, 0x52, 0xAA, 0xAD, 0x75, 0x4A, 0xCB, 0x00, 0x00,   // 0x0C30 (3120)
+0x00, 0x00, 0x00, 0x00, 0x8C, 0x71, 0xDE, 0xFB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB,   // 0x0C40 (3136)
+0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB,   // 0x0C50 (3152)
+0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB,   // 0x0C60 (3168)
+0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xDB, 0xDE, 0xBA, 0x4A, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,   // 0x0C70 (3184)
+0xB3, 0xCF, 0xF9, 0xC7, 0xF3, 0xEF, 0xF1, 0x86, 0xE9, 0xA6, 0x7A, 0x29, 0x63, 0xAE, 0xFF, 0xDF,   // 0x0C80 (3200)
+0xFF, 0xFF, 0x9D, 0x13, 0x21, 0x24, 0x08, 0x82, 0x4A, 0x8A, 0xBE, 0x18, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0C90 (3216)
+0x73, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x61, 0xA5, 0x34, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA,   // 0x0CA0 (3232)
+0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA,   // 0x0CB0 (3248)
+0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA,   // 0x0CC0 (3264)
+0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0xBA, 0x6B, 0x4C, 0x00, 0x00,   // 0x0CD0 (3280)
+0x00, 0x00, 0x08, 0x62, 0xD6, 0x9A, 0xFE, 0xBA, 0xF4, 0x92, 0xF1, 0x24, 0xC9, 0x24, 0x39, 0x45,   // 0x0CE0 (3296)
+0x42, 0x69, 0xEF, 0x9D, 0xFF, 0xFF, 0xDF, 0x1B, 0x84, 0x30, 0xB5, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0CF0 (3312)
+0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x29, 0x24, 0xB5, 0xB6, 0xD6, 0x9A,   // 0x0D00 (3328)
+0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A,   // 0x0D10 (3344)
+0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A,   // 0x0D20 (3360)
+0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0x9A,   // 0x0D30 (3376)
+0x7B, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0xE7, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x9A,   // 0x0D40 (3392)
+0xEE, 0x38, 0xB5, 0xB6, 0xC6, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0D50 (3408)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x39, 0x08, 0x61, 0x00, 0x00, 0x31, 0x85,   // 0x0D60 (3424)
+0xBD, 0xD7, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,   // 0x0D70 (3440)
+0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,   // 0x0D80 (3456)
+0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,   // 0x0D90 (3472)
+0xCE, 0x79, 0xCE, 0x79, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x08, 0xF7, 0xBF, 0xFF, 0xFF,   // 0x0DA0 (3488)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0DB0 (3504)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7E, 0x21, 0x45,   // 0x0DC0 (3520)
+0x00, 0x00, 0x31, 0x86, 0xB5, 0xB6, 0xC6, 0x38, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59,   // 0x0DD0 (3536)
+0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59,   // 0x0DE0 (3552)
+0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59,   // 0x0DF0 (3568)
+0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0xCE, 0x59, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x73, 0xCF,   // 0x0E00 (3584)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0E10 (3600)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0E20 (3616)
+0xFF, 0xFF, 0x63, 0x6E, 0x00, 0x20, 0x29, 0x65, 0xB5, 0xB6, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x18,   // 0x0E30 (3632)
+0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38,   // 0x0E40 (3648)
+0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38,   // 0x0E50 (3664)
+0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x38, 0xC6, 0x18, 0x7B, 0xEF, 0x00, 0x00,   // 0x0E60 (3680)
+0x00, 0x20, 0xBE, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0E70 (3696)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0E80 (3712)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF8, 0x21, 0x45, 0x42, 0x28, 0xAD, 0x75, 0xBD, 0xF7,   // 0x0E90 (3728)
+0xC6, 0x17, 0xBD, 0xF7, 0xBE, 0x17, 0xC6, 0x17, 0xC6, 0x18, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7,   // 0x0EA0 (3744)
+0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7, 0xBD, 0xF7,   // 0x0EB0 (3760)
+0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xBD, 0xF7,   // 0x0EC0 (3776)
+0x7B, 0xCF, 0x10, 0x82, 0x42, 0x49, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0ED0 (3792)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0EE0 (3808)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x5B, 0x0C, 0x42, 0x28,   // 0x0EF0 (3824)
+0xAD, 0x34, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7,   // 0x0F00 (3840)
+0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7,   // 0x0F10 (3856)
+0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7, 0xBD, 0xD7,   // 0x0F20 (3872)
+0xBD, 0xD7, 0xBD, 0xF7, 0x84, 0x0F, 0x29, 0x86, 0xA5, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0F30 (3888)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0F40 (3904)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0F50 (3920)
+0xC6, 0x39, 0x39, 0xE7, 0x8C, 0x51, 0xA5, 0x35, 0x94, 0xD4, 0x94, 0xB3, 0x94, 0xB3, 0x94, 0xB3,   // 0x0F60 (3936)
+0x9C, 0xF4, 0xA5, 0x34, 0xAD, 0x75, 0xB5, 0x96, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6,   // 0x0F70 (3952)
+0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0x96, 0xAD, 0x55, 0xA5, 0x14, 0x9C, 0xD3, 0x94, 0xB3,   // 0x0F80 (3968)
+0x94, 0xB3, 0x94, 0xD3, 0x9C, 0xF4, 0xA5, 0x35, 0x63, 0x2C, 0x52, 0xCB, 0xF7, 0x9E, 0xFF, 0xFF,   // 0x0F90 (3984)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0FA0 (4000)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x0FB0 (4016)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x84, 0x52, 0x52, 0x89, 0x83, 0xEC, 0x8B, 0xAA, 0x8B, 0xA9,   // 0x0FC0 (4032)
+0x8B, 0xA9, 0x83, 0xAB, 0x7B, 0xAD, 0x7B, 0xF0, 0x84, 0x31, 0x94, 0xB2, 0xAD, 0x55, 0xB5, 0x96,   // 0x0FD0 (4048)
+0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xAD, 0x75, 0x9C, 0xF3, 0x8C, 0x72, 0x7C, 0x10, 0x73, 0xAF,   // 0x0FE0 (4064)
+0x7B, 0xAD, 0x83, 0xAB, 0x8B, 0xA9, 0x8B, 0xA9, 0x8B, 0xCA, 0x83, 0xCC, 0x42, 0x49, 0xC6, 0x7A,   // 0x0FF0 (4080)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1000 (4096)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1010 (4112)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xD5, 0xAD, 0xAB, 0xC2, 0xC4, 0x63,   // 0x1020 (4128)
+0xC4, 0x62, 0xC4, 0x40, 0xBC, 0x00, 0xB3, 0xC0, 0xAB, 0xA1, 0x9B, 0x85, 0x83, 0x8A, 0x73, 0xAE,   // 0x1030 (4144)
+0x84, 0x10, 0x9C, 0xF3, 0xAD, 0x75, 0xB5, 0x96, 0xAD, 0x55, 0x94, 0x92, 0x7B, 0xCF, 0x73, 0x8D,   // 0x1040 (4160)
+0x83, 0x68, 0x9B, 0x84, 0xAB, 0xA1, 0xB3, 0xE0, 0xBC, 0x20, 0xC4, 0x61, 0xC4, 0x82, 0xBC, 0x22,   // 0x1050 (4176)
+0xB4, 0x03, 0xEE, 0x71, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1060 (4192)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1070 (4208)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x92, 0xE5, 0x67, 0xE5, 0xEC,   // 0x1080 (4224)
+0xF6, 0xD4, 0xEF, 0x17, 0xEF, 0x18, 0xEE, 0xD5, 0xE6, 0x4F, 0xD5, 0x65, 0xCC, 0x80, 0xC4, 0x20,   // 0x1090 (4240)
+0xB3, 0xC0, 0x93, 0x85, 0x73, 0x8C, 0x7B, 0xF0, 0x9C, 0xD3, 0xA5, 0x34, 0x8C, 0x51, 0x73, 0x8E,   // 0x10A0 (4256)
+0x73, 0x4B, 0x9B, 0x83, 0xB3, 0xE0, 0xC4, 0x40, 0xD4, 0xE1, 0xDD, 0xCA, 0xE6, 0xB3, 0xEF, 0x17,   // 0x10B0 (4272)
+0xEF, 0x18, 0xEF, 0x16, 0xEE, 0x91, 0xE5, 0x67, 0xE5, 0x66, 0xF7, 0x17, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x10C0 (4288)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x10D0 (4304)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x91, 0xED, 0x66,   // 0x10E0 (4320)
+0xF6, 0xF4, 0xFF, 0xBA, 0xFF, 0xDB, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xDB, 0xFF, 0xBB, 0xF7, 0x77,   // 0x10F0 (4336)
+0xEE, 0x49, 0xDD, 0x40, 0xCC, 0x80, 0xBB, 0xE0, 0x9B, 0x83, 0x73, 0x6D, 0x7B, 0xF0, 0x8C, 0x51,   // 0x1100 (4352)
+0x73, 0xAE, 0x73, 0x4A, 0xA3, 0x81, 0xC4, 0x20, 0xD4, 0xC0, 0xE5, 0xA2, 0xEE, 0xF2, 0xF7, 0xBA,   // 0x1110 (4368)
+0xFF, 0xDB, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xDB, 0xFF, 0xDB, 0xFF, 0x99, 0xEE, 0x4C, 0xED, 0x22,   // 0x1120 (4384)
+0xF7, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1130 (4400)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59,   // 0x1140 (4416)
+0xED, 0x43, 0xF6, 0xD0, 0xFF, 0xB6, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0x95, 0xFF, 0x95,   // 0x1150 (4432)
+0xFF, 0x95, 0xFF, 0x96, 0xFF, 0x74, 0xEE, 0x44, 0xE5, 0x60, 0xCC, 0xA0, 0xBB, 0xE0, 0x93, 0x86,   // 0x1160 (4448)
+0x6B, 0x6D, 0x6B, 0x6D, 0x6B, 0x4D, 0x93, 0x63, 0xC4, 0x00, 0xD4, 0xE0, 0xED, 0xA0, 0xF6, 0xED,   // 0x1170 (4464)
+0xFF, 0x96, 0xFF, 0x95, 0xFF, 0x95, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xD5, 0xFF, 0xD5,   // 0x1180 (4480)
+0xFF, 0xB6, 0xF6, 0x07, 0xED, 0x64, 0xFF, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1190 (4496)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF,   // 0x11A0 (4512)
+0xF7, 0x9E, 0xE5, 0xEB, 0xED, 0x82, 0xF7, 0x50, 0xF7, 0xB0, 0xFF, 0x90, 0xFF, 0x90, 0xFF, 0x90,   // 0x11B0 (4528)
+0xFF, 0x70, 0xFF, 0x70, 0xFF, 0x50, 0xFF, 0x50, 0xFF, 0x51, 0xF6, 0xA6, 0xF5, 0xE0, 0xDD, 0x40,   // 0x11C0 (4544)
+0xC4, 0x40, 0xAB, 0xA1, 0x73, 0x6C, 0x63, 0x4D, 0x73, 0x49, 0xB3, 0xC0, 0xCC, 0xA0, 0xED, 0x80,   // 0x11D0 (4560)
+0xF6, 0x20, 0xFF, 0x0E, 0xFF, 0x51, 0xFF, 0x50, 0xFF, 0x70, 0xFF, 0x70, 0xFF, 0x90, 0xFF, 0xB0,   // 0x11E0 (4576)
+0xF7, 0xB0, 0xF7, 0xD0, 0xF7, 0xD1, 0xF6, 0xCA, 0xED, 0x00, 0xEE, 0x93, 0xF7, 0xBF, 0xFF, 0xDF,   // 0x11F0 (4592)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xEF, 0x5D,   // 0x1200 (4608)
+0xD6, 0xBA, 0xC6, 0x18, 0xB5, 0x95, 0xDC, 0xE3, 0xED, 0x80, 0xF7, 0x09, 0xF7, 0x6C, 0xF7, 0x4B,   // 0x1210 (4624)
+0xF7, 0x4B, 0xF7, 0x2C, 0xF7, 0x2C, 0xF7, 0x0C, 0xF7, 0x0C, 0xFE, 0xEC, 0xFE, 0xEB, 0xF6, 0x42,   // 0x1220 (4640)
+0xF5, 0xE0, 0xE5, 0x60, 0xCC, 0x60, 0xB3, 0xC0, 0x83, 0xCC, 0x7B, 0xF0, 0x8B, 0x88, 0xBB, 0xE0,   // 0x1230 (4656)
+0xD4, 0xE0, 0xED, 0xA0, 0xF6, 0x00, 0xF6, 0x88, 0xFE, 0xEC, 0xF7, 0x0C, 0xF7, 0x0C, 0xF7, 0x2C,   // 0x1240 (4672)
+0xF7, 0x4C, 0xF7, 0x4B, 0xF7, 0x6B, 0xF7, 0x8B, 0xF7, 0x8C, 0xEE, 0xA5, 0xED, 0x40, 0xC5, 0x2C,   // 0x1250 (4688)
+0xBD, 0xD8, 0xCE, 0x59, 0xDE, 0xFB, 0xF7, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1260 (4704)
+0xD6, 0xBA, 0xAD, 0x75, 0x94, 0xB2, 0x8C, 0x51, 0x84, 0x30, 0xBC, 0x86, 0xF5, 0x20, 0xF5, 0xC1,   // 0x1270 (4720)
+0xF6, 0x45, 0xF6, 0x46, 0xF6, 0x46, 0xF6, 0x46, 0xF6, 0x26, 0xF6, 0x26, 0xF6, 0x26, 0xF6, 0x06,   // 0x1280 (4736)
+0xF5, 0xC2, 0xF5, 0x60, 0xF5, 0x40, 0xE4, 0xE0, 0xCC, 0x40, 0xAB, 0xC1, 0x7B, 0xCD, 0x73, 0xD0,   // 0x1290 (4752)
+0x7B, 0x8A, 0xB3, 0xC0, 0xD4, 0x80, 0xED, 0x20, 0xF5, 0x60, 0xF5, 0x80, 0xF6, 0x05, 0xF6, 0x26,   // 0x12A0 (4768)
+0xF6, 0x26, 0xF6, 0x46, 0xF6, 0x46, 0xF6, 0x46, 0xF6, 0x66, 0xF6, 0x66, 0xF6, 0x43, 0xF5, 0xA0,   // 0x12B0 (4784)
+0xED, 0x00, 0xA4, 0x4A, 0x84, 0x31, 0x8C, 0x71, 0x9C, 0xF3, 0xBD, 0xF7, 0xEF, 0x7D, 0xFF, 0xFF,   // 0x12C0 (4800)
+0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x59, 0x9C, 0xD3, 0x84, 0x30, 0x84, 0x10, 0x7B, 0xF0, 0x8C, 0x0E,   // 0x12D0 (4816)
+0xBC, 0x66, 0xCC, 0xA3, 0xCC, 0xA4, 0xCC, 0xC5, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xE6,   // 0x12E0 (4832)
+0xCC, 0xE6, 0xCC, 0xC5, 0xCC, 0xA3, 0xCC, 0xA4, 0xCC, 0x84, 0xBC, 0x44, 0xAC, 0x04, 0x8B, 0xEB,   // 0x12F0 (4848)
+0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xCF, 0x93, 0xC9, 0xB4, 0x24, 0xC4, 0x64, 0xCC, 0xA4, 0xCC, 0xA3,   // 0x1300 (4864)
+0xCC, 0xA4, 0xCC, 0xC5, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xE6, 0xCC, 0xC5,   // 0x1310 (4880)
+0xCC, 0xA3, 0xCC, 0xA3, 0xB4, 0x67, 0x84, 0x0F, 0x7B, 0xF0, 0x84, 0x10, 0x8C, 0x71, 0xAD, 0x75,   // 0x1320 (4896)
+0xE7, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7D, 0xD6, 0x9A, 0xBD, 0xD7, 0xA5, 0x34,   // 0x1330 (4912)
+0x9C, 0xD3, 0x8C, 0x92, 0x84, 0x51, 0x84, 0x30, 0x84, 0x10, 0x84, 0x0F, 0x84, 0x0F, 0x83, 0xEF,   // 0x1340 (4928)
+0x83, 0xEF, 0x83, 0xEF, 0x83, 0xEF, 0x83, 0xEF, 0x7B, 0xEF, 0x83, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF,   // 0x1350 (4944)
+0x7B, 0xEF, 0x7B, 0xF0, 0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xF0, 0x7B, 0xF0, 0x7B, 0xEF, 0x7B, 0xEF,   // 0x1360 (4960)
+0x7B, 0xEF, 0x7B, 0xEF, 0x7B, 0xEF, 0x83, 0xEF, 0x83, 0xEF, 0x83, 0xEF, 0x83, 0xEF, 0x83, 0xEF,   // 0x1370 (4976)
+0x84, 0x0F, 0x84, 0x0F, 0x84, 0x30, 0x8C, 0x50, 0x8C, 0x72, 0x94, 0x92, 0x9C, 0xF3, 0xAD, 0x75,   // 0x1380 (4992)
+0xC6, 0x18, 0xDE, 0xFB, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1390 (5008)
+0xF7, 0x9E, 0xE7, 0x3C, 0xDE, 0xDB, 0xCE, 0x79, 0xC6, 0x38, 0xBD, 0xD7, 0xAD, 0x96, 0xA5, 0x55,   // 0x13A0 (5024)
+0xA5, 0x14, 0x9C, 0xF3, 0x9C, 0xD3, 0x94, 0xB2, 0x94, 0x92, 0x8C, 0x92, 0x8C, 0x72, 0x8C, 0x72,   // 0x13B0 (5040)
+0x8C, 0x71, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51,   // 0x13C0 (5056)
+0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x71, 0x8C, 0x72, 0x8C, 0x72, 0x94, 0x92, 0x94, 0xB2, 0x94, 0xB3,   // 0x13D0 (5072)
+0x9C, 0xD3, 0x9D, 0x14, 0xA5, 0x35, 0xAD, 0x75, 0xB5, 0xB6, 0xBD, 0xF8, 0xCE, 0x59, 0xD6, 0xBA,   // 0x13E0 (5088)
+0xE7, 0x1C, 0xEF, 0x7D, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x13F0 (5104)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1400 (5120)
+0xFF, 0xDF, 0xF7, 0xBE, 0xF7, 0x9E, 0xEF, 0x7D, 0xE7, 0x3C, 0xE7, 0x1C, 0xDE, 0xFB, 0xDE, 0xDB,   // 0x1410 (5136)
+0xD6, 0xBA, 0xD6, 0xBA, 0xD6, 0x9A, 0xD6, 0x9A, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,   // 0x1420 (5152)
+0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xD6, 0x9A, 0xD6, 0x9A, 0xD6, 0xBA, 0xDE, 0xDB, 0xDE, 0xFB,   // 0x1430 (5168)
+0xE7, 0x1C, 0xE7, 0x3C, 0xEF, 0x5D, 0xEF, 0x7D, 0xF7, 0x9E, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1440 (5184)
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   // 0x1450 (5200)
+};
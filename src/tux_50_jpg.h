@@ -0,0 +1,128 @@
+// Generated from: tux_50_ad.png
+// Dimensions    : 50x52 pixels
+// Format        : baseline JPEG, quality 85, 4:2:0, see lcd7735_jpeg_draw()
+// Size          : 1926 Bytes
+
+const unsigned char tux_50_jpg[0x786] ={
+0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,   // 0x0010 (16)
+0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03, 0x05,   // 0x0020 (32)
+0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x0C, 0x08, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0B,   // 0x0030 (48)
+0x0B, 0x09, 0x0C, 0x11, 0x0F, 0x12, 0x12, 0x11, 0x0F, 0x11, 0x11, 0x13, 0x16, 0x1C, 0x17, 0x13,   // 0x0040 (64)
+0x14, 0x1A, 0x15, 0x11, 0x11, 0x18, 0x21, 0x18, 0x1A, 0x1D, 0x1D, 0x1F, 0x1F, 0x1F, 0x13, 0x17,   // 0x0050 (80)
+0x22, 0x24, 0x22, 0x1E, 0x24, 0x1C, 0x1E, 0x1F, 0x1E, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x05, 0x05,   // 0x0060 (96)
+0x05, 0x07, 0x06, 0x07, 0x0E, 0x08, 0x08, 0x0E, 0x1E, 0x14, 0x11, 0x14, 0x1E, 0x1E, 0x1E, 0x1E,   // 0x0070 (112)
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,   // 0x0080 (128)
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,   // 0x0090 (144)
+0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xFF, 0xC0,   // 0x00A0 (160)
+0x00, 0x11, 0x08, 0x00, 0x34, 0x00, 0x32, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,   // 0x00B0 (176)
+0x01, 0xFF, 0xC4, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,   // 0x00C0 (192)
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,   // 0x00D0 (208)
+0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,   // 0x00E0 (224)
+0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,   // 0x00F0 (240)
+0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23,   // 0x0100 (256)
+0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17,   // 0x0110 (272)
+0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A,   // 0x0120 (288)
+0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A,   // 0x0130 (304)
+0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,   // 0x0140 (320)
+0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,   // 0x0150 (336)
+0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,   // 0x0160 (352)
+0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5,   // 0x0170 (368)
+0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1,   // 0x0180 (384)
+0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFF, 0xC4, 0x00, 0x1F, 0x01, 0x00, 0x03,   // 0x0190 (400)
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,   // 0x01A0 (416)
+0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xC4, 0x00, 0xB5, 0x11, 0x00,   // 0x01B0 (432)
+0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,   // 0x01C0 (448)
+0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,   // 0x01D0 (464)
+0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,   // 0x01E0 (480)
+0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27,   // 0x01F0 (496)
+0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,   // 0x0200 (512)
+0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,   // 0x0210 (528)
+0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,   // 0x0220 (544)
+0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,   // 0x0230 (560)
+0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,   // 0x0240 (576)
+0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE2,   // 0x0250 (592)
+0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9,   // 0x0260 (608)
+0xFA, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xFB,   // 0x0270 (624)
+0x2E, 0x99, 0x71, 0x34, 0x36, 0xF0, 0x49, 0x71, 0x71, 0x2A, 0x43, 0x0C, 0x6A, 0x5D, 0xE4, 0x76,   // 0x0280 (640)
+0x0A, 0xAA, 0xA3, 0x92, 0x49, 0x3D, 0x05, 0x3E, 0xBE, 0x5B, 0xFD, 0xAE, 0x3C, 0x6D, 0xAE, 0xF8,   // 0x0290 (656)
+0x4B, 0xC4, 0x36, 0xFA, 0x7D, 0xD6, 0xBB, 0x15, 0xBD, 0x96, 0xA5, 0x69, 0x9B, 0x78, 0xE1, 0x8D,   // 0x02A0 (672)
+0x94, 0x32, 0xAC, 0x87, 0x2A, 0xEA, 0x4B, 0x07, 0x3C, 0x8E, 0x46, 0x3B, 0x71, 0x58, 0x62, 0x2B,   // 0x02B0 (688)
+0x3A, 0x30, 0xE6, 0x51, 0x6F, 0xD0, 0xF5, 0x72, 0x7C, 0xB6, 0x39, 0x8E, 0x25, 0x51, 0x95, 0x58,   // 0x02C0 (704)
+0xD3, 0x5B, 0xDE, 0x4E, 0xCB, 0xFC, 0x8E, 0xDF, 0xC4, 0x9F, 0xB4, 0x4F, 0x85, 0xAD, 0x75, 0x19,   // 0x02D0 (720)
+0x2C, 0xB4, 0x75, 0x6B, 0xA4, 0x46, 0x2A, 0x6E, 0xE4, 0x46, 0xD8, 0xC7, 0xD5, 0x54, 0x72, 0x47,   // 0x02E0 (736)
+0xBE, 0x45, 0x6E, 0x78, 0x43, 0xE2, 0xAC, 0x3E, 0x20, 0x05, 0xB4, 0xFB, 0x9D, 0x27, 0x51, 0x65,   // 0x02F0 (752)
+0x19, 0x7B, 0x78, 0xD9, 0xED, 0xE6, 0x03, 0xD8, 0x3E, 0x73, 0xFA, 0x0F, 0x7A, 0xF9, 0xE3, 0x4B,   // 0x0300 (768)
+0xF0, 0xCF, 0xC5, 0x4B, 0xFB, 0x41, 0x75, 0x14, 0x97, 0x16, 0xD0, 0x14, 0xDF, 0xBE, 0x49, 0xD2,   // 0x0310 (784)
+0x10, 0x17, 0x1D, 0x7D, 0xAA, 0x97, 0x85, 0xED, 0x3E, 0x27, 0x6B, 0x57, 0x32, 0x36, 0x95, 0x73,   // 0x0320 (800)
+0xA9, 0x79, 0x96, 0xF3, 0xB4, 0x25, 0x9E, 0xE0, 0x0F, 0x9D, 0x49, 0x04, 0x67, 0x3E, 0xA3, 0xE8,   // 0x0330 (816)
+0x6B, 0xC8, 0x8E, 0x2B, 0x1B, 0xCD, 0x77, 0x07, 0x6F, 0x4F, 0xF8, 0x27, 0xE8, 0x75, 0xB2, 0x1E,   // 0x0340 (832)
+0x19, 0xF6, 0x5E, 0xCE, 0x9E, 0x22, 0x0A, 0x5D, 0xDD, 0x4B, 0xDF, 0xD7, 0x45, 0xF8, 0x34, 0x7D,   // 0x0350 (848)
+0xAD, 0xA2, 0x6A, 0xF6, 0x7A, 0xBD, 0xBB, 0x49, 0x6A, 0xCE, 0xAF, 0x19, 0xDB, 0x2C, 0x32, 0x0D,   // 0x0360 (864)
+0xB2, 0x44, 0xDE, 0x8C, 0x3F, 0xAF, 0x43, 0xD8, 0xD5, 0xFA, 0xF9, 0x33, 0xC1, 0xDF, 0x15, 0x35,   // 0x0370 (880)
+0x7D, 0x1B, 0xE2, 0xAE, 0x8F, 0xE1, 0x8D, 0x71, 0x2E, 0x6D, 0xF5, 0xD7, 0xB9, 0x8E, 0xD2, 0xEE,   // 0x0380 (896)
+0xCE, 0x48, 0x80, 0x33, 0xA3, 0xF0, 0x08, 0x23, 0xAE, 0x33, 0xB8, 0x7E, 0x35, 0xF5, 0x9D, 0x7A,   // 0x0390 (912)
+0xF8, 0x7A, 0xCE, 0xAC, 0x6E, 0xD3, 0x4F, 0xCC, 0xFC, 0xF7, 0x37, 0xCB, 0x63, 0x80, 0xAA, 0xA3,   // 0x03A0 (928)
+0x0A, 0x91, 0x9C, 0x5E, 0xA9, 0xC5, 0xA7, 0xF2, 0xD0, 0x28, 0xA2, 0x8A, 0xDC, 0xF2, 0x42, 0xBE,   // 0x03B0 (944)
+0x02, 0xFF, 0x00, 0x82, 0x86, 0xEB, 0x82, 0xF7, 0xE3, 0x0E, 0x93, 0x63, 0x01, 0x0D, 0x1E, 0x99,   // 0x03C0 (960)
+0xA6, 0x2A, 0x96, 0xEA, 0x0C, 0x8D, 0x23, 0x33, 0x0F, 0xC0, 0x05, 0x07, 0xDC, 0x1A, 0xFA, 0x2F,   // 0x03D0 (976)
+0xF6, 0x8A, 0xF8, 0xE1, 0x07, 0x81, 0xDC, 0xF8, 0x6B, 0xC3, 0xF0, 0x4B, 0xA8, 0xF8, 0x8A, 0x71,   // 0x03E0 (992)
+0xB1, 0x2D, 0xED, 0x90, 0xBC, 0xBB, 0x88, 0xC8, 0x55, 0x00, 0x1E, 0x70, 0x41, 0x27, 0x07, 0x19,   // 0x03F0 (1008)
+0x18, 0x04, 0xF4, 0xF9, 0x8B, 0xF6, 0x70, 0xD2, 0xAE, 0xFE, 0x2B, 0xFC, 0x7C, 0x97, 0x5F, 0xF1,   // 0x0400 (1024)
+0x9C, 0x7F, 0x69, 0xB7, 0xD1, 0x23, 0x37, 0x52, 0x5B, 0x48, 0xBF, 0x20, 0x90, 0x3E, 0x22, 0x88,   // 0x0410 (1040)
+0xA9, 0xEC, 0x18, 0x96, 0x39, 0xE4, 0x95, 0x39, 0xCE, 0x4D, 0x02, 0x3E, 0x8E, 0x6B, 0xDB, 0x4F,   // 0x0420 (1056)
+0x1A, 0x7C, 0x22, 0xB5, 0xD2, 0x75, 0x9D, 0x3B, 0x50, 0xD2, 0xA4, 0xD6, 0xF4, 0xF4, 0x59, 0x61,   // 0x0430 (1072)
+0x9A, 0x36, 0x8A, 0x48, 0xD4, 0x80, 0x77, 0x0F, 0xC4, 0x64, 0x7B, 0x55, 0x6F, 0x86, 0x3F, 0x0C,   // 0x0440 (1088)
+0xA2, 0xF8, 0x67, 0xA7, 0x5D, 0x4D, 0xA2, 0x6A, 0xF7, 0xDE, 0x22, 0x9B, 0x51, 0x65, 0xCC, 0x0E,   // 0x0450 (1104)
+0x48, 0x74, 0xDB, 0xB8, 0xE4, 0x29, 0x24, 0x0F, 0xBD, 0xC9, 0xC8, 0xCF, 0x15, 0xEB, 0xBA, 0xB1,   // 0x0460 (1120)
+0xB4, 0xD4, 0xED, 0x1A, 0xDE, 0xE9, 0x15, 0xC1, 0xE8, 0x71, 0xCA, 0x9F, 0x51, 0x54, 0xFC, 0x3B,   // 0x0470 (1136)
+0x69, 0x6F, 0xA4, 0x2C, 0x8C, 0xB2, 0x19, 0x66, 0x93, 0x86, 0x91, 0xBA, 0xE3, 0xB0, 0x15, 0xE6,   // 0x0480 (1152)
+0x54, 0xA5, 0x8F, 0xFA, 0xEC, 0x67, 0x09, 0xAF, 0x63, 0x6D, 0x55, 0xB5, 0xBF, 0x97, 0xAF, 0x9E,   // 0x0490 (1168)
+0xC7, 0x52, 0x95, 0x2F, 0x65, 0x66, 0xBD, 0xE3, 0xE1, 0x2F, 0x89, 0x9E, 0x36, 0xD7, 0x24, 0xFD,   // 0x04A0 (1184)
+0xAA, 0x34, 0xBF, 0x11, 0x6B, 0x9A, 0x15, 0xE6, 0x91, 0x77, 0xA5, 0x6A, 0x36, 0x69, 0xF6, 0x39,   // 0x04B0 (1200)
+0xD7, 0xF7, 0xDE, 0x5C, 0x72, 0x03, 0x93, 0x8E, 0x09, 0x60, 0x4E, 0x31, 0x91, 0xC8, 0xC5, 0x7E,   // 0x04C0 (1216)
+0x90, 0xD9, 0xDC, 0xDB, 0xDE, 0x5A, 0x45, 0x77, 0x6B, 0x2A, 0xCD, 0x04, 0xC8, 0x1E, 0x37, 0x53,   // 0x04D0 (1232)
+0x90, 0xCA, 0x46, 0x41, 0x15, 0xF2, 0xB7, 0xED, 0xD1, 0xE1, 0x0B, 0x5D, 0x73, 0xC0, 0x50, 0x78,   // 0x04E0 (1248)
+0xE6, 0xCE, 0x3F, 0x2F, 0x59, 0xD0, 0x65, 0x40, 0xF3, 0x47, 0xC3, 0xBD, 0xBB, 0x36, 0x30, 0x4F,   // 0x04F0 (1264)
+0xFB, 0x2C, 0x55, 0x81, 0xED, 0x96, 0xAC, 0xBF, 0xD9, 0x7B, 0xE3, 0x1F, 0x88, 0xA1, 0xF0, 0xA4,   // 0x0500 (1280)
+0xD7, 0x1E, 0x29, 0x0F, 0xFD, 0x9F, 0x03, 0x28, 0x8A, 0x46, 0xFB, 0xB7, 0x04, 0xB3, 0x6F, 0x75,   // 0x0510 (1296)
+0x18, 0xE0, 0xFC, 0xAD, 0x9D, 0xBC, 0x6E, 0x07, 0x8E, 0x4D, 0x77, 0xD4, 0xAB, 0x1A, 0x6A, 0xF2,   // 0x0520 (1312)
+0x2B, 0x07, 0x81, 0xAB, 0x8C, 0xA8, 0xE1, 0x49, 0x5D, 0xA5, 0x7F, 0xB8, 0xFB, 0x0A, 0x8A, 0x8A,   // 0x0530 (1328)
+0xD2, 0xE6, 0x0B, 0xBB, 0x48, 0x6E, 0xED, 0xA5, 0x49, 0x60, 0x99, 0x16, 0x48, 0xE4, 0x53, 0x90,   // 0x0540 (1344)
+0xEA, 0x46, 0x41, 0x1E, 0xC4, 0x1A, 0x2B, 0x43, 0x90, 0xCB, 0xD3, 0xBC, 0x29, 0xE1, 0xBD, 0x3B,   // 0x0550 (1360)
+0xC4, 0x37, 0xBE, 0x21, 0xB2, 0xD1, 0x2C, 0x61, 0xD5, 0xEF, 0x88, 0x37, 0x37, 0xAB, 0x08, 0xF3,   // 0x0560 (1376)
+0xA4, 0xC0, 0xC6, 0x37, 0x75, 0x03, 0xD8, 0x71, 0x5F, 0x35, 0xFC, 0x32, 0xF0, 0xC3, 0x7C, 0x39,   // 0x0570 (1392)
+0xF8, 0xC1, 0xF1, 0x26, 0xCA, 0xE8, 0x47, 0x0C, 0x57, 0x97, 0xB1, 0xDE, 0x59, 0xBB, 0x1C, 0x6E,   // 0x0580 (1408)
+0xB7, 0x90, 0xC8, 0xEB, 0xF8, 0x02, 0xC5, 0x7E, 0xA0, 0xD7, 0xD2, 0xBE, 0x20, 0xF1, 0x36, 0x8B,   // 0x0590 (1424)
+0xA1, 0xA9, 0x1A, 0x8D, 0xFC, 0x31, 0x4B, 0xB7, 0x2B, 0x16, 0xEF, 0x9D, 0xBD, 0x00, 0x1E, 0xF5,   // 0x05A0 (1440)
+0xC6, 0x6A, 0x1A, 0x67, 0x86, 0x7C, 0x50, 0xD0, 0xEA, 0xFE, 0x23, 0x48, 0xEE, 0xAE, 0xCC, 0x5B,   // 0x05B0 (1456)
+0x63, 0x01, 0xF6, 0x08, 0x50, 0x9C, 0xEC, 0x18, 0xE4, 0xF3, 0xEB, 0xDE, 0xBC, 0xBC, 0xC3, 0x36,   // 0x05C0 (1472)
+0xA1, 0x80, 0x71, 0x85, 0x47, 0xAC, 0xB6, 0xE9, 0xB7, 0xDF, 0xF9, 0x1D, 0x14, 0x30, 0xD2, 0xAA,   // 0x05D0 (1488)
+0x9C, 0x96, 0xC8, 0xCF, 0x8F, 0x5B, 0x82, 0x4F, 0xF5, 0x73, 0x23, 0x8F, 0xF6, 0x58, 0x1A, 0x71,   // 0x05E0 (1504)
+0xD6, 0x10, 0x0C, 0xB3, 0xED, 0x1E, 0xA4, 0xD7, 0x0B, 0xE3, 0xFF, 0x00, 0x0D, 0x69, 0xDA, 0x1C,   // 0x05F0 (1520)
+0xA6, 0xFF, 0x00, 0xC3, 0x77, 0xD2, 0x44, 0x14, 0x6E, 0x31, 0x99, 0x33, 0x8F, 0x6F, 0x71, 0x58,   // 0x0600 (1536)
+0x1A, 0x1A, 0xDD, 0xF8, 0xB7, 0x56, 0x11, 0xEA, 0x77, 0x7F, 0x66, 0xB5, 0x8F, 0x68, 0x64, 0x56,   // 0x0610 (1552)
+0xE3, 0xDC, 0xD7, 0x9D, 0x0E, 0x2A, 0xC1, 0x4B, 0x0D, 0x52, 0xBB, 0xBF, 0xB8, 0xD2, 0x6B, 0x7D,   // 0x0620 (1568)
+0x5E, 0xD6, 0x7B, 0x6B, 0xF2, 0x3A, 0x9E, 0x59, 0x57, 0x9E, 0x31, 0x5F, 0x6B, 0x5F, 0xB8, 0xE8,   // 0x0630 (1584)
+0xBE, 0x38, 0x6A, 0x30, 0xEA, 0x5F, 0x09, 0x3C, 0x4D, 0x63, 0x6F, 0x34, 0x53, 0x4B, 0x35, 0x83,   // 0x0640 (1600)
+0xA2, 0x20, 0x70, 0x49, 0x63, 0x8C, 0x7E, 0xB8, 0xAE, 0xFB, 0xE0, 0xD7, 0xC3, 0x0D, 0x2B, 0x48,   // 0x0650 (1616)
+0xF8, 0x1D, 0xE1, 0x9F, 0x08, 0xF8, 0xA3, 0x46, 0xB2, 0xBE, 0x9A, 0xDE, 0xD3, 0xCC, 0xB9, 0x8A,   // 0x0660 (1632)
+0xE2, 0x20, 0xFB, 0x25, 0x94, 0xB3, 0xBA, 0xF3, 0xE8, 0x5C, 0x8F, 0xC2, 0xA3, 0xD3, 0xFC, 0x13,   // 0x0670 (1648)
+0xE0, 0x1B, 0x78, 0xE1, 0x29, 0x09, 0x69, 0xE1, 0x75, 0x91, 0x27, 0x69, 0xB2, 0xC1, 0xD4, 0x82,   // 0x0680 (1664)
+0xAD, 0x8E, 0x9C, 0x10, 0x0F, 0x4A, 0xEA, 0xB4, 0x3F, 0x18, 0xE9, 0x9F, 0x68, 0x93, 0x4C, 0xD5,   // 0x0690 (1680)
+0x35, 0x3B, 0x75, 0xBC, 0x8A, 0x4D, 0x91, 0xBB, 0x10, 0xA2, 0x65, 0xEC, 0xDE, 0x80, 0xF6, 0x3F,   // 0x06A0 (1696)
+0x4A, 0xE9, 0xC1, 0x67, 0xB8, 0x6C, 0x65, 0x55, 0x41, 0x5B, 0x99, 0xEA, 0xB5, 0xBE, 0xDF, 0x77,   // 0x06B0 (1712)
+0xF9, 0x79, 0x99, 0x4F, 0x0D, 0x52, 0x8A, 0x73, 0x8B, 0x7A, 0x7C, 0xB7, 0x3A, 0x4B, 0x2B, 0x1B,   // 0x06C0 (1728)
+0x3B, 0x2B, 0x38, 0x2C, 0xED, 0x2D, 0x61, 0x86, 0xDE, 0x08, 0xD6, 0x28, 0xA3, 0x44, 0x01, 0x51,   // 0x06D0 (1744)
+0x14, 0x60, 0x28, 0x1E, 0x80, 0x00, 0x28, 0xAB, 0x00, 0x82, 0x32, 0x0E, 0x41, 0xA2, 0xBD, 0xC3,   // 0x06E0 (1760)
+0x88, 0xC1, 0xF1, 0x27, 0x84, 0x3C, 0x3F, 0xE2, 0x09, 0x04, 0xBA, 0x9D, 0x82, 0x4B, 0x30, 0x18,   // 0x06F0 (1776)
+0xF3, 0x41, 0xC3, 0x63, 0xEB, 0x5C, 0xAE, 0xA9, 0xF0, 0xC3, 0xC3, 0xB0, 0xA9, 0x68, 0x6E, 0x35,   // 0x0700 (1792)
+0x48, 0xBD, 0x96, 0xEB, 0x8F, 0xE5, 0x45, 0x15, 0x13, 0xA5, 0x09, 0xFC, 0x49, 0x3F, 0x52, 0xA3,   // 0x0710 (1808)
+0x39, 0x47, 0x66, 0x73, 0x17, 0xBF, 0x0F, 0xF4, 0x7F, 0x98, 0x35, 0xDE, 0xA6, 0xC3, 0x3D, 0x1A,   // 0x0720 (1824)
+0x70, 0x7F, 0xF6, 0x5A, 0xAF, 0x6D, 0xF0, 0xFF, 0x00, 0x45, 0x57, 0xF9, 0x2E, 0x35, 0x04, 0xCF,   // 0x0730 (1840)
+0xF7, 0x66, 0x03, 0xFF, 0x00, 0x65, 0xA2, 0x8A, 0x4A, 0x85, 0x24, 0x9C, 0x54, 0x55, 0xBD, 0x07,   // 0x0740 (1856)
+0xED, 0x24, 0xDD, 0xEE, 0x74, 0x5A, 0x57, 0xC3, 0x5D, 0x0A, 0x62, 0xA2, 0x4B, 0xCD, 0x59, 0x81,   // 0x0750 (1872)
+0xE3, 0x1F, 0x6A, 0xFF, 0x00, 0xEB, 0x57, 0x4D, 0xA6, 0xFC, 0x37, 0xF0, 0x9D, 0x94, 0xEB, 0x38,   // 0x0760 (1888)
+0xB0, 0x7B, 0x89, 0x53, 0xA3, 0x5C, 0x48, 0x5F, 0x14, 0x51, 0x4E, 0x34, 0x69, 0xC1, 0xDE, 0x31,   // 0x0770 (1904)
+0x49, 0xFA, 0x03, 0x9C, 0xA5, 0xA3, 0x67, 0x5E, 0xA0, 0x28, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x45,   // 0x0780 (1920)
+0x14, 0x55, 0x90, 0x7F, 0xFF, 0xD9   // 0x0786 (1926)
+};
@@ -0,0 +1,102 @@
+// Generated from: tux_50_ad.h
+// Dimensions    : 50x52 pixels
+// Format        : RLE565, see lcd7735_drawRLE565()
+// Size          : 3,026 Bytes
+
+const unsigned short tux_50_rle[0x5E9] ={
+0x0032, 0x0034, 0x80AA, 0xFFFF, 0x000B, 0xF7BE, 0xEE59, 0xED55, 0xE451, 0xE410, 0xE430, 0xDC31, 0xE4F3, 0xE5B7, 0xEEFC, 0xF7FF,   // 0x0010 (16)
+0x8025, 0xFFFF, 0x000F, 0xF73D, 0xE4D3, 0xE36D, 0xEB4D, 0xF3EF, 0xF492, 0xFD34, 0xFD75, 0xF555, 0xF514, 0xEC71, 0xE3EF, 0xDC30,   // 0x0020 (32)
+0xE5F7, 0xF7DF, 0x8022, 0xFFFF, 0x0011, 0xE555, 0xE249, 0xE9C7, 0xF228, 0xF249, 0xF28A, 0xF32C, 0xF430, 0xFD14, 0xFDF7, 0xFE59,   // 0x0030 (48)
+0xFE79, 0xFE59, 0xFD96, 0xE410, 0xD410, 0xE6DB, 0x801F, 0xFFFF, 0x0005, 0xFFDF, 0xE38E, 0xE041, 0xF020, 0xF020, 0x8004, 0xE800,   // 0x0040 (64)
+0x000C, 0xE820, 0xF0C3, 0xF208, 0xF3EF, 0xFD96, 0xFE18, 0xFE79, 0xFE9A, 0xF534, 0xDB8E, 0xDDF7, 0xF7FF, 0x801C, 0xFFFF, 0x0004,   // 0x0050 (80)
+0xF77E, 0xE2AA, 0xE800, 0xF000, 0x8004, 0xE800, 0x0002, 0xE820, 0xE820, 0x8003, 0xE800, 0x000A, 0xE841, 0xF1C7, 0xF471, 0xFDB6,   // 0x0060 (96)
+0xFDF7, 0xFE79, 0xFDD7, 0xE38E, 0xD596, 0xF7DF, 0x8018, 0xFFFF, 0x000C, 0xFEDB, 0xFF1C, 0xFF9E, 0xECD3, 0xF228, 0xF2CB, 0xF34D,   // 0x0070 (112)
+0xF38E, 0xF3CF, 0xF3EF, 0xF410, 0xF430, 0x8004, 0xF451, 0x000B, 0xF430, 0xF3CF, 0xF451, 0xFD55, 0xFDD7, 0xFDD7, 0xFDF7, 0xFD75,   // 0x0080 (128)
+0xDBAE, 0xDE38, 0xF7BE, 0x8017, 0xFFFF, 0x000C, 0xF410, 0xF38E, 0xF410, 0xF2EB, 0xF2CB, 0xF28A, 0xF249, 0xF1E7, 0xF1A6, 0xF186,   // 0x0090 (144)
+0xF165, 0xF145, 0x8004, 0xF124, 0x8003, 0xF145, 0x0008, 0xF165, 0xF2CB, 0xFC92, 0xFCD3, 0xFD14, 0xFCF3, 0xF3CF, 0xEDD7, 0x8015,   // 0x00A0 (160)
+0xFFFF, 0x0005, 0xFF7D, 0xFF1C, 0xF2EB, 0xF228, 0xF0A2, 0x8012, 0xE800, 0x0007, 0xF1C7, 0xF32C, 0xF36D, 0xF3AE, 0xF228, 0xEA8A,   // 0x00B0 (176)
+0xEF1C, 0x8013, 0xFFFF, 0x0006, 0xFF7D, 0xF38E, 0xF1A6, 0xE841, 0xF1E7, 0xF1A6, 0x8009, 0xE800, 0x8006, 0xF000, 0x8003, 0xE800,   // 0x00C0 (192)
+0x0008, 0xE820, 0xF228, 0xF2EB, 0xF30C, 0xF2EB, 0xF0E3, 0xE4D3, 0xF7FF, 0x8013, 0xFFFF, 0x0005, 0xFF5D, 0xFDF7, 0xF145, 0xE800,   // 0x00D0 (208)
+0xF061, 0x8009, 0xF000, 0x0001, 0xE800, 0x8009, 0xF000, 0x0007, 0xF8A2, 0xFA08, 0xF249, 0xF2AA, 0xF165, 0xE228, 0xEF3C, 0x8015,   // 0x00E0 (224)
+0xFFFF, 0x001D, 0xF28A, 0xF800, 0xF800, 0xF000, 0xE000, 0xD040, 0xC8C3, 0xC124, 0xC1A6, 0xC228, 0xC2AA, 0xC2EB, 0xC30C, 0x89A6,   // 0x00F0 (240)
+0x6061, 0x70C3, 0x8965, 0xA1E7, 0xBA08, 0xD249, 0xD1C7, 0xC8E3, 0xC000, 0xD820, 0xE861, 0xF0C3, 0xF8C3, 0xF082, 0xE638, 0x8015,   // 0x0100 (256)
+0xFFFF, 0x001D, 0xDB4D, 0x9800, 0x7000, 0x4800, 0x3041, 0x6AEB, 0x9471, 0xA514, 0xAD96, 0xB5F7, 0xC679, 0xD6FB, 0xCEBA, 0x84B2,   // 0x0110 (272)
+0x21A6, 0x530B, 0x8CB2, 0x9514, 0x9D34, 0xBE38, 0xCEBA, 0xBDF7, 0x736D, 0x30C2, 0x4020, 0x5800, 0x8000, 0xB145, 0xE69A, 0x8015,   // 0x0120 (288)
+0xFFFF, 0x0001, 0x9D14, 0x8003, 0x0000, 0x0019, 0x08C2, 0x94D2, 0xBDF8, 0xCE7A, 0xD6BA, 0xD6BA, 0xDEDB, 0xCE79, 0x9CF3, 0x9CF3,   // 0x0130 (304)
+0x4228, 0x73AE, 0xA514, 0xC638, 0xCE59, 0xCE59, 0xE73D, 0xEF9E, 0xD6FB, 0x4ACA, 0x0021, 0x0000, 0x0000, 0x4AAB, 0xF79E, 0x8015,   // 0x0140 (320)
+0xFFFF, 0x0001, 0x8451, 0x8003, 0x0000, 0x0019, 0x18E3, 0xAD55, 0xCE79, 0xDEBB, 0xDEDB, 0xDEDB, 0xE6FC, 0x73AE, 0x18E3, 0x4228,   // 0x0150 (336)
+0x18C2, 0x4A49, 0x630C, 0xC5F8, 0xD69A, 0xD67A, 0xDEDB, 0xEF5D, 0xEF5D, 0x8C71, 0x0020, 0x0000, 0x0000, 0x3A08, 0xF7BF, 0x8015,   // 0x0160 (352)
+0xFFFF, 0x0001, 0x6B8E, 0x8003, 0x0000, 0x0003, 0x18E3, 0xAD75, 0xD69A, 0x8003, 0xDEDB, 0x0013, 0xE6FC, 0x6B4D, 0x0000, 0x0000,   // 0x0170 (368)
+0x0841, 0x0000, 0x0861, 0xB596, 0xD6BA, 0xD69A, 0xD69A, 0xE6FC, 0xDEFB, 0x8C71, 0x0020, 0x0000, 0x0000, 0x2986, 0xEF7E, 0x8015,   // 0x0180 (384)
+0xFFFF, 0x0001, 0x4A8A, 0x8003, 0x0000, 0x0014, 0x10A2, 0xA534, 0xD69A, 0xDEFB, 0xDEDB, 0xDEDB, 0xE6FC, 0x9CD3, 0x4229, 0x18E4,   // 0x0190 (400)
+0x10A3, 0x31A7, 0x39E8, 0xBDD7, 0xD67A, 0xD67A, 0xCE59, 0xCE79, 0xCE59, 0x738D, 0x8003, 0x0000, 0x0002, 0x10C3, 0xDEFC, 0x8014,   // 0x01A0 (416)
+0xFFFF, 0x0002, 0xF7BE, 0x2986, 0x8003, 0x0000, 0x0014, 0x0020, 0x7C0F, 0xCE79, 0xDEDB, 0xE71C, 0xDEFC, 0xDEDC, 0xC617, 0x942E,   // 0x01B0 (432)
+0x8389, 0x62A5, 0x83AA, 0xA4B0, 0xBDD7, 0xC639, 0xCE59, 0xC618, 0xC638, 0xA534, 0x3186, 0x8003, 0x0000, 0x0002, 0x0021, 0xC639,   // 0x01C0 (448)
+0x8014, 0xFFFF, 0x0002, 0xD6BB, 0x10C3, 0x8004, 0x0000, 0x0013, 0x3A07, 0xB5D6, 0xD6BA, 0xE6FC, 0xDEDB, 0xD5F2, 0xDDAB, 0xEE2D,   // 0x01D0 (464)
+0xF6D1, 0xF734, 0xF735, 0xEED4, 0xD611, 0xBDB4, 0xB5B6, 0xAD55, 0x8C50, 0x3A07, 0x0020, 0x8003, 0x0000, 0x0002, 0x0020, 0x94F4,   // 0x01E0 (480)
+0x8014, 0xFFFF, 0x0002, 0xA575, 0x0081, 0x8004, 0x0000, 0x0011, 0x0840, 0x52CA, 0xBDD7, 0xD69A, 0xDE14, 0xE545, 0xEDA1, 0xF644,   // 0x01F0 (496)
+0xFEEA, 0xFF92, 0xFFD8, 0xFFFB, 0xFFDB, 0xC58E, 0x9491, 0x7BEF, 0x2104, 0x8006, 0x0000, 0x0001, 0x52CB, 0x8013, 0xFFFF, 0x0003,   // 0x0200 (512)
+0xFFDF, 0x73EF, 0x10C2, 0x8005, 0x0000, 0x0011, 0x634C, 0xAD74, 0xA554, 0xACCF, 0xDD46, 0xEDA0, 0xF600, 0xF660, 0xF6E3, 0xFF8E,   // 0x0210 (528)
+0xFFB6, 0xF735, 0xCDB0, 0xBDD7, 0xC638, 0xA534, 0x3185, 0x8004, 0x0000, 0x0003, 0x0020, 0x31A6, 0xBE17, 0x8012, 0xFFFF, 0x0003,   // 0x0220 (544)
+0xAD95, 0x8430, 0x1924, 0x8004, 0x0000, 0x0013, 0x7BEF, 0xF77D, 0xE71C, 0xBDF7, 0xA514, 0xB4CC, 0xE565, 0xEDE0, 0xF660, 0xF6C0,   // 0x0230 (560)
+0xEEE2, 0xEEEE, 0xD5EE, 0xD699, 0xEF7D, 0xF79E, 0xFFDF, 0xDEDB, 0x39E7, 0x8003, 0x0000, 0x0004, 0x0020, 0x5AEB, 0x7C0F, 0xDF1B,   // 0x0240 (576)
+0x8010, 0xFFFF, 0x0004, 0xC638, 0x8C71, 0x9492, 0x0881, 0x8003, 0x0000, 0x000F, 0x6B4C, 0xF7BE, 0xF7BE, 0xF79E, 0xEF5D, 0xDEFB,   // 0x0250 (592)
+0xBDD7, 0xC52D, 0xE585, 0xEE20, 0xEE80, 0xE600, 0xD588, 0xCE37, 0xEF7E, 0x8003, 0xF7BE, 0x0003, 0xFFFF, 0xD6BA, 0x2945, 0x8003,   // 0x0260 (608)
+0x0000, 0x0004, 0x4A49, 0xA514, 0x7C0F, 0xEF7D, 0x800E, 0xFFFF, 0x000A, 0xC638, 0x8450, 0x9CD3, 0x2965, 0x0020, 0x0000, 0x0000,   // 0x0270 (624)
+0x39C6, 0xE73C, 0xF7BE, 0x8003, 0xF79E, 0x0009, 0xF77D, 0xE73C, 0xC618, 0xC54D, 0xE5A4, 0xE5C0, 0xD544, 0xC5F4, 0xE71D, 0x8005,   // 0x0280 (640)
+0xF79E, 0x000B, 0xFFDF, 0xB595, 0x0841, 0x0000, 0x0000, 0x0041, 0x6B6D, 0x94B2, 0x7C0F, 0xE69A, 0xFF5D, 0x800B, 0xFFFF, 0x000A,   // 0x0290 (656)
+0xAD96, 0x8430, 0x8C71, 0x2965, 0x0000, 0x0020, 0x0000, 0x0841, 0xB5B6, 0xF7BE, 0x8006, 0xEF7D, 0x0007, 0xDEFC, 0xC618, 0xC56F,   // 0x02A0 (672)
+0xCD4A, 0xC5D3, 0xDEDB, 0xEF5D, 0x8006, 0xEF7D, 0x000B, 0xF7BE, 0x632C, 0x0000, 0x0000, 0x0020, 0x0020, 0x6B4D, 0x8C71, 0xCB0B,   // 0x02B0 (688)
+0xFCB2, 0xFE59, 0x8008, 0xFFFF, 0x000B, 0xEF7D, 0x94D2, 0x8430, 0x7BEF, 0x2104, 0x0000, 0x0020, 0x0020, 0x0000, 0x5ACA, 0xEF7D,   // 0x02C0 (704)
+0x8007, 0xEF5D, 0x0006, 0xE73C, 0xDEDB, 0xC639, 0xC618, 0xD6BB, 0xE73C, 0x8007, 0xEF5D, 0x000C, 0xEF7D, 0xCE59, 0x18C3, 0x0000,   // 0x02D0 (720)
+0x0020, 0x0000, 0x0000, 0x52AA, 0xCA49, 0xFCD3, 0xFD75, 0xFD75, 0x8006, 0xFFFF, 0x000C, 0xEF5D, 0x8471, 0x8C51, 0x630C, 0x0861,   // 0x02E0 (736)
+0x0000, 0x0000, 0x0040, 0x0000, 0x0020, 0xAD55, 0xEF7D, 0x8008, 0xE73C, 0x0004, 0xE71C, 0xDEDB, 0xD6BB, 0xE71C, 0x8009, 0xE73C,   // 0x02F0 (752)
+0x000C, 0xEF7D, 0x62EB, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x9820, 0xFAAA, 0xFE18, 0xF410, 0xFDD7, 0x8004, 0xFFFF, 0x0004,   // 0x0300 (768)
+0xF79E, 0x8450, 0x8430, 0x4A69, 0x8003, 0x0000, 0x0006, 0x0020, 0x0020, 0x0000, 0x2945, 0xD69A, 0xE73C, 0x8015, 0xE71C, 0x000C,   // 0x0310 (784)
+0xEF5D, 0xA513, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0xB800, 0xFB2C, 0xF410, 0xF36D, 0xE471, 0x8004, 0xFFFF, 0x0003, 0x94B2,   // 0x0320 (800)
+0x73AE, 0x4A49, 0x8003, 0x0000, 0x0005, 0x0041, 0x0020, 0x0000, 0x0000, 0x630B, 0x8017, 0xDEFB, 0x0017, 0xE71C, 0xCE59, 0x2104,   // 0x0330 (816)
+0x0000, 0x0020, 0x0040, 0x4041, 0xE061, 0xFC10, 0xF2EB, 0xF249, 0x9249, 0xC679, 0xFFFF, 0xFFFF, 0xD6BA, 0x5AEB, 0x4228, 0x0000,   // 0x0340 (832)
+0x0041, 0x52AA, 0xAD75, 0x4ACB, 0x8003, 0x0000, 0x0002, 0x8C71, 0xDEFB, 0x8017, 0xDEDB, 0x001A, 0xDEBA, 0x4A48, 0x0000, 0x0000,   // 0x0350 (848)
+0x0062, 0xB3CF, 0xF9C7, 0xF3EF, 0xF186, 0xE9A6, 0x7A29, 0x63AE, 0xFFDF, 0xFFFF, 0x9D13, 0x2124, 0x0882, 0x4A8A, 0xBE18, 0xFFFF,   // 0x0360 (864)
+0xFFFF, 0x73F0, 0x0000, 0x0000, 0x1061, 0xA534, 0x8019, 0xD6BA, 0x0010, 0x6B4C, 0x0000, 0x0000, 0x0862, 0xD69A, 0xFEBA, 0xF492,   // 0x0370 (880)
+0xF124, 0xC924, 0x3945, 0x4269, 0xEF9D, 0xFFFF, 0xDF1B, 0x8430, 0xB5D6, 0x8004, 0xFFFF, 0x0005, 0x9D14, 0x0000, 0x0000, 0x2924,   // 0x0380 (896)
+0xB5B6, 0x8019, 0xD69A, 0x000B, 0x7BEF, 0x0000, 0x0000, 0x1904, 0xE73D, 0xFFFF, 0xFFFF, 0xFE9A, 0xEE38, 0xB5B6, 0xC638, 0x8009,   // 0x0390 (912)
+0xFFFF, 0x0005, 0xC639, 0x0861, 0x0000, 0x3185, 0xBDD7, 0x8019, 0xCE79, 0x0005, 0x8410, 0x0000, 0x0000, 0x3A08, 0xF7BF, 0x800F,   // 0x03A0 (928)
+0xFFFF, 0x0006, 0xEF7E, 0x2145, 0x0000, 0x3186, 0xB5B6, 0xC638, 0x8018, 0xCE59, 0x0004, 0x8410, 0x0000, 0x0000, 0x73CF, 0x8011,   // 0x03B0 (944)
+0xFFFF, 0x0007, 0x636E, 0x0020, 0x2965, 0xB5B6, 0xC618, 0xC638, 0xC618, 0x8003, 0xC638, 0x0001, 0xC618, 0x8011, 0xC638, 0x0005,   // 0x03C0 (960)
+0xC618, 0x7BEF, 0x0000, 0x0020, 0xBE18, 0x8011, 0xFFFF, 0x000A, 0xBDF8, 0x2145, 0x4228, 0xAD75, 0xBDF7, 0xC617, 0xBDF7, 0xBE17,   // 0x03D0 (976)
+0xC617, 0xC618, 0x800B, 0xBDF7, 0x8007, 0xC618, 0x0005, 0xBDF7, 0x7BCF, 0x1082, 0x4249, 0xF79E, 0x8011, 0xFFFF, 0x0004, 0xFFDF,   // 0x03E0 (992)
+0x5B0C, 0x4228, 0xAD34, 0x8018, 0xBDD7, 0x0004, 0xBDF7, 0x840F, 0x2986, 0xA555, 0x8013, 0xFFFF, 0x0005, 0xC639, 0x39E7, 0x8C51,   // 0x03F0 (1008)
+0xA535, 0x94D4, 0x8003, 0x94B3, 0x0004, 0x9CF4, 0xA534, 0xAD75, 0xB596, 0x8007, 0xB5B6, 0x000C, 0xB596, 0xAD55, 0xA514, 0x9CD3,   // 0x0400 (1024)
+0x94B3, 0x94B3, 0x94D3, 0x9CF4, 0xA535, 0x632C, 0x52CB, 0xF79E, 0x8014, 0xFFFF, 0x000D, 0x8452, 0x5289, 0x83EC, 0x8BAA, 0x8BA9,   // 0x0410 (1040)
+0x8BA9, 0x83AB, 0x7BAD, 0x7BF0, 0x8431, 0x94B2, 0xAD55, 0xB596, 0x8003, 0xB5B6, 0x000D, 0xAD75, 0x9CF3, 0x8C72, 0x7C10, 0x73AF,   // 0x0420 (1056)
+0x7BAD, 0x83AB, 0x8BA9, 0x8BA9, 0x8BCA, 0x83CC, 0x4249, 0xC67A, 0x8014, 0xFFFF, 0x001F, 0xFF7B, 0xD5AD, 0xABC2, 0xC463, 0xC462,   // 0x0430 (1072)
+0xC440, 0xBC00, 0xB3C0, 0xABA1, 0x9B85, 0x838A, 0x73AE, 0x8410, 0x9CF3, 0xAD75, 0xB596, 0xAD55, 0x9492, 0x7BCF, 0x738D, 0x8368,   // 0x0440 (1088)
+0x9B84, 0xABA1, 0xB3E0, 0xBC20, 0xC461, 0xC482, 0xBC22, 0xB403, 0xEE71, 0xFFBD, 0x8012, 0xFFFF, 0x0021, 0xF692, 0xE567, 0xE5EC,   // 0x0450 (1104)
+0xF6D4, 0xEF17, 0xEF18, 0xEED5, 0xE64F, 0xD565, 0xCC80, 0xC420, 0xB3C0, 0x9385, 0x738C, 0x7BF0, 0x9CD3, 0xA534, 0x8C51, 0x738E,   // 0x0460 (1120)
+0x734B, 0x9B83, 0xB3E0, 0xC440, 0xD4E1, 0xDDCA, 0xE6B3, 0xEF17, 0xEF18, 0xEF16, 0xEE91, 0xE567, 0xE566, 0xF717, 0x8010, 0xFFFF,   // 0x0470 (1136)
+0x0023, 0xF691, 0xED66, 0xF6F4, 0xFFBA, 0xFFDB, 0xFFDA, 0xFFDA, 0xFFDB, 0xFFBB, 0xF777, 0xEE49, 0xDD40, 0xCC80, 0xBBE0, 0x9B83,   // 0x0480 (1152)
+0x736D, 0x7BF0, 0x8C51, 0x73AE, 0x734A, 0xA381, 0xC420, 0xD4C0, 0xE5A2, 0xEEF2, 0xF7BA, 0xFFDB, 0xFFDA, 0xFFDA, 0xFFDB, 0xFFDB,   // 0x0490 (1168)
+0xFF99, 0xEE4C, 0xED22, 0xF716, 0x800E, 0xFFFF, 0x0004, 0xFF59, 0xED43, 0xF6D0, 0xFFB6, 0x8003, 0xFFB5, 0x8003, 0xFF95, 0x0012,   // 0x04A0 (1184)
+0xFF96, 0xFF74, 0xEE44, 0xE560, 0xCCA0, 0xBBE0, 0x9386, 0x6B6D, 0x6B6D, 0x6B4D, 0x9363, 0xC400, 0xD4E0, 0xEDA0, 0xF6ED, 0xFF96,   // 0x04B0 (1200)
+0xFF95, 0xFF95, 0x8003, 0xFFB5, 0x0006, 0xFFD5, 0xFFD5, 0xFFB6, 0xF607, 0xED64, 0xFFBD, 0x800B, 0xFFFF, 0x0006, 0xF7DF, 0xF79E,   // 0x04C0 (1216)
+0xE5EB, 0xED82, 0xF750, 0xF7B0, 0x8003, 0xFF90, 0x0020, 0xFF70, 0xFF70, 0xFF50, 0xFF50, 0xFF51, 0xF6A6, 0xF5E0, 0xDD40, 0xC440,   // 0x04D0 (1232)
+0xABA1, 0x736C, 0x634D, 0x7349, 0xB3C0, 0xCCA0, 0xED80, 0xF620, 0xFF0E, 0xFF51, 0xFF50, 0xFF70, 0xFF70, 0xFF90, 0xFFB0, 0xF7B0,   // 0x04E0 (1248)
+0xF7D0, 0xF7D1, 0xF6CA, 0xED00, 0xEE93, 0xF7BF, 0xFFDF, 0x8006, 0xFFFF, 0x002E, 0xFFDF, 0xEF5D, 0xD6BA, 0xC618, 0xB595, 0xDCE3,   // 0x04F0 (1264)
+0xED80, 0xF709, 0xF76C, 0xF74B, 0xF74B, 0xF72C, 0xF72C, 0xF70C, 0xF70C, 0xFEEC, 0xFEEB, 0xF642, 0xF5E0, 0xE560, 0xCC60, 0xB3C0,   // 0x0500 (1280)
+0x83CC, 0x7BF0, 0x8B88, 0xBBE0, 0xD4E0, 0xEDA0, 0xF600, 0xF688, 0xFEEC, 0xF70C, 0xF70C, 0xF72C, 0xF74C, 0xF74B, 0xF76B, 0xF78B,   // 0x0510 (1296)
+0xF78C, 0xEEA5, 0xED40, 0xC52C, 0xBDD8, 0xCE59, 0xDEFB, 0xF79E, 0x8004, 0xFFFF, 0x0009, 0xD6BA, 0xAD75, 0x94B2, 0x8C51, 0x8430,   // 0x0520 (1312)
+0xBC86, 0xF520, 0xF5C1, 0xF645, 0x8003, 0xF646, 0x8003, 0xF626, 0x0012, 0xF606, 0xF5C2, 0xF560, 0xF540, 0xE4E0, 0xCC40, 0xABC1,   // 0x0530 (1328)
+0x7BCD, 0x73D0, 0x7B8A, 0xB3C0, 0xD480, 0xED20, 0xF560, 0xF580, 0xF605, 0xF626, 0xF626, 0x8003, 0xF646, 0x000B, 0xF666, 0xF666,   // 0x0540 (1344)
+0xF643, 0xF5A0, 0xED00, 0xA44A, 0x8431, 0x8C71, 0x9CF3, 0xBDF7, 0xEF7D, 0x8003, 0xFFFF, 0x000A, 0xCE59, 0x9CD3, 0x8430, 0x8410,   // 0x0550 (1360)
+0x7BF0, 0x8C0E, 0xBC66, 0xCCA3, 0xCCA4, 0xCCC5, 0x8005, 0xCCE6, 0x0011, 0xCCC5, 0xCCA3, 0xCCA4, 0xCC84, 0xBC44, 0xAC04, 0x8BEB,   // 0x0560 (1376)
+0x7BEF, 0x7BEF, 0x7BCF, 0x93C9, 0xB424, 0xC464, 0xCCA4, 0xCCA3, 0xCCA4, 0xCCC5, 0x8005, 0xCCE6, 0x000A, 0xCCC5, 0xCCA3, 0xCCA3,   // 0x0570 (1392)
+0xB467, 0x840F, 0x7BF0, 0x8410, 0x8C71, 0xAD75, 0xE73C, 0x8003, 0xFFFF, 0x000B, 0xEF7D, 0xD69A, 0xBDD7, 0xA534, 0x9CD3, 0x8C92,   // 0x0580 (1408)
+0x8451, 0x8430, 0x8410, 0x840F, 0x840F, 0x8005, 0x83EF, 0x0002, 0x7BEF, 0x83EF, 0x8003, 0x7BEF, 0x0005, 0x7BF0, 0x7BEF, 0x7BEF,   // 0x0590 (1424)
+0x7BF0, 0x7BF0, 0x8005, 0x7BEF, 0x8005, 0x83EF, 0x000B, 0x840F, 0x840F, 0x8430, 0x8C50, 0x8C72, 0x9492, 0x9CF3, 0xAD75, 0xC618,   // 0x05A0 (1440)
+0xDEFB, 0xFFDF, 0x8005, 0xFFFF, 0x0011, 0xF79E, 0xE73C, 0xDEDB, 0xCE79, 0xC638, 0xBDD7, 0xAD96, 0xA555, 0xA514, 0x9CF3, 0x9CD3,   // 0x05B0 (1456)
+0x94B2, 0x9492, 0x8C92, 0x8C72, 0x8C72, 0x8C71, 0x8009, 0x8C51, 0x0011, 0x8C71, 0x8C72, 0x8C72, 0x9492, 0x94B2, 0x94B3, 0x9CD3,   // 0x05C0 (1472)
+0x9D14, 0xA535, 0xAD75, 0xB5B6, 0xBDF8, 0xCE59, 0xD6BA, 0xE71C, 0xEF7D, 0xFFDF, 0x800D, 0xFFFF, 0x000C, 0xFFDF, 0xF7BE, 0xF79E,   // 0x05D0 (1488)
+0xEF7D, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0x8007, 0xCE79, 0x000B, 0xD69A, 0xD69A, 0xD6BA, 0xDEDB,   // 0x05E0 (1504)
+0xDEFB, 0xE71C, 0xE73C, 0xEF5D, 0xEF7D, 0xF79E, 0xFFDF, 0x800A, 0xFFFF,   // 0x05E9 (1513)
+};
@@ -0,0 +1,196 @@
+/*********************************************************************************
+aatest - host test of the ST7735 anti-aliased lines and circles
+
+Draws lines and circles with ST7735_aa.c through the real driver on the
+emulated panel of tools/host/panel.c. Every pixel has to be within one and
+a half of the 33 coverage steps of a floating point Wu reference, where the
+two pixels across the exact position share its coverage: the coverage is
+truncated to a step and the ramp color rounded to a level. Every pixel has to be sent once, drawing the
+same shape in the background color has to leave the background clean, and
+the bytes of random lines and of the gauge needles of test_gauge() are
+reported against lcd7735_drawFastLine().
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o aatest tools/aatest.c tools/host/panel.c src/ST7735.c src/ST7735_aa.c src/DefaultFonts.c -lm
+Usage:  aatest [lines]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_aa.h"
+#include "panel.h"
+
+#define FG		0xFFE0
+#define BG		0x1082
+#define PREFILL		0xF81F
+#define GREEN(c)	(((c) >> 5) & 0x3F)
+
+static double cov[PANEL_HEIGHT][PANEL_WIDTH];
+static unsigned long failures;
+
+// Coverage c of x,y in the reference, the larger one where pixels meet
+static void plot(int x, int y, double c) {
+	if (x >= 0 && x < PANEL_WIDTH && y >= 0 && y < PANEL_HEIGHT && c > cov[y][x])
+		cov[y][x] = c;
+}
+
+static void refLine(int x0, int y0, int x1, int y1) {
+	int steep = abs(y1 - y0) > abs(x1 - x0), x, t;
+	double y, g;
+
+	if (steep) {
+		t = x0; x0 = y0; y0 = t;
+		t = x1; x1 = y1; y1 = t;
+	}
+	if (x0 > x1) {
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+	g = x1 > x0 ? (double)(y1 - y0) / (x1 - x0) : 0;
+	for (x = x0; x <= x1; x++) {
+		y = y0 + (x - x0) * g;
+		if (steep) {
+			plot(floor(y), x, 1 - (y - floor(y)));
+			plot(floor(y) + 1, x, y - floor(y));
+		} else {
+			plot(x, floor(y), 1 - (y - floor(y)));
+			plot(x, floor(y) + 1, y - floor(y));
+		}
+	}
+}
+
+static void refCircle(int cx, int cy, int r) {
+	int x, sx, sy;
+	double y, f;
+
+	for (x = 0; x <= sqrt(r * r - x * x); x++) {
+		y = sqrt(r * r - x * x);
+		f = y - floor(y);
+		for (sy = -1; sy <= 1; sy += 2)
+			for (sx = -1; sx <= 1; sx += 2) {
+				plot(cx + sx * x, cy + sy * (int)floor(y), 1 - f);
+				plot(cx + sx * x, cy + sy * ((int)floor(y) + 1), f);
+				plot(cx + sy * (int)floor(y), cy + sx * x, 1 - f);
+				plot(cx + sy * ((int)floor(y) + 1), cy + sx * x, f);
+			}
+	}
+}
+
+static unsigned long missing, sent, drawn, stale;
+static double worst;
+
+// Largest difference from the reference in steps of the 33 coverage levels,
+// measured on green, the channel of the widest range. Pixels of no coverage
+// have to keep the screen, below one step they may be skipped.
+static void compare(void) {
+	double c, d;
+	int x, y;
+	uint16_t p;
+
+	for (y = 0; y < PANEL_HEIGHT; y++)
+		for (x = 0; x < PANEL_WIDTH; x++) {
+			p = panel_pixel(x, y);
+			c = cov[y][x];
+			if (p == PREFILL) {
+				missing += c * 32 >= 1;
+				continue;
+			}
+			drawn++;
+			d = fabs((double)(((p >> 5) & 0x3F) - GREEN(BG)) * 32 / (GREEN(FG) - GREEN(BG)) - c * 32);
+			if (d > worst)
+				worst = d;
+		}
+}
+
+// Pixels left by erasing that aren't the background
+static void erased(void) {
+	int x, y;
+	uint16_t p;
+
+	for (y = 0; y < PANEL_HEIGHT; y++)
+		for (x = 0; x < PANEL_WIDTH; x++) {
+			p = panel_pixel(x, y);
+			stale += p != PREFILL && p != BG;
+		}
+}
+
+static int coord(int size, int off) {
+	return off ? rand() % (size + 80) - 40 : rand() % size;
+}
+
+// Bytes of an anti-aliased line and of lcd7735_drawFastLine()
+static void bytes(int x0, int y0, int x1, int y1, unsigned long *aa, unsigned long *fast) {
+	unsigned long b = panel_bytes;
+
+	lcd7735_aa_line(x0, y0, x1, y1, FG, BG);
+	*aa += panel_bytes - b;
+	b = panel_bytes;
+	lcd7735_drawFastLine(x0, y0, x1, y1, FG);
+	*fast += panel_bytes - b;
+}
+
+static void lines(int n) {
+	unsigned long aa = 0, fast = 0;
+	int k, x0, y0, x1, y1;
+
+	for (k = 0; k < n; k++) {
+		// every other line runs off the screen
+		x0 = coord(PANEL_WIDTH, k & 1);
+		y0 = coord(PANEL_HEIGHT, k & 1);
+		x1 = coord(PANEL_WIDTH, k & 1);
+		y1 = coord(PANEL_HEIGHT, k & 1);
+		memset(cov, 0, sizeof(cov));
+		refLine(x0, y0, x1, y1);
+		lcd7735_fillScreen(PREFILL);
+		sent -= panel_pixels;
+		lcd7735_aa_line(x0, y0, x1, y1, FG, BG);
+		sent += panel_pixels;
+		compare();
+		lcd7735_aa_line(x0, y0, x1, y1, BG, BG);
+		erased();
+		if (!(k & 1))
+			bytes(x0, y0, x1, y1, &aa, &fast);
+	}
+	printf("lines    %d lines, on the screen %lu B, drawFastLine %lu B\n", n, aa, fast);
+	// the needles timed by test_gauge()
+	for (k = 0, aa = fast = 0; k < 20; k++)
+		bytes(64, 90, 64 + k * 2, 45, &aa, &fast);
+	printf("needles  %lu B, drawFastLine %lu B\n", aa, fast);
+}
+
+static void circles(void) {
+	int r, cx, cy;
+
+	for (r = 1; r <= 90; r++) {
+		cx = r % 3 == 0 ? rand() % PANEL_WIDTH : 64;
+		cy = r % 3 == 0 ? rand() % PANEL_HEIGHT : 80;
+		memset(cov, 0, sizeof(cov));
+		refCircle(cx, cy, r);
+		lcd7735_fillScreen(PREFILL);
+		sent -= panel_pixels;
+		lcd7735_aa_circle(cx, cy, r, FG, BG);
+		sent += panel_pixels;
+		compare();
+		lcd7735_aa_circle(cx, cy, r, BG, BG);
+		erased();
+	}
+	printf("circles  radius 1 to 90\n");
+}
+
+int main(int argc, char **argv) {
+	srand(1);
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(PORTRAIT);
+	lines(argc > 1 ? atoi(argv[1]) : 2000);
+	circles();
+	printf("within %.2f coverage steps of the reference, %lu covered pixels skipped, %lu of %lu sent twice, %lu left by erasing\n",
+		   worst, missing, sent - drawn, sent, stale);
+	// the coverage is truncated to a step and the ramp rounded to a level
+	if (worst > 1.5 || missing || sent != drawn || stale)
+		failures++;
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,309 @@
+/*********************************************************************************
+animtest - host test of the ST7735 animation player
+
+Plays src/spinner_32.h and random animations of raw and RLE565 rectangles with
+ST7735_anim.c through the real driver on the emulated panel of
+tools/host/panel.c, in all four rotations and at positions on the screen,
+across its edges and off it. The frames are stepped by moving the start tick
+of the player, one by one and in jumps over key frames. After every update
+the animation has to show the frame it has reached the way
+lcd7735_drawBitmap() draws the whole frame, clipped at the screen edges, and
+the rest of the screen has to be untouched. A rectangle with a corrupt RLE565
+run has to end its frame.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o animtest tools/animtest.c tools/host/panel.c src/ST7735.c src/ST7735_anim.c src/DefaultFonts.c -lm
+Usage:  animtest [animations]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_anim.h"
+#include "panel.h"
+#include "spinner_32.h"
+
+#define BG		0x1234
+#define MAX_W		48
+#define MAX_H		40
+#define MAX_FRAMES	12
+#define MAX_WORDS	32768
+#define PERIOD		100
+
+static uint16_t anim[MAX_WORDS];
+static int nwords;
+static uint16_t frames[MAX_FRAMES][MAX_H * MAX_W];	// every frame whole, row by row
+static uint16_t shots[MAX_FRAMES][MAX_H][MAX_W];	// the frames drawn by lcd7735_drawBitmap()
+static unsigned long failures;
+
+/******************** reference ********************/
+
+// Decode every frame of an animation whole, applying its rectangles in order
+static void decode(const uint16_t *a) {
+	const uint16_t *f = a + 4, *p;
+	uint16_t *img;
+	int i, n, w, h, k, j, c;
+
+	for (i = 0; i < a[2]; i++, f += f[0]) {
+		img = frames[i];
+		if (i)
+			memcpy(img, frames[i - 1], sizeof(frames[0]));
+		for (n = f[1] & ~ANIM_KEY, p = f + 2; n--; ) {
+			w = p[2] & ~ANIM_RLE;
+			h = p[3];
+			img = frames[i] + p[1] * a[0] + p[0];
+			if (p[2] & ANIM_RLE) {
+				for (k = 0, p += 4; k < w * h; k += c) {
+					c = *p & ~RLE565_RUN;
+					for (j = k; j < k + c; j++)
+						img[j / w * a[0] + j % w] = *p & RLE565_RUN ? p[1] : p[1 + j - k];
+					p += *p & RLE565_RUN ? 2 : 1 + c;
+				}
+			} else {
+				for (k = 0; k < w * h; k++)
+					img[k / w * a[0] + k % w] = p[4 + k];
+				p += 4 + w * h;
+			}
+		}
+	}
+}
+
+// Draw every frame at 0,0 with lcd7735_drawBitmap() and keep the pixels
+static void drawFrames(const uint16_t *a) {
+	int i, x, y;
+
+	decode(a);
+	for (i = 0; i < a[2]; i++) {
+		lcd7735_drawBitmap(0, 0, a[0], a[1], frames[i], 1);
+		for (y = 0; y < a[1]; y++)
+			for (x = 0; x < a[0]; x++)
+				shots[i][y][x] = panel_pixel(x, y);
+	}
+}
+
+/******************** animations ********************/
+
+static void put(uint16_t v) {
+	if (nwords < MAX_WORDS)
+		anim[nwords++] = v;
+}
+
+// Header of a rectangle, w has ANIM_RLE set for RLE565 pixels
+static void head(int x, int y, int w, int h) {
+	put(x);
+	put(y);
+	put(w);
+	put(h);
+}
+
+// Random pixels with runs of one color, as in real frames
+static void pixels(uint16_t *px, int n) {
+	uint16_t c = rand();
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (rand() % 4 == 0)
+			c = rand();
+		px[i] = c;
+	}
+}
+
+// Rectangle x,y,w,h of new pixels, raw or RLE565 with runs of 3 or more
+// pixels. Longer runs and literals are split at random to get short tokens.
+static void rect(int x, int y, int w, int h) {
+	uint16_t px[MAX_H * MAX_W];
+	int n = w * h, k, r, l;
+
+	pixels(px, n);
+	if (rand() % 3 == 0) {
+		head(x, y, w, h);
+		for (k = 0; k < n; k++)
+			put(px[k]);
+		return;
+	}
+	head(x, y, w | ANIM_RLE, h);
+	for (k = 0; k < n; ) {
+		for (r = 1; k + r < n && px[k + r] == px[k]; r++)
+			;
+		if (r >= 3) {
+			r = 1 + rand() % r;
+			put(RLE565_RUN | r);
+			put(px[k]);
+			k += r;
+			continue;
+		}
+		// a literal up to the next run of 3
+		for (l = 1, r = 1 + rand() % 20; k + l < n && l < r; l++)
+			if (k + l + 2 < n && px[k + l] == px[k + l + 1] && px[k + l] == px[k + l + 2])
+				break;
+		put(l);
+		while (l--)
+			put(px[k++]);
+	}
+}
+
+// Random animation of "count" frames w x h, every third one a key frame made of
+// bands of rectangles that cover it
+static void randomAnim(int w, int h, int count) {
+	int i, f, n, k, y, bh, x, rw, rh;
+
+	nwords = 0;
+	put(w);
+	put(h);
+	put(count);
+	put(PERIOD);
+	for (i = 0; i < count; i++) {
+		f = nwords;
+		put(0);
+		put(0);
+		n = 0;
+		if (i % 3 == 0) {
+			for (y = 0; y < h; y += bh, n++) {
+				bh = 1 + rand() % h;
+				if (bh > h - y)
+					bh = h - y;
+				rect(0, y, w, bh);
+			}
+			n |= ANIM_KEY;
+		} else {
+			for (n = 1 + rand() % 4, k = 0; k < n; k++) {
+				rw = 1 + rand() % w;
+				rh = 1 + rand() % h;
+				x = rand() % (w - rw + 1);
+				y = rand() % (h - rh + 1);
+				rect(x, y, rw, rh);
+			}
+		}
+		anim[f] = nwords - f;
+		anim[f + 1] = n;
+	}
+}
+
+/******************** tests ********************/
+
+// Pixels of the screen that differ from frame i of animation a at x,y
+static int compare(const uint16_t *a, int i, int x, int y) {
+	int sx, sy, u, v, bad = 0;
+	uint16_t want;
+
+	for (sy = 0; sy < lcd7735_getHeight(); sy++)
+		for (sx = 0; sx < lcd7735_getWidth(); sx++) {
+			u = sx - x;
+			v = sy - y;
+			want = u >= 0 && u < a[0] && v >= 0 && v < a[1] ? shots[i][v][u] : BG;
+			bad += panel_pixel(sx, sy) != want;
+		}
+	return bad;
+}
+
+// Step animation a at x,y to frame "target" and check the screen
+static int step(AnimPlayer *ap, const uint16_t *a, int target, const char *name, int rot) {
+	int bad;
+
+	ap->start = get_tick_ms() - target * a[3] - a[3] / 2;
+	lcd7735_anim_update(ap);
+	if (ap->index != target + 1 || ap->drawn + ap->dropped != ap->index) {
+		if (failures++ < 10)
+			printf("%s rotation %d at %d,%d: at frame %d of %d, %d drawn, %d dropped\n", name, rot,
+				   ap->x, ap->y, ap->index, target + 1, ap->drawn, ap->dropped);
+		return 1;
+	}
+	bad = compare(a, target, ap->x, ap->y);
+	if (bad && failures++ < 10)
+		printf("%s rotation %d at %d,%d: frame %d has %d wrong pixels\n", name, rot, ap->x, ap->y, target, bad);
+	return bad != 0;
+}
+
+// Play animation a at positions on the screen, across its edges and off it,
+// once frame by frame and once in random jumps
+static int play(const uint16_t *a, const char *name, int rot) {
+	int w = lcd7735_getWidth(), h = lcd7735_getHeight();
+	int pos[][2] = {
+		{ 3, 5 }, { w - a[0], h - a[1] }, { -5, -3 }, { w - a[0] / 2, 7 }, { 2, h - a[1] / 3 },
+		{ -a[0] + 1, h - 1 }, { -a[0] - 4, 10 }, { w + 9, h / 2 }, { 8, -a[1] }, { -600, 1000 }
+	};
+	AnimPlayer ap;
+	int p, jumps, target, bad = 0;
+
+	drawFrames(a);
+	for (p = 0; p < (int)(sizeof(pos) / sizeof(pos[0])); p++)
+		for (jumps = 0; jumps < 2; jumps++) {
+			lcd7735_fillScreen(BG);
+			lcd7735_anim_start(&ap, a, pos[p][0], pos[p][1], 0);
+			for (target = 0; target < a[2]; target += jumps ? 1 + rand() % 4 : 1)
+				bad += step(&ap, a, target, name, rot);
+			if (ap.index < a[2])
+				bad += step(&ap, a, a[2] - 1, name, rot);
+			if (lcd7735_anim_update(&ap) && failures++ < 10)
+				printf("%s rotation %d: a non looping animation doesn't end\n", name, rot);
+		}
+	return bad;
+}
+
+// A key frame of a raw rectangle, one with a corrupt RLE565 token and another
+// raw one: the frame has to end at the corrupt rectangle
+static int corrupt(uint16_t token, int rot) {
+	static const uint16_t colors[3] = { 0xF800, 0x07E0, 0x001F };
+	AnimPlayer ap;
+	uint16_t want;
+	int x, y, bad = 0;
+
+	nwords = 0;
+	put(8);
+	put(8);
+	put(1);
+	put(PERIOD);
+	put(0);
+	put(ANIM_KEY | 3);
+	head(0, 0, 8, 2);
+	for (x = 0; x < 16; x++)
+		put(colors[0]);
+	head(0, 2, 8 | ANIM_RLE, 2);
+	put(RLE565_RUN | 4);
+	put(colors[1]);
+	put(token);
+	put(colors[1]);
+	put(colors[1]);
+	head(0, 4, 8, 4);
+	for (x = 0; x < 32; x++)
+		put(colors[2]);
+	anim[4] = nwords - 4;
+
+	lcd7735_fillScreen(BG);
+	lcd7735_anim_start(&ap, anim, 10, 10, 0);
+	ap.start = get_tick_ms() - PERIOD / 2;
+	lcd7735_anim_update(&ap);
+	for (y = 0; y < 8; y++)
+		for (x = 0; x < 8; x++) {
+			// the corrupt rectangle may be drawn up to its bad token
+			want = y < 2 ? colors[0] : y < 4 && panel_pixel(10 + x, 10 + y) == colors[1] ? colors[1] : BG;
+			if (panel_pixel(10 + x, 10 + y) != want && !bad++ && failures++ < 10)
+				printf("corrupt token %04X rotation %d: pixel %d,%d is %04X, expected %04X\n",
+					   token, rot, x, y, panel_pixel(10 + x, 10 + y), want);
+		}
+	return bad;
+}
+
+int main(int argc, char **argv) {
+	int n = argc > 1 ? atoi(argv[1]) : 20, rot, k, bad;
+	char name[32];
+
+	srand(1);
+	lcd7735_initR(INITR_REDTAB);
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		bad = play(spinner_32, "spinner_32", rot);
+		for (k = 0; k < n; k++) {
+			randomAnim(1 + rand() % MAX_W, 1 + rand() % MAX_H, 1 + rand() % MAX_FRAMES);
+			sprintf(name, "random %d", k);
+			bad += play(anim, name, rot);
+		}
+		bad += corrupt(0, rot);
+		bad += corrupt(0x7FFF, rot);
+		bad += corrupt(RLE565_RUN | 100, rot);
+		printf("rotation %d  spinner and %d random animations  %s\n", rot, n, bad ? "FAILED" : "ok");
+	}
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,189 @@
+/*********************************************************************************
+blendtest - host test of the ST7735 alpha blending
+
+Checks the row kernels of ST7735_blend.c against a per-channel reference,
+every channel mixed as (s * a + d * (32 - a)) / 32 with a the alpha reduced
+to 0..32, on random rows of odd lengths and offsets. Then draws bitmaps with
+lcd7735_drawBitmapBlend() through the real driver on the emulated panel of
+tools/host/panel.c in all four rotations: an opaque blend has to give the
+pixels of lcd7735_drawBitmap(), and a blend over a background bitmap clipped
+at the screen edges the pixels of the same blend drawn whole.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o blendtest tools/blendtest.c tools/host/panel.c src/ST7735.c src/ST7735_blend.c src/DefaultFonts.c -lm
+Usage:  blendtest [rows]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_blend.h"
+#include "panel.h"
+
+#define ROW_MAX		96
+#define SX		23
+#define SY		17
+
+static unsigned long failures;
+
+// Reference: every channel of s over d, a is 0..32
+static uint16_t mix(uint16_t s, uint16_t d, int a) {
+	int r = ((s >> 11) * a + (d >> 11) * (32 - a)) >> 5;
+	int g = (((s >> 5) & 0x3F) * a + ((d >> 5) & 0x3F) * (32 - a)) >> 5;
+	int b = ((s & 0x1F) * a + (d & 0x1F) * (32 - a)) >> 5;
+
+	return r << 11 | g << 5 | b;
+}
+
+static int alpha8to5(int a) {
+	return (a + 4) >> 3;
+}
+
+static int alpha4to5(int a) {
+	return (a * 32 + 7) / 15;
+}
+
+static void fail(const char *name, int row, int i, uint16_t got, uint16_t want) {
+	if (failures++ < 10)
+		printf("%s: row %d pixel %d is %04X, expected %04X\n", name, row, i, got, want);
+}
+
+static void kernels(int rows) {
+	static uint16_t src[ROW_MAX + 1], dst[ROW_MAX + 1], want[ROW_MAX + 1];
+	static uint8_t map[ROW_MAX + 1];
+	int k, i, n, so, dof, a, first;
+	uint16_t key;
+
+	for (k = 0; k < rows; k++) {
+		n = rand() % (ROW_MAX - 1);
+		so = rand() & 1;
+		dof = rand() & 1;
+		for (i = 0; i <= ROW_MAX; i++) {
+			src[i] = rand();
+			dst[i] = rand();
+			// runs of transparent and opaque pixels as in real maps
+			map[i] = rand() % 4 == 0 ? 0 : rand() % 4 == 0 ? 255 : rand();
+		}
+
+		// global alpha
+		a = rand() & 0xFF;
+		for (i = 0; i < n; i++)
+			want[i] = mix(src[so + i], dst[dof + i], alpha8to5(a));
+		lcd7735_blend(dst + dof, src + so, n, a);
+		for (i = 0; i < n; i++)
+			if (dst[dof + i] != want[i])
+				fail("blend", k, i, dst[dof + i], want[i]);
+
+		// 8-bit map
+		for (i = 0; i < n; i++)
+			want[i] = mix(src[so + i], dst[dof + i], alpha8to5(map[so + i]));
+		lcd7735_blendAlpha8(dst + dof, src + so, map + so, n);
+		for (i = 0; i < n; i++)
+			if (dst[dof + i] != want[i])
+				fail("alpha8", k, i, dst[dof + i], want[i]);
+
+		// 4-bit map from any nibble
+		first = rand() % 8;
+		for (i = 0; i < n; i++) {
+			a = (first + i) & 1 ? map[(first + i) >> 1] & 0x0F : map[(first + i) >> 1] >> 4;
+			want[i] = mix(src[so + i], dst[dof + i], alpha4to5(a));
+		}
+		lcd7735_blendAlpha4(dst + dof, src + so, map, first, n);
+		for (i = 0; i < n; i++)
+			if (dst[dof + i] != want[i])
+				fail("alpha4", k, i, dst[dof + i], want[i]);
+
+		// color key, present in about every third pixel
+		key = src[so];
+		for (i = 0; i < n; i++) {
+			if (rand() % 3 == 0)
+				src[so + i] = key;
+			want[i] = src[so + i] == key ? dst[dof + i] : src[so + i];
+		}
+		lcd7735_blendKey(dst + dof, src + so, n, key);
+		for (i = 0; i < n; i++)
+			if (dst[dof + i] != want[i])
+				fail("key", k, i, dst[dof + i], want[i]);
+	}
+	printf("kernels   %d random rows  %s\n", rows, failures ? "FAILED" : "ok");
+}
+
+static uint16_t bmp[SY * SX], bg[(SY + 8) * (SX + 8)];
+static uint8_t map8[SY * SX];
+static uint16_t shot[PANEL_HEIGHT][PANEL_HEIGHT];
+
+static void grab(void) {
+	int x, y;
+
+	for (y = 0; y < lcd7735_getHeight(); y++)
+		for (x = 0; x < lcd7735_getWidth(); x++)
+			shot[y][x] = panel_pixel(x, y);
+}
+
+// Pixels of the image drawn at bx,by that differ from the grabbed one at ax,ay
+static int compare(int ax, int ay, int bx, int by) {
+	int x, y, w = lcd7735_getWidth(), h = lcd7735_getHeight(), bad = 0;
+
+	for (y = 0; y < SY; y++)
+		for (x = 0; x < SX; x++)
+			if (bx + x >= 0 && bx + x < w && by + y >= 0 && by + y < h)
+				bad += shot[ay + y][ax + x] != panel_pixel(bx + x, by + y);
+	return bad;
+}
+
+static void draws(void) {
+	static const int pos[][2] = { { -5, -3 }, { -1, 4 }, { 4, -6 }, { 1000, 1000 }, { 9, 1000 } };
+	Blend b;
+	int rot, i, x, y, w, h, bad, opaque;
+
+	for (i = 0; i < SX * SY; i++) {
+		bmp[i] = rand();
+		map8[i] = i % 5 == 0 ? 0 : rand();
+	}
+	for (i = 0; i < (SX + 8) * (SY + 8); i++)
+		bg[i] = rand();
+	lcd7735_initR(INITR_REDTAB);
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		w = lcd7735_getWidth();
+		h = lcd7735_getHeight();
+
+		memset(&b, 0, sizeof(b));
+		b.mode = BLEND_ALPHA;
+		b.alpha = 255;
+		lcd7735_fillScreen(0);
+		lcd7735_drawBitmap(20, 30, SX, SY, bmp, 1);
+		grab();
+		lcd7735_fillScreen(0);
+		lcd7735_drawBitmapBlend(20, 30, SX, SY, bmp, &b);
+		opaque = compare(20, 30, 20, 30);
+
+		// a map blend over a background bitmap, at the edges of the screen
+		b.mode = BLEND_ALPHA8;
+		b.map = map8;
+		b.bg = bg + 4 * (SX + 8) + 4;
+		b.bg_stride = SX + 8;
+		lcd7735_fillScreen(0);
+		lcd7735_drawBitmapBlend(20, 30, SX, SY, bmp, &b);
+		grab();
+		for (i = 0, bad = 0; i < (int)(sizeof(pos) / sizeof(pos[0])); i++) {
+			x = pos[i][0] == 1000 ? w - SX + 6 : pos[i][0];
+			y = pos[i][1] == 1000 ? h - SY + 5 : pos[i][1];
+			lcd7735_fillScreen(0);
+			lcd7735_drawBitmapBlend(x, y, SX, SY, bmp, &b);
+			bad += compare(20, 30, x, y);
+		}
+		printf("rotation %d  opaque %d, clipped %d pixels wrong  %s\n", rot, opaque, bad, opaque || bad ? "FAILED" : "ok");
+		if (opaque || bad)
+			failures++;
+	}
+}
+
+int main(int argc, char **argv) {
+	srand(1);
+	kernels(argc > 1 ? atoi(argv[1]) : 20000);
+	draws();
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
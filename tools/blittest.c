@@ -0,0 +1,275 @@
+/*********************************************************************************
+blittest - host test of the ST7735 bitmap blits
+
+Draws a bitmap of distinct random pixels through the real driver on the
+emulated panel of tools/host/panel.c in all four rotations, at positions on
+the screen and against its edges: sub-images of a wider bitmap with
+lcd7735_drawSubBitmap() and the cells of a sprite sheet with
+lcd7735_drawSprite() in all eight flip and transpose combinations, pixel
+streams into lcd7735_blitBegin() windows, lcd7735_drawBitmapRotate() at 90,
+180 and 270 degrees and lcd7735_drawBitmap() at scales 1 to 3. The screen has
+to match a reference placed pixel by pixel: flips before transposition, and
+in landscape the mirror the bitmaps have always been drawn with, except for
+the raw windows and the rotations. After every blit the driver's MADCTL has
+to be back, so a following pixel lands at its place in the panel memory.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o blittest tools/blittest.c tools/host/panel.c src/ST7735.c src/DefaultFonts.c -lm
+Usage:  blittest
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "panel.h"
+
+#define BG		0x1234
+#define MARK		0xFFFF
+#define STRIDE		29
+#define ROWS		21
+#define CELL_W		5
+#define CELL_H		7
+#define SHEET_STRIDE	17	// 3 cells and 2 pixels of padding
+
+static uint16_t img[ROWS * STRIDE];
+static uint16_t sheet[2 * CELL_H * SHEET_STRIDE];
+static uint16_t want[PANEL_HEIGHT][PANEL_HEIGHT];
+static int mark_x, mark_y;			// panel memory place of screen pixel 1,2
+static unsigned long failures;
+
+/******************** reference ********************/
+
+static void clear(void) {
+	int x, y;
+
+	lcd7735_fillScreen(BG);
+	for (y = 0; y < PANEL_HEIGHT; y++)
+		for (x = 0; x < PANEL_HEIGHT; x++)
+			want[y][x] = BG;
+}
+
+// Place pixel u,v of a w x h source at x,y with BLIT_ flags, mirrored in the
+// box it covers if "mirror" is set
+static void place(int x, int y, int w, int h, int u, int v, uint8_t flags, uint8_t mirror, uint16_t c) {
+	int dx, dy, t;
+
+	if (flags & BLIT_FLIP_H)
+		u = w - 1 - u;
+	if (flags & BLIT_FLIP_V)
+		v = h - 1 - v;
+	dx = u;
+	dy = v;
+	if (flags & BLIT_TRANSPOSE) {
+		t = dx;
+		dx = dy;
+		dy = t;
+	}
+	if (mirror)
+		dx = ((flags & BLIT_TRANSPOSE) ? h : w) - 1 - dx;
+	want[y + dy][x + dx] = c;
+}
+
+// Bitmaps are mirrored in landscape
+static uint8_t landscape(void) {
+	return lcd7735_getWidth() > lcd7735_getHeight();
+}
+
+/******************** checks ********************/
+
+// Compare the screen with the reference and check that MADCTL is restored
+static int check(const char *what, int rot, int a, int b) {
+	int x, y, bad = 0;
+
+	for (y = 0; y < lcd7735_getHeight(); y++)
+		for (x = 0; x < lcd7735_getWidth(); x++)
+			bad += panel_pixel(x, y) != want[y][x];
+	if (bad && failures++ < 10)
+		printf("%s %d,%d rotation %d: %d wrong pixels\n", what, a, b, rot, bad);
+	lcd7735_drawPixel(1, 2, MARK);
+	if (panel_mem[mark_y][mark_x] != MARK) {
+		if (failures++ < 10)
+			printf("%s %d,%d rotation %d: MADCTL not restored\n", what, a, b, rot);
+		bad++;
+	}
+	return bad != 0;
+}
+
+// Find where screen pixel 1,2 is kept in the panel memory
+static void findMark(void) {
+	int x, y;
+
+	lcd7735_fillScreen(BG);
+	lcd7735_drawPixel(1, 2, MARK);
+	for (y = 0; y < PANEL_HEIGHT; y++)
+		for (x = 0; x < PANEL_WIDTH; x++)
+			if (panel_mem[y][x] == MARK) {
+				mark_x = x;
+				mark_y = y;
+			}
+}
+
+/******************** tests ********************/
+
+// Positions of a w x h box: inside the screen and against each edge
+static int positions(int w, int h, int pos[][2]) {
+	int sw = lcd7735_getWidth(), sh = lcd7735_getHeight();
+
+	pos[0][0] = 3;		pos[0][1] = 5;
+	pos[1][0] = 0;		pos[1][1] = 0;
+	pos[2][0] = sw - w;	pos[2][1] = sh - h;
+	pos[3][0] = sw - w;	pos[3][1] = 0;
+	pos[4][0] = 0;		pos[4][1] = sh - h;
+	return 5;
+}
+
+// Sub-images of img in all flag combinations
+static int subBitmap(int rot) {
+	int pos[5][2], np, p, f, u, v, sx, sy, w, h, bad = 0;
+
+	for (f = 0; f < 8; f++) {
+		sx = 1 + rand() % 8;
+		sy = 1 + rand() % 6;
+		w = 1 + rand() % (STRIDE - sx);
+		h = 1 + rand() % (ROWS - sy);
+		np = positions(f & BLIT_TRANSPOSE ? h : w, f & BLIT_TRANSPOSE ? w : h, pos);
+		for (p = 0; p < np; p++) {
+			clear();
+			lcd7735_drawSubBitmap(pos[p][0], pos[p][1], img, STRIDE, sx, sy, w, h, f);
+			for (v = 0; v < h; v++)
+				for (u = 0; u < w; u++)
+					place(pos[p][0], pos[p][1], w, h, u, v, f, landscape(), img[(sy + v) * STRIDE + sx + u]);
+			bad += check("drawSubBitmap flags", rot, f, p);
+		}
+	}
+	return bad;
+}
+
+// Every cell of the sprite sheet in all flag combinations
+static int sprites(int rot) {
+	SpriteSheet ss = { sheet, SHEET_STRIDE, CELL_W, CELL_H };
+	int n, f, u, v, x, y, bad = 0;
+
+	for (n = 0; n < 6; n++)
+		for (f = 0; f < 8; f++) {
+			x = rand() % (lcd7735_getWidth() - CELL_H);
+			y = rand() % (lcd7735_getHeight() - CELL_H);
+			clear();
+			lcd7735_drawSprite(x, y, &ss, n, f);
+			for (v = 0; v < CELL_H; v++)
+				for (u = 0; u < CELL_W; u++)
+					place(x, y, CELL_W, CELL_H, u, v, f, landscape(),
+						  sheet[(n / 3 * CELL_H + v) * SHEET_STRIDE + n % 3 * CELL_W + u]);
+			bad += check("drawSprite cell", rot, n, f);
+		}
+	return bad;
+}
+
+// Pixel streams into raw windows, half of them as repeated colors, without the
+// landscape mirror
+static int windows(int rot) {
+	int pos[5][2], np, p, f, u, v, w, h, bad = 0;
+
+	for (f = 0; f < 8; f++) {
+		w = 1 + rand() % 40;
+		h = 1 + rand() % 20;
+		np = positions(f & BLIT_TRANSPOSE ? h : w, f & BLIT_TRANSPOSE ? w : h, pos);
+		for (p = 0; p < np; p++) {
+			clear();
+			lcd7735_blitBegin(pos[p][0], pos[p][1], w, h, f);
+			for (v = 0; v < h; v++) {
+				if (v & 1)
+					lcd7735_pushColorRepeat(img[v], w);
+				else
+					lcd7735_pushColors(img + v * STRIDE, w);
+				for (u = 0; u < w; u++)
+					place(pos[p][0], pos[p][1], w, h, u, v, f, 0, v & 1 ? img[v] : img[v * STRIDE + u]);
+			}
+			lcd7735_blitEnd();
+			bad += check("blitBegin flags", rot, f, p);
+		}
+	}
+	return bad;
+}
+
+// drawBitmapRotate() at right angles around a few centers, placed like the
+// original per-pixel code placed them, with no landscape mirror
+static int rotations(int rot) {
+	static const int centers[][2] = { { 0, 0 }, { 6, 4 }, { 13, 9 }, { 21, 2 } };
+	int deg, c, u, v, x, y, rx, ry, bad = 0;
+	const int w = 22, h = 15;
+
+	for (deg = 90; deg < 360; deg += 90)
+		for (c = 0; c < (int)(sizeof(centers) / sizeof(centers[0])); c++) {
+			rx = centers[c][0];
+			ry = centers[c][1];
+			x = 40;
+			y = 50;
+			clear();
+			lcd7735_drawBitmapRotate(x, y, w, h, img, deg, rx, ry);
+			for (v = 0; v < h; v++)
+				for (u = 0; u < w; u++) {
+					if (deg == 90)
+						want[y + ry + u - rx][x + rx - v + ry] = img[v * w + u];
+					else if (deg == 180)
+						want[y + 2 * ry - v][x + 2 * rx - u] = img[v * w + u];
+					else
+						want[y + ry - u + rx][x + rx + v - ry] = img[v * w + u];
+				}
+			bad += check("drawBitmapRotate degrees", rot, deg, c);
+		}
+	return bad;
+}
+
+// drawBitmap() at scales 1 to 3, mirrored in landscape
+static int scales(int rot) {
+	int pos[5][2], np, p, s, u, v, i, j, x, w = 17, h = 11, bad = 0;
+
+	for (s = 1; s <= 3; s++) {
+		np = positions(w * s, h * s, pos);
+		for (p = 0; p < np; p++) {
+			clear();
+			lcd7735_drawBitmap(pos[p][0], pos[p][1], w, h, img, s);
+			for (v = 0; v < h; v++)
+				for (u = 0; u < w; u++) {
+					x = landscape() ? w - 1 - u : u;
+					for (j = 0; j < s; j++)
+						for (i = 0; i < s; i++)
+							want[pos[p][1] + v * s + j][pos[p][0] + x * s + i] = img[v * w + u];
+				}
+			bad += check("drawBitmap scale", rot, s, p);
+		}
+	}
+	return bad;
+}
+
+int main(void) {
+	int i, rot, bad;
+
+	srand(1);
+	for (i = 0; i < ROWS * STRIDE; i++)
+		img[i] = rand();
+	for (i = 0; i < 2 * CELL_H * SHEET_STRIDE; i++)
+		sheet[i] = rand();
+	// no pixel may look like the background or the mark
+	for (i = 0; i < ROWS * STRIDE; i++)
+		if (img[i] == BG || img[i] == MARK)
+			img[i] ^= 1;
+	for (i = 0; i < 2 * CELL_H * SHEET_STRIDE; i++)
+		if (sheet[i] == BG || sheet[i] == MARK)
+			sheet[i] ^= 1;
+
+	lcd7735_initR(INITR_REDTAB);
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		findMark();
+		bad = subBitmap(rot);
+		bad += sprites(rot);
+		bad += windows(rot);
+		bad += rotations(rot);
+		bad += scales(rot);
+		printf("rotation %d  sub-images, sprites, windows, rotations and scales  %s\n", rot, bad ? "FAILED" : "ok");
+	}
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,178 @@
+/*********************************************************************************
+blockdev - host test bench for the ST7735 image loader
+
+Runs src/ST7735_imgload.c against a file-backed block device, through the real
+driver on the emulated panel of tools/host/panel.c, so BMP and PPM images can
+be checked without an SD card. The device is marked as sharing the panel bus
+and the bench verifies the chip select protocol: no sector is read while the
+panel is selected and no byte is sent to it while it is released. Every
+visible pixel has to be sent once. Images up to 128x128 pixels also have to
+be laid out like lcd7735_drawBitmap() draws their pixels loaded in portrait,
+clipped at the screen edges. The screen is written as a PPM image.
+
+The file is used as a raw disk image, -s selects the sector the image starts
+at (0 for a plain image file). -l selects landscape orientation, where images
+are mirrored like lcd7735_drawBitmap() draws them.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o blockdev tools/blockdev.c tools/host/panel.c src/ST7735.c src/ST7735_imgload.c src/DefaultFonts.c -lm
+Usage:  blockdev [-s sector] [-l] [-x X] [-y Y] image.bmp|image.ppm out.ppm
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_imgload.h"
+#include "panel.h"
+
+#define BG		0x1234
+#define MAX_REF		128
+
+static uint16_t bmp[MAX_REF * MAX_REF], shot[MAX_REF][MAX_REF];
+static unsigned long sectors, violations;
+
+/******************** bus accounting ********************/
+
+// Every byte sent to the panel, none may be sent while it is released
+static void hook(uint8_t dc, uint8_t b) {
+	(void)dc;
+	(void)b;
+	if (panel_released)
+		violations++;
+}
+
+/******************** file-backed block device ********************/
+
+static uint8_t file_read(void *ctx, uint32_t sector, uint8_t *buf) {
+	FILE *f = (FILE *)ctx;
+	size_t n;
+
+	if (!panel_released)
+		violations++;
+	sectors++;
+	if (fseek(f, (long)sector * IMG_SECTOR_SIZE, SEEK_SET))
+		return 1;
+	n = fread(buf, 1, IMG_SECTOR_SIZE, f);
+	if (n == 0)
+		return 1;
+	memset(buf + n, 0, IMG_SECTOR_SIZE - n);
+	return 0;
+}
+
+// Pixels of n from at on that are on a screen of size pixels
+static int visible(int at, int n, int size) {
+	int lo = at < 0 ? 0 : at, hi = at + n > size ? size : at + n;
+
+	return hi > lo ? hi - lo : 0;
+}
+
+// Load the image at 0,0 in portrait and draw its pixels with
+// lcd7735_drawBitmap() at 0,0 in orientation rot
+static int reference(BlockDevice *dev, uint32_t sector, int w, int h, uint8_t rot) {
+	int x, y, res;
+
+	lcd7735_setRotation(PORTRAIT);
+	res = lcd7735_loadImage(dev, sector, 0, 0);
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			bmp[y * w + x] = panel_pixel(x, y);
+	lcd7735_setRotation(rot);
+	lcd7735_drawBitmap(0, 0, w, h, bmp, 1);
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			shot[y][x] = panel_pixel(x, y);
+	return res;
+}
+
+// Pixels of the screen that differ from the reference moved to x,y
+static unsigned long compare(int x, int y, int w, int h) {
+	unsigned long bad = 0;
+	int sx, sy, u, v;
+
+	for (sy = 0; sy < lcd7735_getHeight(); sy++)
+		for (sx = 0; sx < lcd7735_getWidth(); sx++) {
+			u = sx - x;
+			v = sy - y;
+			bad += panel_pixel(sx, sy) != (u >= 0 && u < w && v >= 0 && v < h ? shot[v][u] : BG);
+		}
+	return bad;
+}
+
+static void usage(void) {
+	fprintf(stderr, "usage: blockdev [-s sector] [-l] [-x X] [-y Y] image out.ppm\n");
+	exit(1);
+}
+
+int main(int argc, char **argv) {
+	BlockDevice dev;
+	uint32_t sector = 0;
+	uint16_t w, h;
+	uint8_t rot = PORTRAIT;
+	unsigned long pixels, bad = 0;
+	int x = 0, y = 0, i, res, ref;
+	FILE *f;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+		if (!strcmp(argv[i], "-l")) {
+			rot = LANDSAPE;
+		} else if (i + 1 < argc && !strcmp(argv[i], "-s")) {
+			sector = strtoul(argv[++i], NULL, 0);
+		} else if (i + 1 < argc && !strcmp(argv[i], "-x")) {
+			x = atoi(argv[++i]);
+		} else if (i + 1 < argc && !strcmp(argv[i], "-y")) {
+			y = atoi(argv[++i]);
+		} else {
+			usage();
+		}
+	}
+	if (argc - i != 2)
+		usage();
+	f = fopen(argv[i], "rb");
+	if (!f) {
+		perror(argv[i]);
+		return 1;
+	}
+	dev.read = file_read;
+	dev.ctx = f;
+	dev.shared_bus = 1;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(rot);
+	panel_hook = hook;
+	res = lcd7735_imageSize(&dev, sector, &w, &h);
+	ref = res == IMG_OK && w <= MAX_REF && h <= MAX_REF;
+	if (ref)
+		res = reference(&dev, sector, w, h, rot);
+	if (res == IMG_OK) {
+		lcd7735_fillScreen(BG);
+		sectors = 0;
+		pixels = panel_pixels;
+		res = lcd7735_loadImage(&dev, sector, x, y);
+		pixels = panel_pixels - pixels;
+		if (pixels != (unsigned long)visible(x, w, lcd7735_getWidth()) * visible(y, h, lcd7735_getHeight())) {
+			fprintf(stderr, "blockdev: %lu pixels sent, %d visible\n", pixels,
+					visible(x, w, lcd7735_getWidth()) * visible(y, h, lcd7735_getHeight()));
+			violations++;
+		}
+		if (ref)
+			bad = compare(x, y, w, h);
+		if (bad)
+			violations++;
+	}
+	fclose(f);
+	if (res != IMG_OK) {
+		fprintf(stderr, "blockdev: %s: error %d\n", argv[i], res);
+		return 1;
+	}
+	if (panel_writePPM(argv[i + 1], lcd7735_getWidth(), lcd7735_getHeight())) {
+		perror(argv[i + 1]);
+		return 1;
+	}
+	fprintf(stderr, "%s: %ux%u, %lu pixels, %lu sector reads, %lu violations",
+			argv[i], w, h, pixels, sectors, violations);
+	if (ref)
+		fprintf(stderr, ", %lu pixels unlike lcd7735_drawBitmap()", bad);
+	fprintf(stderr, "\n");
+	return violations ? 2 : 0;
+}
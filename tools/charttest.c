@@ -0,0 +1,105 @@
+/*********************************************************************************
+charttest - host test of the scrolled strip chart of the ST7735 driver
+
+Runs the chart of test_chart() in src/main.c through the real driver on the
+emulated panel of tools/host/panel.c, in both landscape rotations, with fixed
+columns on both sides. After 50 and after 300 samples the image shown through
+the hardware scroll has to equal a full redraw of the same samples without
+scrolling, and the fixed columns have to keep what was drawn there before.
+The bytes sent per sample are reported against a full redraw.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o charttest tools/charttest.c tools/host/panel.c src/ST7735.c src/ST7735_chart.c src/DefaultFonts.c -lm
+Usage:  charttest
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_chart.h"
+#include "panel.h"
+
+#define TOP		20
+#define BOTTOM		40
+#define SCR_W		ST7735_TFTHEIGHT
+#define SCR_H		ST7735_TFTWIDTH
+
+static StripChart chart, full;
+static uint16_t shown[SCR_H][SCR_W], fixed[SCR_H][SCR_W];
+static uint16_t saved[PANEL_HEIGHT][PANEL_WIDTH];
+static unsigned long failures, redraw;
+
+static void grab(uint16_t img[SCR_H][SCR_W]) {
+	int x, y;
+
+	for (y = 0; y < SCR_H; y++)
+		for (x = 0; x < SCR_W; x++)
+			img[y][x] = panel_shown(x, y);
+}
+
+// The shown chart against the same samples redrawn without scrolling
+static int compare(int rot, uint32_t n) {
+	int x, y, bad = 0;
+
+	grab(shown);
+	memcpy(saved, panel_mem, sizeof(saved));
+	full = chart;
+	full.offset = 0;
+	lcd7735_scrollTo(0);
+	redraw = panel_bytes;
+	lcd7735_chart_redraw(&full);
+	redraw = panel_bytes - redraw;
+	for (y = 0; y < SCR_H; y++)
+		for (x = 0; x < SCR_W; x++)
+			if (x < TOP || x >= SCR_W - BOTTOM) {
+				if (shown[y][x] != fixed[y][x] && !bad++)
+					printf("rotation %d, %u samples: fixed pixel %d,%d is %04X, expected %04X\n",
+						   rot, n, x, y, shown[y][x], fixed[y][x]);
+			} else if (shown[y][x] != panel_shown(x, y) && !bad++) {
+				printf("rotation %d, %u samples: pixel %d,%d is %04X, expected %04X\n",
+					   rot, n, x, y, shown[y][x], panel_shown(x, y));
+			}
+	memcpy(panel_mem, saved, sizeof(saved));
+	lcd7735_scrollTo(chart.offset);
+	return bad;
+}
+
+static void run(int rot) {
+	int16_t v[2];
+	unsigned long bytes = 0;
+	uint32_t i;
+	int x, y, bad = 0;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(rot);
+	panel_reset();
+	// a pattern in the fixed columns that the chart must not touch
+	for (y = 0; y < SCR_H; y++)
+		for (x = 0; x < SCR_W; x++)
+			lcd7735_drawPixel(x, y, x * 409 ^ y * 1031);
+	grab(fixed);
+	lcd7735_chart_init(&chart, 2, -100, 100);
+	lcd7735_chart_show(&chart, TOP, BOTTOM);
+	for (i = 0; i < 300; i++) {
+		v[0] = 90 * sinf(i * 0.1f);
+		v[1] = (i * 13) % 200 - 100;
+		bytes -= panel_bytes;
+		lcd7735_chart_add(&chart, v);
+		bytes += panel_bytes;
+		if (i + 1 == 50 || i + 1 == 300)
+			bad += compare(rot, i + 1);
+	}
+	printf("rotation %d  %lu B per sample, %lu B per redraw, %d pixels wrong  %s\n",
+		   rot, bytes / 300, redraw, bad, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+int main(void) {
+	run(LANDSAPE);
+	run(LANDSAPE_FLIP);
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
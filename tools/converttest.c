@@ -0,0 +1,250 @@
+/*********************************************************************************
+converttest - host test of the ST7735 color conversion blits
+
+Checks the row conversion of ST7735_convert.c on random rows: plain RGB888 and
+XRGB8888 have to give lcd7735_Color565() of every pixel, both formats have to
+dither alike, and YUYV has to stay within one RGB565 step of a floating point
+BT.601 reference. On a gray gradient the mean error of 4x4 blocks, in levels
+of the 5-6-5 channels, is reported plain and dithered.
+
+Then lcd7735_drawBitmapRGB() runs through the real driver on the emulated
+panel of tools/host/panel.c in all four rotations: plain images have to look
+like lcd7735_drawBitmap() of the converted pixels, also when clipped at the
+screen edges and at odd columns of YUYV pairs, and a dithered image of one
+color has to show the same screen fixed pattern wherever it is drawn.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o converttest tools/converttest.c tools/host/panel.c src/ST7735.c src/ST7735_convert.c src/DefaultFonts.c -lm
+Usage:  converttest [rows]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_convert.h"
+#include "panel.h"
+
+#define ROW_MAX		64
+#define SX		22
+#define SY		13
+
+static unsigned long failures;
+
+static uint16_t color565(int r, int g, int b) {
+	return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3;
+}
+
+// Largest difference of the channels of two colors in their own steps
+static int steps(uint16_t a, uint16_t b) {
+	int r = abs((a >> 11) - (b >> 11)), g = abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F)), d = abs((a & 0x1F) - (b & 0x1F));
+
+	return r > g ? (r > d ? r : d) : (g > d ? g : d);
+}
+
+static double clampf(double v) {
+	return v < 0 ? 0 : v > 255 ? 255 : v;
+}
+
+// Reference: BT.601 with Y in 16..235, in floating point
+static uint16_t yuv565(int y, int u, int v) {
+	double c = 1.164 * (y - 16);
+
+	return color565(clampf(c + 1.596 * (v - 128)), clampf(c - 0.392 * (u - 128) - 0.813 * (v - 128)),
+					clampf(c + 2.017 * (u - 128)));
+}
+
+static void fail(const char *name, int row, int i, uint16_t got, uint16_t want) {
+	if (failures++ < 10)
+		printf("%s: row %d pixel %d is %04X, expected %04X\n", name, row, i, got, want);
+}
+
+static void rows(int nrows) {
+	static uint8_t rgb[ROW_MAX * 3], yuyv[ROW_MAX * 2];
+	static uint32_t xrgb[ROW_MAX];
+	static uint16_t a[ROW_MAX], b[ROW_MAX];
+	int k, i, n, x, y, d, worst = 0;
+
+	for (k = 0; k < nrows; k++) {
+		n = 1 + rand() % ROW_MAX;
+		x = rand() % 160;
+		y = rand() % 160;
+		for (i = 0; i < n; i++) {
+			rgb[i * 3] = rand();
+			rgb[i * 3 + 1] = rand();
+			rgb[i * 3 + 2] = rand();
+			xrgb[i] = (uint32_t)rand() << 24 | rgb[i * 3] << 16 | rgb[i * 3 + 1] << 8 | rgb[i * 3 + 2];
+			yuyv[i * 2] = 16 + rand() % 220;
+			yuyv[i * 2 + 1] = 16 + rand() % 225;
+		}
+		lcd7735_convertRow(a, rgb, n, PIXEL_RGB888, x, y);
+		lcd7735_convertRow(b, xrgb, n, PIXEL_XRGB8888, x, y);
+		for (i = 0; i < n; i++) {
+			if (a[i] != color565(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]))
+				fail("RGB888", k, i, a[i], color565(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]));
+			if (b[i] != a[i])
+				fail("XRGB8888", k, i, b[i], a[i]);
+		}
+		lcd7735_convertRow(a, rgb, n, PIXEL_RGB888 | CONVERT_DITHER, x, y);
+		lcd7735_convertRow(b, xrgb, n, PIXEL_XRGB8888 | CONVERT_DITHER, x, y);
+		for (i = 0; i < n; i++)
+			if (b[i] != a[i])
+				fail("XRGB8888 dithered", k, i, b[i], a[i]);
+		lcd7735_convertRow(a, yuyv, n, PIXEL_YUYV, x, y);
+		for (i = 0; i < n; i++) {
+			d = steps(a[i], yuv565(yuyv[i * 2], yuyv[(i | 1) * 2 - 1], yuyv[(i | 1) * 2 + 1]));
+			if (d > worst)
+				worst = d;
+		}
+	}
+	printf("rows      %d random rows, YUYV within %d steps  %s\n", nrows, worst, failures || worst > 1 ? "FAILED" : "ok");
+	if (worst > 1)
+		failures++;
+}
+
+// Mean error of the 4x4 blocks of a gray gradient in levels of the channels
+static double gradient(uint8_t format) {
+	static uint8_t img[4][256 * 3];
+	static uint16_t out[256];
+	double err = 0, got[3], want[3];
+	int x, y, i, bx;
+
+	for (y = 0; y < 4; y++)
+		for (x = 0; x < 256 * 3; x++)
+			img[y][x] = x / 3;
+	for (bx = 0; bx < 256; bx += 4) {
+		memset(got, 0, sizeof(got));
+		memset(want, 0, sizeof(want));
+		for (y = 0; y < 4; y++) {
+			lcd7735_convertRow(out, img[y] + bx * 3, 4, format, bx, y);
+			for (i = 0; i < 4; i++) {
+				got[0] += out[i] >> 11;
+				got[1] += (out[i] >> 5) & 0x3F;
+				got[2] += out[i] & 0x1F;
+				want[0] += (bx + i) * 31 / 255.0;
+				want[1] += (bx + i) * 63 / 255.0;
+				want[2] += (bx + i) * 31 / 255.0;
+			}
+		}
+		err += fabs(got[0] - want[0]) + fabs(got[1] - want[1]) + fabs(got[2] - want[2]);
+	}
+	return err / (256 / 4) / 3 / 16;
+}
+
+/******************** drawing ********************/
+
+static uint8_t rgb[SY][SX][3], yuyv[SY][SX][2];
+static uint16_t bmp[SY * SX];
+static uint16_t shot[PANEL_HEIGHT][PANEL_HEIGHT];
+
+static void grab(void) {
+	int x, y;
+
+	for (y = 0; y < lcd7735_getHeight(); y++)
+		for (x = 0; x < lcd7735_getWidth(); x++)
+			shot[y][x] = panel_pixel(x, y);
+}
+
+// Pixels of the image drawn at bx,by that differ from the grabbed one at ax,ay
+static int compare(int ax, int ay, int bx, int by) {
+	int x, y, w = lcd7735_getWidth(), h = lcd7735_getHeight(), bad = 0;
+
+	for (y = 0; y < SY; y++)
+		for (x = 0; x < SX; x++)
+			if (bx + x >= 0 && bx + x < w && by + y >= 0 && by + y < h)
+				bad += shot[ay + y][ax + x] != panel_pixel(bx + x, by + y);
+	return bad;
+}
+
+// Gradients in both formats and the RGB888 one converted to RGB565
+static void images(void) {
+	int x, y;
+
+	for (y = 0; y < SY; y++)
+		for (x = 0; x < SX; x++) {
+			rgb[y][x][0] = x * 12;
+			rgb[y][x][1] = y * 19;
+			rgb[y][x][2] = x * y * 7;
+			bmp[y * SX + x] = color565(x * 12, y * 19, (x * y * 7) & 0xFF);
+			yuyv[y][x][0] = 16 + (x * 10 + y * 3) % 220;
+			yuyv[y][x][1] = 16 + ((x / 2) * 20 + y * 9) % 224;
+		}
+}
+
+static void draws(void) {
+	static const int pos[][2] = { { -4, -4 }, { -5, 0 }, { -7, 8 }, { 0, 8 }, { 1000, 1000 }, { 1001, 3 } };
+	static const uint8_t fmts[] = { PIXEL_RGB888, PIXEL_YUYV };
+	int rot, f, i, x, y, c, w, h, bad, pattern;
+	const void *d;
+
+	lcd7735_initR(INITR_REDTAB);
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		images();
+		w = lcd7735_getWidth();
+		h = lcd7735_getHeight();
+		lcd7735_fillScreen(0);
+		lcd7735_drawBitmap(10, 10, SX, SY, bmp, 1);
+		grab();
+		lcd7735_fillScreen(0);
+		lcd7735_drawBitmapRGB(10, 10, SX, SY, rgb, 0, PIXEL_RGB888);
+		bad = compare(10, 10, 10, 10);
+
+		// clipped plain images
+		for (f = 0; f < 2; f++) {
+			d = fmts[f] == PIXEL_YUYV ? (const void *)yuyv : (const void *)rgb;
+			lcd7735_fillScreen(0);
+			lcd7735_drawBitmapRGB(8, 8, SX, SY, d, 0, fmts[f]);
+			grab();
+			for (i = 0; i < (int)(sizeof(pos) / sizeof(pos[0])); i++) {
+				x = pos[i][0] >= 1000 ? w - SX + 4 + pos[i][0] % 1000 : pos[i][0];
+				y = pos[i][1] == 1000 ? h - SY + 5 : pos[i][1];
+				lcd7735_fillScreen(0);
+				lcd7735_drawBitmapRGB(x, y, SX, SY, d, 0, fmts[f]);
+				bad += compare(8, 8, x, y);
+			}
+		}
+
+		// a dithered image of one color shows the same pattern everywhere
+		memset(rgb, 101, sizeof(rgb));
+		for (i = 0; i < SY * SX; i++) {
+			((uint8_t *)yuyv)[i * 2] = 100;
+			((uint8_t *)yuyv)[i * 2 + 1] = 140;
+		}
+		for (f = 0, pattern = 0; f < 2; f++) {
+			d = fmts[f] == PIXEL_YUYV ? (const void *)yuyv : (const void *)rgb;
+			lcd7735_fillScreen(0);
+			lcd7735_drawBitmapRGB(0, 0, SX, SY, d, 0, fmts[f] | CONVERT_DITHER);
+			grab();
+			for (i = 1; i < 6; i++) {
+				x = i < 4 ? i : i == 4 ? -3 : w - SX + 2;
+				lcd7735_fillScreen(0);
+				lcd7735_drawBitmapRGB(x, 0, SX, SY, d, 0, fmts[f] | CONVERT_DITHER);
+				for (y = 0; y < SY; y++)
+					for (c = x < 0 ? 0 : x; c < x + SX && c < w; c++)
+						pattern += panel_pixel(c, y) != shot[y][c & 3];
+			}
+		}
+		printf("rotation %d  %d pixels wrong, %d off the dither pattern  %s\n", rot, bad, pattern,
+			   bad || pattern ? "FAILED" : "ok");
+		if (bad || pattern)
+			failures++;
+	}
+}
+
+int main(int argc, char **argv) {
+	double plain, dith;
+
+	srand(1);
+	rows(argc > 1 ? atoi(argv[1]) : 20000);
+	plain = gradient(PIXEL_RGB888);
+	dith = gradient(PIXEL_RGB888 | CONVERT_DITHER);
+	printf("gradient  4x4 block error %.2f levels plain, %.2f dithered  %s\n", plain, dith,
+		   dith < plain / 2 ? "ok" : "FAILED");
+	if (dith >= plain / 2)
+		failures++;
+	draws();
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,175 @@
+/*********************************************************************************
+filltest - host test of the ST7735 gradient fills and filled shapes
+
+Fills the screen through the real driver on the emulated panel of
+tools/host/panel.c. Linear gradients at several angles and radial gradients,
+have to be within half a 5-6-5 level of a floating point reference in every
+channel, rounded, and within one level dithered. A solid circle has to cover exactly the pixels
+with x^2 + y^2 <= r^2, also when it is clipped at the screen edges. Two
+triangles that share the diagonal of a quadrilateral have to fill exactly the
+pixels of the quadrilateral, none of them twice.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o filltest tools/filltest.c tools/host/panel.c src/ST7735.c src/ST7735_fill.c src/DefaultFonts.c -lm
+Usage:  filltest [quads]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_fill.h"
+#include "panel.h"
+
+#define C0		0x1234
+#define C1		0xFBE0
+
+static unsigned long failures;
+static uint16_t first[PANEL_HEIGHT][PANEL_WIDTH];
+
+// Largest difference of the channels of c from the levels of c0..c1 at t
+static double levels(uint16_t c, double t) {
+	double r = (C0 >> 11) + t * ((C1 >> 11) - (C0 >> 11));
+	double g = ((C0 >> 5) & 0x3F) + t * (((C1 >> 5) & 0x3F) - ((C0 >> 5) & 0x3F));
+	double b = (C0 & 0x1F) + t * ((C1 & 0x1F) - (C0 & 0x1F));
+	double dr = fabs((c >> 11) - r), dg = fabs(((c >> 5) & 0x3F) - g), db = fabs((c & 0x1F) - b);
+
+	return dr > dg ? (dr > db ? dr : db) : (dg > db ? dg : db);
+}
+
+static double clamp01(double t) {
+	return t < 0 ? 0 : t > 1 ? 1 : t;
+}
+
+static void gradients(void) {
+	static const int deg[] = { 0, 30, 45, 90, 135, 200, 315 };
+	Fill f;
+	double worst[2] = { 0, 0 }, e, t, a;
+	int i, d, x, y, x1, y1;
+
+	for (d = 0; d < 2; d++) {
+		for (i = 0; i < (int)(sizeof(deg) / sizeof(deg[0])); i++) {
+			a = deg[i] * M_PI / 180;
+			x1 = 64 + (int)lround(70 * cos(a));
+			y1 = 80 + (int)lround(70 * sin(a));
+			lcd7735_fill_linear(&f, 64, 80, C0, x1, y1, C1);
+			f.type |= d ? FILL_DITHER : 0;
+			lcd7735_fill_rect(&f, 0, 0, PANEL_WIDTH, PANEL_HEIGHT);
+			for (y = 0; y < PANEL_HEIGHT; y++)
+				for (x = 0; x < PANEL_WIDTH; x++) {
+					t = ((x - 64) * (x1 - 64) + (y - 80) * (y1 - 80)) / (double)((x1 - 64) * (x1 - 64) + (y1 - 80) * (y1 - 80));
+					if ((e = levels(panel_pixel(x, y), clamp01(t))) > worst[d])
+						worst[d] = e;
+				}
+		}
+		lcd7735_fill_radial(&f, 50, 70, 60, C0, C1);
+		f.type |= d ? FILL_DITHER : 0;
+		lcd7735_fill_rect(&f, 0, 0, PANEL_WIDTH, PANEL_HEIGHT);
+		for (y = 0; y < PANEL_HEIGHT; y++)
+			for (x = 0; x < PANEL_WIDTH; x++)
+				if ((e = levels(panel_pixel(x, y), clamp01(hypot(x - 50, y - 70) / 60))) > worst[d])
+					worst[d] = e;
+	}
+	// the fixed point steps add a little to the rounding
+	d = worst[0] > 0.6 || worst[1] > 1;
+	printf("gradients  within %.2f levels of the reference, %.2f dithered  %s\n", worst[0], worst[1], d ? "FAILED" : "ok");
+	if (d)
+		failures++;
+}
+
+static void circles(void) {
+	static const int c[][3] = { { 64, 80, 0 }, { 64, 80, 1 }, { 60, 70, 17 }, { 3, 5, 30 }, { 120, 150, 45 }, { 64, 80, 90 } };
+	Fill f;
+	int i, x, y, in, bad = 0;
+
+	lcd7735_fill_solid(&f, C1);
+	for (i = 0; i < (int)(sizeof(c) / sizeof(c[0])); i++) {
+		lcd7735_fillScreen(0);
+		lcd7735_fill_circle(&f, c[i][0], c[i][1], c[i][2]);
+		for (y = 0; y < PANEL_HEIGHT; y++)
+			for (x = 0; x < PANEL_WIDTH; x++) {
+				in = (x - c[i][0]) * (x - c[i][0]) + (y - c[i][1]) * (y - c[i][1]) <= c[i][2] * c[i][2];
+				if (in != (panel_pixel(x, y) == C1) && !bad++)
+					printf("circle %d,%d r %d: pixel %d,%d %s\n", c[i][0], c[i][1], c[i][2], x, y,
+						   in ? "missing" : "drawn");
+			}
+	}
+	printf("circles    %d pixels wrong  %s\n", bad, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+// A convex quadrilateral with a corner in every quarter of the screen
+static void quad(int16_t *q) {
+	int i, ax, ay, bx, by, convex;
+
+	do {
+		q[0] = rand() % 60;
+		q[1] = rand() % 76;
+		q[2] = 68 + rand() % 60;
+		q[3] = rand() % 76;
+		q[4] = 68 + rand() % 60;
+		q[5] = 84 + rand() % 76;
+		q[6] = rand() % 60;
+		q[7] = 84 + rand() % 76;
+		// every corner turns the same way
+		for (i = 0, convex = 1; i < 4; i++) {
+			ax = q[(i + 1) % 4 * 2] - q[i * 2];
+			ay = q[(i + 1) % 4 * 2 + 1] - q[i * 2 + 1];
+			bx = q[(i + 2) % 4 * 2] - q[(i + 1) % 4 * 2];
+			by = q[(i + 2) % 4 * 2 + 1] - q[(i + 1) % 4 * 2 + 1];
+			convex &= ax * by - ay * bx > 0;
+		}
+	} while (!convex);
+}
+
+static void triangles(int n) {
+	Fill f;
+	int16_t q[8], a[6], b[6];
+	unsigned long sent, area;
+	int k, x, y, inq, bad = 0;
+
+	for (k = 0; k < n; k++) {
+		quad(q);
+		// the diagonal from corner 0 to 2
+		memcpy(a, q, 6 * sizeof(int16_t));
+		memcpy(b, q + 4, 4 * sizeof(int16_t));
+		memcpy(b + 4, q, 2 * sizeof(int16_t));
+		lcd7735_fillScreen(0);
+		lcd7735_fill_solid(&f, C1);
+		lcd7735_fill_polygon(&f, q, 4);
+		memcpy(first, panel_mem, sizeof(first));
+		lcd7735_fillScreen(0);
+		sent = panel_pixels;
+		lcd7735_fill_solid(&f, 0x0001);
+		lcd7735_fill_polygon(&f, a, 3);
+		lcd7735_fill_solid(&f, 0x0002);
+		lcd7735_fill_polygon(&f, b, 3);
+		sent = panel_pixels - sent;
+		for (y = 0, area = 0; y < PANEL_HEIGHT; y++)
+			for (x = 0; x < PANEL_WIDTH; x++) {
+				inq = first[y][x] == C1;
+				area += inq;
+				if (inq != (panel_mem[y][x] != 0) && !bad++)
+					printf("quad %d: pixel %d,%d %s\n", k, x, y, inq ? "missing" : "outside");
+			}
+		// the pixels sent by both triangles are those of the quad, so none twice
+		if (sent != area && !bad++)
+			printf("quad %d: triangles send %lu pixels for %lu\n", k, sent, area);
+	}
+	printf("triangles  %d quads, %d pixels wrong  %s\n", n, bad, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+int main(int argc, char **argv) {
+	srand(1);
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(PORTRAIT);
+	gradients();
+	circles();
+	triangles(argc > 1 ? atoi(argv[1]) : 200);
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
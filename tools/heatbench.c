@@ -0,0 +1,166 @@
+/*********************************************************************************
+heatbench - host benchmark of the ST7735 heat map renderer
+
+Draws the synthetic 32x24 thermal frame of test_heatmap() in src/main.c with
+ST7735_heatmap.c through the real driver on the emulated panel of
+tools/host/panel.c in landscape, scaled to the whole screen and to smaller
+sizes. For each it reports the host time of a frame and the bytes a frame
+sends to the panel. Every pixel has to be sent once and has to be within a
+palette step of a floating point bilinear reference, with a palette whose
+colors are their own indexes. Grids of equal values at
+the ends of the int16_t range have to draw as well. The frame scaled to the
+screen is written in the iron palette as a PPM image.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o heatbench tools/heatbench.c tools/host/panel.c src/ST7735.c src/ST7735_heatmap.c src/DefaultFonts.c -lm
+Usage:  heatbench [-n loops] [out.ppm]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_heatmap.h"
+#include "panel.h"
+
+static unsigned long violations;
+static int16_t thermal[24][32];
+static uint16_t index_palette[256], iron[256];
+
+// The frame of test_heatmap(): 25C with a warm spot, in hundredths of a degree
+static void thermal_frame(uint32_t n) {
+	int x, y, dx, dy;
+	int sx = 16 + 10 * cosf(n * 0.05f), sy = 12 + 7 * sinf(n * 0.05f);
+
+	for (y = 0; y < 24; y++)
+		for (x = 0; x < 32; x++) {
+			dx = x - sx;
+			dy = y - sy;
+			thermal[y][x] = 2500 + 1000 * 16 / (16 + dx * dx + dy * dy) + (x * 7 + y * 13 + n) % 10;
+		}
+}
+
+// Grid position of the center of output pixel i of n
+static double ref_pos(int i, int n, int size) {
+	double p = (i + 0.5) * size / n - 0.5;
+
+	return p < 0 ? 0 : p > size - 1 ? size - 1 : p;
+}
+
+// Largest difference in palette steps from the bilinear reference
+static int ref_error(const HeatMap *hm, int w, int h) {
+	double px, py, fx, fy, v, idx;
+	int x, y, gx, gy, d, err = 0;
+
+	for (y = 0; y < h; y++) {
+		py = ref_pos(y, h, 24);
+		gy = py >= 23 ? 22 : (int)py;
+		fy = py - gy;
+		for (x = 0; x < w; x++) {
+			px = ref_pos(x, w, 32);
+			gx = px >= 31 ? 30 : (int)px;
+			fx = px - gx;
+			v = (thermal[gy][gx] * (1 - fx) + thermal[gy][gx + 1] * fx) * (1 - fy) +
+				(thermal[gy + 1][gx] * (1 - fx) + thermal[gy + 1][gx + 1] * fx) * fy;
+			idx = (v - hm->lo) * 255 / (hm->hi - hm->lo);
+			idx = idx < 0 ? 0 : idx > 255 ? 255 : idx;
+			d = abs(panel_pixel(x, y) - (int)idx);
+			if (d > err)
+				err = d;
+		}
+	}
+	return err;
+}
+
+static void bench(int w, int h, int loops) {
+	HeatMap hm;
+	unsigned long bytes, pixels;
+	double t;
+	int i, err;
+
+	lcd7735_heatmap_init(&hm, thermal, 32, 24, 16, index_palette);
+	thermal_frame(0);
+	lcd7735_heatmap_draw(&hm, 0, 0, w, h);
+	err = ref_error(&hm, w, h);
+	bytes = panel_bytes;
+	pixels = panel_pixels;
+	t = panel_time();
+	for (i = 0; i < loops; i++)
+		lcd7735_heatmap_draw(&hm, 0, 0, w, h);
+	t = (panel_time() - t) / loops;
+	bytes = (panel_bytes - bytes) / loops;
+	pixels = (panel_pixels - pixels) / loops;
+	printf("32x24 -> %3dx%-3d %8.2f us %6lu B to panel  max error %d palette steps\n", w, h, t * 1e6, bytes, err);
+	// every pixel of the frame is sent once
+	if (err > 1 || pixels != (unsigned long)w * h)
+		violations++;
+}
+
+// A grid of one value at the ends of the range, auto-ranged and fixed
+static void flat(int16_t v) {
+	HeatMap hm;
+	int i;
+
+	for (i = 0; i < 32 * 24; i++)
+		thermal[i / 32][i % 32] = v;
+	lcd7735_heatmap_init(&hm, thermal, 32, 24, 16, index_palette);
+	lcd7735_heatmap_draw(&hm, 0, 0, 64, 48);
+	if (hm.hi <= hm.lo) {
+		printf("flat %d: range %d..%d\n", v, hm.lo, hm.hi);
+		violations++;
+	}
+	lcd7735_heatmap_setRange(&hm, v, v);
+	lcd7735_heatmap_draw(&hm, 0, 0, 64, 48);
+	if (hm.hi <= hm.lo) {
+		printf("flat %d: set range %d..%d\n", v, hm.lo, hm.hi);
+		violations++;
+	}
+}
+
+static void write_ppm(const char *fn) {
+	HeatMap hm;
+
+	thermal_frame(0);
+	lcd7735_heatmap_init(&hm, thermal, 32, 24, 16, iron);
+	lcd7735_heatmap_draw(&hm, 0, 0, lcd7735_getWidth(), lcd7735_getHeight());
+	if (panel_writePPM(fn, lcd7735_getWidth(), lcd7735_getHeight())) {
+		perror(fn);
+		exit(1);
+	}
+}
+
+int main(int argc, char **argv) {
+	const char *out = NULL;
+	int loops = 1000, i;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			loops = atoi(argv[++i]);
+		} else if (argv[i][0] == '-' || out) {
+			fprintf(stderr, "usage: heatbench [-n loops] [out.ppm]\n");
+			return 2;
+		} else {
+			out = argv[i];
+		}
+	}
+	if (loops < 1)
+		loops = 1;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(LANDSAPE);
+	for (i = 0; i < 256; i++)
+		index_palette[i] = i;
+	lcd7735_heatmap_palette(iron, HEATMAP_IRON);
+	bench(lcd7735_getWidth(), lcd7735_getHeight(), loops);
+	bench(96, 72, loops);
+	bench(64, 48, loops);
+	bench(32, 24, loops);
+	flat(INT16_MAX);
+	flat(INT16_MIN);
+	if (out)
+		write_ppm(out);
+	if (violations)
+		fprintf(stderr, "heatbench: %lu violations\n", violations);
+	return violations != 0;
+}
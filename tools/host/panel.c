@@ -0,0 +1,245 @@
+/*********************************************************************************
+Emulated ST7735 controller for the host tools, see panel.h
+**********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ST7735.h"
+#include "hw_config.h"
+#include "panel.h"
+
+GPIO_TypeDef host_gpiob;
+
+uint16_t panel_mem[PANEL_HEIGHT][PANEL_WIDTH];
+unsigned long panel_bytes, panel_cmds, panel_pixels;
+void (*panel_hook)(uint8_t dc, uint8_t b);
+uint8_t panel_released;
+uint32_t lcd7735_bytes;
+
+static uint8_t dc, cmd, madctl, colmod = 0x05;
+static uint8_t args[8];
+static int nargs;
+static int xs, xe = PANEL_WIDTH - 1, ys, ye = PANEL_HEIGHT - 1, cx, cy;
+static int tfa, vsa = PANEL_HEIGHT, ssa;
+// bytes, or 12-bit mode nibbles, of the pixel being received
+static uint32_t part;
+static int nparts;
+
+void panel_reset(void) {
+	memset(panel_mem, 0, sizeof(panel_mem));
+	panel_bytes = panel_cmds = panel_pixels = 0;
+}
+
+// Panel position of x,y of the window address space under MADCTL
+static int physical(int x, int y, int *px, int *py) {
+	int t;
+
+	if (madctl & MADCTL_MV) {
+		t = x;
+		x = y;
+		y = t;
+	}
+	if (madctl & MADCTL_MX)
+		x = PANEL_WIDTH - 1 - x;
+	if (madctl & MADCTL_MY)
+		y = PANEL_HEIGHT - 1 - y;
+	*px = x;
+	*py = y;
+	return x >= 0 && x < PANEL_WIDTH && y >= 0 && y < PANEL_HEIGHT;
+}
+
+static void writePixel(uint16_t c) {
+	int px, py;
+
+	if (physical(cx, cy, &px, &py))
+		panel_mem[py][px] = c;
+	panel_pixels++;
+	if (++cx > xe) {
+		cx = xs;
+		if (++cy > ye)
+			cy = ys;
+	}
+}
+
+static void ramData(uint8_t b) {
+	uint16_t r, g, c;
+
+	if (colmod == 0x03) {
+		// 4-4-4, two pixels in three bytes
+		part = (part << 8) | b;
+		nparts += 2;
+		while (nparts >= 3) {
+			c = (part >> ((nparts - 3) * 4)) & 0xFFF;
+			nparts -= 3;
+			r = c >> 8;
+			g = (c >> 4) & 0xF;
+			c &= 0xF;
+			writePixel((r << 1 | r >> 3) << 11 | (g << 2 | g >> 2) << 5 | (c << 1 | c >> 3));
+		}
+		return;
+	}
+	if (nparts) {
+		writePixel(part << 8 | b);
+		nparts = 0;
+	} else {
+		part = b;
+		nparts = 1;
+	}
+}
+
+static void command(uint8_t b) {
+	cmd = b;
+	nargs = 0;
+	nparts = 0;
+	panel_cmds++;
+	if (cmd == ST7735_RAMWR) {
+		cx = xs;
+		cy = ys;
+	}
+}
+
+static void parameter(uint8_t b) {
+	if (cmd == ST7735_RAMWR) {
+		ramData(b);
+		return;
+	}
+	if (nargs < (int)sizeof(args))
+		args[nargs] = b;
+	nargs++;
+	if (cmd == ST7735_CASET && nargs == 4) {
+		xs = args[0] << 8 | args[1];
+		xe = args[2] << 8 | args[3];
+	} else if (cmd == ST7735_RASET && nargs == 4) {
+		ys = args[0] << 8 | args[1];
+		ye = args[2] << 8 | args[3];
+	} else if (cmd == ST7735_MADCTL && nargs == 1) {
+		madctl = b;
+	} else if (cmd == ST7735_COLMOD && nargs == 1) {
+		colmod = b & 0x07;
+	} else if (cmd == ST7735_VSCRDEF && nargs == 6) {
+		tfa = args[0] << 8 | args[1];
+		vsa = args[2] << 8 | args[3];
+	} else if (cmd == ST7735_VSCRSADD && nargs == 2) {
+		ssa = args[0] << 8 | args[1];
+	}
+}
+
+// Pixel x,y of the screen in the current orientation
+uint16_t panel_pixel(int x, int y) {
+	int px, py;
+
+	return physical(x, y, &px, &py) ? panel_mem[py][px] : 0;
+}
+
+// Pixel x,y as shown, with the vertical scrolling applied
+uint16_t panel_shown(int x, int y) {
+	int px, py;
+
+	if (!physical(x, y, &px, &py))
+		return 0;
+	if (vsa > 0 && py >= tfa && py < tfa + vsa)
+		py = tfa + ((ssa - tfa + py - tfa) % vsa + vsa) % vsa;
+	return py < PANEL_HEIGHT ? panel_mem[py][px] : 0;
+}
+
+// Seconds of the host clock
+double panel_time(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Write the w x h pixels of the screen from the top left as a PPM image
+int panel_writePPM(const char *fn, int w, int h) {
+	FILE *f = fopen(fn, "wb");
+	uint16_t c;
+	int x, y;
+
+	if (!f)
+		return -1;
+	fprintf(f, "P6\n%d %d\n255\n", w, h);
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++) {
+			c = panel_shown(x, y);
+			fputc((c >> 11) << 3, f);
+			fputc(((c >> 5) & 0x3F) << 2, f);
+			fputc((c & 0x1F) << 3, f);
+		}
+	return fclose(f);
+}
+
+/******************** hw_config.c stand-ins ********************/
+
+void GPIO_SetBits(GPIO_TypeDef *gpio, uint16_t pins) {
+	if (gpio == LCD_GPIO && (pins & LCD_A0_PIN))
+		dc = 1;
+}
+
+void GPIO_ResetBits(GPIO_TypeDef *gpio, uint16_t pins) {
+	if (gpio == LCD_GPIO && (pins & LCD_A0_PIN))
+		dc = 0;
+}
+
+void lcd7735_setup(void) {
+}
+
+void lcd7735_senddata(const uint8_t data) {
+	panel_bytes++;
+	lcd7735_bytes++;
+	if (panel_hook)
+		panel_hook(dc, data);
+	// the controller isn't selected
+	if (panel_released)
+		return;
+	if (dc)
+		parameter(data);
+	else
+		command(data);
+}
+
+void lcd7735_senddata16(const uint16_t data) {
+	lcd7735_senddata(data >> 8);
+	lcd7735_senddata(data & 0xFF);
+}
+
+void lcd7735_senddatabuf(const uint8_t *data, uint32_t len) {
+	while (len--)
+		lcd7735_senddata(*data++);
+}
+
+void lcd7735_sendCmd(const uint8_t cmd) {
+	LCD_DC0;
+	lcd7735_senddata(cmd);
+}
+
+void lcd7735_sendData(const uint8_t data) {
+	LCD_DC1;
+	lcd7735_senddata(data);
+}
+
+void lcd7735_releaseBus(void) {
+	panel_released = 1;
+}
+
+void lcd7735_acquireBus(void) {
+	panel_released = 0;
+}
+
+void receive_data(const uint8_t cmd, uint8_t *data, uint8_t cnt) {
+	(void)cmd;
+	memset(data, 0, cnt);
+}
+
+void delay_ms(uint32_t delay_value) {
+	(void)delay_value;
+}
+
+uint32_t get_tick_ms(void) {
+	return (uint32_t)(panel_time() * 1000);
+}
+
+uint32_t get_tick_us(void) {
+	return (uint32_t)(panel_time() * 1000000);
+}
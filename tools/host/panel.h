@@ -0,0 +1,40 @@
+/*********************************************************************************
+Emulated ST7735 controller for the host tools
+
+Stands in for the SPI layer of src/hw_config.c, so the real driver
+(src/ST7735.c and the modules on top of it, built with NO_BITBIND) runs on
+the host. The byte stream is decoded like the controller does: CASET, RASET,
+MADCTL, COLMOD (16 and 12 bits per pixel), RAMWR and vertical scrolling.
+The chip select follows lcd7735_releaseBus() and lcd7735_acquireBus().
+The memory is kept in panel orientation, panel_pixel() reads it through the
+current MADCTL like the driver's coordinates.
+
+get_tick_ms() and get_tick_us() are the host clock, delay_ms() returns at once.
+**********************************************************************************/
+
+#ifndef _PANEL_H_
+#define _PANEL_H_
+
+#include <stdint.h>
+
+#define PANEL_WIDTH	128
+#define PANEL_HEIGHT	160
+
+extern uint16_t panel_mem[PANEL_HEIGHT][PANEL_WIDTH];
+extern unsigned long panel_bytes;	// bytes sent, commands and parameters included
+extern unsigned long panel_cmds;	// commands sent
+extern unsigned long panel_pixels;	// pixels written by RAMWR
+
+// Called with every byte sent when set, dc is 0 for commands
+extern void (*panel_hook)(uint8_t dc, uint8_t b);
+// Set between lcd7735_releaseBus() and lcd7735_acquireBus(), the controller
+// ignores the bytes sent meanwhile
+extern uint8_t panel_released;
+
+extern void panel_reset(void);
+extern uint16_t panel_pixel(int x, int y);
+extern uint16_t panel_shown(int x, int y);
+extern double panel_time(void);
+extern int panel_writePPM(const char *fn, int w, int h);
+
+#endif /* _PANEL_H_ */
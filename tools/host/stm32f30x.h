@@ -0,0 +1,31 @@
+/*********************************************************************************
+Host stand-in for the device header, lets driver modules that only need the
+integer types be compiled by the host tools. The GPIO part is enough for the
+driver built with NO_BITBIND, the pin calls go to the emulated panel of
+tools/host/panel.c.
+**********************************************************************************/
+
+#ifndef __STM32F30x_H
+#define __STM32F30x_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t	BSRR, BRR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef host_gpiob;
+#define GPIOB			(&host_gpiob)
+
+#define GPIO_Pin_10		0x0400
+#define GPIO_Pin_12		0x1000
+#define GPIO_Pin_13		0x2000
+#define GPIO_Pin_14		0x4000
+#define GPIO_Pin_15		0x8000
+#define RCC_AHBPeriph_GPIOB	0x00040000
+#define SPI_BaudRatePrescaler_2	0
+
+extern void GPIO_SetBits(GPIO_TypeDef *gpio, uint16_t pins);
+extern void GPIO_ResetBits(GPIO_TypeDef *gpio, uint16_t pins);
+
+#endif /* __STM32F30x_H */
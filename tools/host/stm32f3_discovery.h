@@ -0,0 +1,10 @@
+/*********************************************************************************
+Host stand-in for the board header included by main.h
+**********************************************************************************/
+
+#ifndef __STM32F3_DISCOVERY_H
+#define __STM32F3_DISCOVERY_H
+
+#include "stm32f30x.h"
+
+#endif /* __STM32F3_DISCOVERY_H */
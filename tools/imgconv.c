@@ -0,0 +1,1800 @@
+/*********************************************************************************
+imgconv - host side asset converter for the ST7735 driver
+
+Reads PNG, PPM (P3/P6) or BMP images and BDF fonts and writes C headers in the
+formats understood by the driver:
+
+  raw    const unsigned short[], RGB565 as for lcd7735_drawBitmap()
+  swap   const unsigned char[], RGB565 in panel byte order, lcd7735_drawBitmapSwapped()
+  rle    const unsigned short[], RLE565 as for lcd7735_drawRLE565()
+  index  const unsigned char[] + RGB565 palette, lcd7735_drawBitmapIndexed()
+  font   UTFT font array as for lcd7735_setFont(), or with -b an anti-aliased
+         font of 2 or 4 bits per pixel (see FONT_AA_HEADER in ST7735.h), with
+         -p a proportional Unicode font (see FONT_PROP in ST7735.h)
+  anim   const unsigned short[] delta-frame animation, see ST7735_anim.h
+  path   const unsigned char[] vector path as for lcd7735_path_load(), see
+         ST7735_path.h
+
+Without -f the smallest of raw, rle and index is chosen. The size of every
+candidate encoding is reported on stderr.
+
+With -a the images are frames of an animation shown every "ms" milliseconds.
+Frame 0 and every -K th frame are stored completely, the others as the
+rectangles that differ from the previous frame. Each rectangle is stored raw
+or RLE565, whichever is smaller.
+
+An anti-aliased font is rendered from the BDF font scaled down by -S, every
+pixel is the coverage of a scale x scale block, so a 32 pixel BDF font with
+-S 2 gives a 16 pixel font with smooth edges.
+
+A proportional font (-p) keeps the advance and the box of every glyph, -r
+lists its code point ranges, e.g. 0x20-0x7E,0x410-0x44F. -j adds kerning
+pairs from a text file with one "left right pixels" line per pair, where left
+and right are UTF-8 characters or U+XXXX, e.g. "A V -1". -c stores the glyphs
+as runs of background, foreground and edge pixels (see FONT_RLE in ST7735.h),
+which the driver draws without unpacking them.
+
+With -v the input is SVG path data (the d attribute: M, L, H, V, Q, T, C, S
+and Z, absolute or relative) in pixels, or an SVG file whose path elements are
+taken together. -e or fill-rule="evenodd" in the SVG file store the even-odd
+rule. Coordinates are stored with the fewest fraction bits that keep them
+exact to 1/16 pixel.
+
+Fonts are read from BDF files or from a UTFT font array of a C source given as
+file.c:array, e.g. src/DefaultFonts.c:BigFont.
+
+Build:  gcc -O2 -o imgconv tools/imgconv.c
+Usage:  imgconv [-f raw|swap|rle|index] [-n name] [-k RRGGBB] [-o out.h] image
+        imgconv [-r first-last] [-b 2|4 [-S scale]] [-n name] [-o out.h] font.bdf
+        imgconv -p [-c] [-r ranges] [-b 1|2|4] [-S scale] [-j kern.txt] [-n name] [-o out.h] font.bdf
+        imgconv -a ms [-K keyint] [-n name] [-k RRGGBB] [-o out.h] frame0 frame1 ...
+        imgconv -v [-e] [-n name] [-o out.h] path.txt|image.svg
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+#define RLE565_RUN	0x8000
+#define ANIM_KEY	0x8000
+#define ANIM_RLE	0x8000
+// changed areas closer than this many pixels are sent as one rectangle
+#define ANIM_GAP	4
+#define FONT_AA_HEADER	6
+#define FONT_PROP	0x80
+#define FONT_RLE	0x40
+#define FONT_PROP_HEADER	10
+#define PATH_OP_MOVE	0
+#define PATH_OP_LINE	1
+#define PATH_OP_QUAD	2
+#define PATH_OP_CUBIC	3
+#define PATH_OP_CLOSE	4
+#define PATH_OP_END	7
+#define PATH_FMT_WIDE	0x08
+#define PATH_FMT_EVENODD	0x80
+#define GLYPH_RUN_BG	0x00
+#define GLYPH_RUN_FG	0x40
+#define GLYPH_LITERAL	0x80
+
+typedef struct _image {
+	int		w;
+	int		h;
+	uint8_t	*rgb;		// w*h*3
+} Image;
+
+static void die(const char *msg, const char *arg) {
+	fprintf(stderr, "imgconv: %s%s%s\n", msg, arg ? ": " : "", arg ? arg : "");
+	exit(1);
+}
+
+static void *xmalloc(size_t n) {
+	void *p = calloc(1, n ? n : 1);
+	if (!p)
+		die("out of memory", NULL);
+	return p;
+}
+
+static uint8_t *load_file(const char *fn, size_t *len) {
+	FILE *f = fopen(fn, "rb");
+	uint8_t *buf;
+	long n;
+
+	if (!f)
+		die("can't open", fn);
+	fseek(f, 0, SEEK_END);
+	n = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = xmalloc(n + 1);
+	if (fread(buf, 1, n, f) != (size_t)n)
+		die("can't read", fn);
+	fclose(f);
+	buf[n] = 0;
+	*len = n;
+	return buf;
+}
+
+/********************************************************************
+ * Inflate (RFC 1951), enough for PNG IDAT streams
+ ********************************************************************/
+
+typedef struct _inflate {
+	const uint8_t	*in;
+	size_t		inlen;
+	size_t		pos;
+	uint32_t	bitbuf;
+	int		bitcnt;
+	uint8_t		*out;
+	size_t		outlen;
+	size_t		outcap;
+} Inflate;
+
+typedef struct _huffman {
+	short	count[16];
+	short	symbol[288];
+} Huffman;
+
+static int inf_bits(Inflate *s, int need) {
+	uint32_t val = s->bitbuf;
+
+	while (s->bitcnt < need) {
+		if (s->pos >= s->inlen)
+			die("truncated deflate stream", NULL);
+		val |= (uint32_t)s->in[s->pos++] << s->bitcnt;
+		s->bitcnt += 8;
+	}
+	s->bitbuf = val >> need;
+	s->bitcnt -= need;
+	return val & ((1L << need) - 1);
+}
+
+static void inf_put(Inflate *s, uint8_t c) {
+	if (s->outlen == s->outcap) {
+		s->outcap = s->outcap ? s->outcap * 2 : 65536;
+		s->out = realloc(s->out, s->outcap);
+		if (!s->out)
+			die("out of memory", NULL);
+	}
+	s->out[s->outlen++] = c;
+}
+
+static void inf_build(Huffman *h, const short *length, int n) {
+	short offs[16];
+	int sym, len;
+
+	memset(h->count, 0, sizeof(h->count));
+	for (sym = 0; sym < n; sym++)
+		h->count[length[sym]]++;
+	offs[1] = 0;
+	for (len = 1; len < 15; len++)
+		offs[len + 1] = offs[len] + h->count[len];
+	for (sym = 0; sym < n; sym++)
+		if (length[sym] != 0)
+			h->symbol[offs[length[sym]]++] = sym;
+}
+
+static int inf_decode(Inflate *s, const Huffman *h) {
+	int code = 0, first = 0, index = 0, len, count;
+
+	for (len = 1; len < 16; len++) {
+		code |= inf_bits(s, 1);
+		count = h->count[len];
+		if (code - count < first)
+			return h->symbol[index + (code - first)];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	die("bad huffman code", NULL);
+	return 0;
+}
+
+static void inf_codes(Inflate *s, const Huffman *lencode, const Huffman *distcode) {
+	static const short lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const short lext[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const short dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const short dext[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+	int sym, len;
+	size_t dist;
+
+	for (;;) {
+		sym = inf_decode(s, lencode);
+		if (sym < 256) {
+			inf_put(s, sym);
+		} else if (sym == 256) {
+			return;
+		} else {
+			sym -= 257;
+			if (sym >= 29)
+				die("bad length code", NULL);
+			len = lbase[sym] + inf_bits(s, lext[sym]);
+			sym = inf_decode(s, distcode);
+			if (sym >= 30)
+				die("bad distance code", NULL);
+			dist = dbase[sym] + inf_bits(s, dext[sym]);
+			if (dist > s->outlen)
+				die("distance too far back", NULL);
+			while (len--)
+				inf_put(s, s->out[s->outlen - dist]);
+		}
+	}
+}
+
+static void inf_fixed(Inflate *s) {
+	static Huffman lencode, distcode;
+	static int built = 0;
+	short lengths[288];
+	int i;
+
+	if (!built) {
+		for (i = 0; i < 144; i++) lengths[i] = 8;
+		for (; i < 256; i++) lengths[i] = 9;
+		for (; i < 280; i++) lengths[i] = 7;
+		for (; i < 288; i++) lengths[i] = 8;
+		inf_build(&lencode, lengths, 288);
+		for (i = 0; i < 30; i++) lengths[i] = 5;
+		inf_build(&distcode, lengths, 30);
+		built = 1;
+	}
+	inf_codes(s, &lencode, &distcode);
+}
+
+static void inf_dynamic(Inflate *s) {
+	static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+	short lengths[320];
+	Huffman lencode, distcode;
+	int nlen, ndist, ncode, index, sym, len, rep;
+
+	nlen = inf_bits(s, 5) + 257;
+	ndist = inf_bits(s, 5) + 1;
+	ncode = inf_bits(s, 4) + 4;
+	memset(lengths, 0, sizeof(lengths));
+	for (index = 0; index < ncode; index++)
+		lengths[order[index]] = inf_bits(s, 3);
+	inf_build(&lencode, lengths, 19);
+
+	index = 0;
+	while (index < nlen + ndist) {
+		sym = inf_decode(s, &lencode);
+		if (sym < 16) {
+			lengths[index++] = sym;
+			continue;
+		}
+		len = 0;
+		if (sym == 16) {
+			if (index == 0)
+				die("bad repeat", NULL);
+			len = lengths[index - 1];
+			rep = 3 + inf_bits(s, 2);
+		} else if (sym == 17) {
+			rep = 3 + inf_bits(s, 3);
+		} else {
+			rep = 11 + inf_bits(s, 7);
+		}
+		if (index + rep > nlen + ndist)
+			die("too many lengths", NULL);
+		while (rep--)
+			lengths[index++] = len;
+	}
+	inf_build(&lencode, lengths, nlen);
+	inf_build(&distcode, lengths + nlen, ndist);
+	inf_codes(s, &lencode, &distcode);
+}
+
+static uint8_t *inflate_zlib(const uint8_t *in, size_t inlen, size_t *outlen) {
+	Inflate s;
+	int last, type;
+	size_t n;
+
+	memset(&s, 0, sizeof(s));
+	s.in = in + 2;		// skip zlib header
+	s.inlen = inlen - 2;
+	do {
+		last = inf_bits(&s, 1);
+		type = inf_bits(&s, 2);
+		if (type == 0) {
+			s.bitbuf = 0;
+			s.bitcnt = 0;
+			if (s.pos + 4 > s.inlen)
+				die("truncated stored block", NULL);
+			n = s.in[s.pos] | (s.in[s.pos + 1] << 8);
+			s.pos += 4;
+			if (s.pos + n > s.inlen)
+				die("truncated stored block", NULL);
+			while (n--)
+				inf_put(&s, s.in[s.pos++]);
+		} else if (type == 1) {
+			inf_fixed(&s);
+		} else if (type == 2) {
+			inf_dynamic(&s);
+		} else {
+			die("bad block type", NULL);
+		}
+	} while (!last);
+	*outlen = s.outlen;
+	return s.out;
+}
+
+/********************************************************************
+ * Image loaders, all produce 8-bit RGB composed over "bg"
+ ********************************************************************/
+
+static uint32_t be32(const uint8_t *p) {
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static uint32_t le32(const uint8_t *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t le16(const uint8_t *p) {
+	return p[0] | (p[1] << 8);
+}
+
+static uint8_t blend8(int c, int a, int bg) {
+	return (c * a + bg * (255 - a) + 127) / 255;
+}
+
+static void put_rgba(Image *img, int i, int r, int g, int b, int a, const uint8_t *bg) {
+	img->rgb[i * 3 + 0] = blend8(r, a, bg[0]);
+	img->rgb[i * 3 + 1] = blend8(g, a, bg[1]);
+	img->rgb[i * 3 + 2] = blend8(b, a, bg[2]);
+}
+
+static int paeth(int a, int b, int c) {
+	int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+	if (pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+static void load_png(Image *img, const uint8_t *buf, size_t len, const uint8_t *bg) {
+	static const int channels[7] = { 1, 0, 3, 1, 2, 0, 4 };
+	uint8_t palette[256 * 3], trns[256], *idat = NULL, *raw, *prev, *cur;
+	size_t pos = 8, idatlen = 0, rawlen, stride;
+	uint32_t clen, type;
+	int depth = 0, ctype = 0, bpp, x, y, i, v, a, r, g, b, k;
+	int ch, maxv;
+
+	memset(trns, 255, sizeof(trns));
+	while (pos + 12 <= len) {
+		clen = be32(buf + pos);
+		type = be32(buf + pos + 4);
+		if (pos + 12 + clen > len)
+			die("truncated PNG chunk", NULL);
+		if (type == 0x49484452) {			// IHDR
+			img->w = be32(buf + pos + 8);
+			img->h = be32(buf + pos + 12);
+			depth = buf[pos + 16];
+			ctype = buf[pos + 17];
+			if (buf[pos + 20])
+				die("interlaced PNG is not supported", NULL);
+		} else if (type == 0x504C5445) {	// PLTE
+			memcpy(palette, buf + pos + 8, clen > 768 ? 768 : clen);
+		} else if (type == 0x74524E53) {	// tRNS
+			if (ctype == 3)
+				memcpy(trns, buf + pos + 8, clen > 256 ? 256 : clen);
+		} else if (type == 0x49444154) {	// IDAT
+			idat = realloc(idat, idatlen + clen);
+			memcpy(idat + idatlen, buf + pos + 8, clen);
+			idatlen += clen;
+		} else if (type == 0x49454E44) {	// IEND
+			break;
+		}
+		pos += 12 + clen;
+	}
+	if (!idat || ctype > 6 || !channels[ctype])
+		die("unsupported PNG", NULL);
+
+	ch = channels[ctype];
+	bpp = (ch * depth + 7) / 8;
+	stride = (img->w * ch * depth + 7) / 8;
+	raw = inflate_zlib(idat, idatlen, &rawlen);
+	if (rawlen < (stride + 1) * img->h)
+		die("truncated PNG image data", NULL);
+
+	// undo filters in place
+	prev = NULL;
+	for (y = 0; y < img->h; y++) {
+		cur = raw + y * (stride + 1) + 1;
+		for (x = 0; x < (int)stride; x++) {
+			a = x >= bpp ? cur[x - bpp] : 0;
+			b = prev ? prev[x] : 0;
+			k = (prev && x >= bpp) ? prev[x - bpp] : 0;
+			switch (cur[-1]) {
+			case 1: cur[x] += a; break;
+			case 2: cur[x] += b; break;
+			case 3: cur[x] += (a + b) / 2; break;
+			case 4: cur[x] += paeth(a, b, k); break;
+			}
+		}
+		prev = cur;
+	}
+
+	img->rgb = xmalloc(img->w * img->h * 3);
+	maxv = (1 << depth) - 1;
+	for (y = 0; y < img->h; y++) {
+		cur = raw + y * (stride + 1) + 1;
+		for (x = 0; x < img->w; x++) {
+			int s[4] = { 0, 0, 0, 0 };
+			for (k = 0; k < ch; k++) {
+				i = x * ch + k;
+				if (depth == 16)
+					s[k] = cur[i * 2];
+				else if (depth == 8)
+					s[k] = cur[i];
+				else
+					s[k] = (cur[i * depth / 8] >> (8 - depth - (i * depth) % 8)) & maxv;
+			}
+			if (ctype == 3) {
+				v = s[0];
+				put_rgba(img, y * img->w + x, palette[v * 3], palette[v * 3 + 1], palette[v * 3 + 2], trns[v], bg);
+				continue;
+			}
+			if (depth < 8)
+				s[0] = s[0] * 255 / maxv;
+			r = s[0];
+			g = ch >= 3 ? s[1] : r;
+			b = ch >= 3 ? s[2] : r;
+			a = ch == 2 ? s[1] : ch == 4 ? s[3] : 255;
+			put_rgba(img, y * img->w + x, r, g, b, a, bg);
+		}
+	}
+	free(raw);
+	free(idat);
+}
+
+static int ppm_int(const uint8_t *buf, size_t len, size_t *pos) {
+	int v = 0;
+
+	for (;;) {
+		while (*pos < len && isspace(buf[*pos]))
+			(*pos)++;
+		if (*pos < len && buf[*pos] == '#') {
+			while (*pos < len && buf[*pos] != '\n')
+				(*pos)++;
+			continue;
+		}
+		break;
+	}
+	if (*pos >= len || !isdigit(buf[*pos]))
+		die("bad PPM header", NULL);
+	while (*pos < len && isdigit(buf[*pos]))
+		v = v * 10 + buf[(*pos)++] - '0';
+	return v;
+}
+
+static void load_ppm(Image *img, const uint8_t *buf, size_t len) {
+	size_t pos = 2;
+	int maxv, i, n, bytes;
+
+	img->w = ppm_int(buf, len, &pos);
+	img->h = ppm_int(buf, len, &pos);
+	maxv = ppm_int(buf, len, &pos);
+	pos++;
+	n = img->w * img->h * 3;
+	bytes = maxv > 255 ? 2 : 1;
+	img->rgb = xmalloc(n);
+	if (buf[1] == '6' && pos + (size_t)n * bytes > len)
+		die("truncated PPM", NULL);
+	for (i = 0; i < n; i++) {
+		int v;
+		if (buf[1] == '3')
+			v = ppm_int(buf, len, &pos);
+		else if (bytes == 2)
+			v = (buf[pos + i * 2] << 8) | buf[pos + i * 2 + 1];
+		else
+			v = buf[pos + i];
+		img->rgb[i] = v * 255 / maxv;
+	}
+}
+
+static void load_bmp(Image *img, const uint8_t *buf, size_t len) {
+	uint32_t off = le32(buf + 10), hsize = le32(buf + 14), comp, rmask = 0x7C00, gmask = 0x03E0, bmask = 0x001F;
+	int bpp, x, y, sy, stride, topdown, v;
+	const uint8_t *row, *pal;
+
+	img->w = (int32_t)le32(buf + 18);
+	img->h = (int32_t)le32(buf + 22);
+	bpp = le16(buf + 28);
+	comp = le32(buf + 30);
+	topdown = img->h < 0;
+	if (topdown)
+		img->h = -img->h;
+	if (comp == 3) {			// BI_BITFIELDS
+		rmask = le32(buf + 54);
+		gmask = le32(buf + 58);
+		bmask = le32(buf + 62);
+	} else if (comp != 0) {
+		die("compressed BMP is not supported", NULL);
+	}
+	if (bpp != 8 && bpp != 16 && bpp != 24 && bpp != 32)
+		die("unsupported BMP depth", NULL);
+	stride = ((img->w * bpp + 31) / 32) * 4;
+	if (off + (size_t)stride * img->h > len)
+		die("truncated BMP", NULL);
+	pal = buf + 14 + hsize;
+	img->rgb = xmalloc(img->w * img->h * 3);
+	for (y = 0; y < img->h; y++) {
+		sy = topdown ? y : img->h - 1 - y;
+		row = buf + off + sy * stride;
+		for (x = 0; x < img->w; x++) {
+			uint8_t *d = img->rgb + (y * img->w + x) * 3;
+			if (bpp == 8) {
+				d[0] = pal[row[x] * 4 + 2];
+				d[1] = pal[row[x] * 4 + 1];
+				d[2] = pal[row[x] * 4];
+			} else if (bpp == 16) {
+				v = le16(row + x * 2);
+				d[0] = (v & rmask) * 255 / rmask;
+				d[1] = (v & gmask) * 255 / gmask;
+				d[2] = (v & bmask) * 255 / bmask;
+			} else {
+				d[0] = row[x * bpp / 8 + 2];
+				d[1] = row[x * bpp / 8 + 1];
+				d[2] = row[x * bpp / 8];
+			}
+		}
+	}
+}
+
+static void load_image(Image *img, const char *fn, const uint8_t *bg) {
+	size_t len;
+	uint8_t *buf = load_file(fn, &len);
+
+	if (len > 8 && !memcmp(buf, "\x89PNG", 4))
+		load_png(img, buf, len, bg);
+	else if (len > 2 && buf[0] == 'P' && (buf[1] == '3' || buf[1] == '6'))
+		load_ppm(img, buf, len);
+	else if (len > 54 && buf[0] == 'B' && buf[1] == 'M')
+		load_bmp(img, buf, len);
+	else
+		die("unknown image format", fn);
+	free(buf);
+}
+
+/********************************************************************
+ * Encoders
+ ********************************************************************/
+
+static uint16_t rgb565(const uint8_t *p) {
+	return (((p[0] * 31 + 127) / 255) << 11) | (((p[1] * 63 + 127) / 255) << 5) | ((p[2] * 31 + 127) / 255);
+}
+
+// RLE565 tokens for n pixels, returns number of words written to out
+static int rle_encode(const uint16_t *px, int n, uint16_t *out) {
+	int i = 0, j, lit = 0, k = 0, litpos = 0;
+
+	while (i < n) {
+		j = i;
+		while (j < n && px[j] == px[i] && j - i < 0x7FFF)
+			j++;
+		if (j - i >= 3) {
+			lit = 0;
+			out[k++] = RLE565_RUN | (j - i);
+			out[k++] = px[i];
+			i = j;
+		} else {
+			if (lit == 0 || lit == 0x7FFF) {
+				litpos = k++;
+				lit = 0;
+			}
+			out[k++] = px[i++];
+			out[litpos] = ++lit;
+		}
+	}
+	return k;
+}
+
+/********************************************************************
+ * Output
+ ********************************************************************/
+
+static void write_header(FILE *f, const char *src, int w, int h, const char *fmt, long size) {
+	fprintf(f, "// Generated by  : imgconv\n");
+	fprintf(f, "// Generated from: %s\n", src);
+	if (w)
+		fprintf(f, "// Dimensions    : %dx%d pixels\n", w, h);
+	fprintf(f, "// Format        : %s\n", fmt);
+	fprintf(f, "// Size          : %ld Bytes\n\n", size);
+}
+
+static void write_u16(FILE *f, const char *type, const char *name, const uint16_t *v, int n) {
+	int i;
+
+	fprintf(f, "const %s %s[0x%X] ={\n", type, name, n);
+	for (i = 0; i < n; i++) {
+		fprintf(f, "0x%04X,%s", v[i], (i % 16 == 15 || i == n - 1) ? "" : " ");
+		if (i % 16 == 15 || i == n - 1)
+			fprintf(f, "   // 0x%04X (%d)\n", i + 1, i + 1);
+	}
+	fprintf(f, "};\n");
+}
+
+static void write_u8(FILE *f, const char *name, const uint8_t *v, int n) {
+	int i;
+
+	fprintf(f, "const unsigned char %s[0x%X] ={\n", name, n);
+	for (i = 0; i < n; i++) {
+		fprintf(f, "0x%02X,%s", v[i], (i % 16 == 15 || i == n - 1) ? "" : " ");
+		if (i % 16 == 15 || i == n - 1)
+			fprintf(f, "   // 0x%04X (%d)\n", i + 1, i + 1);
+	}
+	fprintf(f, "};\n");
+}
+
+static void convert_image(FILE *out, const char *fn, const char *name, const char *format, const uint8_t *bg) {
+	Image img;
+	uint16_t *px, *rle, palette[256];
+	uint8_t *idx, *swp;
+	int n, i, k, ncolors = 0, nrle;
+	long size_raw, size_rle, size_idx;
+	char palname[256];
+
+	load_image(&img, fn, bg);
+	n = img.w * img.h;
+	px = xmalloc(n * 2);
+	for (i = 0; i < n; i++)
+		px[i] = rgb565(img.rgb + i * 3);
+
+	rle = xmalloc((n * 2 + 4) * 2);
+	rle[0] = img.w;
+	rle[1] = img.h;
+	nrle = 2 + rle_encode(px, n, rle + 2);
+
+	idx = xmalloc(n);
+	for (i = 0; i < n && ncolors <= 256; i++) {
+		for (k = 0; k < ncolors && palette[k] != px[i]; k++)
+			;
+		if (k == ncolors && ncolors++ < 256)
+			palette[k] = px[i];
+		idx[i] = k;
+	}
+
+	size_raw = n * 2L;
+	size_rle = nrle * 2L;
+	size_idx = ncolors <= 256 ? n + ncolors * 2L : -1;
+	fprintf(stderr, "%s: %dx%d, raw %ld, rle %ld, index ", fn, img.w, img.h, size_raw, size_rle);
+	if (size_idx < 0)
+		fprintf(stderr, "n/a (%s colors)\n", "> 256");
+	else
+		fprintf(stderr, "%ld (%d colors)\n", size_idx, ncolors);
+
+	if (!format) {
+		format = "raw";
+		if (size_rle < size_raw)
+			format = "rle";
+		if (size_idx >= 0 && size_idx < (size_rle < size_raw ? size_rle : size_raw))
+			format = "index";
+	}
+	fprintf(stderr, "%s: %s selected\n", fn, format);
+
+	if (!strcmp(format, "raw")) {
+		write_header(out, fn, img.w, img.h, "RGB565, see lcd7735_drawBitmap()", size_raw);
+		write_u16(out, "unsigned short", name, px, n);
+	} else if (!strcmp(format, "swap")) {
+		swp = xmalloc(n * 2);
+		for (i = 0; i < n; i++) {
+			swp[i * 2] = px[i] >> 8;
+			swp[i * 2 + 1] = px[i] & 0xFF;
+		}
+		write_header(out, fn, img.w, img.h, "RGB565 panel byte order, see lcd7735_drawBitmapSwapped()", size_raw);
+		write_u8(out, name, swp, n * 2);
+		free(swp);
+	} else if (!strcmp(format, "rle")) {
+		write_header(out, fn, img.w, img.h, "RLE565, see lcd7735_drawRLE565()", size_rle);
+		write_u16(out, "unsigned short", name, rle, nrle);
+	} else if (!strcmp(format, "index")) {
+		if (size_idx < 0)
+			die("too many colors for index format", fn);
+		snprintf(palname, sizeof(palname), "%s_palette", name);
+		write_header(out, fn, img.w, img.h, "8-bit indices + RGB565 palette, see lcd7735_drawBitmapIndexed()", size_idx);
+		write_u16(out, "unsigned short", palname, palette, ncolors);
+		fprintf(out, "\n");
+		write_u8(out, name, idx, n);
+	} else {
+		die("unknown format", format);
+	}
+	free(px);
+	free(rle);
+	free(idx);
+	free(img.rgb);
+}
+
+/********************************************************************
+ * Animations
+ ********************************************************************/
+
+typedef struct _words {
+	uint16_t	*v;
+	int		n, size;
+} Words;
+
+static void words_add(Words *b, uint16_t v) {
+	if (b->n == b->size) {
+		b->size = b->size ? b->size * 2 : 4096;
+		b->v = realloc(b->v, b->size * 2);
+		if (!b->v)
+			die("out of memory", NULL);
+	}
+	b->v[b->n++] = v;
+}
+
+// Store the x0,y0-x1,y1 area of frame px (w pixels wide), raw or RLE565
+static void anim_rect(Words *b, const uint16_t *px, int w, int x0, int y0, int x1, int y1) {
+	int rw = x1 - x0 + 1, rh = y1 - y0 + 1, n = rw * rh, i, y, k;
+	uint16_t *pix = xmalloc(n * 2), *rle = xmalloc(n * 4 + 4);
+
+	for (y = 0; y < rh; y++)
+		memcpy(pix + y * rw, px + (y0 + y) * w + x0, rw * 2);
+	k = rle_encode(pix, n, rle);
+	words_add(b, x0);
+	words_add(b, y0);
+	words_add(b, rw | (k < n ? ANIM_RLE : 0));
+	words_add(b, rh);
+	for (i = 0; i < (k < n ? k : n); i++)
+		words_add(b, k < n ? rle[i] : pix[i]);
+	free(pix);
+	free(rle);
+}
+
+// Rectangles covering the pixels that differ between prev and cur: rows with
+// changes are grouped into bands, changed columns of a band into rectangles,
+// each rectangle is then shrunk to its changed pixels.
+static int anim_delta(Words *b, const uint16_t *prev, const uint16_t *cur, int w, int h) {
+	int y0, y1, x0, x1, x, y, gap, rx0, rx1, ry0, ry1, n = 0;
+	uint8_t *col = xmalloc(w);
+
+	for (y0 = 0; y0 < h; y0 = y1 + 1) {
+		for (; y0 < h && !memcmp(prev + y0 * w, cur + y0 * w, w * 2); y0++)
+			;
+		if (y0 == h)
+			break;
+		for (y1 = y0, gap = 0, y = y0 + 1; y < h && gap <= ANIM_GAP; y++) {
+			if (memcmp(prev + y * w, cur + y * w, w * 2)) {
+				y1 = y;
+				gap = 0;
+			} else {
+				gap++;
+			}
+		}
+		for (x = 0; x < w; x++)
+			for (col[x] = 0, y = y0; y <= y1 && !col[x]; y++)
+				col[x] = prev[y * w + x] != cur[y * w + x];
+		for (x0 = 0; x0 < w; x0 = x1 + 1) {
+			for (; x0 < w && !col[x0]; x0++)
+				;
+			if (x0 == w)
+				break;
+			for (x1 = x0, gap = 0, x = x0 + 1; x < w && gap <= ANIM_GAP; x++) {
+				if (col[x]) {
+					x1 = x;
+					gap = 0;
+				} else {
+					gap++;
+				}
+			}
+			rx0 = x1;
+			rx1 = x0;
+			ry0 = y1;
+			ry1 = y0;
+			for (y = y0; y <= y1; y++)
+				for (x = x0; x <= x1; x++)
+					if (prev[y * w + x] != cur[y * w + x]) {
+						rx0 = x < rx0 ? x : rx0;
+						rx1 = x > rx1 ? x : rx1;
+						ry0 = y < ry0 ? y : ry0;
+						ry1 = y > ry1 ? y : ry1;
+					}
+			anim_rect(b, cur, w, rx0, ry0, rx1, ry1);
+			n++;
+		}
+	}
+	free(col);
+	return n;
+}
+
+static void convert_anim(FILE *out, char **files, int nfiles, const char *name, int period, int keyint, const uint8_t *bg) {
+	Words b = { NULL, 0, 0 };
+	Image img;
+	uint16_t *prev = NULL, *cur;
+	int w = 0, h = 0, f, i, start;
+	char fmt[128];
+
+	words_add(&b, 0);
+	words_add(&b, 0);
+	words_add(&b, nfiles);
+	words_add(&b, period);
+	for (f = 0; f < nfiles; f++) {
+		load_image(&img, files[f], bg);
+		if (f == 0) {
+			w = b.v[0] = img.w;
+			h = b.v[1] = img.h;
+		} else if (img.w != w || img.h != h) {
+			die("frame size differs", files[f]);
+		}
+		cur = xmalloc(w * h * 2);
+		for (i = 0; i < w * h; i++)
+			cur[i] = rgb565(img.rgb + i * 3);
+		free(img.rgb);
+
+		start = b.n;
+		words_add(&b, 0);
+		words_add(&b, 0);
+		if (f == 0 || (keyint && f % keyint == 0)) {
+			anim_rect(&b, cur, w, 0, 0, w - 1, h - 1);
+			b.v[start + 1] = ANIM_KEY | 1;
+		} else {
+			b.v[start + 1] = anim_delta(&b, prev, cur, w, h);
+		}
+		if (b.n - start > 0xFFFF)
+			die("frame too large", files[f]);
+		b.v[start] = b.n - start;
+		fprintf(stderr, "%s: frame %d, %d rects, %d bytes\n", files[f], f, b.v[start + 1] & ~ANIM_KEY, (b.n - start) * 2);
+		free(prev);
+		prev = cur;
+	}
+	free(prev);
+	fprintf(stderr, "%s: %d frames, %ld bytes, full frames %ld bytes\n", name, nfiles, b.n * 2L, (long)w * h * 2 * nfiles);
+	snprintf(fmt, sizeof(fmt), "%d frames every %d ms, see ST7735_anim.h", nfiles, period);
+	write_header(out, files[0], w, h, fmt, b.n * 2L);
+	write_u16(out, "unsigned short", name, b.v, b.n);
+	free(b.v);
+}
+
+/********************************************************************
+ * BDF fonts
+ ********************************************************************/
+
+typedef struct _glyph {
+	int		encoding;
+	int		bbw, bbh, bbx, bby;	// glyph bounding box
+	int		dwidth;
+	uint8_t		*bits;			// bbh rows of (bbw+7)/8 bytes
+} Glyph;
+
+typedef struct _bdf {
+	int		w, h, x, y;		// font bounding box
+	int		nglyphs;
+	Glyph		*glyphs;
+} Bdf;
+
+static void load_bdf(Bdf *font, const char *fn) {
+	size_t len;
+	char *buf = (char *)load_file(fn, &len), *line, *next;
+	Glyph *g = NULL;
+	int row = -1, i, rowbytes = 0;
+
+	memset(font, 0, sizeof(*font));
+	font->glyphs = xmalloc(65536 * sizeof(Glyph));
+	for (line = buf; line && *line; line = next) {
+		next = strchr(line, '\n');
+		if (next)
+			*next++ = 0;
+		if (row >= 0 && g) {
+			if (!strncmp(line, "ENDCHAR", 7)) {
+				row = -1;
+				if (g->encoding >= 0)
+					font->nglyphs++;
+				continue;
+			}
+			for (i = 0; i < rowbytes && row < g->bbh; i++) {
+				unsigned v;
+				if (sscanf(line + i * 2, "%2x", &v) == 1)
+					g->bits[row * rowbytes + i] = v;
+			}
+			row++;
+			continue;
+		}
+		if (!strncmp(line, "FONTBOUNDINGBOX ", 16)) {
+			sscanf(line + 16, "%d %d %d %d", &font->w, &font->h, &font->x, &font->y);
+		} else if (!strncmp(line, "STARTCHAR", 9)) {
+			if (font->nglyphs >= 65536)
+				die("too many glyphs", fn);
+			g = &font->glyphs[font->nglyphs];
+			memset(g, 0, sizeof(*g));
+			g->encoding = -1;
+		} else if (g && !strncmp(line, "ENCODING ", 9)) {
+			g->encoding = atoi(line + 9);
+		} else if (g && !strncmp(line, "DWIDTH ", 7)) {
+			g->dwidth = atoi(line + 7);
+		} else if (g && !strncmp(line, "BBX ", 4)) {
+			sscanf(line + 4, "%d %d %d %d", &g->bbw, &g->bbh, &g->bbx, &g->bby);
+		} else if (g && !strncmp(line, "BITMAP", 6)) {
+			rowbytes = (g->bbw + 7) / 8;
+			g->bits = xmalloc(rowbytes * g->bbh);
+			row = 0;
+		}
+	}
+	free(buf);
+}
+
+// UTFT font array "name" of a C source, given as file.c:name, loaded as a BDF
+// font so it can be converted to the other font formats
+static void load_utft(Bdf *font, const char *spec) {
+	char fn[256], *arr, *p, *end;
+	uint8_t *data, *src;
+	size_t len;
+	long v;
+	int n = 0, i, rowbytes;
+
+	snprintf(fn, sizeof(fn), "%s", spec);
+	arr = strrchr(fn, ':');
+	*arr++ = 0;
+	src = load_file(fn, &len);
+	data = xmalloc(len);
+	p = strstr((char *)src, arr);
+	while (p && (isalnum((unsigned char)p[strlen(arr)]) || p[strlen(arr)] == '_'))
+		p = strstr(p + 1, arr);
+	if (!p || !(p = strchr(p, '{')))
+		die("no such array", spec);
+	for (p++; *p && *p != '}'; ) {
+		if (p[0] == '/' && p[1] == '/') {
+			p = strchr(p, '\n');
+			if (!p)
+				break;
+		} else if (p[0] == '/' && p[1] == '*') {
+			p = strstr(p + 2, "*/");
+			if (!p)
+				break;
+			p += 2;
+		} else if (isdigit((unsigned char)*p)) {
+			v = strtol(p, &end, 0);
+			data[n++] = v;
+			p = end;
+		} else {
+			p++;
+		}
+	}
+	if (n < 4 || data[0] == 0 || n < 4 + data[3] * (data[0] / 8) * data[1])
+		die("not a UTFT font", spec);
+
+	memset(font, 0, sizeof(*font));
+	font->w = data[0];
+	font->h = data[1];
+	font->glyphs = xmalloc(data[3] * sizeof(Glyph));
+	rowbytes = data[0] / 8;
+	for (i = 0; i < data[3]; i++) {
+		Glyph *g = &font->glyphs[font->nglyphs++];
+		g->encoding = data[2] + i;
+		g->bbw = data[0];
+		g->bbh = data[1];
+		g->dwidth = data[0];
+		g->bits = xmalloc(rowbytes * data[1]);
+		memcpy(g->bits, data + 4 + i * rowbytes * data[1], rowbytes * data[1]);
+	}
+	free(data);
+	free(src);
+}
+
+static void load_font(Bdf *font, const char *fn) {
+	if (strrchr(fn, ':') && strrchr(fn, ':') > strrchr(fn, '.'))
+		load_utft(font, fn);
+	else
+		load_bdf(font, fn);
+}
+
+static const Glyph *bdf_glyph(const Bdf *font, int code) {
+	int i;
+
+	for (i = 0; i < font->nglyphs; i++)
+		if (font->glyphs[i].encoding == code)
+			return &font->glyphs[i];
+	return NULL;
+}
+
+// Pixel x,y of the font cell of glyph g, cell origin is the top left corner
+static int bdf_pixel(const Bdf *font, const Glyph *g, int x, int y) {
+	int gx, gy;
+
+	if (!g)
+		return 0;
+	gx = x - (g->bbx - font->x);
+	gy = y - (font->h + font->y - g->bby - g->bbh);
+	if (gx < 0 || gy < 0 || gx >= g->bbw || gy >= g->bbh)
+		return 0;
+	return (g->bits[gy * ((g->bbw + 7) / 8) + gx / 8] >> (7 - gx % 8)) & 1;
+}
+
+static void convert_font(FILE *out, const char *fn, const char *name, int first, int last) {
+	Bdf font;
+	const Glyph *g;
+	uint8_t *data;
+	int w, n, c, x, y, k;
+	long size;
+
+	load_font(&font, fn);
+	w = (font.w + 7) & ~7;
+	n = last - first + 1;
+	size = 4 + (long)n * (w / 8) * font.h;
+	data = xmalloc(size);
+	data[0] = w;
+	data[1] = font.h;
+	data[2] = first;
+	data[3] = n;
+	k = 4;
+	for (c = first; c <= last; c++) {
+		g = bdf_glyph(&font, c);
+		if (!g)
+			fprintf(stderr, "%s: no glyph for 0x%02X, left blank\n", fn, c);
+		for (y = 0; y < font.h; y++)
+			for (x = 0; x < w; x++)
+				if (bdf_pixel(&font, g, x, y))
+					data[k + y * (w / 8) + x / 8] |= 0x80 >> (x % 8);
+		k += (w / 8) * font.h;
+	}
+	fprintf(stderr, "%s: %dx%d, %d chars, font %ld\n", fn, w, font.h, n, size);
+	write_header(out, fn, 0, 0, "UTFT font, see lcd7735_setFont()", size);
+	write_u8(out, name, data, size);
+	free(data);
+}
+
+// Anti-aliased font: every pixel is the coverage of a scale x scale block of
+// the BDF glyph, quantized to bpp bits
+static void convert_font_aa(FILE *out, const char *fn, const char *name, int first, int last, int bpp, int scale) {
+	Bdf font;
+	const Glyph *g;
+	uint8_t *data;
+	int w, h, n, c, x, y, k, rowbytes, top = (1 << bpp) - 1, sum, i, j;
+	long size;
+
+	load_font(&font, fn);
+	w = (font.w + scale - 1) / scale;
+	h = (font.h + scale - 1) / scale;
+	if (w > 255 || h > 255)
+		die("font too large", fn);
+	rowbytes = (w * bpp + 7) / 8;
+	n = last - first + 1;
+	size = FONT_AA_HEADER + (long)n * rowbytes * h;
+	data = xmalloc(size);
+	data[0] = 0;
+	data[1] = bpp;
+	data[2] = w;
+	data[3] = h;
+	data[4] = first;
+	data[5] = n;
+	k = FONT_AA_HEADER;
+	for (c = first; c <= last; c++) {
+		g = bdf_glyph(&font, c);
+		if (!g)
+			fprintf(stderr, "%s: no glyph for 0x%02X, left blank\n", fn, c);
+		for (y = 0; y < h; y++)
+			for (x = 0; x < w; x++) {
+				for (sum = 0, j = 0; j < scale; j++)
+					for (i = 0; i < scale; i++)
+						sum += bdf_pixel(&font, g, x * scale + i, y * scale + j);
+				sum = (sum * top + scale * scale / 2) / (scale * scale);
+				data[k + y * rowbytes + x * bpp / 8] |= sum << (8 - bpp - x * bpp % 8);
+			}
+		k += rowbytes * h;
+	}
+	fprintf(stderr, "%s: %dx%d, %d bpp, %d chars, font %ld\n", fn, w, h, bpp, n, size);
+	write_header(out, fn, 0, 0, "anti-aliased font, see lcd7735_setFont()", size);
+	write_u8(out, name, data, size);
+	free(data);
+}
+
+// Code point ranges selected with -r
+typedef struct _ranges {
+	int		n;
+	int		first[64], last[64];
+} Ranges;
+
+static int parse_ranges(Ranges *r, const char *arg) {
+	const char *p = arg;
+	char *end;
+	long a, b;
+
+	r->n = 0;
+	while (*p) {
+		a = strtol(p, &end, 0);
+		if (end == p)
+			return 0;
+		b = a;
+		p = end;
+		if (*p == '-') {
+			b = strtol(p + 1, &end, 0);
+			if (end == p + 1)
+				return 0;
+			p = end;
+		}
+		if (a < 0 || b < a || b > 0xFFFF || r->n == 64)
+			return 0;
+		r->first[r->n] = a;
+		r->last[r->n++] = b;
+		if (*p == ',')
+			p++;
+		else if (*p)
+			return 0;
+	}
+	return r->n > 0;
+}
+
+// Next code point of a UTF-8 string
+static int utf8_next(const char **s) {
+	const uint8_t *p = (const uint8_t *)*s;
+	int c = *p++, n = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+
+	if (n)
+		c &= 0x3F >> n;
+	while (n-- && (*p & 0xC0) == 0x80)
+		c = (c << 6) | (*p++ & 0x3F);
+	*s = (const char *)p;
+	return c;
+}
+
+// One kerning file token: a UTF-8 character or U+XXXX
+static int kern_char(const char **s) {
+	const char *p = *s;
+	int c;
+
+	while (*p == ' ' || *p == '\t')
+		p++;
+	if (!*p || *p == '\n' || *p == '\r')
+		return -1;
+	if (p[0] == 'U' && p[1] == '+' && isxdigit((unsigned char)p[2])) {
+		c = strtol(p + 2, (char **)&p, 16);
+	} else {
+		c = utf8_next(&p);
+	}
+	*s = p;
+	return c;
+}
+
+static int floor_div(int a, int b) {
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+typedef struct _pglyph {
+	int		code;
+	int		x, y, w, h;		// box, y from the BDF ascent line
+	int		advance;
+	long		offset;
+	uint8_t		*lev;			// w*h levels
+	uint8_t		*data;			// encoded bitmap
+	int		size;
+} PGlyph;
+
+typedef struct _kern {
+	int		left, right, adj;
+} Kern;
+
+static int cmp_kern(const void *a, const void *b) {
+	const Kern *ka = (const Kern *)a, *kb = (const Kern *)b;
+
+	if (ka->left != kb->left)
+		return ka->left - kb->left;
+	return ka->right - kb->right;
+}
+
+// Rows of n levels packed at bpp bits, each row padded to a byte
+static int glyph_pack(const uint8_t *lev, int w, int h, int bpp, uint8_t *out) {
+	int rowbytes = (w * bpp + 7) / 8, x, y;
+
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			out[y * rowbytes + x * bpp / 8] |= lev[y * w + x] << (8 - bpp - x * bpp % 8);
+	return rowbytes * h;
+}
+
+// FONT_RLE tokens for n levels with the fewest bytes: runs of level 0 or of
+// the top level cost a byte, literals a byte plus the packed levels
+static int glyph_rle(const uint8_t *lev, int n, int bpp, uint8_t *out) {
+	int top = (1 << bpp) - 1, *cost = xmalloc((n + 1) * sizeof(int));
+	int *from = xmalloc((n + 1) * sizeof(int)), *tok = xmalloc((n + 1) * sizeof(int));
+	int i, j, k, len = 0, c;
+
+	for (i = 1; i <= n; i++) {
+		cost[i] = 1 << 30;
+		for (j = i - 1; j >= 0 && i - j <= 64; j--) {
+			c = cost[j] + 1 + ((i - j) * bpp + 7) / 8;
+			if (c < cost[i]) {
+				cost[i] = c;
+				from[i] = j;
+				tok[i] = GLYPH_LITERAL;
+			}
+		}
+		if (lev[i - 1] == 0 || lev[i - 1] == top) {
+			for (j = i - 1; j >= 0 && i - j <= 64 && lev[j] == lev[i - 1]; j--) {
+				if (cost[j] + 1 <= cost[i]) {
+					cost[i] = cost[j] + 1;
+					from[i] = j;
+					tok[i] = lev[i - 1] ? GLYPH_RUN_FG : GLYPH_RUN_BG;
+				}
+			}
+		}
+	}
+	// tokens were found back to front, chain them up front to back
+	for (i = n, j = 0; i > 0; i = from[i])
+		cost[j++] = i;
+	while (j--) {
+		i = cost[j];
+		k = from[i];
+		out[len++] = tok[i] | (i - k - 1);
+		if (tok[i] == GLYPH_LITERAL) {
+			for (c = 0; c < i - k; c++)
+				out[len + c * bpp / 8] |= lev[k + c] << (8 - bpp - c * bpp % 8);
+			len += ((i - k) * bpp + 7) / 8;
+		}
+	}
+	free(cost);
+	free(from);
+	free(tok);
+	return len;
+}
+
+// Proportional font: every glyph is cut to the box of its covered pixels,
+// code points come from the -r ranges and glyphs missing in the BDF font are
+// left out of the range table
+static void convert_font_prop(FILE *out, const char *fn, const char *name, const Ranges *r,
+		int bpp, int scale, const char *kernfn, int rle) {
+	Bdf font;
+	const Glyph *g;
+	PGlyph *pg;
+	Kern *kern = NULL;
+	uint8_t *data, *lev, *d;
+	int asc, top, bottom, np = 0, nk = 0, nr = 0, i, j, k, c, x, y, x0, y0, x1, y1, sum, gx, gy;
+	int maxlev = (1 << bpp) - 1, ty, bx0, bx1, by0, by1;
+	long bits = 0, packed = 0, size;
+
+	load_font(&font, fn);
+	asc = font.h + font.y;
+	pg = xmalloc(65536 * sizeof(PGlyph));
+	for (c = 0; c <= 0xFFFF; c++) {
+		for (i = 0; i < r->n; i++)
+			if (c >= r->first[i] && c <= r->last[i])
+				break;
+		if (i == r->n)
+			continue;
+		g = bdf_glyph(&font, c);
+		if (!g) {
+			fprintf(stderr, "%s: no glyph for U+%04X, left out\n", fn, c);
+			continue;
+		}
+		// scaled box, then coverage, then the box is cut to the covered pixels
+		ty = asc - g->bby - g->bbh;
+		x0 = floor_div(g->bbx, scale);
+		y0 = floor_div(ty, scale);
+		x1 = floor_div(g->bbx + g->bbw + scale - 1, scale);
+		y1 = floor_div(ty + g->bbh + scale - 1, scale);
+		lev = xmalloc((x1 - x0) * (y1 - y0) + 1);
+		for (y = y0; y < y1; y++)
+			for (x = x0; x < x1; x++) {
+				for (sum = 0, j = 0; j < scale; j++)
+					for (i = 0; i < scale; i++) {
+						gx = x * scale + i - g->bbx;
+						gy = y * scale + j - ty;
+						if (gx >= 0 && gy >= 0 && gx < g->bbw && gy < g->bbh)
+							sum += (g->bits[gy * ((g->bbw + 7) / 8) + gx / 8] >> (7 - gx % 8)) & 1;
+					}
+				lev[(y - y0) * (x1 - x0) + x - x0] = (sum * maxlev + scale * scale / 2) / (scale * scale);
+			}
+		pg[np].code = c;
+		pg[np].advance = (g->dwidth + scale / 2) / scale;
+		pg[np].x = pg[np].y = pg[np].w = pg[np].h = 0;
+		bx0 = x1;
+		bx1 = x0 - 1;
+		by0 = y1;
+		by1 = y0 - 1;
+		for (y = y0; y < y1; y++)
+			for (x = x0; x < x1; x++)
+				if (lev[(y - y0) * (x1 - x0) + x - x0]) {
+					bx0 = x < bx0 ? x : bx0;
+					bx1 = x > bx1 ? x : bx1;
+					by0 = y < by0 ? y : by0;
+					by1 = y > by1 ? y : by1;
+				}
+		if (bx1 >= bx0) {
+			pg[np].x = bx0;
+			pg[np].y = by0;
+			pg[np].w = bx1 - bx0 + 1;
+			pg[np].h = by1 - by0 + 1;
+			pg[np].lev = xmalloc(pg[np].w * pg[np].h);
+			for (y = 0; y < pg[np].h; y++)
+				for (x = 0; x < pg[np].w; x++)
+					pg[np].lev[y * pg[np].w + x] = lev[(by0 - y0 + y) * (x1 - x0) + bx0 - x0 + x];
+		}
+		free(lev);
+		if (pg[np].x < -128 || pg[np].x > 127 || pg[np].w > 255 || pg[np].h > 255 || pg[np].advance > 255)
+			die("glyph too large", fn);
+		np++;
+	}
+	if (!np)
+		die("no glyphs in the ranges", fn);
+
+	// line: from the font box or the highest glyph to the lowest one
+	top = 0;
+	bottom = (font.h + scale - 1) / scale;
+	for (i = 0; i < np; i++) {
+		if (pg[i].h && pg[i].y < top)
+			top = pg[i].y;
+		if (pg[i].h && pg[i].y + pg[i].h > bottom)
+			bottom = pg[i].y + pg[i].h;
+	}
+	if (bottom - top > 255)
+		die("font too large", fn);
+	for (i = 0; i < np; i++) {
+		// a literal of n pixels costs at most 1 + n bytes
+		pg[i].data = xmalloc(pg[i].w * pg[i].h * 2 + 1);
+		if (rle)
+			pg[i].size = glyph_rle(pg[i].lev, pg[i].w * pg[i].h, bpp, pg[i].data);
+		else
+			pg[i].size = glyph_pack(pg[i].lev, pg[i].w, pg[i].h, bpp, pg[i].data);
+		packed += (long)((pg[i].w * bpp + 7) / 8) * pg[i].h;
+		pg[i].offset = bits;
+		bits += pg[i].size;
+		if (i == 0 || pg[i].code != pg[i - 1].code + 1)
+			nr++;
+	}
+	if (bits > 0xFFFFFF)
+		die("font too large", fn);
+
+	if (kernfn) {
+		size_t len;
+		char *buf = (char *)load_file(kernfn, &len), *line, *next;
+		const char *q;
+		int a, b;
+
+		kern = xmalloc((len / 4 + 1) * sizeof(Kern));
+		for (line = buf; line && *line; line = next) {
+			next = strchr(line, '\n');
+			if (next)
+				*next++ = 0;
+			if (line[0] == '#')
+				continue;
+			q = line;
+			a = kern_char(&q);
+			b = kern_char(&q);
+			if (a < 0 || b < 0)
+				continue;
+			kern[nk].adj = strtol(q, NULL, 0);
+			kern[nk].left = kern[nk].right = -1;
+			for (i = 0; i < np; i++) {
+				if (pg[i].code == a)
+					kern[nk].left = i;
+				if (pg[i].code == b)
+					kern[nk].right = i;
+			}
+			if (kern[nk].left >= 0 && kern[nk].right >= 0 && kern[nk].adj)
+				nk++;
+		}
+		free(buf);
+		qsort(kern, nk, sizeof(Kern), cmp_kern);
+		for (i = j = 0; i < nk; i++)
+			if (j == 0 || cmp_kern(&kern[i], &kern[j - 1]))
+				kern[j++] = kern[i];
+		nk = j;
+	}
+
+	size = FONT_PROP_HEADER + nr * 6 + np * 8 + nk * 5 + bits;
+	data = xmalloc(size);
+	data[0] = 0;
+	data[1] = FONT_PROP | (rle ? FONT_RLE : 0) | bpp;
+	data[2] = bottom - top;
+	data[3] = (asc + scale / 2) / scale - top;
+	data[4] = nr;
+	data[5] = nr >> 8;
+	data[6] = np;
+	data[7] = np >> 8;
+	data[8] = nk;
+	data[9] = nk >> 8;
+	d = data + FONT_PROP_HEADER;
+	for (i = 0; i < np; i = j) {
+		for (j = i + 1; j < np && pg[j].code == pg[j - 1].code + 1; j++)
+			;
+		d[0] = pg[i].code;
+		d[1] = pg[i].code >> 8;
+		d[2] = j - i;
+		d[3] = (j - i) >> 8;
+		d[4] = i;
+		d[5] = i >> 8;
+		d += 6;
+	}
+	for (i = 0; i < np; i++, d += 8) {
+		d[0] = pg[i].offset;
+		d[1] = pg[i].offset >> 8;
+		d[2] = pg[i].offset >> 16;
+		d[3] = pg[i].w;
+		d[4] = pg[i].h;
+		d[5] = (uint8_t)pg[i].x;
+		d[6] = pg[i].h ? pg[i].y - top : 0;
+		d[7] = pg[i].advance;
+	}
+	for (i = 0; i < nk; i++, d += 5) {
+		d[0] = kern[i].left;
+		d[1] = kern[i].left >> 8;
+		d[2] = kern[i].right;
+		d[3] = kern[i].right >> 8;
+		d[4] = (uint8_t)kern[i].adj;
+	}
+	for (i = 0; i < np; i++) {
+		memcpy(d, pg[i].data, pg[i].size);
+		d += pg[i].size;
+		free(pg[i].lev);
+		free(pg[i].data);
+	}
+	for (i = 0, k = 0; i < np; i++)
+		k += pg[i].advance;
+	fprintf(stderr, "%s: height %d, %d bpp, %d glyphs in %d ranges, %d kerning pairs, mean advance %d, font %ld\n",
+			fn, bottom - top, bpp, np, nr, nk, k / np, size);
+	if (rle)
+		fprintf(stderr, "%s: glyph runs %ld bytes, packed rows would be %ld\n", fn, bits, packed);
+	write_header(out, fn, 0, 0, "proportional font, see lcd7735_setFont()", size);
+	write_u8(out, name, data, size);
+	free(data);
+	free(kern);
+	free(pg);
+}
+
+/********************************************************************
+ * Vector paths
+ ********************************************************************/
+
+typedef struct _path_cmd {
+	int		op;
+	int		n;		// points
+	double		x[3], y[3];
+} PathCmd;
+
+typedef struct _path_cmds {
+	PathCmd		*v;
+	int		n, size;
+} PathCmds;
+
+static void path_add(PathCmds *c, int op, int n, const double *pt) {
+	int i;
+
+	if (c->n == c->size) {
+		c->size = c->size ? c->size * 2 : 64;
+		c->v = realloc(c->v, c->size * sizeof(PathCmd));
+		if (!c->v)
+			die("out of memory", NULL);
+	}
+	c->v[c->n].op = op;
+	c->v[c->n].n = n;
+	for (i = 0; i < n; i++) {
+		c->v[c->n].x[i] = pt[2 * i];
+		c->v[c->n].y[i] = pt[2 * i + 1];
+	}
+	c->n++;
+}
+
+static int svg_number(const char **s, double *v) {
+	char *end;
+
+	while (isspace((unsigned char)**s) || **s == ',')
+		(*s)++;
+	*v = strtod(*s, &end);
+	if (end == *s)
+		return 0;
+	*s = end;
+	return 1;
+}
+
+// SVG path data to absolute move, line, quad, cubic and close commands
+static void parse_svg_path(PathCmds *c, const char *d) {
+	double cx = 0, cy = 0, sx = 0, sy = 0, qx = 0, qy = 0, v[6], pt[6];
+	int cmd = 0, last = 0, rel, i, n;
+
+	for (;;) {
+		while (isspace((unsigned char)*d) || *d == ',')
+			d++;
+		if (!*d)
+			break;
+		if (isalpha((unsigned char)*d))
+			cmd = *d++;
+		else if (!cmd)
+			die("path data must start with a command", NULL);
+		rel = islower(cmd);
+		switch (toupper(cmd)) {
+		case 'Z':
+			path_add(c, PATH_OP_CLOSE, 0, NULL);
+			cx = sx;
+			cy = sy;
+			last = 'Z';
+			cmd = 0;
+			continue;
+		case 'M': case 'L': case 'T':
+			n = 2;
+			break;
+		case 'H': case 'V':
+			n = 1;
+			break;
+		case 'Q': case 'S':
+			n = 4;
+			break;
+		case 'C':
+			n = 6;
+			break;
+		default:
+			die(toupper(cmd) == 'A' ? "arcs are not supported" : "bad path command", d - 1);
+		}
+		for (i = 0; i < n; i++)
+			if (!svg_number(&d, &v[i]))
+				die("missing path coordinate", d);
+		if (toupper(cmd) == 'H') {
+			v[1] = rel ? 0 : cy;
+			n = 2;
+		} else if (toupper(cmd) == 'V') {
+			v[1] = v[0];
+			v[0] = rel ? 0 : cx;
+			n = 2;
+		}
+		for (i = 0; i < n; i += 2) {
+			pt[i] = v[i] + (rel ? cx : 0);
+			pt[i + 1] = v[i + 1] + (rel ? cy : 0);
+		}
+		switch (toupper(cmd)) {
+		case 'M':
+			path_add(c, PATH_OP_MOVE, 1, pt);
+			sx = pt[0];
+			sy = pt[1];
+			// further pairs are lines
+			cmd = rel ? 'l' : 'L';
+			break;
+		case 'H': case 'V': case 'L':
+			path_add(c, PATH_OP_LINE, 1, pt);
+			break;
+		case 'T':
+			pt[2] = pt[0];
+			pt[3] = pt[1];
+			pt[0] = (last == 'Q' || last == 'T') ? 2 * cx - qx : cx;
+			pt[1] = (last == 'Q' || last == 'T') ? 2 * cy - qy : cy;
+			// fall through
+		case 'Q':
+			path_add(c, PATH_OP_QUAD, 2, pt);
+			qx = pt[0];
+			qy = pt[1];
+			break;
+		case 'S':
+			memmove(pt + 2, pt, 4 * sizeof(double));
+			pt[0] = (last == 'C' || last == 'S') ? 2 * cx - qx : cx;
+			pt[1] = (last == 'C' || last == 'S') ? 2 * cy - qy : cy;
+			// fall through
+		case 'C':
+			path_add(c, PATH_OP_CUBIC, 3, pt);
+			qx = pt[2];
+			qy = pt[3];
+			break;
+		}
+		cx = c->v[c->n - 1].x[c->v[c->n - 1].n - 1];
+		cy = c->v[c->n - 1].y[c->v[c->n - 1].n - 1];
+		last = toupper(cmd);
+	}
+}
+
+// Commands of the input, SVG path data or the path elements of an SVG file,
+// each parsed on its own as a first relative moveto is absolute
+static void load_path_data(PathCmds *c, const char *fn, int *evenodd) {
+	size_t len;
+	char *buf = (char *)load_file(fn, &len), *p, *end;
+
+	if (!strstr(buf, "<svg")) {
+		parse_svg_path(c, buf);
+		free(buf);
+		return;
+	}
+	if (strstr(buf, "fill-rule=\"evenodd\""))
+		*evenodd = 1;
+	for (p = buf; (p = strstr(p, "<path")) != NULL; p = end + 1) {
+		if (!(p = strstr(p, " d=\"")) || !(end = strchr(p + 4, '"')))
+			break;
+		*end = 0;
+		parse_svg_path(c, p + 4);
+	}
+	free(buf);
+}
+
+static void convert_path(FILE *out, const char *fn, const char *name, int evenodd) {
+	PathCmds c = { NULL, 0, 0 };
+	uint8_t *buf;
+	long *q;
+	int i, j, k, m, n, s, op, w, wide, run, npts = 0, maxx = 0, maxy = 0;
+	long px = 0, py = 0, lx, ly, dx, dy;
+	char fmt[64];
+
+	load_path_data(&c, fn, &evenodd);
+	if (!c.n)
+		die("no path data", fn);
+	for (i = 0; i < c.n; i++)
+		npts += c.v[i].n;
+	// coordinates in 1/16 pixel, then the fewest fraction bits keeping them
+	q = xmalloc(2 * npts * sizeof(long));
+	for (i = k = 0; i < c.n; i++)
+		for (j = 0; j < c.v[i].n; j++, k += 2) {
+			q[k] = (long)((c.v[i].x[j] * 16) + (c.v[i].x[j] < 0 ? -0.5 : 0.5));
+			q[k + 1] = (long)((c.v[i].y[j] * 16) + (c.v[i].y[j] < 0 ? -0.5 : 0.5));
+			if ((q[k] + 15) / 16 > maxx)
+				maxx = (q[k] + 15) / 16;
+			if ((q[k + 1] + 15) / 16 > maxy)
+				maxy = (q[k + 1] + 15) / 16;
+		}
+	for (s = 0; s < 4; s++) {
+		for (k = 0; k < 2 * npts && q[k] % (16 >> s) == 0; k++)
+			;
+		if (k == 2 * npts)
+			break;
+	}
+	for (k = 0; k < 2 * npts; k++)
+		q[k] /= 16 >> s;
+
+	// worst case 1 + 4 bytes per point and an op byte per command
+	buf = xmalloc(2 + c.n + 4 * npts);
+	n = 0;
+	buf[n++] = s | (evenodd ? PATH_FMT_EVENODD : 0);
+	for (i = k = 0; i < c.n; i += run) {
+		op = c.v[i].op;
+		// commands of the same op and size share an op byte, up to 16
+		for (run = 0, wide = -1, j = k; i + run < c.n && run < 16 && c.v[i + run].op == op; run++) {
+			w = 0;
+			lx = run ? q[j - 2] : px;
+			ly = run ? q[j - 1] : py;
+			for (m = 0; m < c.v[i + run].n; m++, j += 2) {
+				dx = q[j] - lx;
+				dy = q[j + 1] - ly;
+				if (dx < -128 || dx > 127 || dy < -128 || dy > 127)
+					w = 1;
+				lx = q[j];
+				ly = q[j + 1];
+			}
+			if (wide >= 0 && w != wide)
+				break;
+			wide = w;
+		}
+		buf[n++] = op | (wide > 0 ? PATH_FMT_WIDE : 0) | (run - 1) << 4;
+		for (j = 0; j < run; j++) {
+			for (m = 0; m < c.v[i + j].n; m++, k += 2) {
+				dx = q[k] - px;
+				dy = q[k + 1] - py;
+				if (dx < -32768 || dx > 32767 || dy < -32768 || dy > 32767)
+					die("path coordinates out of range", fn);
+				if (wide > 0) {
+					buf[n++] = dx & 0xFF;
+					buf[n++] = (dx >> 8) & 0xFF;
+					buf[n++] = dy & 0xFF;
+					buf[n++] = (dy >> 8) & 0xFF;
+				} else {
+					buf[n++] = dx & 0xFF;
+					buf[n++] = dy & 0xFF;
+				}
+				px = q[k];
+				py = q[k + 1];
+			}
+		}
+	}
+	buf[n++] = PATH_OP_END;
+
+	fprintf(stderr, "path: %d commands, %d points, %d fraction bits, %d bytes\n", c.n, npts, s, n);
+	snprintf(fmt, sizeof(fmt), "vector path, %s, %d fraction bits, see lcd7735_path_load()", evenodd ? "even-odd" : "nonzero", s);
+	write_header(out, fn, maxx, maxy, fmt, n);
+	write_u8(out, name, buf, n);
+	free(buf);
+	free(q);
+	free(c.v);
+}
+
+/********************************************************************/
+
+static void usage(void) {
+	fprintf(stderr,
+		"usage: imgconv [-f raw|swap|rle|index] [-n name] [-k RRGGBB] [-o out.h] image.{png,ppm,bmp}\n"
+		"       imgconv [-r first-last] [-b 2|4 [-S scale]] [-n name] [-o out.h] font.bdf|file.c:array\n"
+		"       imgconv -p [-c] [-r ranges] [-b 1|2|4] [-S scale] [-j kern.txt] [-n name] [-o out.h] font.bdf|file.c:array\n"
+		"       imgconv -a ms [-K keyint] [-n name] [-k RRGGBB] [-o out.h] frame0 frame1 ...\n"
+		"       imgconv -v [-e] [-n name] [-o out.h] path.txt|image.svg\n");
+	exit(2);
+}
+
+int main(int argc, char **argv) {
+	const char *format = NULL, *outname = NULL, *in = NULL, *ext;
+	char name[256] = "", *p;
+	uint8_t bg[3] = { 0, 0, 0 };
+	unsigned long rgb;
+	int first = 0x20, last = 0x7E, i, period = 0, keyint = 0, nframes = 0, bpp = 1, scale = 1, prop = 0, rle = 0, font, path = 0, evenodd = 0;
+	const char *kernfn = NULL;
+	Ranges ranges = { 1, { 0x20 }, { 0x7E } };
+	char **frames = xmalloc(argc * sizeof(char *));
+	FILE *out = stdout;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+			format = argv[++i];
+		} else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			snprintf(name, sizeof(name), "%s", argv[++i]);
+		} else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			outname = argv[++i];
+		} else if (!strcmp(argv[i], "-k") && i + 1 < argc) {
+			rgb = strtoul(argv[++i], NULL, 16);
+			bg[0] = rgb >> 16;
+			bg[1] = rgb >> 8;
+			bg[2] = rgb;
+		} else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+			if (!parse_ranges(&ranges, argv[++i]))
+				usage();
+		} else if (!strcmp(argv[i], "-v")) {
+			path = 1;
+		} else if (!strcmp(argv[i], "-e")) {
+			evenodd = 1;
+		} else if (!strcmp(argv[i], "-p")) {
+			prop = 1;
+		} else if (!strcmp(argv[i], "-c")) {
+			rle = 1;
+		} else if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+			kernfn = argv[++i];
+		} else if (!strcmp(argv[i], "-b") && i + 1 < argc) {
+			bpp = atoi(argv[++i]);
+			if (bpp != 1 && bpp != 2 && bpp != 4)
+				usage();
+		} else if (!strcmp(argv[i], "-S") && i + 1 < argc) {
+			scale = atoi(argv[++i]);
+			if (scale < 1 || scale > 16)
+				usage();
+		} else if (!strcmp(argv[i], "-a") && i + 1 < argc) {
+			period = atoi(argv[++i]);
+			if (period <= 0 || period > 0xFFFF)
+				usage();
+		} else if (!strcmp(argv[i], "-K") && i + 1 < argc) {
+			keyint = atoi(argv[++i]);
+		} else if (argv[i][0] == '-' || (in && !period)) {
+			usage();
+		} else {
+			frames[nframes++] = argv[i];
+			if (!in)
+				in = argv[i];
+		}
+	}
+
+	if (!in)
+		usage();
+
+	if (!name[0] && (p = strstr(in, ".c:")) != NULL) {
+		snprintf(name, sizeof(name), "%s", p + 3);
+	} else if (!name[0]) {
+		p = strrchr(in, '/');
+		snprintf(name, sizeof(name), "%s", p ? p + 1 : in);
+		if ((p = strrchr(name, '.')) != NULL)
+			*p = 0;
+		for (p = name; *p; p++)
+			if (!isalnum((unsigned char)*p))
+				*p = '_';
+	}
+	if (outname && !(out = fopen(outname, "w")))
+		die("can't create", outname);
+
+	if (!prop) {
+		// UTFT and anti-aliased fonts hold one range of 8-bit codes
+		first = ranges.first[0];
+		last = ranges.last[0];
+		if (ranges.n != 1 || last > 255)
+			usage();
+	}
+
+	ext = strrchr(in, '.');
+	font = ext && (!strcmp(ext, ".bdf") || !strncmp(ext, ".c:", 3));
+	if (rle && !prop)
+		usage();
+	if (path)
+		convert_path(out, in, name, evenodd);
+	else if (period)
+		convert_anim(out, frames, nframes, name, period, keyint, bg);
+	else if (font && prop)
+		convert_font_prop(out, in, name, &ranges, bpp, scale, kernfn, rle);
+	else if (font && (bpp > 1 || scale > 1))
+		convert_font_aa(out, in, name, first, last, bpp > 1 ? bpp : 4, scale);
+	else if (font)
+		convert_font(out, in, name, first, last);
+	else
+		convert_image(out, in, name, format, bg);
+
+	if (out != stdout)
+		fclose(out);
+	free(frames);
+	return 0;
+}
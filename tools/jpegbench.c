@@ -0,0 +1,196 @@
+/*********************************************************************************
+jpegbench - host benchmark of the ST7735 JPEG decoder
+
+Decodes JPEG images with ST7735_jpeg.c through the real driver on the emulated
+panel of tools/host/panel.c at the scales 1, 1/2, 1/4 and 1/8 and reports
+for each the host time of a decode, the pixels, commands and bytes sent to
+the panel and the size of the JPEG data against the same image as RGB565.
+Without files the tux image of src/tux_50_jpg.h is used. Images larger than
+the panel are decoded whole, the part outside the screen is clipped and every
+visible pixel has to be sent once. In all four rotations the tux has to be
+laid out like lcd7735_drawBitmap() draws its decoded pixels, also across the
+screen edges. The first image at full scale is written as a PPM image.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o jpegbench tools/jpegbench.c tools/host/panel.c src/ST7735.c src/ST7735_jpeg.c src/DefaultFonts.c -lm
+Usage:  jpegbench [-n loops] [-o out.ppm] [image.jpg ...]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_jpeg.h"
+#include "panel.h"
+#include "tux_50_jpg.h"
+
+static unsigned long violations;
+
+/******************** benchmark ********************/
+
+static JpegDec jd;
+
+// Pixels of n from 0 on that are on a screen of size pixels
+static int clip(int n, int size) {
+	return n < size ? n : size;
+}
+
+static int decode(const uint8_t *data, uint32_t size, int x, int y, uint8_t scale) {
+	JpegMem src;
+	int res;
+
+	src.data = data;
+	src.size = size;
+	src.pos = 0;
+	res = lcd7735_jpeg_prepare(&jd, lcd7735_jpeg_memInput, &src);
+	if (res == JPEG_OK)
+		res = lcd7735_jpeg_draw(&jd, x, y, scale);
+	return res;
+}
+
+static void bench(const char *name, const uint8_t *data, uint32_t size, int loops) {
+	static const char *scales[] = { "1", "1/2", "1/4", "1/8" };
+	unsigned long bytes, cmds, pixels, visible;
+	double t;
+	uint8_t s;
+	int i, res;
+
+	for (s = JPEG_SCALE_1; s <= JPEG_SCALE_1_8; s++) {
+		res = decode(data, size, 0, 0, s);
+		if (res != JPEG_OK) {
+			fprintf(stderr, "jpegbench: %s: error %d\n", name, res);
+			violations++;
+			return;
+		}
+		bytes = panel_bytes;
+		cmds = panel_cmds;
+		pixels = panel_pixels;
+		t = panel_time();
+		for (i = 0; i < loops; i++)
+			decode(data, size, 0, 0, s);
+		t = (panel_time() - t) / loops;
+		bytes = (panel_bytes - bytes) / loops;
+		cmds = (panel_cmds - cmds) / loops;
+		pixels = (panel_pixels - pixels) / loops;
+		if (s == JPEG_SCALE_1)
+			printf("%s: %dx%d, %lu B jpeg, %lu B as RGB565\n", name, jd.width, jd.height,
+				   (unsigned long)size, (unsigned long)jd.width * jd.height * 2);
+		printf("  %-3s %8.1f us  %6lu pixels  %5lu commands  %7lu B to panel\n",
+			   scales[s], t * 1e6, pixels, cmds, bytes);
+		// every visible pixel is sent once
+		visible = (unsigned long)clip((jd.width + (1 << s) - 1) >> s, lcd7735_getWidth()) *
+				  clip((jd.height + (1 << s) - 1) >> s, lcd7735_getHeight());
+		if (pixels != visible) {
+			fprintf(stderr, "jpegbench: %s at %s: %lu pixels sent, %lu visible\n", name, scales[s], pixels, visible);
+			violations++;
+		}
+	}
+}
+
+// The tux drawn at x,y in the current rotation has to match its pixels decoded
+// in portrait and drawn with lcd7735_drawBitmap(), moved to x,y and clipped
+static void layout(void) {
+	static const int pos[][2] = { { 0, 0 }, { 7, 3 }, { -13, -7 }, { -45, 20 }, { 100, 130 }, { 110, -30 } };
+	static uint16_t bmp[64 * 64], shot[64][64];
+	int rot, p, x, y, u, v, w, h, bad;
+
+	lcd7735_setRotation(PORTRAIT);
+	decode(tux_50_jpg, sizeof(tux_50_jpg), 0, 0, JPEG_SCALE_1);
+	w = jd.width;
+	h = jd.height;
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			bmp[y * w + x] = panel_pixel(x, y);
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		lcd7735_drawBitmap(0, 0, w, h, bmp, 1);
+		for (y = 0; y < h; y++)
+			for (x = 0; x < w; x++)
+				shot[y][x] = panel_pixel(x, y);
+		for (p = 0, bad = 0; p < (int)(sizeof(pos) / sizeof(pos[0])); p++) {
+			lcd7735_fillScreen(0x1234);
+			decode(tux_50_jpg, sizeof(tux_50_jpg), pos[p][0], pos[p][1], JPEG_SCALE_1);
+			for (y = 0; y < lcd7735_getHeight(); y++)
+				for (x = 0; x < lcd7735_getWidth(); x++) {
+					u = x - pos[p][0];
+					v = y - pos[p][1];
+					bad += panel_pixel(x, y) != (u >= 0 && u < w && v >= 0 && v < h ? shot[v][u] : 0x1234);
+				}
+		}
+		printf("tux_50_jpg rotation %d: %d pixels unlike lcd7735_drawBitmap()\n", rot, bad);
+		if (bad)
+			violations++;
+	}
+	lcd7735_setRotation(PORTRAIT);
+}
+
+static uint8_t *load(const char *fn, uint32_t *size) {
+	FILE *f = fopen(fn, "rb");
+	uint8_t *buf;
+	long len;
+
+	if (!f) {
+		perror(fn);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = malloc(len > 0 ? len : 1);
+	if (!buf || fread(buf, 1, len, f) != (size_t)len) {
+		fprintf(stderr, "jpegbench: can't read %s\n", fn);
+		exit(1);
+	}
+	fclose(f);
+	*size = len;
+	return buf;
+}
+
+static void write_ppm(const char *fn, const uint8_t *data, uint32_t size) {
+	lcd7735_fillScreen(0);
+	if (decode(data, size, 0, 0, JPEG_SCALE_1) != JPEG_OK)
+		return;
+	if (panel_writePPM(fn, clip(jd.width, lcd7735_getWidth()), clip(jd.height, lcd7735_getHeight()))) {
+		perror(fn);
+		exit(1);
+	}
+}
+
+int main(int argc, char **argv) {
+	const char *out = NULL;
+	uint32_t size;
+	uint8_t *data;
+	int loops = 200, files = 0, i;
+
+	lcd7735_initR(INITR_REDTAB);
+	printf("work area %u B\n", (unsigned)sizeof(JpegDec));
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			loops = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			out = argv[++i];
+		} else if (argv[i][0] == '-') {
+			fprintf(stderr, "usage: jpegbench [-n loops] [-o out.ppm] [image.jpg ...]\n");
+			return 2;
+		} else {
+			if (loops < 1)
+				loops = 1;
+			data = load(argv[i], &size);
+			bench(argv[i], data, size, loops);
+			if (!files++ && out)
+				write_ppm(out, data, size);
+			free(data);
+		}
+	}
+	if (!files) {
+		if (loops < 1)
+			loops = 1;
+		bench("tux_50_jpg", tux_50_jpg, sizeof(tux_50_jpg), loops);
+		if (out)
+			write_ppm(out, tux_50_jpg, sizeof(tux_50_jpg));
+	}
+	layout();
+	if (violations)
+		fprintf(stderr, "jpegbench: %lu violations\n", violations);
+	return violations != 0;
+}
@@ -0,0 +1,159 @@
+/*********************************************************************************
+pathbench - host benchmark of the ST7735 vector paths
+
+Draws the icons of src/gear_path.h and src/drop_path.h with ST7735_path.c
+through the real driver on the emulated panel of tools/host/panel.c, at 1x
+and 2x, and compares them with the same icons drawn as pre-rendered RGB565
+bitmaps by lcd7735_drawBitmap(). For each it reports the flash bytes, the
+host time of a draw and the bytes a draw sends to the panel. The bitmaps are
+rendered once by the path code, so both ways have to draw the same pixels.
+The icons are written side by side as a PPM image.
+
+A path is drawn transparent, only the spans inside it are sent, while a
+bitmap is opaque and sends its whole box. "on bg" is the path drawn opaque
+the simple way, the box filled with the background first, to compare like
+for like.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o pathbench tools/pathbench.c tools/host/panel.c src/ST7735.c src/ST7735_path.c src/ST7735_fill.c src/DefaultFonts.c -lm
+Usage:  pathbench [-n loops] [out.ppm]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_path.h"
+#include "gear_path.h"
+#include "drop_path.h"
+#include "panel.h"
+
+static unsigned long violations;
+static PathPoint points[1024];
+
+static void draw_path(const uint8_t *data, int x, int y, uint16_t scale, const Fill *f) {
+	Path p;
+	uint8_t rule;
+
+	lcd7735_path_init(&p, points, sizeof(points) / sizeof(points[0]));
+	rule = lcd7735_path_load(&p, data, x, y, scale);
+	if (p.overflow)
+		violations++;
+	lcd7735_path_fill(&p, rule, f);
+}
+
+// The path over its box filled with the background color
+static void draw_path_bg(const uint8_t *data, int x, int y, uint16_t scale, const Fill *f, int w, int h) {
+	lcd7735_fillRect(x, y, w, h, 0);
+	draw_path(data, x, y, scale, f);
+}
+
+// Sheet of the rendered icons
+#define SHEET_W	256
+#define SHEET_H	96
+static uint16_t sheet[SHEET_W * SHEET_H];
+static int sheet_x;
+
+static void bench(const char *name, const uint8_t *data, int size, int w, int h, int scale, int loops, const Fill *f) {
+	uint16_t *bmp;
+	unsigned long pb, ob, bb;
+	double t, tp, to, tb;
+	int i, x, y;
+
+	w *= scale;
+	h *= scale;
+	// pre-render the bitmap with the path code on a cleared screen
+	lcd7735_fillScreen(0);
+	draw_path(data, 0, 0, scale * 256, f);
+	bmp = malloc(w * h * 2);
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			bmp[y * w + x] = panel_pixel(x, y);
+	if (sheet_x + w <= SHEET_W) {
+		for (y = 0; y < h && y < SHEET_H; y++)
+			memcpy(&sheet[y * SHEET_W + sheet_x], bmp + y * w, w * 2);
+		sheet_x += w;
+	}
+
+	pb = panel_bytes;
+	t = panel_time();
+	for (i = 0; i < loops; i++)
+		draw_path(data, 0, 0, scale * 256, f);
+	tp = (panel_time() - t) / loops;
+	pb = (panel_bytes - pb) / loops;
+
+	ob = panel_bytes;
+	t = panel_time();
+	for (i = 0; i < loops; i++)
+		draw_path_bg(data, 0, 0, scale * 256, f, w, h);
+	to = (panel_time() - t) / loops;
+	ob = (panel_bytes - ob) / loops;
+
+	bb = panel_bytes;
+	t = panel_time();
+	for (i = 0; i < loops; i++)
+		lcd7735_drawBitmap(0, 0, w, h, bmp, 1);
+	tb = (panel_time() - t) / loops;
+	bb = (panel_bytes - bb) / loops;
+
+	// the bitmap draws the pixels of the path
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			violations += panel_pixel(x, y) != bmp[y * w + x];
+
+	printf("%-5s %dx %3dx%-3d  path %5d B %7.2f us %6lu B to panel   on bg %7.2f us %6lu B   bitmap %6d B %7.2f us %6lu B to panel\n",
+		   name, scale, w, h, size, tp * 1e6, pb, to * 1e6, ob, w * h * 2, tb * 1e6, bb);
+	free(bmp);
+}
+
+static void write_ppm(const char *fn) {
+	FILE *f = fopen(fn, "wb");
+	uint16_t c;
+	int i;
+
+	if (!f) {
+		perror(fn);
+		exit(1);
+	}
+	fprintf(f, "P6\n%d %d\n255\n", sheet_x, SHEET_H);
+	for (i = 0; i < sheet_x * SHEET_H; i++) {
+		c = sheet[i / sheet_x * SHEET_W + i % sheet_x];
+		fputc((c >> 11) << 3, f);
+		fputc(((c >> 5) & 0x3F) << 2, f);
+		fputc((c & 0x1F) << 3, f);
+	}
+	fclose(f);
+}
+
+int main(int argc, char **argv) {
+	const char *out = NULL;
+	int loops = 1000, i;
+	Fill gray, blue;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			loops = atoi(argv[++i]);
+		} else if (argv[i][0] == '-' || out) {
+			fprintf(stderr, "usage: pathbench [-n loops] [out.ppm]\n");
+			return 2;
+		} else {
+			out = argv[i];
+		}
+	}
+	if (loops < 1)
+		loops = 1;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_fill_solid(&gray, 0xC618);
+	lcd7735_fill_linear(&blue, 0, 0, 0x07FF, 0, 100, 0x001F);
+	bench("gear", gear_path, sizeof(gear_path), 48, 48, 1, loops, &gray);
+	bench("drop", drop_path, sizeof(drop_path), 32, 48, 1, loops, &blue);
+	bench("gear", gear_path, sizeof(gear_path), 48, 48, 2, loops, &gray);
+	bench("drop", drop_path, sizeof(drop_path), 32, 48, 2, loops, &blue);
+	if (out)
+		write_ppm(out);
+	if (violations)
+		fprintf(stderr, "pathbench: %lu violations\n", violations);
+	return violations != 0;
+}
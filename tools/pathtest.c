@@ -0,0 +1,305 @@
+/*********************************************************************************
+pathtest - host test of the ST7735 vector paths
+
+Fills paths with ST7735_path.c through the real driver on the emulated panel
+of tools/host/panel.c, in portrait and landscape, and checks every pixel
+against a floating point reference of the pixel centers:
+
+- Random polygons, also self-intersecting and off the screen, have to fill
+  exactly the pixels inside them by the nonzero and the even-odd rule. Only
+  centers within 1/64 pixel of an edge may go either way.
+- Random quadratic and cubic curves are compared with the exact curves. The
+  pixels that differ have to lie within PATH_TOLERANCE of the curve, plus
+  the rounding of the flattened points.
+- Strokes of random open and closed polylines have to cover the pixels
+  within half the width of the lines. The pixels that differ have to lie
+  within the octagons of the round joins and caps and the quarter pixel gap
+  of the other joins.
+
+The checksum of every byte sent to the panel is printed at the end. A build
+with -DPATH_MAX_EDGES=32 fills the longer paths in bands of rows and has to
+send the same stream, the table only has to hold the edges crossing a row.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o pathtest tools/pathtest.c tools/host/panel.c src/ST7735.c src/ST7735_path.c src/ST7735_fill.c src/DefaultFonts.c -lm
+Usage:  pathtest [paths]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_path.h"
+#include "panel.h"
+
+#define FG		0xFFFF
+#define CURVE_STEPS	1024
+#define MAX_REF		16384
+
+static PathPoint pts[4096], outline[16384];
+static double ref[MAX_REF][2];
+static int nref, contour[64], ncontours;
+static unsigned long failures;
+static uint32_t stream = 2166136261u;
+
+// FNV-1a of the stream, commands and data
+static void hook(uint8_t dc, uint8_t b) {
+	stream = (stream ^ (dc << 8 | b)) * 16777619u;
+}
+
+/******************** reference ********************/
+
+// The reference contours are lists of points in 1/16 pixel, contour[i] is
+// the end of contour i
+static void refPoint(double x, double y) {
+	if (nref < MAX_REF) {
+		ref[nref][0] = x;
+		ref[nref][1] = y;
+		nref++;
+	}
+}
+
+static void refEnd(void) {
+	if (ncontours < 64)
+		contour[ncontours++] = nref;
+}
+
+static double cross[MAX_REF];
+static int crossDir[MAX_REF], ncross;
+
+// Edges of the contours crossing the row through cy, with their direction
+static void row(double cy) {
+	const double *a, *b;
+	int c, i, s;
+
+	ncross = 0;
+	for (c = 0, s = 0; c < ncontours; s = contour[c++])
+		for (i = s; i < contour[c]; i++) {
+			a = ref[i];
+			b = ref[i + 1 < contour[c] ? i + 1 : s];
+			if (a[1] == b[1] || (cy < a[1] && cy < b[1]) || (cy >= a[1] && cy >= b[1]))
+				continue;
+			cross[ncross] = a[0] + (cy - a[1]) * (b[0] - a[0]) / (b[1] - a[1]);
+			crossDir[ncross++] = a[1] < b[1] ? 1 : -1;
+		}
+}
+
+// 1 if cx of the row is inside by rule, the edges left of it counted; near
+// is set when an edge passes within d of cx
+static int inside(double cx, uint8_t rule, double d, int *near) {
+	int i, w = 0;
+
+	*near = 0;
+	for (i = 0; i < ncross; i++) {
+		if (fabs(cross[i] - cx) < d)
+			*near = 1;
+		if (cross[i] <= cx)
+			w += rule == PATH_EVENODD ? 1 : crossDir[i];
+	}
+	return rule == PATH_EVENODD ? w & 1 : w != 0;
+}
+
+// Distance of x,y to segment a-b
+static double segDist(double x, double y, const double *a, const double *b) {
+	double dx = b[0] - a[0], dy = b[1] - a[1], l = dx * dx + dy * dy, t;
+
+	t = l == 0 ? 0 : ((x - a[0]) * dx + (y - a[1]) * dy) / l;
+	t = t < 0 ? 0 : t > 1 ? 1 : t;
+	return hypot(x - a[0] - t * dx, y - a[1] - t * dy);
+}
+
+// Distance of x,y to the outline of the contours, closed or open
+static double outlineDist(double x, double y, int closed) {
+	double d = 1e9, e;
+	int c, i, s;
+
+	for (c = 0, s = 0; c < ncontours; s = contour[c++])
+		for (i = s; i < contour[c]; i++) {
+			if (i + 1 == contour[c] && (!closed || i == s))
+				e = segDist(x, y, ref[i], ref[i]);
+			else
+				e = segDist(x, y, ref[i], ref[i + 1 < contour[c] ? i + 1 : s]);
+			if (e < d)
+				d = e;
+		}
+	return d;
+}
+
+/******************** tests ********************/
+
+static int coord(int size) {
+	return rand() % ((size + 40) * PATH_ONE) - 20 * PATH_ONE;
+}
+
+static void fill(Path *p, uint8_t rule) {
+	Fill f;
+
+	lcd7735_fill_solid(&f, FG);
+	lcd7735_fillScreen(0);
+	lcd7735_path_fill(p, rule, &f);
+}
+
+// Pixels of the polygons filled by both rules that differ from the reference
+static int polygons(int n) {
+	Path p;
+	uint8_t rule;
+	int k, c, i, m, x, y, in, near, bad = 0;
+
+	for (k = 0; k < n; k++) {
+		lcd7735_path_init(&p, pts, sizeof(pts) / sizeof(pts[0]));
+		nref = ncontours = 0;
+		for (c = 0; c < 1 + k % 3; c++) {
+			m = 3 + rand() % 10;
+			for (i = 0; i < m; i++) {
+				x = coord(lcd7735_getWidth());
+				y = coord(lcd7735_getHeight());
+				if (i == 0)
+					lcd7735_path_moveTo(&p, x, y);
+				else
+					lcd7735_path_lineTo(&p, x, y);
+				refPoint(x, y);
+			}
+			lcd7735_path_close(&p);
+			refEnd();
+		}
+		for (rule = PATH_NONZERO; rule <= PATH_EVENODD; rule++) {
+			fill(&p, rule);
+			for (y = 0; y < lcd7735_getHeight(); y++)
+				for (row(16 * y + 8), x = 0; x < lcd7735_getWidth(); x++) {
+					in = inside(16 * x + 8, rule, PATH_ONE / 64.0, &near);
+					if (in != (panel_pixel(x, y) == FG) && !near && !bad++)
+						printf("polygon %d rule %d: pixel %d,%d %s\n", k, rule, x, y, in ? "missing" : "outside");
+				}
+		}
+	}
+	return bad;
+}
+
+// Pixels of curved paths that differ from the exact curves farther than the
+// tolerance, chord counts those within it
+static int curves(int n, unsigned long *chord) {
+	Path p;
+	double t, u, v[8];
+	int k, c, j, i, x, y, in, near, bad = 0;
+
+	for (k = 0; k < n; k++) {
+		lcd7735_path_init(&p, pts, sizeof(pts) / sizeof(pts[0]));
+		nref = ncontours = 0;
+		for (c = 0; c < 1 + k % 2; c++) {
+			v[0] = coord(lcd7735_getWidth());
+			v[1] = coord(lcd7735_getHeight());
+			lcd7735_path_moveTo(&p, v[0], v[1]);
+			refPoint(v[0], v[1]);
+			for (j = 0; j < 3; j++) {
+				for (i = 2; i < 8; i++)
+					v[i] = coord(i & 1 ? lcd7735_getHeight() : lcd7735_getWidth());
+				if ((k + j) & 1)
+					lcd7735_path_quadTo(&p, v[2], v[3], v[4], v[5]);
+				else
+					lcd7735_path_cubicTo(&p, v[2], v[3], v[4], v[5], v[6], v[7]);
+				for (i = 1; i <= CURVE_STEPS; i++) {
+					t = (double)i / CURVE_STEPS;
+					u = 1 - t;
+					if ((k + j) & 1)
+						refPoint(u * u * v[0] + 2 * u * t * v[2] + t * t * v[4],
+								 u * u * v[1] + 2 * u * t * v[3] + t * t * v[5]);
+					else
+						refPoint(u * u * u * v[0] + 3 * u * u * t * v[2] + 3 * u * t * t * v[4] + t * t * t * v[6],
+								 u * u * u * v[1] + 3 * u * u * t * v[3] + 3 * u * t * t * v[5] + t * t * t * v[7]);
+				}
+				v[0] = v[(k + j) & 1 ? 4 : 6];
+				v[1] = v[(k + j) & 1 ? 5 : 7];
+			}
+			lcd7735_path_close(&p);
+			refEnd();
+		}
+		if (p.overflow && !bad++)
+			printf("curve %d: %u points don't fit\n", k, p.n);
+		fill(&p, k & 2 ? PATH_EVENODD : PATH_NONZERO);
+		for (y = 0; y < lcd7735_getHeight(); y++)
+			for (row(16 * y + 8), x = 0; x < lcd7735_getWidth(); x++) {
+				in = inside(16 * x + 8, k & 2 ? PATH_EVENODD : PATH_NONZERO, 0, &near);
+				if (in == (panel_pixel(x, y) == FG))
+					continue;
+				// the flattened points are rounded to 1/16 pixel
+				if (outlineDist(16 * x + 8, 16 * y + 8, 1) <= PATH_TOLERANCE + 1)
+					(*chord)++;
+				else if (!bad++)
+					printf("curve %d: pixel %d,%d %s\n", k, x, y, in ? "missing" : "outside");
+			}
+	}
+	return bad;
+}
+
+// Pixels of strokes that differ from the lines width wide farther than the
+// joins and caps allow, edge counts those within
+static int strokes(int n, unsigned long *edge) {
+	Path p, o;
+	int k, i, m, x, y, w, closed, in, bad = 0;
+	double d, hw;
+
+	for (k = 0; k < n; k++) {
+		lcd7735_path_init(&p, pts, sizeof(pts) / sizeof(pts[0]));
+		lcd7735_path_init(&o, outline, sizeof(outline) / sizeof(outline[0]));
+		nref = ncontours = 0;
+		m = 2 + rand() % 8;
+		closed = k & 1 && m > 2;
+		for (i = 0; i < m; i++) {
+			x = coord(lcd7735_getWidth());
+			y = coord(lcd7735_getHeight());
+			if (i == 0)
+				lcd7735_path_moveTo(&p, x, y);
+			else
+				lcd7735_path_lineTo(&p, x, y);
+			refPoint(x, y);
+		}
+		if (closed)
+			lcd7735_path_close(&p);
+		refEnd();
+		w = PATH_ONE + rand() % (12 * PATH_ONE);
+		hw = w / 2.0;
+		lcd7735_path_stroke(&p, &o, w);
+		if (o.overflow && !bad++)
+			printf("stroke %d: %u points don't fit\n", k, o.n);
+		fill(&o, PATH_NONZERO);
+		for (y = 0; y < lcd7735_getHeight(); y++)
+			for (x = 0; x < lcd7735_getWidth(); x++) {
+				d = outlineDist(16 * x + 8, 16 * y + 8, closed);
+				in = d <= hw;
+				if (in == (panel_pixel(x, y) == FG))
+					continue;
+				// the octagon corners reach 8% out, the joins leave a quarter pixel
+				if (fabs(d - hw) <= hw * 0.0824 + PATH_ONE / 4 + 1)
+					(*edge)++;
+				else if (!bad++)
+					printf("stroke %d width %d: pixel %d,%d %s\n", k, w, x, y, in ? "missing" : "outside");
+			}
+	}
+	return bad;
+}
+
+int main(int argc, char **argv) {
+	static const uint8_t rot[] = { PORTRAIT, LANDSAPE };
+	unsigned long chord = 0, edge = 0;
+	int n = argc > 1 ? atoi(argv[1]) : 200, r, bad[3] = { 0, 0, 0 };
+
+	srand(1);
+	lcd7735_initR(INITR_REDTAB);
+	panel_hook = hook;
+	for (r = 0; r < 2; r++) {
+		lcd7735_setRotation(rot[r]);
+		bad[0] += polygons(n);
+		bad[1] += curves(n, &chord);
+		bad[2] += strokes(n, &edge);
+	}
+	printf("polygons  %d pixels wrong  %s\n", bad[0], bad[0] ? "FAILED" : "ok");
+	printf("curves    %d pixels wrong, %lu within the tolerance  %s\n", bad[1], chord, bad[1] ? "FAILED" : "ok");
+	printf("strokes   %d pixels wrong, %lu within the joins  %s\n", bad[2], edge, bad[2] ? "FAILED" : "ok");
+	for (r = 0; r < 3; r++)
+		if (bad[r])
+			failures++;
+	printf("stream %08X, %lu bytes\n", stream, panel_bytes);
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
@@ -0,0 +1,198 @@
+/*********************************************************************************
+rgb444test - host test of the 12-bit color mode of the ST7735 driver
+
+Runs drawing calls of every pixel path (fills, lines, bitmaps, RLE, glyphs,
+the terminal and raw windows with split, odd and incomplete pixel streams)
+through the real driver on the emulated panel of tools/host/panel.c, once in
+16-bit and once in 12-bit color mode. The RAMWR data of the 16-bit run is
+packed by a reference 4-4-4 packer, two pixels in three bytes and an odd last
+pixel in two, and has to match the 12-bit stream byte for byte. The panel
+contents of both runs are compared as well.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o rgb444test tools/rgb444test.c tools/host/panel.c src/ST7735.c src/DefaultFonts.c -lm
+Usage:  rgb444test
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "DefaultFonts.h"
+#include "panel.h"
+
+#define STREAM_MAX	(3 * 160 * 160)
+#define BURST_MAX	4096
+
+// RAMWR data of a run, split into bursts, one per RAMWR command
+typedef struct _stream {
+	uint8_t		data[STREAM_MAX];
+	uint32_t	n;
+	uint32_t	start[BURST_MAX];	// data index of every burst
+	uint32_t	bursts;
+	uint8_t		in_ramwr;
+} Stream;
+
+static Stream s16, s12, ref;
+static Stream *rec;
+static uint16_t mem16[PANEL_HEIGHT][PANEL_WIDTH];
+static unsigned long failures, checked;
+
+static void hook(uint8_t dc, uint8_t b) {
+	if (!dc) {
+		rec->in_ramwr = b == ST7735_RAMWR;
+		if (rec->in_ramwr && rec->bursts < BURST_MAX)
+			rec->start[rec->bursts++] = rec->n;
+	} else if (rec->in_ramwr && rec->n < STREAM_MAX) {
+		rec->data[rec->n++] = b;
+	}
+}
+
+// Reference: RGB565 pixels of a burst to 4-4-4, high nibble first
+static void pack444(Stream *dst, const uint8_t *src, uint32_t pixels) {
+	uint16_t a, b, c;
+	uint32_t i;
+
+	dst->start[dst->bursts++] = dst->n;
+	for (i = 0; i < pixels; i += 2) {
+		c = src[i * 2] << 8 | src[i * 2 + 1];
+		a = (c >> 12) << 8 | ((c >> 7) & 0xF) << 4 | ((c >> 1) & 0xF);
+		if (i + 1 < pixels) {
+			c = src[i * 2 + 2] << 8 | src[i * 2 + 3];
+			b = (c >> 12) << 8 | ((c >> 7) & 0xF) << 4 | ((c >> 1) & 0xF);
+			dst->data[dst->n++] = a >> 4;
+			dst->data[dst->n++] = (a & 0xF) << 4 | b >> 8;
+			dst->data[dst->n++] = b & 0xFF;
+		} else {
+			dst->data[dst->n++] = a >> 4;
+			dst->data[dst->n++] = (a & 0xF) << 4;
+		}
+	}
+}
+
+static uint32_t burstLen(const Stream *s, uint32_t i) {
+	return (i + 1 < s->bursts ? s->start[i + 1] : s->n) - s->start[i];
+}
+
+// 4-4-4 color as the panel shows it, expanded back to RGB565
+static uint16_t shown444(uint16_t c) {
+	uint16_t r = c >> 12, g = (c >> 7) & 0xF, b = (c >> 1) & 0xF;
+
+	return (r << 1 | r >> 3) << 11 | (g << 2 | g >> 2) << 5 | (b << 1 | b >> 3);
+}
+
+/******************** drawing cases ********************/
+
+static uint16_t pix9[9] = { 0xF800, 0x07E0, 0x001F, 0xFFFF, 0x1234, 0x8421, 0xFEDC, 0x0001, 0x7BEF };
+static const uint16_t rle[] = { 5, 3, RLE565_RUN | 4, 0xF81F, 3, 0x1111, 0x2222, 0x3333, RLE565_RUN | 8, 0x07FF };
+static const uint8_t swapped[] = { 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xAB, 0xCD, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F, 0xF0 };
+static const uint8_t index5[15] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2 };
+static const uint16_t palette[4] = { 0x0000, 0xF800, 0x07E0, 0xACE1 };
+
+static void caseFills(void) {
+	lcd7735_fillScreen(0x39E7);
+	lcd7735_fillRect(3, 5, 7, 3, 0xF81F);
+	lcd7735_fillRect(20, 20, 1, 1, 0x07FF);
+	lcd7735_drawPixel(50, 60, 0xFFE0);
+	lcd7735_drawFastHLine(0, 70, 33, 0x8410);
+	lcd7735_drawFastVLine(40, 10, 17, 0x4208);
+	lcd7735_fillCircle(90, 100, 11, 0xC618);
+}
+
+static void caseWindows(void) {
+	// split pushes across a 3x3 window
+	lcd7735_setAddrWindow(10, 100, 12, 102);
+	lcd7735_pushColors(pix9, 3);
+	lcd7735_pushColors(pix9 + 3, 2);
+	lcd7735_pushColors(pix9 + 5, 4);
+	// incomplete window ended by the next command
+	lcd7735_setAddrWindow(20, 100, 24, 101);
+	lcd7735_pushColors(pix9, 5);
+	lcd7735_setAddrWindow(30, 100, 30, 100);
+	lcd7735_pushColor(0x5555);
+	lcd7735_setAddrWindow(40, 100, 46, 100);
+	lcd7735_pushColorRepeat(0xA5A5, 7);
+}
+
+static void caseBitmaps(void) {
+	lcd7735_drawBitmap(60, 10, 3, 3, pix9, 1);
+	lcd7735_drawBitmap(70, 10, 3, 3, pix9, 3);
+	lcd7735_drawRLE565(60, 30, rle);
+	lcd7735_drawBitmapSwapped(70, 30, 3, 3, swapped);
+	lcd7735_drawBitmapIndexed(80, 30, 5, 3, index5, palette);
+	lcd7735_drawBitmapRotate(90, 40, 3, 3, pix9, 90, 1, 1);
+}
+
+static void caseText(void) {
+	lcd7735_setFont((uint8_t *)SmallFont);
+	lcd7735_setForeground(0xFFE0);
+	lcd7735_setBackground(0x0010);
+	lcd7735_print("Odd 12-bit!", 3, 120, 0);
+	lcd7735_print("Odd 12-bit!", 3, 132, 0);	// from the glyph cache
+	lcd7735_setFont((uint8_t *)BigFont);
+	lcd7735_print("7", 101, 120, 0);
+}
+
+static void caseTerminal(void) {
+	lcd7735_init_screen((void *)SmallFont, ST7735_GREEN, ST7735_BLACK, PORTRAIT);
+	lcd7735_puts("ab\ncd");
+	lcd7735_putc('!');
+}
+
+static void run(Stream *s, uint8_t bits, void (*draw)(void)) {
+	memset(s, 0, sizeof(*s));
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(PORTRAIT);
+	lcd7735_setColorMode(bits);
+	panel_reset();
+	rec = s;
+	panel_hook = hook;
+	draw();
+	lcd7735_setColorMode(16);	// a command completes the last stream
+	panel_hook = NULL;
+}
+
+static void check(const char *name, void (*draw)(void)) {
+	uint32_t i, j, n, bad = 0;
+	int x, y;
+
+	run(&s16, 16, draw);
+	memcpy(mem16, panel_mem, sizeof(mem16));
+	run(&s12, 12, draw);
+
+	memset(&ref, 0, sizeof(ref));
+	for (i = 0; i < s16.bursts; i++)
+		pack444(&ref, s16.data + s16.start[i], burstLen(&s16, i) / 2);
+	if (ref.bursts != s12.bursts || ref.n != s12.n) {
+		printf("%s: %u bursts of %u bytes, expected %u of %u\n", name, s12.bursts, s12.n, ref.bursts, ref.n);
+		failures++;
+		return;
+	}
+	for (i = 0; i < ref.bursts; i++) {
+		n = burstLen(&ref, i);
+		if (burstLen(&s12, i) != n || memcmp(ref.data + ref.start[i], s12.data + s12.start[i], n)) {
+			for (j = 0; j < n && ref.data[ref.start[i] + j] == s12.data[s12.start[i] + j]; j++)
+				;
+			if (!bad++)
+				printf("%s: burst %u differs at byte %u of %u\n", name, i, j, n);
+		}
+	}
+	for (y = 0; y < PANEL_HEIGHT; y++)
+		for (x = 0; x < PANEL_WIDTH; x++)
+			if (shown444(mem16[y][x]) != panel_mem[y][x] && !bad++)
+				printf("%s: pixel %d,%d is %04X, expected %04X\n", name, x, y, panel_mem[y][x], shown444(mem16[y][x]));
+	checked += ref.n;
+	printf("%-9s %4u bursts  %6u B 16-bit  %6u B 12-bit  %s\n", name, s12.bursts, s16.n, s12.n, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+int main(void) {
+	check("fills", caseFills);
+	check("windows", caseWindows);
+	check("bitmaps", caseBitmaps);
+	check("text", caseText);
+	check("terminal", caseTerminal);
+	printf("%lu bytes checked, %lu failures\n", checked, failures);
+	return failures != 0;
+}
@@ -0,0 +1,584 @@
+/*********************************************************************************
+texttest - host test of opaque proportional printing of the ST7735 driver
+
+Prints every pair of printable ASCII characters, and strings with kerned and
+overhanging pairs, with lcd7735_print() in the opaque mode through the real
+driver on the emulated panel of tools/host/panel.c. The reference is the same
+text from lcd7735_printLine(), which composes whole rows of the line. Every
+pixel of ink in the reference has to be drawn by print, and every pixel that
+print draws has to match the reference, so a glyph cell may not clear the ink
+of the glyph before it. The strings are printed twice, the second time from
+the glyph cache.
+
+Text of BigFontRLE and SevenSegRLE, opaque and transparent, straight and
+rotated, has to leave the same pixels as BigFont and SevenSegNumFont drawn by
+the UTFT code, in all four screen rotations, and may not send more bytes.
+
+Text of AAFont16 is checked in all four screen rotations, straight and
+rotated, opaque and transparent, against the coverage levels of the font
+data: every pixel has the ramp color of its level, and a transparent
+glyph leaves the pixels of level 0 alone.
+
+lcd7735_printLine() has to give the pixels of lcd7735_print() for every kind
+of font (UTFT, anti-aliased, proportional and RLE) in all four rotations,
+opaque and transparent. An opaque line has to go out through one window.
+
+lcd7735_printScaled() at 1x has to give the pixels of lcd7735_print() in the
+box of the text, and at 2x to 4x every pixel of the 1x text as a block.
+Opaque scaled text has to go out through one window.
+
+Labels of ST7735_text.c show a changing readout in every kind of font. After
+every lcd7735_label_update() the label has to look like the text printed
+whole with lcd7735_printLine() over the widest text before it, so the glyphs
+redrawn alone fit in and shorter text leaves nothing behind.
+
+Text boxes have to wrap between words, split words wider than the box
+between UTF-8 chars, end text that doesn't fit in "..." and reuse the layout
+of unchanged text. Every alignment has to place the words where they are
+printed one by one.
+
+The bytes of "Hello, world" in OpenSans16 and in the fixed AAFont16, the
+checksum of every byte sent to the panel and the counters of the glyph cache
+are printed at the end. The stream also holds terminal output that scrolls,
+in the 16 and 12-bit color modes. A build with -DLCD_GLYPH_CACHE=0 has to
+send the same stream.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o texttest tools/texttest.c tools/host/panel.c src/ST7735.c src/ST7735_text.c src/DefaultFonts.c -lm
+Usage:  texttest
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "ST7735.h"
+#include "ST7735_text.h"
+#include "DefaultFonts.h"
+#include "panel.h"
+#include "opensans_16.h"
+#include "bigfont_rle.h"
+#include "sevenseg_rle.h"
+#include "aa_font_16.h"
+
+#define FG		0xFFE0
+#define BG		0x0010
+#define PREFILL		0xF81F
+#define TEXT_X		20
+#define TEXT_Y		40
+
+static uint16_t ref[PANEL_HEIGHT][PANEL_WIDTH], shot[PANEL_HEIGHT][PANEL_HEIGHT];
+static unsigned long failures, strings;
+static uint32_t stream = 2166136261u;
+
+// FNV-1a of the stream, commands and data
+static void hook(uint8_t dc, uint8_t b) {
+	stream = (stream ^ (dc << 8 | b)) * 16777619u;
+}
+
+// Pixels of s printed at TEXT_X,TEXT_Y that differ from the reference
+static int check(const char *s, uint8_t report) {
+	int w = lcd7735_textWidth((char *)s), h = lcd7735_getFontHeight(), x, y, bad = 0;
+	uint16_t c;
+
+	// the reference box holds the overhang of the first and last glyph
+	lcd7735_fillRect(0, TEXT_Y, PANEL_WIDTH, h, PREFILL);
+	lcd7735_printLine(s, -1, TEXT_X - 8, TEXT_Y, w + 16, h, 8, 0);
+	for (y = TEXT_Y; y < TEXT_Y + h; y++)
+		for (x = 0; x < PANEL_WIDTH; x++)
+			ref[y][x] = panel_pixel(x, y);
+	lcd7735_fillRect(0, TEXT_Y, PANEL_WIDTH, h, PREFILL);
+	lcd7735_print((char *)s, TEXT_X, TEXT_Y, 0);
+	for (y = TEXT_Y; y < TEXT_Y + h; y++)
+		for (x = 0; x < PANEL_WIDTH; x++) {
+			c = panel_pixel(x, y);
+			if (c == ref[y][x] || (c == PREFILL && ref[y][x] == BG))
+				continue;
+			if (report && !bad)
+				printf("\"%s\": pixel %d,%d is %04X, expected %04X\n", s, x, y, c, ref[y][x]);
+			bad++;
+		}
+	strings++;
+	return bad;
+}
+
+static void font(const char *name, const uint8_t *f, const char **extra) {
+	char s[3] = { 0, 0, 0 };
+	int a, b, bad, pairs = 0, pixels = 0, pass;
+
+	lcd7735_setFont((uint8_t *)f);
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (pass = 0; pass < 2; pass++)
+		for (a = 0x20; a < 0x7F; a++)
+			for (b = 0x20; b < 0x7F; b++) {
+				s[0] = a;
+				s[1] = b;
+				if ((bad = check(s, pairs == 0))) {
+					pairs++;
+					pixels += bad;
+				}
+			}
+	for (; *extra; extra++)
+		if ((bad = check(*extra, 1))) {
+			pairs++;
+			pixels += bad;
+		}
+	printf("%-10s %5d strings wrong, %6d pixels  %s\n", name, pairs, pixels, pairs ? "FAILED" : "ok");
+	if (pairs)
+		failures++;
+}
+
+static void rotated(void) {
+	static const struct { const char *name; const uint8_t *utft, *rle; const char *s; } fonts[] = {
+		{ "BigFontRLE", BigFont, BigFontRLE, "A7g%" }, { "SevenSegRLE", SevenSegNumFont, SevenSegRLE, "0729" },
+	};
+	unsigned long ub, rb, utft, rle;
+	int k, rot, deg, t, x, y, bad, more;
+
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (k = 0; k < (int)(sizeof(fonts) / sizeof(fonts[0])); k++) {
+		for (rot = 0, bad = more = 0, utft = rle = 0; rot < 4; rot++)
+			for (t = 0; t < 2; t++)
+				for (deg = 0; deg < 360; deg += 30) {
+					lcd7735_setRotation(rot);
+					lcd7735_setTransparent(t);
+					lcd7735_fillScreen(PREFILL);
+					lcd7735_setFont((uint8_t *)fonts[k].utft);
+					ub = panel_bytes;
+					lcd7735_print((char *)fonts[k].s, 64, 80, deg);
+					ub = panel_bytes - ub;
+					memcpy(ref, panel_mem, sizeof(ref));
+					lcd7735_fillScreen(PREFILL);
+					lcd7735_setFont((uint8_t *)fonts[k].rle);
+					rb = panel_bytes;
+					lcd7735_print((char *)fonts[k].s, 64, 80, deg);
+					rb = panel_bytes - rb;
+					utft += ub;
+					rle += rb;
+					if (rb > ub && !more++)
+						printf("%s rotation %d, %s at %d degrees: %lu bytes, UTFT %lu\n", fonts[k].name, rot,
+							   t ? "transparent" : "opaque", deg, rb, ub);
+					for (y = 0; y < PANEL_HEIGHT; y++)
+						for (x = 0; x < PANEL_WIDTH; x++)
+							if (panel_mem[y][x] != ref[y][x] && !bad++)
+								printf("%s rotation %d, %s at %d degrees: pixel %d,%d is %04X, expected %04X\n",
+									   fonts[k].name, rot, t ? "transparent" : "opaque", deg, x, y, panel_mem[y][x],
+									   ref[y][x]);
+					strings++;
+				}
+		// the RLE glyphs may not cost more than the UTFT ones
+		printf("%-10s %5d pixels wrong rotated, %lu B, UTFT %lu B  %s\n", fonts[k].name, bad, rle, utft,
+			   bad || more ? "FAILED" : "ok");
+		if (bad || more)
+			failures++;
+	}
+	// a transparent readout in landscape
+	lcd7735_setRotation(LANDSAPE);
+	lcd7735_setTransparent(1);
+	lcd7735_setFont((uint8_t *)SevenSegNumFont);
+	ub = panel_bytes;
+	lcd7735_print((char *)"0123456789", 0, 40, 0);
+	ub = panel_bytes - ub;
+	lcd7735_setFont((uint8_t *)SevenSegRLE);
+	rb = panel_bytes;
+	lcd7735_print((char *)"0123456789", 0, 40, 0);
+	rb = panel_bytes - rb;
+	printf("%-10s transparent \"0123456789\" %lu B, UTFT %lu B\n", "SevenSegRLE", rb, ub);
+	lcd7735_setTransparent(0);
+	lcd7735_setRotation(PORTRAIT);
+}
+
+static uint16_t rampColor(int l, int top) {
+	int r = ((FG >> 11) * l + (BG >> 11) * (top - l) + top / 2) / top;
+	int g = (((FG >> 5) & 0x3F) * l + ((BG >> 5) & 0x3F) * (top - l) + top / 2) / top;
+	int b = ((FG & 0x1F) * l + (BG & 0x1F) * (top - l) + top / 2) / top;
+
+	return r << 11 | g << 5 | b;
+}
+
+// Coverage level of pixel i,j of char c in an anti-aliased font
+static int aaLevel(const uint8_t *f, int c, int i, int j) {
+	int bpp = f[1], w = f[2], h = f[3], row = (w * bpp + 7) / 8;
+	const uint8_t *p = f + FONT_AA_HEADER + ((c - f[4]) * h + j) * row;
+
+	return (p[i * bpp / 8] >> (8 - bpp - i * bpp % 8)) & ((1 << bpp) - 1);
+}
+
+static void aa(void) {
+	static const char s[] = "Ag%@";
+	static const int degs[] = { 0, 90, 180, 270, 30 };
+	const uint8_t *f = AAFont16;
+	int rot, d, t, k, i, j, x, y, l, bad = 0, n = 0;
+	double rad;
+
+	lcd7735_setFont((uint8_t *)f);
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (rot = 0; rot < 4; rot++)
+		for (d = 0; d < (int)(sizeof(degs) / sizeof(degs[0])); d++)
+			for (t = 0; t < 2; t++) {
+				lcd7735_setRotation(rot);
+				lcd7735_setTransparent(t);
+				lcd7735_fillScreen(PREFILL);
+				lcd7735_print((char *)s, 60, 60, degs[d]);
+				// the pixels in the order of the driver, so later ones win
+				for (y = 0; y < PANEL_HEIGHT; y++)
+					for (x = 0; x < PANEL_HEIGHT; x++)
+						shot[y][x] = PREFILL;
+				rad = degs[d] * 0.0175;
+				for (k = 0; s[k]; k++)
+					for (j = 0; j < f[3]; j++)
+						for (i = 0; i < f[2]; i++) {
+							l = aaLevel(f, s[k], i, j);
+							if (t && !l)
+								continue;
+							x = 60 + ((i + k * f[2]) * cos(rad) - j * sin(rad));
+							y = 60 + (j * cos(rad) + (i + k * f[2]) * sin(rad));
+							shot[y][x] = rampColor(l, (1 << f[1]) - 1);
+						}
+				for (y = 0; y < lcd7735_getHeight(); y++)
+					for (x = 0; x < lcd7735_getWidth(); x++)
+						if (panel_pixel(x, y) != shot[y][x] && !bad++)
+							printf("AAFont16 rotation %d, %d degrees%s: pixel %d,%d is %04X, expected %04X\n", rot, degs[d],
+								   t ? " transparent" : "", x, y, panel_pixel(x, y), shot[y][x]);
+				n++;
+				strings++;
+			}
+	lcd7735_setTransparent(0);
+	lcd7735_setRotation(PORTRAIT);
+	printf("%-10s %5d pixels wrong in %d prints  %s\n", "AAFont16", bad, n, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+static void lines(void) {
+	static const struct { const char *name; const uint8_t *f; } fonts[] = {
+		{ "SmallFont", SmallFont }, { "BigFont", BigFont }, { "AAFont16", AAFont16 },
+		{ "OpenSans16", OpenSans16 }, { "BigFontRLE", BigFontRLE },
+	};
+	static const char *text[] = { "Hi 7%", "AVAWAY", "g j", NULL };
+	const char **s;
+	unsigned long cmds;
+	int rot, k, t, w, h, x, y, bad = 0, windows = 0;
+	uint16_t c;
+
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (rot = 0; rot < 4; rot++)
+		for (k = 0; k < (int)(sizeof(fonts) / sizeof(fonts[0])); k++)
+			for (t = 0; t < 2; t++)
+				for (s = text; *s; s++) {
+					lcd7735_setRotation(rot);
+					lcd7735_setFont((uint8_t *)fonts[k].f);
+					lcd7735_setTransparent(t);
+					w = lcd7735_textWidth((char *)*s);
+					h = lcd7735_getFontHeight();
+					lcd7735_fillScreen(PREFILL);
+					cmds = panel_cmds;
+					lcd7735_printLine(*s, -1, TEXT_X - 8, TEXT_Y, w + 16, h, 8, 0);
+					// an opaque line is one window: CASET, RASET and RAMWR
+					if (!t && panel_cmds - cmds != 3 && !windows++)
+						printf("%s rotation %d \"%s\": %lu commands\n", fonts[k].name, rot, *s, panel_cmds - cmds);
+					for (y = 0; y < lcd7735_getHeight(); y++)
+						for (x = 0; x < lcd7735_getWidth(); x++)
+							shot[y][x] = panel_pixel(x, y);
+					lcd7735_fillScreen(PREFILL);
+					lcd7735_print((char *)*s, TEXT_X, TEXT_Y, 0);
+					for (y = 0; y < lcd7735_getHeight(); y++)
+						for (x = 0; x < lcd7735_getWidth(); x++) {
+							c = panel_pixel(x, y);
+							// the box of the line is cleared beyond the cells of print
+							if (c == shot[y][x] || (!t && c == PREFILL && shot[y][x] == BG))
+								continue;
+							if (!bad++)
+								printf("%s rotation %d%s \"%s\": pixel %d,%d is %04X, expected %04X\n", fonts[k].name, rot,
+									   t ? " transparent" : "", *s, x, y, c, shot[y][x]);
+						}
+					strings++;
+				}
+	lcd7735_setTransparent(0);
+	lcd7735_setRotation(PORTRAIT);
+	printf("%-10s %5d pixels wrong, %d opaque lines of more than one window  %s\n", "printLine", bad, windows,
+		   bad || windows ? "FAILED" : "ok");
+	if (bad || windows)
+		failures++;
+}
+
+static void scaled(void) {
+	static const struct { const char *name; const uint8_t *f; } fonts[] = {
+		{ "SmallFont", SmallFont }, { "BigFont", BigFont }, { "AAFont16", AAFont16 },
+		{ "OpenSans16", OpenSans16 }, { "BigFontRLE", BigFontRLE },
+	};
+	static uint16_t one[PANEL_HEIGHT][PANEL_HEIGHT];
+	static const char s[] = "7g%";
+	unsigned long cmds;
+	int rot, k, t, n, m, w, h, x, y, bad = 0, windows = 0;
+	uint16_t c, want;
+
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (rot = 0; rot < 4; rot++)
+		for (k = 0; k < (int)(sizeof(fonts) / sizeof(fonts[0])); k++)
+			for (t = 0; t < 2; t++) {
+				lcd7735_setRotation(rot);
+				lcd7735_setFont((uint8_t *)fonts[k].f);
+				lcd7735_setTransparent(t);
+				w = lcd7735_textWidth((char *)s);
+				h = lcd7735_getFontHeight();
+				lcd7735_fillScreen(PREFILL);
+				lcd7735_print((char *)s, TEXT_X, TEXT_Y, 0);
+				for (y = 0; y < lcd7735_getHeight(); y++)
+					for (x = 0; x < lcd7735_getWidth(); x++)
+						shot[y][x] = panel_pixel(x, y);
+				for (n = 1; n <= 4; n++) {
+					lcd7735_fillScreen(PREFILL);
+					cmds = panel_cmds;
+					lcd7735_printScaled((char *)s, TEXT_X, TEXT_Y, n);
+					// opaque text is one window
+					if (!t && panel_cmds - cmds != 3 && !windows++)
+						printf("%s rotation %d at %dx: %lu commands\n", fonts[k].name, rot, n, panel_cmds - cmds);
+					// whole font pixels up to the edge of the panel
+					m = w * n > lcd7735_getWidth() - TEXT_X ? (lcd7735_getWidth() - TEXT_X) / n : w;
+					for (y = 0; y < lcd7735_getHeight(); y++)
+						for (x = 0; x < lcd7735_getWidth(); x++) {
+							c = panel_pixel(x, y);
+							if (x < TEXT_X || x >= TEXT_X + m * n || y < TEXT_Y || y >= TEXT_Y + h * n)
+								want = PREFILL;
+							else if (n == 1)
+								want = shot[y][x] == PREFILL && !t ? BG : shot[y][x];
+							else
+								want = one[TEXT_Y + (y - TEXT_Y) / n][TEXT_X + (x - TEXT_X) / n];
+							if (n == 1)
+								one[y][x] = c;
+							if (c != want && !bad++)
+								printf("%s rotation %d%s at %dx: pixel %d,%d is %04X, expected %04X\n", fonts[k].name, rot,
+									   t ? " transparent" : "", n, x, y, c, want);
+						}
+					strings++;
+				}
+			}
+	lcd7735_setTransparent(0);
+	lcd7735_setRotation(PORTRAIT);
+	printf("%-10s %5d pixels wrong, %d opaque strings of more than one window  %s\n", "printScaled", bad, windows,
+		   bad || windows ? "FAILED" : "ok");
+	if (bad || windows)
+		failures++;
+}
+
+static void labels(void) {
+	static const struct { const char *name; const uint8_t *f; const char *fmt; } fonts[] = {
+		{ "SmallFont", SmallFont, "%lu.%02lu V" }, { "SevenSeg", SevenSegNumFont, "%lu%02lu" },
+		{ "AAFont16", AAFont16, "%lu.%02lu V" }, { "OpenSans16", OpenSans16, "%lu.%02lu V" },
+		{ "BigFontRLE", BigFontRLE, "%lu.%02lu" },
+	};
+	static uint16_t saved[PANEL_HEIGHT][PANEL_WIDTH];
+	Label lb;
+	char buf[16];
+	unsigned long v, cells = 0, chars = 0;
+	int k, n, w, widest, h, x, y, bad = 0;
+
+	lcd7735_setRotation(LANDSAPE);
+	lcd7735_setBackground(BG);
+	for (k = 0; k < (int)(sizeof(fonts) / sizeof(fonts[0])); k++) {
+		lcd7735_setFont((uint8_t *)fonts[k].f);
+		lcd7735_setForeground(FG);
+		h = lcd7735_getFontHeight();
+		lcd7735_fillScreen(PREFILL);
+		lcd7735_label_init(&lb, TEXT_X, TEXT_Y);
+		widest = 0;
+		// values of changing length
+		for (n = 0, v = 0; n < 300; n++, v = n < 150 ? v * 3 + 7 : v / 2 + n) {
+			v %= 10000;
+			if (n == 200)
+				lcd7735_setForeground(FG ^ 0x0841);	// a full redraw in new colors
+			sprintf(buf, fonts[k].fmt, v / 100, v % 100);
+			cells += lcd7735_label_update(&lb, buf);
+			for (x = 0; buf[x]; x++)
+				chars++;
+			w = lcd7735_textWidth(buf);
+			if (w > widest)
+				widest = w;
+			// the reference on the same panel, the label is restored after it
+			memcpy(saved, panel_mem, sizeof(saved));
+			for (y = TEXT_Y; y < TEXT_Y + h; y++)
+				for (x = 0; x < lcd7735_getWidth(); x++)
+					shot[y][x] = panel_pixel(x, y);
+			lcd7735_printLine(buf, -1, TEXT_X, TEXT_Y, widest, h, 0, 0);
+			for (y = TEXT_Y; y < TEXT_Y + h; y++)
+				for (x = TEXT_X; x < TEXT_X + widest; x++)
+					if (shot[y][x] != panel_pixel(x, y) && !bad++)
+						printf("%s label \"%s\": pixel %d,%d is %04X, expected %04X\n", fonts[k].name, buf,
+							   x, y, shot[y][x], panel_pixel(x, y));
+			memcpy(panel_mem, saved, sizeof(saved));
+			strings++;
+		}
+	}
+	lcd7735_setForeground(FG);
+	lcd7735_setRotation(PORTRAIT);
+	printf("%-10s %5d pixels wrong, %lu of %lu chars sent  %s\n", "labels", bad, cells, chars, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+// 1 if the lines of st laid out in the box aren't the expected "text|flags"
+static int layout(TextBox *tb, const char *st, const char *const *want) {
+	char buf[TEXT_LINE_BYTES];
+	int i, w, n = lcd7735_textbox_layout(tb, st), bad = 0;
+	TextLine *l;
+
+	for (i = 0; i < n || want[i]; i++) {
+		l = &tb->lines[i];
+		buf[0] = 0;
+		if (i < n)
+			sprintf(buf, "%.*s|%d", l->len, st + l->start, l->flags);
+		w = lcd7735_textWidthN(st + l->start, l->len) + (l->flags & TEXT_LINE_CUT ? lcd7735_textWidthN("...", -1) : 0);
+		if (i >= n || !want[i] || strcmp(buf, want[i]) || l->width != w) {
+			bad++;
+			printf("box \"%s\": line %d is \"%s\", expected \"%s\"\n", st, i, buf, want[i] ? want[i] : "");
+			break;
+		}
+	}
+	strings++;
+	return bad;
+}
+
+static void boxes(void) {
+	static const char *wrap[] = { "aa bb cc|0", "dddd|0", "eeeeeeee|0", "eee|1", "f|1", NULL };
+	static const char *cut[] = { "aa bb cc|0", "dddd|2", NULL };
+	static const char *narrow[] = { "aa bb|0", "cc|2", NULL };
+	static const int indent[][2] = { { 0, 0 }, { 4, 28 }, { 8, 56 }, { 0, 0 } };
+	static const char ru[] = "Съешь же ещё этих мягких французских булок";
+	char text[16];
+	TextBox tb;
+	int a, i, k, h, x, y, w, bad = 0;
+
+	lcd7735_setFont((uint8_t *)SmallFont);
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	h = lcd7735_getFontHeight();
+	// words wrap, a word wider than the box is cut between chars
+	lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, 64, 100, TEXT_LEFT, 0);
+	bad += layout(&tb, "aa bb cc dddd eeeeeeeeeee\nf", wrap);
+	// the last line ends in "..." when the text doesn't fit
+	lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, 64, 2 * h + 3, TEXT_LEFT | TEXT_ELLIPSIS, 3);
+	bad += layout(&tb, "aa bb cc dddd eeeeeeeeeee\nf", cut);
+	lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, 40, 2 * h, TEXT_LEFT | TEXT_ELLIPSIS, 0);
+	bad += layout(&tb, "aa bb cccccc dd", narrow);
+
+	// the same layout is reused while the contents stay the same
+	strcpy(text, "aa bb cc dd");
+	lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, 64, 100, TEXT_LEFT, 0);
+	lcd7735_textbox_layout(&tb, text);
+	tb.lines[0].width = -1;
+	lcd7735_textbox_layout(&tb, text);
+	if (tb.lines[0].width != -1 && !bad++)
+		printf("box \"%s\": laid out again\n", text);
+	text[0] = 'x';
+	lcd7735_textbox_layout(&tb, text);
+	if (tb.lines[0].width == -1 && !bad++)
+		printf("box \"%s\": changed text not laid out again\n", text);
+
+	// UTF-8 chars are never split, every line fits in the box
+	lcd7735_setFont((uint8_t *)OpenSans16);
+	for (w = 20; w <= 120; w += 5) {
+		// and those cut for "..." on the last of three lines
+		lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, w, w & 1 ? 160 : 3 * lcd7735_getFontHeight(), TEXT_LEFT | TEXT_ELLIPSIS, 0);
+		k = lcd7735_textbox_layout(&tb, ru);
+		for (i = 0; i < k; i++)
+			if (((ru[tb.lines[i].start] & 0xC0) == 0x80 || (ru[tb.lines[i].start + tb.lines[i].len] & 0xC0) == 0x80
+				 || (tb.lines[i].width > w && tb.lines[i].len > (ru[tb.lines[i].start] & 0x80 ? 2 : 1))) && !bad++)
+				printf("box \"%s\" %d wide: line %d is \"%.*s\"\n", ru, w, i, tb.lines[i].len, ru + tb.lines[i].start);
+		strings++;
+	}
+
+	// every alignment places the words of "aa bb cc" and "dd" in a box of 72
+	lcd7735_setFont((uint8_t *)SmallFont);
+	for (a = TEXT_LEFT; a <= TEXT_JUSTIFY; a++) {
+		lcd7735_fillScreen(PREFILL);
+		lcd7735_fillRect(TEXT_X, TEXT_Y, 72, 2 * h, BG);
+		for (k = 0; k < 3; k++) {
+			text[0] = text[1] = 'a' + k;
+			text[2] = 0;
+			lcd7735_print(text, TEXT_X + indent[a][0] + k * (a == TEXT_JUSTIFY ? 28 : 24), TEXT_Y, 0);
+		}
+		lcd7735_print((char *)"dd", TEXT_X + indent[a][1], TEXT_Y + h, 0);
+		for (y = TEXT_Y; y < TEXT_Y + 2 * h; y++)
+			for (x = TEXT_X; x < TEXT_X + 72; x++)
+				ref[y][x] = panel_pixel(x, y);
+		lcd7735_fillScreen(PREFILL);
+		lcd7735_textbox_init(&tb, TEXT_X, TEXT_Y, 72, 2 * h, a, 0);
+		lcd7735_textbox_draw(&tb, "aa bb cc dd");
+		for (y = TEXT_Y; y < TEXT_Y + 2 * h; y++)
+			for (x = TEXT_X; x < TEXT_X + 72; x++)
+				if (panel_pixel(x, y) != ref[y][x] && !bad++)
+					printf("box aligned %d: pixel %d,%d is %04X, expected %04X\n", a, x, y, panel_pixel(x, y), ref[y][x]);
+		strings++;
+	}
+	printf("%-10s %5d lines or pixels wrong  %s\n", "textbox", bad, bad ? "FAILED" : "ok");
+	if (bad)
+		failures++;
+}
+
+// Bytes of an opaque line in the proportional font and in the fixed 10x16 one
+static void hello(void) {
+	unsigned long b[2];
+	int k;
+
+	lcd7735_setForeground(FG);
+	lcd7735_setBackground(BG);
+	for (k = 0; k < 2; k++) {
+		lcd7735_setFont((uint8_t *)(k ? AAFont16 : OpenSans16));
+		b[k] = panel_bytes;
+		lcd7735_print((char *)"Hello, world", TEXT_X, TEXT_Y, 0);
+		b[k] = panel_bytes - b[k];
+	}
+	printf("%-10s OpenSans16 %lu B, AAFont16 %lu B\n", "\"Hello, world\"", b[0], b[1]);
+}
+
+// Terminal output that scrolls, in both color modes and every rotation, for
+// the checksum of the stream
+static void terminal(void) {
+	static const uint8_t bits[] = { 16, 12 };
+	char line[40];
+	int b, rot, i;
+
+	for (b = 0; b < 2; b++)
+		for (rot = 0; rot < 4; rot++) {
+			lcd7735_setColorMode(bits[b]);
+			lcd7735_init_screen((void *)(rot & 1 ? BigFont : SmallFont), FG, BG, rot);
+			for (i = 0; i < 30; i++) {
+				sprintf(line, "%d: Zing %d%%\n", i, i * 37 % 101);
+				lcd7735_puts(line);
+			}
+		}
+	lcd7735_setColorMode(16);
+	lcd7735_setRotation(PORTRAIT);
+}
+
+int main(void) {
+	static const char *opensans[] = { "AV", "LT", "AB", "AVAWAY", "Tj fj", "LYT'AV", NULL };
+	static const char *big[] = { "AV", "1/7", NULL };
+	GlyphCacheStats cache;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(PORTRAIT);
+	panel_reset();
+	panel_hook = hook;
+	font("OpenSans16", OpenSans16, opensans);
+	font("BigFontRLE", BigFontRLE, big);
+	rotated();
+	aa();
+	lines();
+	scaled();
+	labels();
+	boxes();
+	hello();
+	terminal();
+	lcd7735_getGlyphCacheStats(&cache);
+	printf("stream %08X, %lu bytes, glyph cache %u hits, %u misses\n", stream, panel_bytes,
+		   cache.hits, cache.misses);
+	printf("%lu strings checked, %lu failures\n", strings, failures);
+	return failures != 0;
+}
@@ -0,0 +1,175 @@
+/*********************************************************************************
+tiletest - host test of the ST7735 tile maps
+
+Pans random maps of an RGB565 atlas of 8x8 tiles and of an indexed atlas of
+16x16 tiles with ST7735_tilemap.c through the real driver on the emulated
+panel of tools/host/panel.c, in all four rotations, with and without fixed
+lines. The moves go along the scroll axis, where the panel is scrolled and
+only the exposed lines are drawn, across it and farther than the viewport,
+where the viewport is redrawn, and past the map edges. After every move the
+screen as shown, with the hardware scrolling applied, has to match the map
+rendered pixel by pixel from the atlas, and the fixed lines have to be
+untouched. A map of one tile is panned again after its palette has changed
+under the same pointer, where stale cached rows would show. It reports the
+bytes sent per line of panning and per redraw.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o tiletest tools/tiletest.c tools/host/panel.c src/ST7735.c src/ST7735_tilemap.c src/DefaultFonts.c -lm
+Usage:  tiletest [moves]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_tilemap.h"
+#include "panel.h"
+
+#define BG		0x1234
+#define TILES		24
+#define MAP_W		37
+#define MAP_H		29
+
+static uint16_t rgb_tiles[TILES * 8 * 8];
+static uint8_t index_tiles[TILES * 16 * 16];
+static uint16_t palette[256];
+static uint8_t map[MAP_H * MAP_W];
+static unsigned long failures;
+
+// Map pixel x,y rendered straight from the atlas, black outside the map
+static uint16_t mapPixel(const TileMap *tm, int x, int y) {
+	int ts = tm->tile_size, i;
+
+	if (x < 0 || y < 0 || x >= tm->map_w * ts || y >= tm->map_h * ts)
+		return ST7735_BLACK;
+	i = (tm->map[y / ts * tm->map_w + x / ts] * ts + y % ts) * ts + x % ts;
+	return tm->palette ? tm->palette[((const uint8_t *)tm->tiles)[i]] : ((const uint16_t *)tm->tiles)[i];
+}
+
+// Pixels of the screen that differ from the viewport of tm between its fixed
+// lines, or from BG on them
+static int compare(const TileMap *tm, uint8_t landscape) {
+	int x, y, along, bad = 0;
+	uint16_t want;
+
+	for (y = 0; y < lcd7735_getHeight(); y++)
+		for (x = 0; x < lcd7735_getWidth(); x++) {
+			along = landscape ? x : y;
+			if (along < tm->top || along >= ST7735_TFTHEIGHT - tm->bottom)
+				want = BG;
+			else if (landscape)
+				want = mapPixel(tm, tm->view_x + x - tm->top, tm->view_y + y);
+			else
+				want = mapPixel(tm, tm->view_x + x, tm->view_y + y - tm->top);
+			bad += panel_shown(x, y) != want;
+		}
+	return bad;
+}
+
+// Random moves of the viewport, mostly along the scroll axis
+static int pan(TileMap *tm, uint8_t landscape, int moves, const char *name, int rot,
+			   unsigned long *line_bytes, unsigned long *lines) {
+	int k, d, cross, moved, bad, total = 0;
+	int16_t vx, vy;
+	unsigned long bytes;
+
+	for (k = 0; k < moves; k++) {
+		vx = tm->view_x;
+		vy = tm->view_y;
+		d = rand() % 5 == 0 ? rand() % 400 - 200 : rand() % 33 - 16;
+		cross = rand() % 6 == 0 ? rand() % 41 - 20 : 0;
+		bytes = panel_bytes;
+		switch (rand() % 3) {
+		case 0:
+			if (landscape)
+				lcd7735_tilemap_scroll(tm, d, cross);
+			else
+				lcd7735_tilemap_scroll(tm, cross, d);
+			break;
+		case 1:
+			if (landscape)
+				lcd7735_tilemap_moveTo(tm, tm->view_x + d, tm->view_y + cross);
+			else
+				lcd7735_tilemap_moveTo(tm, tm->view_x + cross, tm->view_y + d);
+			break;
+		default:
+			// to a map edge and beyond
+			if (landscape)
+				lcd7735_tilemap_moveTo(tm, d < 0 ? -50 : 2000, tm->view_y);
+			else
+				lcd7735_tilemap_moveTo(tm, tm->view_x, d < 0 ? -50 : 2000);
+			break;
+		}
+		// pans of a few lines along the scroll axis
+		moved = landscape ? tm->view_x - vx : tm->view_y - vy;
+		if ((landscape ? tm->view_y == vy : tm->view_x == vx) && moved != 0 && abs(moved) < 16) {
+			*line_bytes += panel_bytes - bytes;
+			*lines += abs(moved);
+		}
+		bad = compare(tm, landscape);
+		if (bad && failures++ < 10)
+			printf("%s rotation %d: move %d to %d,%d, %d wrong pixels\n", name, rot, k, tm->view_x, tm->view_y, bad);
+		total += bad != 0;
+	}
+	return total;
+}
+
+static int run(TileMap *tm, const char *name, int moves) {
+	static const uint8_t fixed[][2] = { { 0, 0 }, { 16, 8 }, { 0, 40 }, { 7, 0 } };
+	unsigned long line_bytes = 0, lines = 0, redraw = 0;
+	uint8_t landscape;
+	int rot, f, bad = 0;
+
+	for (rot = 0; rot < 4; rot++) {
+		lcd7735_setRotation(rot);
+		landscape = rot == LANDSAPE || rot == LANDSAPE_FLIP;
+		for (f = 0; f < (int)(sizeof(fixed) / sizeof(fixed[0])); f++) {
+			lcd7735_fillScreen(BG);
+			lcd7735_tilemap_show(tm, fixed[f][0], fixed[f][1], rand() % 100, rand() % 100);
+			if (compare(tm, landscape) && failures++ < 10)
+				printf("%s rotation %d: show with %d,%d fixed lines is wrong\n", name, rot, fixed[f][0], fixed[f][1]);
+			redraw = panel_bytes;
+			lcd7735_tilemap_redraw(tm);
+			redraw = panel_bytes - redraw;
+			bad += pan(tm, landscape, moves, name, rot, &line_bytes, &lines);
+		}
+	}
+	// the scroll area is left to the next test
+	lcd7735_setScrollArea(0, 0);
+	lcd7735_scrollTo(0);
+	printf("%-7s %5.0f B per line panned, %6lu B per redraw  %s\n", name,
+		   lines ? (double)line_bytes / lines : 0.0, redraw, bad ? "FAILED" : "ok");
+	return bad;
+}
+
+int main(int argc, char **argv) {
+	int moves = argc > 1 ? atoi(argv[1]) : 200, i;
+	TileMap tm;
+
+	srand(1);
+	for (i = 0; i < TILES * 8 * 8; i++)
+		rgb_tiles[i] = rand();
+	for (i = 0; i < TILES * 16 * 16; i++)
+		index_tiles[i] = rand();
+	for (i = 0; i < 256; i++)
+		palette[i] = rand();
+	for (i = 0; i < MAP_W * MAP_H; i++)
+		map[i] = rand() % TILES;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_tilemap_init(&tm, map, MAP_W, MAP_H, rgb_tiles, 8, NULL);
+	run(&tm, "rgb565", moves);
+	lcd7735_tilemap_init(&tm, map, MAP_W, MAP_H, index_tiles, 16, palette);
+	run(&tm, "indexed", moves);
+	// a changed palette under the same pointer, the cache is cleared by init;
+	// a map of one tile finds every row of it in the cache
+	memset(map, 5, sizeof(map));
+	lcd7735_tilemap_init(&tm, map, MAP_W, MAP_H, index_tiles, 16, palette);
+	run(&tm, "one", moves);
+	for (i = 0; i < 256; i++)
+		palette[i] = ~palette[i];
+	lcd7735_tilemap_init(&tm, map, MAP_W, MAP_H, index_tiles, 16, palette);
+	run(&tm, "palette", moves);
+	printf("%lu failures\n", failures);
+	return failures != 0;
+}
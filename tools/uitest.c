@@ -0,0 +1,142 @@
+/*********************************************************************************
+uitest - host test of the incremental redraw of the ST7735 widgets
+
+Builds the widget screen of test_widgets() in src/main.c on a UiFrame target
+in RAM and animates it step by step like the demo. After every incremental
+lcd7735_ui_update() the frame has to match a full redraw of the same screen
+into a second frame, so no change may leave stale pixels behind. The pixels
+of the incremental updates are reported against the full redraws, and those
+of a single changed digit and a single step of the bar. Every tenth step the
+screen is also redrawn through the driver on the emulated panel of
+tools/host/panel.c and has to show the pixels of the frame.
+
+Build:  gcc -O2 -DNO_BITBIND -Itools/host -Isrc -o uitest tools/uitest.c tools/host/panel.c src/ST7735.c src/ST7735_ui.c src/DefaultFonts.c -lm
+Usage:  uitest [steps]
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "ST7735_ui.h"
+#include "DefaultFonts.h"
+#include "opensans_16.h"
+#include "aa_font_16.h"
+#include "panel.h"
+
+#define FRAME_W		160
+#define FRAME_H		128
+
+static uint16_t frame[FRAME_H][FRAME_W], full[FRAME_H][FRAME_W];
+static UiFrame f_frame = { &frame[0][0], FRAME_W, 0, 0, 0, 0, 0 };
+static UiFrame f_full = { &full[0][0], FRAME_W, 0, 0, 0, 0, 0 };
+static const UiTarget t_frame = { &f_frame, FRAME_W, FRAME_H, lcd7735_ui_frameWindow, lcd7735_ui_framePixels };
+static const UiTarget t_full = { &f_full, FRAME_W, FRAME_H, lcd7735_ui_frameWindow, lcd7735_ui_framePixels };
+
+static const char * const menu_items[] = { "Output", "Limits", "Presets", "Logging", "Display", "About" };
+
+static Ui ui;
+static UiLabel title;
+static UiValue volts, percent;
+static UiBar bar;
+static UiGauge gauge;
+static UiButton run;
+static UiList menu;
+
+static void screen(void) {
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+	lcd7735_setForeground(ST7735_WHITE);
+	lcd7735_setBackground(ST7735_BLACK);
+	lcd7735_ui_init(&ui, ST7735_BLACK, &t_frame);
+	lcd7735_ui_labelInit(&title, 0, 0, 160, 14, TEXT_LEFT, "");
+	lcd7735_ui_listInit(&menu, 0, 84, 76, 42, menu_items, 6);
+	lcd7735_setBackground(ST7735_BLUE);
+	lcd7735_ui_buttonInit(&run, 0, 62, 50, 18, "RUN");
+	lcd7735_setBackground(ST7735_BLACK);
+	lcd7735_setFont((uint8_t *)&OpenSans16[0]);
+	lcd7735_setForeground(ST7735_YELLOW);
+	lcd7735_ui_valueInit(&volts, 0, 16, 76, 24, 2, " V");
+	lcd7735_setForeground(ST7735_GREEN);
+	lcd7735_ui_barInit(&bar, 0, 44, 76, 10, 1500);
+	lcd7735_setForeground(ST7735_CYAN);
+	lcd7735_ui_gaugeInit(&gauge, 90, 20, 64, 8, 100);
+	// drawn over the middle of the gauge
+	lcd7735_setFont((uint8_t *)&AAFont16[0]);
+	lcd7735_setForeground(ST7735_WHITE);
+	lcd7735_ui_valueInit(&percent, 100, 42, 44, 20, 0, "%");
+	percent.label.wg.flags |= WIDGET_TRANSPARENT;
+	lcd7735_setFont((uint8_t *)&SmallFont[0]);
+
+	lcd7735_ui_add(&ui, &title.wg);
+	lcd7735_ui_add(&ui, &volts.label.wg);
+	lcd7735_ui_add(&ui, &bar.wg);
+	lcd7735_ui_add(&ui, &gauge.wg);
+	lcd7735_ui_add(&ui, &percent.label.wg);
+	lcd7735_ui_add(&ui, &run.label.wg);
+	lcd7735_ui_add(&ui, &menu.wg);
+}
+
+// The properties of step t as test_widgets() sets them
+static void step(uint32_t t, uint32_t pixels) {
+	char buf[32];
+
+	lcd7735_ui_setValue(&volts, t * 7 % 1500);
+	lcd7735_ui_setBar(&bar, t * 7 % 1500);
+	lcd7735_ui_setGauge(&gauge, t % 200 < 100 ? t % 100 : 100 - t % 100);
+	lcd7735_ui_setValue(&percent, gauge.value);
+	lcd7735_ui_setPressed(&run, t / 20 % 2);
+	lcd7735_ui_select(&menu, t / 20 % 6);
+	sprintf(buf, "Last update %lupx", (unsigned long)pixels);
+	lcd7735_ui_setText(&title, buf);
+}
+
+// Redraw the whole screen on target, the second frame or the panel
+static uint32_t redraw(const UiTarget *target) {
+	uint32_t pixels;
+
+	ui.target = target;
+	lcd7735_ui_invalidate(&ui, 0, 0, FRAME_W, FRAME_H);
+	pixels = lcd7735_ui_update(&ui);
+	ui.target = &t_frame;
+	return pixels;
+}
+
+int main(int argc, char **argv) {
+	uint32_t t, steps = argc > 1 ? atoi(argv[1]) : 1000, pixels = 0, inc = 0, all = 0, bad = 0, onpanel = 0, digit, step1;
+	int x, y;
+
+	lcd7735_initR(INITR_REDTAB);
+	lcd7735_setRotation(LANDSAPE);
+	memset(frame, 0xAA, sizeof(frame));
+	screen();
+	lcd7735_ui_update(&ui);
+	for (t = 0; t < steps; t++) {
+		step(t, pixels);
+		pixels = lcd7735_ui_update(&ui);
+		inc += pixels;
+		all += redraw(&t_full);
+		for (y = 0; y < FRAME_H; y++)
+			for (x = 0; x < FRAME_W; x++)
+				if (frame[y][x] != full[y][x] && !bad++)
+					printf("step %u: pixel %d,%d is %04X, expected %04X\n", t, x, y, frame[y][x], full[y][x]);
+		// now and then the same screen through the driver
+		if (t % 10 == 0) {
+			redraw(NULL);
+			for (y = 0; y < FRAME_H; y++)
+				for (x = 0; x < FRAME_W; x++)
+					if (panel_pixel(x, y) != full[y][x] && !onpanel++)
+						printf("step %u: panel pixel %d,%d is %04X, expected %04X\n", t, x, y, panel_pixel(x, y),
+							   full[y][x]);
+		}
+	}
+	// single changes: the last digit of the readout and one step of the bar
+	lcd7735_ui_setValue(&volts, volts.value / 10 * 10 + (volts.value + 1) % 10);
+	digit = lcd7735_ui_update(&ui);
+	lcd7735_ui_setBar(&bar, bar.value < 1400 ? bar.value + 20 : bar.value - 20);
+	step1 = lcd7735_ui_update(&ui);
+	printf("one digit %u pixels, one bar step %u pixels\n", digit, step1);
+	printf("%u steps, %.0f pixels per update, %.0f per full redraw, %u pixels wrong, %u on the panel  %s\n",
+		   steps, (double)inc / steps, (double)all / steps, bad, onpanel, bad || onpanel ? "FAILED" : "ok");
+	return bad || onpanel;
+}